@@ -0,0 +1,77 @@
+using HUDRA.Services.ArtworkPlaceholders;
+using System;
+
+namespace HUDRA.Benchmarks
+{
+    /// <summary>
+    /// Placeholder work per game: encode and dominant color at the 32x15 sample UpdateAsync decodes a Steam
+    /// header to, and decode to the 32x21 tile bitmap, against a hit in the tile bitmap cache.
+    /// </summary>
+    public static class ArtworkPlaceholderBenchmarks
+    {
+        private const int SampleWidth = 32;
+        private const int SampleHeight = 15;
+        private const int TileWidth = 32;
+        private const int TileHeight = 21;
+
+        /// <summary>
+        /// Smooth gradients under seeded noise, so the histogram sees many bins like real key art.
+        /// </summary>
+        private static byte[] BuildSample()
+        {
+            var random = new Random(88);
+            var pixels = new byte[SampleWidth * SampleHeight * 4];
+            for (int y = 0; y < SampleHeight; y++)
+            {
+                for (int x = 0; x < SampleWidth; x++)
+                {
+                    int p = (y * SampleWidth + x) * 4;
+                    pixels[p] = (byte)Math.Clamp(40 + x * 5 + random.Next(-20, 21), 0, 255);
+                    pixels[p + 1] = (byte)Math.Clamp(30 + y * 8 + random.Next(-20, 21), 0, 255);
+                    pixels[p + 2] = (byte)Math.Clamp(200 - x * 4 + random.Next(-20, 21), 0, 255);
+                    pixels[p + 3] = 255;
+                }
+            }
+            return pixels;
+        }
+
+        public static void Run()
+        {
+            Bench.Header("Artwork placeholders");
+
+            var sample = BuildSample();
+            int stride = SampleWidth * 4;
+            var hash = ArtworkPlaceholderCodec.Encode(sample, SampleWidth, SampleHeight, stride);
+            var tile = new byte[TileWidth * TileHeight * 4];
+
+            Bench.Run("Encode 4x3 from 32x15", 1, () => ArtworkPlaceholderCodec.Encode(sample, SampleWidth, SampleHeight, stride));
+            Bench.Run("GetDominantColor 32x15", 1, () => ArtworkPlaceholderCodec.GetDominantColor(sample, SampleWidth, SampleHeight, stride));
+            Bench.Run("TryDecode to 32x21 tile", 1, () => ArtworkPlaceholderCodec.TryDecode(hash, TileWidth, TileHeight, tile));
+            Bench.Run("IsValid", 1, () => ArtworkPlaceholderCodec.IsValid(hash));
+
+            // 300 distinct placeholders cycling through a 64-entry cache: the miss path is a decode
+            var hashes = new string[300];
+            for (int i = 0; i < hashes.Length; i++)
+            {
+                sample[i % sample.Length] ^= 0x5A;
+                hashes[i] = ArtworkPlaceholderCodec.Encode(sample, SampleWidth, SampleHeight, stride);
+            }
+
+            var cache = new LruCache<string, byte[]>(64, StringComparer.Ordinal);
+            for (int i = 0; i < 64; i++)
+                cache.Set(hashes[i], tile);
+            int hit = 0;
+            Bench.Run("LruCache hit (64 entries)", 1, () => cache.TryGetValue(hashes[hit++ & 63], out _));
+
+            int churn = 0;
+            Bench.Run("LruCache miss + Set (evicts)", 1, () =>
+            {
+                var key = hashes[churn++ % hashes.Length];
+                if (!cache.TryGetValue(key, out _))
+                    cache.Set(key, tile);
+            });
+
+            Bench.Note($"{TileWidth}x{TileHeight} tile bitmap = {TileWidth * TileHeight * 4} B of pixels; 64 cached = {64 * TileWidth * TileHeight * 4 / 1024} KB before WinRT overhead");
+        }
+    }
+}
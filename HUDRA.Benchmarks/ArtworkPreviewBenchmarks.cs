@@ -0,0 +1,93 @@
+using HUDRA.Services;
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using System.Net;
+using System.Net.Http;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace HUDRA.Benchmarks
+{
+    /// <summary>
+    /// Time to first SteamGridDB preview for a 10-result search against a simulated CDN: one download at a
+    /// time (the old path) versus ArtworkPreviewDownloader's default of four in flight, yielding in
+    /// completion order.
+    /// </summary>
+    public static class ArtworkPreviewBenchmarks
+    {
+        private const int ResultCount = 10;
+        private const int Runs = 5;
+
+        /// <summary>
+        /// Answers "/{index}.png" after a fixed per-index latency with a 60 KB thumbnail body.
+        /// </summary>
+        private sealed class SimulatedCdnHandler : HttpMessageHandler
+        {
+            private readonly TimeSpan[] _latency;
+            private readonly byte[] _body = new byte[60 * 1024];
+
+            public SimulatedCdnHandler(TimeSpan[] latency) => _latency = latency;
+
+            protected override async Task<HttpResponseMessage> SendAsync(HttpRequestMessage request, CancellationToken cancellationToken)
+            {
+                int index = int.Parse(request.RequestUri!.Segments[^1].Split('.')[0]);
+                await Task.Delay(_latency[index], cancellationToken).ConfigureAwait(false);
+                return new HttpResponseMessage(HttpStatusCode.OK) { Content = new ByteArrayContent(_body) };
+            }
+        }
+
+        public static void Run()
+        {
+            const string name = "Artwork preview time to first";
+            if (Bench.Filter != null && !name.Contains(Bench.Filter, StringComparison.OrdinalIgnoreCase))
+                return;
+
+            Bench.Header("Artwork previews (simulated CDN)");
+
+            // 80-400 ms per thumbnail, seeded. Latencies are assumptions, not recordings.
+            var random = new Random(84);
+            var latency = Enumerable.Range(0, ResultCount)
+                .Select(_ => TimeSpan.FromMilliseconds(random.Next(80, 401)))
+                .ToArray();
+            Bench.Note($"per-image latency (ms): {string.Join(", ", latency.Select(l => (int)l.TotalMilliseconds))}");
+
+            var directory = Directory.CreateTempSubdirectory("hudra-artbench-").FullName;
+            try
+            {
+                using var httpClient = new HttpClient(new SimulatedCdnHandler(latency));
+                foreach (int concurrency in new[] { 1, 4 })
+                {
+                    var first = new List<double>();
+                    var total = new List<double>();
+                    for (int run = 0; run < Runs; run++)
+                    {
+                        var downloader = new ArtworkPreviewDownloader(httpClient, concurrency);
+                        var downloads = Enumerable.Range(0, ResultCount)
+                            .Select(i => new ArtworkDownload(i, new Uri($"https://cdn.example.test/{i}.png"), Path.Combine(directory, $"{run}-{i}.png")))
+                            .ToList();
+
+                        Task.Run(async () =>
+                        {
+                            await foreach (var _ in downloader.DownloadAsync(downloads).ConfigureAwait(false))
+                            {
+                            }
+                        }).GetAwaiter().GetResult();
+
+                        first.Add(downloader.LastTimeToFirstResult!.Value.TotalMilliseconds);
+                        total.Add(downloader.LastTotalTime!.Value.TotalMilliseconds);
+                    }
+
+                    first.Sort();
+                    total.Sort();
+                    Console.WriteLine($"{$"{name}, {concurrency} in flight",-52} {first[Runs / 2],9:F0} ms   all {total[Runs / 2],6:F0} ms");
+                }
+            }
+            finally
+            {
+                try { Directory.Delete(directory, recursive: true); } catch { }
+            }
+        }
+    }
+}
@@ -0,0 +1,84 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Threading.Tasks;
+
+namespace HUDRA.Benchmarks
+{
+    /// <summary>
+    /// Minimal Stopwatch harness: warms up, times 15 batches of about 1/15 s each and reports the median
+    /// and best batch. Allocations are per operation on the calling thread.
+    /// </summary>
+    public static class Bench
+    {
+        private static readonly TimeSpan WarmupTime = TimeSpan.FromMilliseconds(200);
+        private static readonly TimeSpan MeasureTime = TimeSpan.FromSeconds(1);
+        private const int BatchCount = 15;
+
+        public static string? Filter { get; set; }
+
+        public static void Run(string name, int operationsPerInvoke, Action action)
+        {
+            if (Filter != null && !name.Contains(Filter, StringComparison.OrdinalIgnoreCase))
+                return;
+
+            // Warm up and size a batch to roughly MeasureTime / BatchCount
+            var warmup = Stopwatch.StartNew();
+            long invocations = 0;
+            while (warmup.Elapsed < WarmupTime)
+            {
+                action();
+                invocations++;
+            }
+
+            long perBatch = Math.Max(1, (long)(invocations * (MeasureTime / BatchCount / WarmupTime)));
+            var nsPerOp = new List<double>(BatchCount);
+            long allocated = 0;
+
+            for (int batch = 0; batch < BatchCount; batch++)
+            {
+                long allocatedBefore = GC.GetAllocatedBytesForCurrentThread();
+                long start = Stopwatch.GetTimestamp();
+                for (long i = 0; i < perBatch; i++)
+                    action();
+                long elapsed = Stopwatch.GetTimestamp() - start;
+                allocated += GC.GetAllocatedBytesForCurrentThread() - allocatedBefore;
+
+                nsPerOp.Add(elapsed * (1_000_000_000.0 / Stopwatch.Frequency) / (perBatch * operationsPerInvoke));
+            }
+
+            nsPerOp.Sort();
+            double bytesPerOp = allocated / (double)(BatchCount * perBatch * operationsPerInvoke);
+            Report(name, nsPerOp[BatchCount / 2], nsPerOp[0], bytesPerOp);
+        }
+
+        public static void RunAsync(string name, int operationsPerInvoke, Func<Task> action)
+        {
+            Run(name, operationsPerInvoke, () => action().GetAwaiter().GetResult());
+        }
+
+        public static void Note(string text)
+        {
+            if (Filter == null)
+                Console.WriteLine($"  {text}");
+        }
+
+        private static void Report(string name, double median, double best, double bytesPerOp)
+        {
+            Console.WriteLine($"{name,-52} {FormatTime(median),12} {FormatTime(best),12} {bytesPerOp,10:F0} B");
+        }
+
+        public static void Header(string title)
+        {
+            if (Filter != null) return;
+            Console.WriteLine();
+            Console.WriteLine(title);
+            Console.WriteLine($"{"",-52} {"median/op",12} {"best/op",12} {"alloc/op",12}");
+        }
+
+        private static string FormatTime(double ns) =>
+            ns >= 1_000_000 ? $"{ns / 1_000_000:F2} ms" :
+            ns >= 1_000 ? $"{ns / 1_000:F2} us" :
+            $"{ns:F1} ns";
+    }
+}
@@ -0,0 +1,131 @@
+using HUDRA.Engine.Protocol;
+using HUDRA.Engine.State;
+using HUDRA.Engine.Transport;
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Text.Json;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace HUDRA.Benchmarks
+{
+    /// <summary>
+    /// Engine IPC hot paths: building and parsing a telemetry batch, the per-session flush,
+    /// framing a stream, and a command round trip over a real pipe.
+    /// </summary>
+    public static class EngineProtocolBenchmarks
+    {
+        private sealed class PingHandler : IEngineCommandHandler
+        {
+            public EngineCommandResult Execute(EngineCommand command, StateValue argument) => EngineCommandResult.Ok("pong");
+        }
+
+        // What the engine publishes every telemetry tick while a game runs
+        private static readonly List<StateEntry> TelemetryBatch = new()
+        {
+            new(StateKey.TdpCurrentWatts, StateValue.From(14.6)),
+            new(StateKey.FanDutyPercent, StateValue.From(41.5)),
+            new(StateKey.FanRpm, StateValue.From(3120L)),
+            new(StateKey.CpuTemperature, StateValue.From(72.3)),
+            new(StateKey.GameFps, StateValue.From(58.9)),
+            new(StateKey.GameJoulesPerFrame, StateValue.From(0.2479))
+        };
+
+        public static void Run()
+        {
+            Bench.Header("Engine protocol");
+
+            var output = new PayloadWriter();
+            var scratch = new PayloadWriter();
+            Bench.Run("Encode telemetry batch (6 values)", 1, () =>
+            {
+                output.Reset();
+                EngineMessages.WriteState(output, scratch, FrameType.StateBatch, TelemetryBatch);
+            });
+            Bench.Note($"frame size: {output.Length} bytes");
+
+            var json = new Dictionary<string, object>();
+            foreach (var entry in TelemetryBatch)
+                json[entry.Key.ToString()] = entry.Value.Kind == StateValueKind.Double ? entry.Value.AsDouble() : entry.Value.AsInt64();
+            byte[] jsonBytes = Array.Empty<byte>();
+            Bench.Run("Baseline: same batch as System.Text.Json", 1, () => jsonBytes = JsonSerializer.SerializeToUtf8Bytes(json));
+            Bench.Note($"json size: {jsonBytes.Length} bytes");
+
+            output.Reset();
+            EngineMessages.WriteState(output, scratch, FrameType.StateBatch, TelemetryBatch);
+            var frame = output.WrittenSpan.ToArray();
+            var decoded = new List<StateEntry>(8);
+            Bench.Run("Decode telemetry batch (6 values)", 1, () =>
+            {
+                FrameCodec.TryReadFrame(frame, out _, out int offset, out int length, out _);
+                decoded.Clear();
+                EngineMessages.ReadState(frame.AsSpan(offset, length), decoded);
+            });
+
+            // Ten writes per key between flushes, as the 50 ms coalescing window sees at a 200 Hz source
+            var store = new EngineStateStore();
+            var session = new EngineSession(store, new PingHandler());
+            var hello = new PayloadWriter();
+            EngineMessages.WriteHello(hello, scratch, new HelloMessage(EngineProtocol.Version, "bench"));
+            FrameCodec.TryReadFrame(hello.WrittenSpan, out var helloType, out int helloOffset, out int helloLength, out _);
+            session.HandleFrame(helloType, hello.WrittenSpan.Slice(helloOffset, helloLength), output);
+            long tick = 0;
+            Bench.Run("60 store writes + session flush", 1, () =>
+            {
+                for (int i = 0; i < 10; i++)
+                {
+                    tick++;
+                    store.Set(StateKey.TdpCurrentWatts, 10 + (tick % 50) / 10.0);
+                    store.Set(StateKey.FanRpm, 3000 + tick % 200);
+                    store.Set(StateKey.CpuTemperature, 60 + (tick % 100) / 10.0);
+                    store.Set(StateKey.GameFps, 50 + (tick % 100) / 10.0);
+                    store.Set(StateKey.FanDutyPercent, 40 + (tick % 20) / 2.0);
+                    store.Set(StateKey.GameJoulesPerFrame, 0.2 + (tick % 10) / 100.0);
+                }
+                output.Reset();
+                session.Flush(output);
+            });
+            Bench.Note($"batches sent: {session.BatchesSent:N0}, entries: {session.EntriesSent:N0} for {tick * 6:N0} writes");
+
+            var streamOutput = new PayloadWriter(64 * 1024);
+            for (int i = 0; i < 1000; i++)
+                EngineMessages.WriteState(streamOutput, scratch, FrameType.StateBatch, TelemetryBatch);
+            var streamBytes = streamOutput.WrittenSpan.ToArray();
+            var memory = new MemoryStream(streamBytes);
+            var reader = new FrameStreamReader(memory);
+            Bench.RunAsync("FrameStreamReader, 1000 frames from memory", 1000, async () =>
+            {
+                memory.Position = 0;
+                reader = new FrameStreamReader(memory);
+                while (await reader.ReadFrameAsync(CancellationToken.None).ConfigureAwait(false))
+                {
+                }
+            });
+
+            RunPipeRoundTrip();
+        }
+
+        private static void RunPipeRoundTrip()
+        {
+            string pipeName = $"HUDRA.Engine.Bench.{Environment.ProcessId}";
+            var store = new EngineStateStore();
+            using var server = new PipeEngineServer(store, new PingHandler(), pipeName);
+            server.Start();
+
+            using var client = new PipeEngineClient("bench", pipeName);
+            try
+            {
+                client.ConnectAsync(timeoutMs: 5000).GetAwaiter().GetResult();
+            }
+            catch (Exception ex) when (ex is TimeoutException || ex is IOException || ex is PlatformNotSupportedException)
+            {
+                Bench.Note($"pipe round trip skipped: {ex.Message}");
+                return;
+            }
+
+            Bench.RunAsync("Ping command round trip over pipe", 1,
+                () => client.SendCommandAsync(EngineCommand.Ping, StateValue.None));
+        }
+    }
+}
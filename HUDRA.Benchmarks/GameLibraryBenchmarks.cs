@@ -0,0 +1,150 @@
+using HUDRA.Models;
+using System;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.Linq;
+using System.Text.Json;
+using System.Text.Json.Serialization;
+
+namespace HUDRA.Benchmarks
+{
+    /// <summary>
+    /// The in-memory game library at 10k games deserialized from library JSON: bytes retained per game and GC
+    /// heap size for the one-store DetectedGame library against the previous model (List-backed alternative
+    /// executables, a second ToDictionary cache in the detection service), and the per-tile property reads the
+    /// library page binds.
+    /// </summary>
+    public static class GameLibraryBenchmarks
+    {
+        private const int GameCount = 10_000;
+
+        // Same options EnhancedGameDatabase loads the library with
+        private static readonly JsonSerializerOptions JsonOptions = new()
+        {
+            PropertyNamingPolicy = JsonNamingPolicy.CamelCase,
+            DefaultIgnoreCondition = JsonIgnoreCondition.WhenWritingNull,
+            Converters = { new JsonStringEnumConverter() }
+        };
+
+        private static readonly string[] SharedExecutables =
+        {
+            "UnityCrashHandler64", "CrashReportClient", "EasyAntiCheat_EOS_Setup", "vc_redist.x64", "dxsetup",
+            "UE4PrereqSetup_x64", "launcher", "BsSndRpt64", "start_protected_game", "QuickSFV"
+        };
+
+        /// <summary>
+        /// DetectedGame before the library was compacted.
+        /// </summary>
+        private sealed class LegacyGame
+        {
+            public string ProcessName { get; set; } = string.Empty;
+            public string DisplayName { get; set; } = string.Empty;
+            public string ExecutablePath { get; set; } = string.Empty;
+            public string InstallLocation { get; set; } = string.Empty;
+            public GameSource Source { get; set; } = GameSource.Unknown;
+            public string LauncherInfo { get; set; } = string.Empty;
+            public string PackageInfo { get; set; } = string.Empty;
+            public DateTime LastDetected { get; set; } = DateTime.Now;
+            public DateTime FirstDetected { get; set; } = DateTime.Now;
+            public List<string> AlternativeExecutables { get; set; } = new List<string>();
+            public string? ArtworkPath { get; set; }
+            public string? ArtworkPlaceholder { get; set; }
+            public string? ArtworkColor { get; set; }
+            public string? ProfileJson { get; set; }
+        }
+
+        /// <summary>
+        /// A third each of two Steam libraries and Xbox installs; Xbox games list 4-9 shared helper executables.
+        /// </summary>
+        private static string BuildLibraryJson(int count)
+        {
+            var random = new Random(89);
+            var games = new List<object>(count);
+            const string artworkDirectory = @"C:\Users\player\AppData\Local\HUDRA\artwork\";
+
+            for (int i = 0; i < count; i++)
+            {
+                var library = (i % 3) switch
+                {
+                    0 => @"D:\SteamLibrary\steamapps\common\",
+                    1 => @"C:\Program Files (x86)\Steam\steamapps\common\",
+                    _ => @"C:\XboxGames\"
+                };
+                var title = "Some Fairly Long Game Title " + i;
+                var installLocation = library + title;
+                var process = "GameExecutable" + i;
+                bool xbox = i % 3 == 2;
+
+                games.Add(new
+                {
+                    processName = process,
+                    displayName = title,
+                    executablePath = installLocation + @"\Binaries\Win64\" + process + ".exe",
+                    installLocation,
+                    source = xbox ? "Xbox" : "Steam",
+                    launcherInfo = "steam://rungameid/" + (100000 + i),
+                    packageInfo = (100000 + i).ToString(),
+                    alternativeExecutables = xbox
+                        ? SharedExecutables.Take(4 + random.Next(6)).Append(process).ToArray()
+                        : Array.Empty<string>(),
+                    artworkPath = artworkDirectory + process + ".png",
+                    artworkPlaceholder = "L8M_Ai=2fQ=2||o2fQo2fQfQfQfQ",
+                    artworkColor = "#141E8C"
+                });
+            }
+
+            return JsonSerializer.Serialize(games);
+        }
+
+        private static (long RetainedBytes, long HeapBytes) MeasureRetained(Func<object> load)
+        {
+            long before = GC.GetTotalMemory(forceFullCollection: true);
+            var library = load();
+            long after = GC.GetTotalMemory(forceFullCollection: true);
+            long heap = GC.GetGCMemoryInfo().HeapSizeBytes;
+            GC.KeepAlive(library);
+            return (after - before, heap);
+        }
+
+        public static void Run()
+        {
+            Bench.Header("Game library (10k games)");
+
+            var json = BuildLibraryJson(GameCount);
+
+            var legacy = MeasureRetained(() =>
+            {
+                var games = JsonSerializer.Deserialize<List<LegacyGame>>(json, JsonOptions)!;
+                var database = new ConcurrentDictionary<string, LegacyGame>(
+                    games.ToDictionary(g => g.ProcessName, StringComparer.OrdinalIgnoreCase), StringComparer.OrdinalIgnoreCase);
+                var cachedGames = database.Values.ToDictionary(g => g.ProcessName, StringComparer.OrdinalIgnoreCase);
+                return (database, cachedGames);
+            });
+
+            ConcurrentDictionary<string, DetectedGame>? store = null;
+            var current = MeasureRetained(() =>
+            {
+                var games = JsonSerializer.Deserialize<List<DetectedGame>>(json, JsonOptions)!;
+                store = new ConcurrentDictionary<string, DetectedGame>(Environment.ProcessorCount, games.Count, StringComparer.OrdinalIgnoreCase);
+                foreach (var game in games)
+                    store[game.ProcessName] = game;
+                return store;
+            });
+
+            var tiles = store!.Values.ToArray();
+            Bench.Run("Tile bindings (name, install folder, artwork)", tiles.Length, () =>
+            {
+                int length = 0;
+                foreach (var game in tiles)
+                    length += game.DisplayName.Length + game.InstallLocation.Length + (game.ArtworkPath?.Length ?? 0);
+                GC.KeepAlive(length);
+            });
+
+            Bench.Note($"Previous model, two dictionaries: {legacy.RetainedBytes / GameCount} B/game, " +
+                       $"{legacy.RetainedBytes / 1048576.0:F1} MB retained, {legacy.HeapBytes / 1048576.0:F1} MB GC heap");
+            Bench.Note($"DetectedGame, one store:          {current.RetainedBytes / GameCount} B/game, " +
+                       $"{current.RetainedBytes / 1048576.0:F1} MB retained, {current.HeapBytes / 1048576.0:F1} MB GC heap " +
+                       $"({LibraryStringPool.Shared.Count} pooled names; both heaps include the {json.Length * 2 / 1048576.0:F1} MB source JSON)");
+        }
+    }
+}
@@ -0,0 +1,44 @@
+using HUDRA.Services;
+using System;
+using System.Collections.Generic;
+
+namespace HUDRA.Benchmarks
+{
+    /// <summary>
+    /// The startup check that decides whether saved device detection can be reused: building the fingerprint
+    /// from the BIOS registry values and comparing it to the saved one. On a match this is all that runs
+    /// instead of the WMI Win32_ComputerSystem queries and device probing; that side needs the device
+    /// itself and is logged at startup (DeviceDetectionService.LastDetection) rather than measured here.
+    /// </summary>
+    public static class HardwareFingerprintBenchmarks
+    {
+        // HARDWARE\DESCRIPTION\System\BIOS on a Legion Go
+        private static readonly Dictionary<string, string?> LegionGo = new()
+        {
+            ["SystemManufacturer"] = "LENOVO",
+            ["SystemProductName"] = "83E1",
+            ["SystemFamily"] = "Legion Go 8APU1",
+            ["BaseBoardManufacturer"] = "LENOVO",
+            ["BaseBoardProduct"] = "LNVNB161216",
+            ["BIOSVersion"] = "N3CN29WW"
+        };
+
+        public static void Run()
+        {
+            Bench.Header("Hardware fingerprint");
+
+            Func<string, string?> readValue = name => LegionGo.TryGetValue(name, out var value) ? value : null;
+            var saved = HardwareFingerprint.FromValues(readValue).Value;
+
+            Bench.Run("FromValues + Compare (saved detection reused)", 1, () =>
+                HardwareFingerprint.FromValues(readValue).Compare(saved));
+
+            // Reads the registry on Windows; returns Empty straight away elsewhere
+            Bench.Run("Read from the BIOS registry key", 1, () => HardwareFingerprint.Read());
+
+            Bench.Note(OperatingSystem.IsWindows()
+                ? $"Read on this machine: {HardwareFingerprint.Read()}"
+                : "Not Windows: Read() returns Empty without touching the registry");
+        }
+    }
+}
@@ -0,0 +1,23 @@
+using System;
+
+namespace HUDRA.Benchmarks
+{
+    public static class Program
+    {
+        public static void Main(string[] args)
+        {
+            Bench.Filter = args.Length > 0 ? args[0] : null;
+
+            Console.WriteLine($".NET {Environment.Version}, {Environment.ProcessorCount} logical CPUs, {(Environment.Is64BitProcess ? "x64" : "x86")}");
+
+            EngineProtocolBenchmarks.Run();
+            UiUpdateCoalescerBenchmarks.Run();
+            ArtworkPlaceholderBenchmarks.Run();
+            ArtworkPreviewBenchmarks.Run();
+            TitleMatcherBenchmarks.Run();
+            GameLibraryBenchmarks.Run();
+            HardwareFingerprintBenchmarks.Run();
+            SessionHistoryBenchmarks.Run();
+        }
+    }
+}
@@ -0,0 +1,112 @@
+using HUDRA.Services.SessionHistory;
+using System;
+using System.Diagnostics;
+using System.IO;
+
+namespace HUDRA.Benchmarks
+{
+    /// <summary>
+    /// A year of one game's history: two 2-hour sessions a day at the recorder's 5 s rate (730 sessions,
+    /// about a million samples), written in the recorder's 120-sample batches. Times the write, summary
+    /// and range queries over the full-resolution file, then downsampling everything past 30 days and
+    /// reading it back.
+    /// </summary>
+    public static class SessionHistoryBenchmarks
+    {
+        private const int Sessions = 730;
+        private const int SamplesPerSession = 1440;
+        private const int BatchSize = 120; // GameSessionRecorder's flush threshold
+        private const long SampleIntervalMs = 5000;
+        private const string GameKey = "bench";
+
+        private static void Report(string name, Stopwatch stopwatch, string detail)
+        {
+            Console.WriteLine($"{name,-52} {stopwatch.Elapsed.TotalMilliseconds,9:F0} ms   {detail}");
+        }
+
+        public static void Run()
+        {
+            const string name = "Session history year";
+            if (Bench.Filter != null && !name.Contains(Bench.Filter, StringComparison.OrdinalIgnoreCase))
+                return;
+
+            Bench.Header("Session history (one game, a year at 5 s)");
+
+            var directory = Directory.CreateTempSubdirectory("hudra-historybench-").FullName;
+            try
+            {
+                var store = new SessionHistoryStore(directory);
+                var random = new Random(92);
+                var batch = new SessionSample[BatchSize];
+                DateTime yearStart = DateTime.UtcNow.AddDays(-365);
+                long yearStartMs = new DateTimeOffset(yearStart).ToUnixTimeMilliseconds();
+                long total = 0;
+
+                var stopwatch = Stopwatch.StartNew();
+                for (int session = 0; session < Sessions; session++)
+                {
+                    long sessionId = yearStartMs + session * 12L * 3600_000;
+                    var summary = new SessionSummaryBuilder(sessionId, "Bench");
+                    for (int offset = 0; offset < SamplesPerSession; offset += BatchSize)
+                    {
+                        for (int i = 0; i < BatchSize; i++)
+                        {
+                            var sample = SessionSample.Empty(sessionId + (offset + i) * SampleIntervalMs);
+                            sample.TdpWatts = 15;
+                            sample.PackagePowerWatts = 14.3f + (float)random.NextDouble();
+                            sample.CpuTemperature = 70 + random.Next(10);
+                            sample.GpuTemperature = 65;
+                            sample.FanDutyPercent = 45;
+                            sample.Fps = 60 + random.Next(-3, 3);
+                            sample.BatteryDischargeWatts = 18.2f;
+                            batch[i] = sample;
+                            summary.Add(sample);
+                        }
+
+                        store.AppendSamples(GameKey, sessionId, batch);
+                        total += BatchSize;
+                    }
+
+                    store.AppendSummary(GameKey, summary.Build());
+                }
+                stopwatch.Stop();
+
+                long size = store.GetFileSize(GameKey);
+                Report($"{name}: write {Sessions} sessions", stopwatch,
+                    $"{total / stopwatch.Elapsed.TotalSeconds / 1e6:F2} M samples/s, {size / 1048576.0:F1} MB ({(double)size / total:F1} B/sample)");
+
+                stopwatch.Restart();
+                var summaries = store.GetSummaries(GameKey);
+                stopwatch.Stop();
+                Report($"{name}: read {summaries.Count} summaries", stopwatch, "skips every sample block");
+
+                stopwatch.Restart();
+                var week = store.GetSamples(GameKey, yearStart.AddDays(180), yearStart.AddDays(187));
+                stopwatch.Stop();
+                Report($"{name}: read a 7-day range", stopwatch, $"{week.Count} samples");
+
+                stopwatch.Restart();
+                var all = store.GetSamples(GameKey, DateTime.UnixEpoch, DateTime.UtcNow);
+                stopwatch.Stop();
+                Report($"{name}: read everything", stopwatch, $"{all.Count / stopwatch.Elapsed.TotalSeconds / 1e6:F2} M samples/s");
+
+                stopwatch.Restart();
+                var result = store.Downsample(GameKey, DateTime.UtcNow - SessionHistoryStore.DefaultDownsampleAge,
+                    SessionHistoryStore.DefaultDownsampleInterval);
+                stopwatch.Stop();
+                Report($"{name}: downsample past 30 days", stopwatch,
+                    $"{result.SessionsDownsampled} sessions, {result.SamplesBefore} -> {result.SamplesAfter} samples, " +
+                    $"{result.BytesBefore / 1048576.0:F1} -> {result.BytesAfter / 1048576.0:F1} MB");
+
+                stopwatch.Restart();
+                all = store.GetSamples(GameKey, DateTime.UnixEpoch, DateTime.UtcNow);
+                stopwatch.Stop();
+                Report($"{name}: read after downsampling", stopwatch, $"{all.Count} samples");
+            }
+            finally
+            {
+                try { Directory.Delete(directory, recursive: true); } catch { }
+            }
+        }
+    }
+}
@@ -0,0 +1,87 @@
+using HUDRA.Services.TitleMatching;
+using System;
+using System.IO;
+using System.Linq;
+using System.Text.RegularExpressions;
+
+namespace HUDRA.Benchmarks
+{
+    /// <summary>
+    /// Title scoring over the 50 labelled pairs in HUDRA.Tests\Fixtures\TitleMatching\title_pairs.tsv: preparing
+    /// keys, scoring prepared keys as the SteamGridDB search loop does, and scoring raw strings, against the
+    /// regex scorer the search used before TitleMatcher.
+    /// </summary>
+    public static class TitleMatcherBenchmarks
+    {
+        // SteamGridDbArtworkService.MinimumMatchScore
+        private const int ArtworkSearchThreshold = 50;
+
+        private static readonly Regex LegacyStrip = new(@"[™®©℠]|[^\w\s]", RegexOptions.Compiled);
+        private static readonly Regex LegacyWhitespace = new(@"\s+", RegexOptions.Compiled);
+
+        private static string LegacyNormalize(string name) =>
+            LegacyWhitespace.Replace(LegacyStrip.Replace(name, ""), " ").Trim().ToLowerInvariant();
+
+        /// <summary>
+        /// Prefix/substring/shared-word scorer SteamGridDbArtworkService used before TitleMatcher.
+        /// </summary>
+        private static int LegacyScore(string search, string result)
+        {
+            var a = LegacyNormalize(search);
+            var b = LegacyNormalize(result);
+            if (a.Length == 0 || b.Length == 0) return 0;
+            if (a == b) return 100;
+            if (b.StartsWith(a, StringComparison.Ordinal)) return 90;
+            if (a.StartsWith(b, StringComparison.Ordinal)) return 85;
+            if (b.Contains(a, StringComparison.Ordinal)) return 70;
+            if (a.Contains(b, StringComparison.Ordinal)) return 60;
+
+            var searchWords = a.Split(' ', StringSplitOptions.RemoveEmptyEntries);
+            var resultWords = b.Split(' ', StringSplitOptions.RemoveEmptyEntries);
+            int shared = searchWords.Intersect(resultWords).Count();
+            return shared > 0 ? (int)(50.0 * shared / Math.Max(searchWords.Length, resultWords.Length)) : 0;
+        }
+
+        public static void Run()
+        {
+            Bench.Header("Title matching");
+
+            var pairs = File.ReadLines(Path.Combine(AppContext.BaseDirectory, "Fixtures", "TitleMatching", "title_pairs.tsv"))
+                .Skip(1)
+                .Where(line => line.Length > 0)
+                .Select(line => line.Split('\t'))
+                .Select(f => (A: f[0], B: f[1], SameGame: bool.Parse(f[2])))
+                .ToArray();
+
+            var matcher = new TitleMatcher();
+            var keysA = pairs.Select(p => matcher.Prepare(p.A)).ToArray();
+            var keysB = pairs.Select(p => matcher.Prepare(p.B)).ToArray();
+            var candidates = pairs.Select(p => p.B).ToArray();
+            int ops = pairs.Length;
+
+            Bench.Run("Prepare (interned tokens)", ops, () =>
+            {
+                foreach (var p in pairs) matcher.Prepare(p.A);
+            });
+            Bench.Run("Score prepared keys", ops, () =>
+            {
+                for (int i = 0; i < keysA.Length; i++) matcher.Score(keysA[i], keysB[i]);
+            });
+            Bench.Run("Score strings", ops, () =>
+            {
+                foreach (var p in pairs) matcher.Score(p.A, p.B);
+            });
+            Bench.Run("Legacy regex score", ops, () =>
+            {
+                foreach (var p in pairs) LegacyScore(p.A, p.B);
+            });
+            Bench.Run($"Rank {candidates.Length} results", 1, () =>
+                matcher.Rank(keysA[0], candidates, c => c, ArtworkSearchThreshold));
+
+            int matcherCorrect = pairs.Count(p => (matcher.Score(p.A, p.B) >= ArtworkSearchThreshold) == p.SameGame);
+            int legacyCorrect = pairs.Count(p => (LegacyScore(p.A, p.B) >= ArtworkSearchThreshold) == p.SameGame);
+            Bench.Note($"Pairs classified at score >= {ArtworkSearchThreshold}: TitleMatcher {matcherCorrect}/{pairs.Length}, " +
+                       $"legacy {legacyCorrect}/{pairs.Length}; {matcher.TokenCount} interned tokens");
+        }
+    }
+}
@@ -0,0 +1,87 @@
+using HUDRA.Services.UiDispatch;
+using System;
+using System.Collections.Generic;
+using System.Linq;
+
+namespace HUDRA.Benchmarks
+{
+    /// <summary>
+    /// Replays a simulated minute of service updates in virtual time, once as one dispatcher work item per
+    /// update (the old TryEnqueue path) and once through <see cref="UiUpdateCoalescer"/> drained on 60 Hz
+    /// frames, then times Post and Drain themselves.
+    /// </summary>
+    public static class UiUpdateCoalescerBenchmarks
+    {
+        private const double FrameMs = 1000.0 / 60;
+        private const double DurationMs = 60_000;
+
+        private readonly record struct Update(double AtMs, string Key);
+
+        /// <summary>
+        /// Sensor cadences from the services (fan and temperature every 2 s, battery every 30 s, TDP drift
+        /// every 60 s), plus a library rescan at 5 s: twelve scan progress lines in quick succession, then an
+        /// artwork pass over 200 games where 150 are already cached (~2 ms each) and 50 download (~250 ms).
+        /// Timings are assumptions, not recordings.
+        /// </summary>
+        private static List<Update> BuildWorkload()
+        {
+            var updates = new List<Update>();
+            for (double t = 1000; t < DurationMs; t += 2000)
+            {
+                updates.Add(new Update(t, "FanStatus"));
+                updates.Add(new Update(t + 3, "Temperature"));
+            }
+            for (double t = 0; t < DurationMs; t += 30_000)
+                updates.Add(new Update(t, "BatteryInfo"));
+            updates.Add(new Update(59_000, "TdpDrift"));
+
+            double at = 5000;
+            updates.Add(new Update(at, "ScanningState"));
+            for (int i = 0; i < 12; i++)
+                updates.Add(new Update(at += 4, "ScanProgress"));
+
+            var random = new Random(81);
+            for (int game = 0; game < 200; game++)
+            {
+                at += game % 4 == 3 ? 200 + random.Next(100) : 1 + random.Next(3);
+                updates.Add(new Update(at, "ScanProgress"));
+            }
+            updates.Add(new Update(at += 2, "ScanProgress"));
+            updates.Add(new Update(at + 1, "DatabaseReady"));
+            updates.Add(new Update(at + 2, "ScanningState"));
+
+            return updates.OrderBy(u => u.AtMs).ToList();
+        }
+
+        public static void Run()
+        {
+            Bench.Header("UI update coalescing");
+
+            var workload = BuildWorkload();
+            var coalescer = new UiUpdateCoalescer();
+            int next = 0;
+            for (double frame = FrameMs; next < workload.Count; frame += FrameMs)
+            {
+                while (next < workload.Count && workload[next].AtMs < frame)
+                    coalescer.Post(workload[next++].Key, static () => { });
+                coalescer.Drain();
+            }
+
+            Bench.Note($"simulated minute, direct TryEnqueue: {workload.Count} posted, {workload.Count} applied, 0 superseded, {workload.Count} UI batches");
+            Bench.Note($"simulated minute, coalesced @60 Hz:  {coalescer.Stats}");
+
+            var timed = new UiUpdateCoalescer();
+            Action noop = static () => { };
+            Bench.Run("Post, same key (superseding)", 1, () => timed.Post("FanStatus", noop));
+            timed.Drain();
+
+            var keys = new[] { "FanStatus", "Temperature", "BatteryInfo", "TdpDrift", "ScanProgress", "ScanningState" };
+            Bench.Run("6 posts + Drain", 1, () =>
+            {
+                for (int i = 0; i < keys.Length; i++)
+                    timed.Post(keys[i], noop);
+                timed.Drain();
+            });
+        }
+    }
+}
@@ -0,0 +1,66 @@
+namespace HUDRA.Engine.Protocol
+{
+    /// <summary>
+    /// Wire constants shared by the engine and its UI clients.
+    /// </summary>
+    public static class EngineProtocol
+    {
+        public const ushort Version = 1;
+        public const string PipeName = "HUDRA.Engine";
+
+        /// <summary>
+        /// Upper bound on a single frame payload. Anything larger is treated as a corrupt stream.
+        /// </summary>
+        public const int MaxPayloadLength = 1024 * 1024;
+    }
+
+    public enum FrameType : byte
+    {
+        Hello = 1,          // client -> engine: protocol version + client name
+        Welcome = 2,        // engine -> client: protocol version accepted
+        StateSnapshot = 3,  // engine -> client: every known state value (sent once after Welcome)
+        StateBatch = 4,     // engine -> client: values changed since the last batch
+        Command = 5,        // client -> engine
+        CommandResult = 6,  // engine -> client
+        Goodbye = 7,        // either direction: orderly close with a reason
+    }
+
+    /// <summary>
+    /// State published by the engine. Values are stable wire IDs - append only.
+    /// </summary>
+    public enum StateKey : ushort
+    {
+        TdpTargetWatts = 1,
+        TdpCurrentWatts = 2,
+        StickyTdpEnabled = 3,
+
+        FanControlEnabled = 10,
+        FanDutyPercent = 11,
+        FanRpm = 12,
+
+        CpuTemperature = 20,
+        GpuTemperature = 21,
+
+        BatteryPercent = 30,
+        BatteryCharging = 31,
+        BatteryOnAc = 32,
+
+        GameProcessId = 40,
+        GameName = 41,
+        GameProfileActive = 42,
+        GameFps = 43,              // Double, 0 when unknown
+        GameJoulesPerFrame = 44,   // Double over the last minute, 0 when unknown
+    }
+
+    /// <summary>
+    /// Commands a client can send. Values are stable wire IDs - append only.
+    /// </summary>
+    public enum EngineCommand : ushort
+    {
+        Ping = 1,
+        SetTdp = 2,          // Int64 watts
+        SetStickyTdp = 3,    // Bool
+        SetFanAuto = 4,      // no argument
+        SwitchToGame = 5,    // no argument
+    }
+}
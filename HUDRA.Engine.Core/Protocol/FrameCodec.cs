@@ -0,0 +1,183 @@
+using System;
+using System.Collections.Generic;
+
+namespace HUDRA.Engine.Protocol
+{
+    public enum FrameReadStatus
+    {
+        Complete,
+        NeedMoreData,
+        Invalid
+    }
+
+    /// <summary>
+    /// Frame layout: [1 byte FrameType][varint payload length][payload].
+    /// A typical state batch of a handful of numeric values is under 30 bytes.
+    /// </summary>
+    public static class FrameCodec
+    {
+        public static void WriteFrame(PayloadWriter output, FrameType type, ReadOnlySpan<byte> payload)
+        {
+            output.WriteByte((byte)type);
+            output.WriteVarUInt((ulong)payload.Length);
+            output.WriteBytes(payload);
+        }
+
+        /// <summary>
+        /// Tries to parse one frame from the start of <paramref name="buffer"/>.
+        /// </summary>
+        public static FrameReadStatus TryReadFrame(
+            ReadOnlySpan<byte> buffer,
+            out FrameType type,
+            out int payloadOffset,
+            out int payloadLength,
+            out int frameLength)
+        {
+            type = default;
+            payloadOffset = 0;
+            payloadLength = 0;
+            frameLength = 0;
+
+            if (buffer.Length < 2)
+                return FrameReadStatus.NeedMoreData;
+
+            type = (FrameType)buffer[0];
+            if (!Enum.IsDefined(type))
+                return FrameReadStatus.Invalid;
+
+            // Decode the varint length by hand so a partial header isn't mistaken for corruption
+            ulong length = 0;
+            int index = 1;
+            for (int shift = 0; ; shift += 7)
+            {
+                if (index >= buffer.Length)
+                    return FrameReadStatus.NeedMoreData;
+                if (shift > 28)
+                    return FrameReadStatus.Invalid;
+
+                byte b = buffer[index++];
+                length |= (ulong)(b & 0x7F) << shift;
+                if ((b & 0x80) == 0) break;
+            }
+
+            if (length > EngineProtocol.MaxPayloadLength)
+                return FrameReadStatus.Invalid;
+
+            payloadOffset = index;
+            payloadLength = (int)length;
+            frameLength = index + payloadLength;
+
+            return buffer.Length >= frameLength ? FrameReadStatus.Complete : FrameReadStatus.NeedMoreData;
+        }
+    }
+
+    public readonly record struct HelloMessage(ushort ProtocolVersion, string ClientName);
+    public readonly record struct CommandMessage(uint RequestId, EngineCommand Command, StateValue Argument);
+    public readonly record struct CommandResultMessage(uint RequestId, bool Success, string Message);
+
+    /// <summary>
+    /// Payload encoders/decoders for each frame type. Writers append a complete frame to <c>output</c>;
+    /// <c>scratch</c> is a reusable buffer for building the payload.
+    /// </summary>
+    public static class EngineMessages
+    {
+        public static void WriteHello(PayloadWriter output, PayloadWriter scratch, HelloMessage message)
+        {
+            scratch.Reset();
+            scratch.WriteVarUInt(message.ProtocolVersion);
+            scratch.WriteString(message.ClientName);
+            FrameCodec.WriteFrame(output, FrameType.Hello, scratch.WrittenSpan);
+        }
+
+        public static HelloMessage ReadHello(ReadOnlySpan<byte> payload)
+        {
+            var reader = new PayloadReader(payload);
+            return new HelloMessage((ushort)reader.ReadVarUInt(), reader.ReadString());
+        }
+
+        public static void WriteWelcome(PayloadWriter output, PayloadWriter scratch, ushort protocolVersion)
+        {
+            scratch.Reset();
+            scratch.WriteVarUInt(protocolVersion);
+            FrameCodec.WriteFrame(output, FrameType.Welcome, scratch.WrittenSpan);
+        }
+
+        public static ushort ReadWelcome(ReadOnlySpan<byte> payload)
+        {
+            var reader = new PayloadReader(payload);
+            return (ushort)reader.ReadVarUInt();
+        }
+
+        /// <summary>
+        /// Writes a StateSnapshot or StateBatch frame: [varint count] then [varint key][value] per entry.
+        /// </summary>
+        public static void WriteState(PayloadWriter output, PayloadWriter scratch, FrameType type, IReadOnlyList<StateEntry> entries)
+        {
+            scratch.Reset();
+            scratch.WriteVarUInt((ulong)entries.Count);
+            for (int i = 0; i < entries.Count; i++)
+            {
+                scratch.WriteVarUInt((ushort)entries[i].Key);
+                scratch.WriteValue(entries[i].Value);
+            }
+            FrameCodec.WriteFrame(output, type, scratch.WrittenSpan);
+        }
+
+        public static void ReadState(ReadOnlySpan<byte> payload, List<StateEntry> into)
+        {
+            var reader = new PayloadReader(payload);
+            ulong count = reader.ReadVarUInt();
+            if (count > (ulong)payload.Length)
+                throw new FormatException("State entry count exceeds payload");
+
+            for (ulong i = 0; i < count; i++)
+            {
+                var key = (StateKey)reader.ReadVarUInt();
+                into.Add(new StateEntry(key, reader.ReadValue()));
+            }
+        }
+
+        public static void WriteCommand(PayloadWriter output, PayloadWriter scratch, CommandMessage message)
+        {
+            scratch.Reset();
+            scratch.WriteVarUInt(message.RequestId);
+            scratch.WriteVarUInt((ushort)message.Command);
+            scratch.WriteValue(message.Argument);
+            FrameCodec.WriteFrame(output, FrameType.Command, scratch.WrittenSpan);
+        }
+
+        public static CommandMessage ReadCommand(ReadOnlySpan<byte> payload)
+        {
+            var reader = new PayloadReader(payload);
+            return new CommandMessage((uint)reader.ReadVarUInt(), (EngineCommand)reader.ReadVarUInt(), reader.ReadValue());
+        }
+
+        public static void WriteCommandResult(PayloadWriter output, PayloadWriter scratch, CommandResultMessage message)
+        {
+            scratch.Reset();
+            scratch.WriteVarUInt(message.RequestId);
+            scratch.WriteByte(message.Success ? (byte)1 : (byte)0);
+            scratch.WriteString(message.Message);
+            FrameCodec.WriteFrame(output, FrameType.CommandResult, scratch.WrittenSpan);
+        }
+
+        public static CommandResultMessage ReadCommandResult(ReadOnlySpan<byte> payload)
+        {
+            var reader = new PayloadReader(payload);
+            return new CommandResultMessage((uint)reader.ReadVarUInt(), reader.ReadByte() != 0, reader.ReadString());
+        }
+
+        public static void WriteGoodbye(PayloadWriter output, PayloadWriter scratch, string reason)
+        {
+            scratch.Reset();
+            scratch.WriteString(reason);
+            FrameCodec.WriteFrame(output, FrameType.Goodbye, scratch.WrittenSpan);
+        }
+
+        public static string ReadGoodbye(ReadOnlySpan<byte> payload)
+        {
+            var reader = new PayloadReader(payload);
+            return reader.ReadString();
+        }
+    }
+}
@@ -0,0 +1,173 @@
+using System;
+using System.Buffers.Binary;
+using System.Text;
+
+namespace HUDRA.Engine.Protocol
+{
+    /// <summary>
+    /// Append-only binary writer used to build frames. Integers are LEB128 varints,
+    /// strings are varint length + UTF-8, doubles are 8 bytes little-endian.
+    /// Reusable: call <see cref="Reset"/> between frames to avoid reallocating.
+    /// </summary>
+    public sealed class PayloadWriter
+    {
+        private byte[] _buffer;
+        private int _length;
+
+        public PayloadWriter(int initialCapacity = 256)
+        {
+            _buffer = new byte[Math.Max(16, initialCapacity)];
+        }
+
+        public int Length => _length;
+        public ReadOnlySpan<byte> WrittenSpan => _buffer.AsSpan(0, _length);
+        public ReadOnlyMemory<byte> WrittenMemory => _buffer.AsMemory(0, _length);
+
+        public void Reset() => _length = 0;
+
+        public void WriteByte(byte value)
+        {
+            Ensure(1);
+            _buffer[_length++] = value;
+        }
+
+        public void WriteVarUInt(ulong value)
+        {
+            Ensure(10);
+            while (value >= 0x80)
+            {
+                _buffer[_length++] = (byte)(value | 0x80);
+                value >>= 7;
+            }
+            _buffer[_length++] = (byte)value;
+        }
+
+        public void WriteVarInt(long value)
+        {
+            // ZigZag so small negatives stay small
+            WriteVarUInt((ulong)((value << 1) ^ (value >> 63)));
+        }
+
+        public void WriteDouble(double value)
+        {
+            Ensure(8);
+            BinaryPrimitives.WriteInt64LittleEndian(_buffer.AsSpan(_length), BitConverter.DoubleToInt64Bits(value));
+            _length += 8;
+        }
+
+        public void WriteString(string value)
+        {
+            int byteCount = Encoding.UTF8.GetByteCount(value);
+            WriteVarUInt((ulong)byteCount);
+            Ensure(byteCount);
+            _length += Encoding.UTF8.GetBytes(value, _buffer.AsSpan(_length));
+        }
+
+        public void WriteBytes(ReadOnlySpan<byte> bytes)
+        {
+            Ensure(bytes.Length);
+            bytes.CopyTo(_buffer.AsSpan(_length));
+            _length += bytes.Length;
+        }
+
+        public void WriteValue(StateValue value)
+        {
+            WriteByte((byte)value.Kind);
+            switch (value.Kind)
+            {
+                case StateValueKind.Int64:
+                    WriteVarInt(value.AsInt64());
+                    break;
+                case StateValueKind.Double:
+                    WriteDouble(value.AsDouble());
+                    break;
+                case StateValueKind.Bool:
+                    WriteByte(value.AsBool() ? (byte)1 : (byte)0);
+                    break;
+                case StateValueKind.String:
+                    WriteString(value.AsString());
+                    break;
+            }
+        }
+
+        private void Ensure(int additional)
+        {
+            if (_length + additional <= _buffer.Length) return;
+
+            int newSize = Math.Max(_buffer.Length * 2, _length + additional);
+            Array.Resize(ref _buffer, newSize);
+        }
+    }
+
+    /// <summary>
+    /// Forward-only reader over a frame payload. Throws <see cref="FormatException"/> on truncated or malformed data.
+    /// </summary>
+    public ref struct PayloadReader
+    {
+        private readonly ReadOnlySpan<byte> _data;
+        private int _position;
+
+        public PayloadReader(ReadOnlySpan<byte> data)
+        {
+            _data = data;
+            _position = 0;
+        }
+
+        public bool IsAtEnd => _position >= _data.Length;
+
+        public byte ReadByte()
+        {
+            if (_position >= _data.Length) throw new FormatException("Unexpected end of payload");
+            return _data[_position++];
+        }
+
+        public ulong ReadVarUInt()
+        {
+            ulong result = 0;
+            for (int shift = 0; shift < 64; shift += 7)
+            {
+                byte b = ReadByte();
+                result |= (ulong)(b & 0x7F) << shift;
+                if ((b & 0x80) == 0) return result;
+            }
+            throw new FormatException("Varint too long");
+        }
+
+        public long ReadVarInt()
+        {
+            ulong raw = ReadVarUInt();
+            return (long)(raw >> 1) ^ -(long)(raw & 1);
+        }
+
+        public double ReadDouble()
+        {
+            if (_position + 8 > _data.Length) throw new FormatException("Unexpected end of payload");
+            long bits = BinaryPrimitives.ReadInt64LittleEndian(_data.Slice(_position, 8));
+            _position += 8;
+            return BitConverter.Int64BitsToDouble(bits);
+        }
+
+        public string ReadString()
+        {
+            ulong length = ReadVarUInt();
+            if (length > (ulong)(_data.Length - _position)) throw new FormatException("String length exceeds payload");
+            var value = Encoding.UTF8.GetString(_data.Slice(_position, (int)length));
+            _position += (int)length;
+            return value;
+        }
+
+        public StateValue ReadValue()
+        {
+            var kind = (StateValueKind)ReadByte();
+            return kind switch
+            {
+                StateValueKind.None => StateValue.None,
+                StateValueKind.Int64 => StateValue.From(ReadVarInt()),
+                StateValueKind.Double => StateValue.From(ReadDouble()),
+                StateValueKind.Bool => StateValue.From(ReadByte() != 0),
+                StateValueKind.String => StateValue.From(ReadString()),
+                _ => throw new FormatException($"Unknown value kind {(byte)kind}")
+            };
+        }
+    }
+}
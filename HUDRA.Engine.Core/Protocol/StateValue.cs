@@ -0,0 +1,75 @@
+using System;
+using System.Globalization;
+
+namespace HUDRA.Engine.Protocol
+{
+    public enum StateValueKind : byte
+    {
+        None = 0,
+        Int64 = 1,
+        Double = 2,
+        Bool = 3,
+        String = 4,
+    }
+
+    /// <summary>
+    /// Small tagged value carried in state updates and command arguments.
+    /// </summary>
+    public readonly struct StateValue : IEquatable<StateValue>
+    {
+        private readonly long _integer;
+        private readonly double _double;
+        private readonly string? _string;
+
+        public StateValueKind Kind { get; }
+
+        private StateValue(StateValueKind kind, long integer = 0, double dbl = 0, string? str = null)
+        {
+            Kind = kind;
+            _integer = integer;
+            _double = dbl;
+            _string = str;
+        }
+
+        public static readonly StateValue None = default;
+
+        public static StateValue From(long value) => new(StateValueKind.Int64, integer: value);
+        public static StateValue From(double value) => new(StateValueKind.Double, dbl: value);
+        public static StateValue From(bool value) => new(StateValueKind.Bool, integer: value ? 1 : 0);
+        public static StateValue From(string? value) => value == null ? None : new(StateValueKind.String, str: value);
+
+        public long AsInt64() => Kind switch
+        {
+            StateValueKind.Int64 or StateValueKind.Bool => _integer,
+            StateValueKind.Double => (long)_double,
+            _ => 0
+        };
+
+        public double AsDouble() => Kind == StateValueKind.Double ? _double : AsInt64();
+        public bool AsBool() => AsInt64() != 0;
+        public string AsString() => Kind == StateValueKind.String ? _string ?? string.Empty : ToString();
+
+        public bool Equals(StateValue other) =>
+            Kind == other.Kind &&
+            _integer == other._integer &&
+            _double.Equals(other._double) &&
+            string.Equals(_string, other._string, StringComparison.Ordinal);
+
+        public override bool Equals(object? obj) => obj is StateValue other && Equals(other);
+        public override int GetHashCode() => HashCode.Combine(Kind, _integer, _double, _string);
+
+        public static bool operator ==(StateValue left, StateValue right) => left.Equals(right);
+        public static bool operator !=(StateValue left, StateValue right) => !left.Equals(right);
+
+        public override string ToString() => Kind switch
+        {
+            StateValueKind.Int64 => _integer.ToString(CultureInfo.InvariantCulture),
+            StateValueKind.Double => _double.ToString("0.###", CultureInfo.InvariantCulture),
+            StateValueKind.Bool => _integer != 0 ? "true" : "false",
+            StateValueKind.String => _string ?? string.Empty,
+            _ => "none"
+        };
+    }
+
+    public readonly record struct StateEntry(StateKey Key, StateValue Value);
+}
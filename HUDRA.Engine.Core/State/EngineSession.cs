@@ -0,0 +1,179 @@
+using HUDRA.Engine.Protocol;
+using System;
+using System.Collections.Generic;
+
+namespace HUDRA.Engine.State
+{
+    public enum EngineSessionState
+    {
+        AwaitingHello,
+        Ready,
+        Closed
+    }
+
+    public readonly record struct EngineCommandResult(bool Success, string Message)
+    {
+        public static EngineCommandResult Ok(string message = "") => new(true, message);
+        public static EngineCommandResult Fail(string message) => new(false, message);
+    }
+
+    /// <summary>
+    /// Executes client commands inside the engine.
+    /// </summary>
+    public interface IEngineCommandHandler
+    {
+        EngineCommandResult Execute(EngineCommand command, StateValue argument);
+    }
+
+    /// <summary>
+    /// Engine side of one client connection, independent of the transport. Feed it inbound frames with
+    /// <see cref="HandleFrame"/>; it appends outbound frames to the supplied writer.
+    ///
+    /// AwaitingHello --Hello(matching version)--> Ready (Welcome + StateSnapshot sent)
+    /// AwaitingHello --anything else-----------> Closed (Goodbye sent)
+    /// Ready --Command--> Ready (CommandResult sent)
+    /// Ready --Goodbye--> Closed
+    /// </summary>
+    public sealed class EngineSession
+    {
+        private readonly EngineStateStore _store;
+        private readonly IEngineCommandHandler _commandHandler;
+        private readonly PayloadWriter _scratch = new();
+        private readonly List<StateEntry> _pending = new();
+        private long _sentVersion;
+
+        public EngineSessionState State { get; private set; } = EngineSessionState.AwaitingHello;
+        public string ClientName { get; private set; } = string.Empty;
+        public string? CloseReason { get; private set; }
+
+        // Counters for diagnostics
+        public long BatchesSent { get; private set; }
+        public long EntriesSent { get; private set; }
+        public long CommandsHandled { get; private set; }
+
+        public EngineSession(EngineStateStore store, IEngineCommandHandler commandHandler)
+        {
+            _store = store;
+            _commandHandler = commandHandler;
+        }
+
+        public void HandleFrame(FrameType type, ReadOnlySpan<byte> payload, PayloadWriter output)
+        {
+            if (State == EngineSessionState.Closed)
+                return;
+
+            try
+            {
+                switch (State)
+                {
+                    case EngineSessionState.AwaitingHello:
+                        HandleHandshake(type, payload, output);
+                        break;
+
+                    case EngineSessionState.Ready:
+                        HandleReady(type, payload, output);
+                        break;
+                }
+            }
+            catch (FormatException ex)
+            {
+                Close(output, $"Malformed {type} frame: {ex.Message}");
+            }
+        }
+
+        /// <summary>
+        /// Appends one StateBatch frame with everything that changed since the last flush.
+        /// Returns false if there was nothing to send.
+        /// </summary>
+        public bool Flush(PayloadWriter output)
+        {
+            if (State != EngineSessionState.Ready)
+                return false;
+
+            _pending.Clear();
+            _sentVersion = _store.CollectChanges(_sentVersion, _pending);
+            if (_pending.Count == 0)
+                return false;
+
+            EngineMessages.WriteState(output, _scratch, FrameType.StateBatch, _pending);
+            BatchesSent++;
+            EntriesSent += _pending.Count;
+            return true;
+        }
+
+        /// <summary>
+        /// Closes the session, sending Goodbye if the handshake had started.
+        /// </summary>
+        public void Close(PayloadWriter? output, string reason)
+        {
+            if (State == EngineSessionState.Closed)
+                return;
+
+            if (output != null)
+            {
+                EngineMessages.WriteGoodbye(output, _scratch, reason);
+            }
+
+            CloseReason = reason;
+            State = EngineSessionState.Closed;
+        }
+
+        private void HandleHandshake(FrameType type, ReadOnlySpan<byte> payload, PayloadWriter output)
+        {
+            if (type != FrameType.Hello)
+            {
+                Close(output, $"Expected Hello, got {type}");
+                return;
+            }
+
+            var hello = EngineMessages.ReadHello(payload);
+            if (hello.ProtocolVersion != EngineProtocol.Version)
+            {
+                Close(output, $"Protocol version {hello.ProtocolVersion} not supported (engine is {EngineProtocol.Version})");
+                return;
+            }
+
+            ClientName = hello.ClientName;
+            State = EngineSessionState.Ready;
+            EngineMessages.WriteWelcome(output, _scratch, EngineProtocol.Version);
+
+            // Full snapshot, then incremental batches from this version on
+            _pending.Clear();
+            _sentVersion = _store.CollectChanges(0, _pending);
+            EngineMessages.WriteState(output, _scratch, FrameType.StateSnapshot, _pending);
+            EntriesSent += _pending.Count;
+        }
+
+        private void HandleReady(FrameType type, ReadOnlySpan<byte> payload, PayloadWriter output)
+        {
+            switch (type)
+            {
+                case FrameType.Command:
+                    var command = EngineMessages.ReadCommand(payload);
+                    EngineCommandResult result;
+                    try
+                    {
+                        result = _commandHandler.Execute(command.Command, command.Argument);
+                    }
+                    catch (Exception ex)
+                    {
+                        result = EngineCommandResult.Fail(ex.Message);
+                    }
+
+                    CommandsHandled++;
+                    EngineMessages.WriteCommandResult(output, _scratch,
+                        new CommandResultMessage(command.RequestId, result.Success, result.Message));
+                    break;
+
+                case FrameType.Goodbye:
+                    CloseReason = EngineMessages.ReadGoodbye(payload);
+                    State = EngineSessionState.Closed;
+                    break;
+
+                default:
+                    Close(output, $"Unexpected {type} frame");
+                    break;
+            }
+        }
+    }
+}
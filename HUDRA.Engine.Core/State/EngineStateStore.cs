@@ -0,0 +1,112 @@
+using HUDRA.Engine.Protocol;
+using System;
+using System.Collections.Generic;
+
+namespace HUDRA.Engine.State
+{
+    /// <summary>
+    /// Latest-value store for engine state. Each write bumps a global version; sessions remember
+    /// the version they last sent and pull only newer keys, so a value that changes ten times
+    /// between flushes goes over the wire once.
+    /// </summary>
+    public sealed class EngineStateStore
+    {
+        private readonly object _lock = new object();
+        private readonly Dictionary<StateKey, (StateValue Value, long Version)> _values = new();
+        private long _version;
+
+        /// <summary>
+        /// Raised (outside the lock) after a write that changed a value. Used by transports to schedule a flush.
+        /// </summary>
+        public event EventHandler? Changed;
+
+        public long Version
+        {
+            get { lock (_lock) return _version; }
+        }
+
+        /// <summary>
+        /// Sets a value. Returns false (and doesn't bump the version) if the value is unchanged.
+        /// </summary>
+        public bool Set(StateKey key, StateValue value)
+        {
+            lock (_lock)
+            {
+                if (_values.TryGetValue(key, out var existing) && existing.Value == value)
+                    return false;
+
+                _values[key] = (value, ++_version);
+            }
+
+            Changed?.Invoke(this, EventArgs.Empty);
+            return true;
+        }
+
+        public bool Set(StateKey key, long value) => Set(key, StateValue.From(value));
+        public bool Set(StateKey key, double value) => Set(key, StateValue.From(value));
+        public bool Set(StateKey key, bool value) => Set(key, StateValue.From(value));
+        public bool Set(StateKey key, string? value) => Set(key, StateValue.From(value));
+
+        /// <summary>
+        /// Applies a batch of values under one lock with a single Changed notification.
+        /// </summary>
+        public int SetMany(IEnumerable<StateEntry> entries)
+        {
+            int changed = 0;
+            lock (_lock)
+            {
+                foreach (var entry in entries)
+                {
+                    if (_values.TryGetValue(entry.Key, out var existing) && existing.Value == entry.Value)
+                        continue;
+
+                    _values[entry.Key] = (entry.Value, ++_version);
+                    changed++;
+                }
+            }
+
+            if (changed > 0)
+            {
+                Changed?.Invoke(this, EventArgs.Empty);
+            }
+            return changed;
+        }
+
+        public bool TryGet(StateKey key, out StateValue value)
+        {
+            lock (_lock)
+            {
+                if (_values.TryGetValue(key, out var entry))
+                {
+                    value = entry.Value;
+                    return true;
+                }
+            }
+
+            value = StateValue.None;
+            return false;
+        }
+
+        /// <summary>
+        /// Appends every key written after <paramref name="sinceVersion"/> to <paramref name="into"/>
+        /// and returns the store version the result is consistent with. Pass 0 for a full snapshot.
+        /// </summary>
+        public long CollectChanges(long sinceVersion, List<StateEntry> into)
+        {
+            lock (_lock)
+            {
+                if (sinceVersion >= _version)
+                    return _version;
+
+                foreach (var pair in _values)
+                {
+                    if (pair.Value.Version > sinceVersion)
+                    {
+                        into.Add(new StateEntry(pair.Key, pair.Value.Value));
+                    }
+                }
+                return _version;
+            }
+        }
+    }
+}
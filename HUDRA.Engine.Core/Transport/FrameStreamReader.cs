@@ -0,0 +1,77 @@
+using HUDRA.Engine.Protocol;
+using System;
+using System.IO;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace HUDRA.Engine.Transport
+{
+    /// <summary>
+    /// Reads whole frames from a byte stream into a reusable buffer. The payload returned by
+    /// <see cref="ReadFrameAsync"/> is only valid until the next call.
+    /// </summary>
+    public sealed class FrameStreamReader
+    {
+        private readonly Stream _stream;
+        private byte[] _buffer;
+        private int _start;
+        private int _end;
+
+        public FrameType CurrentType { get; private set; }
+        public ReadOnlyMemory<byte> CurrentPayload { get; private set; }
+
+        public FrameStreamReader(Stream stream, int initialBufferSize = 4096)
+        {
+            _stream = stream;
+            _buffer = new byte[initialBufferSize];
+        }
+
+        /// <summary>
+        /// Returns false at end of stream. Throws <see cref="InvalidDataException"/> on a corrupt frame header.
+        /// </summary>
+        public async ValueTask<bool> ReadFrameAsync(CancellationToken cancellationToken)
+        {
+            while (true)
+            {
+                var status = FrameCodec.TryReadFrame(
+                    _buffer.AsSpan(_start, _end - _start),
+                    out var type, out int payloadOffset, out int payloadLength, out int frameLength);
+
+                if (status == FrameReadStatus.Complete)
+                {
+                    CurrentType = type;
+                    CurrentPayload = _buffer.AsMemory(_start + payloadOffset, payloadLength);
+                    _start += frameLength;
+                    return true;
+                }
+
+                if (status == FrameReadStatus.Invalid)
+                    throw new InvalidDataException("Corrupt engine frame header");
+
+                MakeRoom();
+
+                int read = await _stream.ReadAsync(_buffer.AsMemory(_end), cancellationToken).ConfigureAwait(false);
+                if (read == 0)
+                    return false;
+
+                _end += read;
+            }
+        }
+
+        private void MakeRoom()
+        {
+            // Slide unread bytes to the front, then grow if the pending frame still doesn't fit
+            if (_start > 0)
+            {
+                Buffer.BlockCopy(_buffer, _start, _buffer, 0, _end - _start);
+                _end -= _start;
+                _start = 0;
+            }
+
+            if (_end == _buffer.Length)
+            {
+                Array.Resize(ref _buffer, _buffer.Length * 2);
+            }
+        }
+    }
+}
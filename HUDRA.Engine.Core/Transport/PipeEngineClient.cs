@@ -0,0 +1,199 @@
+using HUDRA.Engine.Protocol;
+using HUDRA.Engine.State;
+using System;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+using System.IO;
+using System.IO.Pipes;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace HUDRA.Engine.Transport
+{
+    /// <summary>
+    /// Client side of the engine pipe. Mirrors engine state into <see cref="State"/> and raises
+    /// <see cref="StateReceived"/> once per snapshot/batch frame rather than once per key.
+    /// </summary>
+    public sealed class PipeEngineClient : IDisposable
+    {
+        private readonly string _clientName;
+        private readonly string _pipeName;
+        private readonly ConcurrentDictionary<uint, TaskCompletionSource<CommandResultMessage>> _pendingCommands = new();
+        private readonly SemaphoreSlim _writeLock = new(1, 1);
+        private readonly PayloadWriter _output = new();
+        private readonly PayloadWriter _scratch = new();
+        private readonly CancellationTokenSource _cts = new();
+        private NamedPipeClientStream? _pipe;
+        private TaskCompletionSource<bool>? _welcome;
+        private Task? _readTask;
+        private int _nextRequestId;
+        private bool _disposed;
+
+        public EngineStateStore State { get; } = new EngineStateStore();
+        public bool IsConnected => _pipe?.IsConnected == true && _welcome?.Task.IsCompletedSuccessfully == true;
+
+        public event EventHandler<IReadOnlyList<StateEntry>>? StateReceived;
+        public event EventHandler<string>? Disconnected;
+
+        public PipeEngineClient(string clientName, string pipeName = EngineProtocol.PipeName)
+        {
+            _clientName = clientName;
+            _pipeName = pipeName;
+        }
+
+        /// <summary>
+        /// Connects and completes the handshake. Throws <see cref="TimeoutException"/> if the engine isn't
+        /// running and <see cref="IOException"/> if it rejects the handshake.
+        /// </summary>
+        public async Task ConnectAsync(int timeoutMs = 2000, CancellationToken cancellationToken = default)
+        {
+            if (_pipe != null)
+                throw new InvalidOperationException("Already connected");
+
+            _pipe = new NamedPipeClientStream(".", _pipeName, PipeDirection.InOut,
+                PipeOptions.Asynchronous | PipeOptions.CurrentUserOnly);
+            await _pipe.ConnectAsync(timeoutMs, cancellationToken).ConfigureAwait(false);
+
+            _welcome = new TaskCompletionSource<bool>(TaskCreationOptions.RunContinuationsAsynchronously);
+            _readTask = Task.Run(() => ReadLoopAsync(_pipe, _cts.Token));
+
+            await WriteAsync(() => EngineMessages.WriteHello(_output, _scratch,
+                new HelloMessage(EngineProtocol.Version, _clientName)), cancellationToken).ConfigureAwait(false);
+
+            using var timeout = CancellationTokenSource.CreateLinkedTokenSource(cancellationToken);
+            timeout.CancelAfter(timeoutMs);
+            await _welcome.Task.WaitAsync(timeout.Token).ConfigureAwait(false);
+        }
+
+        public async Task<CommandResultMessage> SendCommandAsync(
+            EngineCommand command, StateValue argument, CancellationToken cancellationToken = default)
+        {
+            if (!IsConnected)
+                throw new InvalidOperationException("Not connected to engine");
+
+            uint requestId = (uint)Interlocked.Increment(ref _nextRequestId);
+            var completion = new TaskCompletionSource<CommandResultMessage>(TaskCreationOptions.RunContinuationsAsynchronously);
+            _pendingCommands[requestId] = completion;
+
+            try
+            {
+                await WriteAsync(() => EngineMessages.WriteCommand(_output, _scratch,
+                    new CommandMessage(requestId, command, argument)), cancellationToken).ConfigureAwait(false);
+
+                return await completion.Task.WaitAsync(cancellationToken).ConfigureAwait(false);
+            }
+            finally
+            {
+                _pendingCommands.TryRemove(requestId, out _);
+            }
+        }
+
+        private async Task WriteAsync(Action build, CancellationToken cancellationToken)
+        {
+            await _writeLock.WaitAsync(cancellationToken).ConfigureAwait(false);
+            try
+            {
+                _output.Reset();
+                build();
+                await _pipe!.WriteAsync(_output.WrittenMemory, cancellationToken).ConfigureAwait(false);
+            }
+            finally
+            {
+                _writeLock.Release();
+            }
+        }
+
+        private async Task ReadLoopAsync(Stream pipe, CancellationToken token)
+        {
+            var reader = new FrameStreamReader(pipe);
+            var entries = new List<StateEntry>();
+            string reason = "Engine closed the connection";
+
+            try
+            {
+                while (await reader.ReadFrameAsync(token).ConfigureAwait(false))
+                {
+                    if (!HandleFrame(reader.CurrentType, reader.CurrentPayload.Span, entries, ref reason))
+                        return;
+                }
+            }
+            catch (OperationCanceledException)
+            {
+                reason = "Client disposed";
+            }
+            catch (Exception ex) when (ex is IOException || ex is InvalidDataException || ex is FormatException)
+            {
+                reason = ex.Message;
+            }
+            finally
+            {
+                var error = new IOException(reason);
+                _welcome?.TrySetException(error);
+                foreach (var pending in _pendingCommands.Values)
+                {
+                    pending.TrySetException(error);
+                }
+
+                Disconnected?.Invoke(this, reason);
+            }
+        }
+
+        /// <summary>
+        /// Returns false when the engine said Goodbye.
+        /// </summary>
+        private bool HandleFrame(FrameType type, ReadOnlySpan<byte> payload, List<StateEntry> entries, ref string reason)
+        {
+            switch (type)
+            {
+                case FrameType.Welcome:
+                    EngineMessages.ReadWelcome(payload);
+                    _welcome?.TrySetResult(true);
+                    break;
+
+                case FrameType.StateSnapshot:
+                case FrameType.StateBatch:
+                    entries.Clear();
+                    EngineMessages.ReadState(payload, entries);
+                    State.SetMany(entries);
+                    StateReceived?.Invoke(this, entries.ToArray());
+                    break;
+
+                case FrameType.CommandResult:
+                    var result = EngineMessages.ReadCommandResult(payload);
+                    if (_pendingCommands.TryGetValue(result.RequestId, out var completion))
+                    {
+                        completion.TrySetResult(result);
+                    }
+                    break;
+
+                case FrameType.Goodbye:
+                    reason = EngineMessages.ReadGoodbye(payload);
+                    return false;
+            }
+            return true;
+        }
+
+        public void Dispose()
+        {
+            if (_disposed) return;
+            _disposed = true;
+
+            if (IsConnected)
+            {
+                try
+                {
+                    WriteAsync(() => EngineMessages.WriteGoodbye(_output, _scratch, "Client disposed"), CancellationToken.None)
+                        .Wait(TimeSpan.FromMilliseconds(250));
+                }
+                catch
+                {
+                }
+            }
+
+            _cts.Cancel();
+            _pipe?.Dispose();
+            try { _readTask?.Wait(TimeSpan.FromSeconds(1)); } catch { }
+            _cts.Dispose();
+        }
+    }
+}
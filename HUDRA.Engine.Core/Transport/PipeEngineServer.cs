@@ -0,0 +1,206 @@
+using HUDRA.Engine.Protocol;
+using HUDRA.Engine.State;
+using System;
+using System.Diagnostics;
+using System.IO;
+using System.IO.Pipes;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace HUDRA.Engine.Transport
+{
+    /// <summary>
+    /// Serves an <see cref="EngineStateStore"/> over a local named pipe. Each client gets its own
+    /// <see cref="EngineSession"/>; state changes are coalesced for <see cref="FlushInterval"/>
+    /// and sent as one StateBatch frame.
+    /// </summary>
+    public sealed class PipeEngineServer : IDisposable
+    {
+        private readonly EngineStateStore _store;
+        private readonly IEngineCommandHandler _commandHandler;
+        private readonly string _pipeName;
+        private readonly CancellationTokenSource _cts = new();
+        private Task? _acceptTask;
+        private int _clientCount;
+        private bool _disposed;
+
+        public TimeSpan FlushInterval { get; init; } = TimeSpan.FromMilliseconds(50);
+        public int MaxClients { get; init; } = 4;
+        public int ClientCount => Volatile.Read(ref _clientCount);
+
+        public event EventHandler<string>? ClientConnected;
+        public event EventHandler<string>? ClientDisconnected;
+
+        public PipeEngineServer(EngineStateStore store, IEngineCommandHandler commandHandler, string pipeName = EngineProtocol.PipeName)
+        {
+            _store = store;
+            _commandHandler = commandHandler;
+            _pipeName = pipeName;
+        }
+
+        public void Start()
+        {
+            if (_acceptTask != null) return;
+            _acceptTask = Task.Run(() => AcceptLoopAsync(_cts.Token));
+        }
+
+        private async Task AcceptLoopAsync(CancellationToken cancellationToken)
+        {
+            while (!cancellationToken.IsCancellationRequested)
+            {
+                NamedPipeServerStream? pipe = null;
+                try
+                {
+                    // CurrentUserOnly: another user on the machine can't drive TDP or fans
+                    pipe = new NamedPipeServerStream(
+                        _pipeName,
+                        PipeDirection.InOut,
+                        MaxClients,
+                        PipeTransmissionMode.Byte,
+                        PipeOptions.Asynchronous | PipeOptions.CurrentUserOnly);
+
+                    await pipe.WaitForConnectionAsync(cancellationToken).ConfigureAwait(false);
+
+                    var connected = pipe;
+                    pipe = null;
+                    _ = Task.Run(() => RunClientAsync(connected, cancellationToken));
+                }
+                catch (OperationCanceledException)
+                {
+                    break;
+                }
+                catch (IOException ex)
+                {
+                    // All instances busy - wait for a slot
+                    Debug.WriteLine($"Engine pipe accept failed: {ex.Message}");
+                    try { await Task.Delay(500, cancellationToken).ConfigureAwait(false); }
+                    catch (OperationCanceledException) { break; }
+                }
+                finally
+                {
+                    pipe?.Dispose();
+                }
+            }
+        }
+
+        private async Task RunClientAsync(NamedPipeServerStream pipe, CancellationToken serverToken)
+        {
+            Interlocked.Increment(ref _clientCount);
+            using var clientCts = CancellationTokenSource.CreateLinkedTokenSource(serverToken);
+            var token = clientCts.Token;
+
+            var session = new EngineSession(_store, _commandHandler);
+            var writeLock = new SemaphoreSlim(1, 1);
+            var flushSignal = new SemaphoreSlim(0, 1);
+
+            void OnStoreChanged(object? sender, EventArgs e)
+            {
+                // At most one pending signal - the flush picks up everything newer anyway
+                if (flushSignal.CurrentCount == 0)
+                {
+                    try { flushSignal.Release(); } catch (SemaphoreFullException) { }
+                }
+            }
+
+            _store.Changed += OnStoreChanged;
+            var flushTask = FlushLoopAsync(pipe, session, writeLock, flushSignal, token);
+
+            try
+            {
+                var reader = new FrameStreamReader(pipe);
+                var output = new PayloadWriter();
+
+                while (session.State != EngineSessionState.Closed &&
+                       await reader.ReadFrameAsync(token).ConfigureAwait(false))
+                {
+                    await writeLock.WaitAsync(token).ConfigureAwait(false);
+                    try
+                    {
+                        output.Reset();
+                        session.HandleFrame(reader.CurrentType, reader.CurrentPayload.Span, output);
+                        if (output.Length > 0)
+                        {
+                            await pipe.WriteAsync(output.WrittenMemory, token).ConfigureAwait(false);
+                        }
+                    }
+                    finally
+                    {
+                        writeLock.Release();
+                    }
+
+                    if (session.State == EngineSessionState.Ready && reader.CurrentType == FrameType.Hello)
+                    {
+                        ClientConnected?.Invoke(this, session.ClientName);
+                    }
+                }
+            }
+            catch (OperationCanceledException)
+            {
+            }
+            catch (Exception ex) when (ex is IOException || ex is InvalidDataException || ex is ObjectDisposedException)
+            {
+                Debug.WriteLine($"Engine client '{session.ClientName}' dropped: {ex.Message}");
+            }
+            finally
+            {
+                _store.Changed -= OnStoreChanged;
+                session.Close(null, session.CloseReason ?? "Disconnected");
+                clientCts.Cancel();
+
+                try { await flushTask.ConfigureAwait(false); } catch { }
+
+                pipe.Dispose();
+                Interlocked.Decrement(ref _clientCount);
+                ClientDisconnected?.Invoke(this, session.ClientName);
+            }
+        }
+
+        private async Task FlushLoopAsync(
+            Stream pipe, EngineSession session, SemaphoreSlim writeLock, SemaphoreSlim flushSignal, CancellationToken token)
+        {
+            var output = new PayloadWriter();
+
+            try
+            {
+                while (!token.IsCancellationRequested && session.State != EngineSessionState.Closed)
+                {
+                    await flushSignal.WaitAsync(token).ConfigureAwait(false);
+
+                    // Coalescing window: later writes in this window ride along in the same batch
+                    await Task.Delay(FlushInterval, token).ConfigureAwait(false);
+
+                    await writeLock.WaitAsync(token).ConfigureAwait(false);
+                    try
+                    {
+                        output.Reset();
+                        if (session.Flush(output))
+                        {
+                            await pipe.WriteAsync(output.WrittenMemory, token).ConfigureAwait(false);
+                        }
+                    }
+                    finally
+                    {
+                        writeLock.Release();
+                    }
+                }
+            }
+            catch (OperationCanceledException)
+            {
+            }
+            catch (IOException)
+            {
+                // Reader side notices the broken pipe and cleans up
+            }
+        }
+
+        public void Dispose()
+        {
+            if (_disposed) return;
+            _disposed = true;
+
+            _cts.Cancel();
+            try { _acceptTask?.Wait(TimeSpan.FromSeconds(2)); } catch { }
+            _cts.Dispose();
+        }
+    }
+}
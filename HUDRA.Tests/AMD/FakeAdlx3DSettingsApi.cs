@@ -0,0 +1,75 @@
+using HUDRA.Models;
+using HUDRA.Services.AMD;
+
+namespace HUDRA.Tests.AMD
+{
+    /// <summary>
+    /// A driver holding global Chill, Boost and Image Sharpening. A null feature is unsupported: reads and
+    /// writes fail. A failing Chill write lands the minimum FPS and then fails, as a multi-call ADLX write can.
+    /// </summary>
+    internal sealed class FakeAdlx3DSettingsApi : IAdlx3DSettingsApi
+    {
+        public RadeonChillState? Chill { get; set; }
+        public bool? Boost { get; set; }
+        public RadeonSharpeningState? Sharpening { get; set; }
+
+        public bool FailChill { get; set; }
+        public int ChillWrites { get; private set; }
+        public int BoostWrites { get; private set; }
+        public int SharpeningWrites { get; private set; }
+
+        public bool TryGetChill(out RadeonChillState state)
+        {
+            state = Chill ?? default;
+            return Chill.HasValue;
+        }
+
+        public bool TrySetChill(RadeonChillState state)
+        {
+            if (Chill == null)
+                return false;
+
+            ChillWrites++;
+            if (FailChill)
+            {
+                Chill = Chill.Value with { MinFps = state.MinFps };
+                return false;
+            }
+
+            Chill = state;
+            return true;
+        }
+
+        public bool TryGetBoost(out bool enabled)
+        {
+            enabled = Boost ?? false;
+            return Boost.HasValue;
+        }
+
+        public bool TrySetBoost(bool enabled)
+        {
+            if (Boost == null)
+                return false;
+
+            BoostWrites++;
+            Boost = enabled;
+            return true;
+        }
+
+        public bool TryGetImageSharpening(out RadeonSharpeningState state)
+        {
+            state = Sharpening ?? default;
+            return Sharpening.HasValue;
+        }
+
+        public bool TrySetImageSharpening(RadeonSharpeningState state)
+        {
+            if (Sharpening == null)
+                return false;
+
+            SharpeningWrites++;
+            Sharpening = state;
+            return true;
+        }
+    }
+}
@@ -0,0 +1,113 @@
+using HUDRA.Models;
+using HUDRA.Services.AMD;
+using System.Text.Json;
+using Xunit;
+
+namespace HUDRA.Tests.AMD
+{
+    public class Radeon3DSettingsPolicyTests
+    {
+        private static readonly Radeon3DSettingsSnapshot Current = new()
+        {
+            Chill = new RadeonChillState(false, 30, 60),
+            BoostEnabled = false,
+            ImageSharpening = new RadeonSharpeningState(true, 50)
+        };
+
+        [Fact]
+        public void Resolve_DefaultProfileChangesNothing()
+        {
+            Assert.True(Radeon3DSettingsPolicy.Resolve(new GameProfile(), Current).IsEmpty);
+        }
+
+        [Fact]
+        public void Resolve_AllThreeFeatures()
+        {
+            var targets = Radeon3DSettingsPolicy.Resolve(new GameProfile
+            {
+                ChillEnabled = true, ChillMinFps = 40, ChillMaxFps = 60,
+                RadeonBoostEnabled = true,
+                ImageSharpeningEnabled = false
+            }, Current);
+
+            Assert.Equal(new RadeonChillState(true, 40, 60), targets.Chill);
+            Assert.True(targets.BoostEnabled);
+            // Off keeps the driver's sharpness for when it's turned back on there
+            Assert.Equal(new RadeonSharpeningState(false, 50), targets.ImageSharpening);
+        }
+
+        [Fact]
+        public void Resolve_SkipsFeaturesAlreadyAsRequested()
+        {
+            var targets = Radeon3DSettingsPolicy.Resolve(new GameProfile
+            {
+                ChillEnabled = false,
+                RadeonBoostEnabled = false,
+                ImageSharpeningEnabled = true, ImageSharpness = 50
+            }, Current);
+
+            Assert.True(targets.IsEmpty);
+        }
+
+        [Fact]
+        public void Resolve_OrdersChillRangeAndClampsSharpness()
+        {
+            var targets = Radeon3DSettingsPolicy.Resolve(new GameProfile
+            {
+                ChillEnabled = true, ChillMinFps = 90, ChillMaxFps = 45,
+                ImageSharpeningEnabled = true, ImageSharpness = 300
+            }, Current);
+
+            Assert.Equal(new RadeonChillState(true, 45, 90), targets.Chill);
+            Assert.Equal(new RadeonSharpeningState(true, 100), targets.ImageSharpening);
+        }
+
+        [Fact]
+        public void Resolve_UnsupportedFeaturesAreNotTargeted()
+        {
+            var targets = Radeon3DSettingsPolicy.Resolve(
+                new GameProfile { ChillEnabled = true, RadeonBoostEnabled = true, ImageSharpeningEnabled = true },
+                new Radeon3DSettingsSnapshot());
+
+            Assert.True(targets.IsEmpty);
+        }
+
+        [Fact]
+        public void ResolveRevert_TargetWinsForChangedFeaturesOnly()
+        {
+            var changed = new Radeon3DSettingsSnapshot { Chill = new RadeonChillState(false, 30, 60) };
+
+            var revert = Radeon3DSettingsPolicy.ResolveRevert(changed,
+                new Radeon3DSettingsSnapshot { Chill = new RadeonChillState(true, 30, 45), BoostEnabled = true });
+
+            Assert.Equal(new RadeonChillState(true, 30, 45), revert.Chill);
+            Assert.Null(revert.BoostEnabled);
+            Assert.Null(revert.ImageSharpening);
+        }
+
+        [Fact]
+        public void ResolveRevert_FallsBackToValueBeforeProfile()
+        {
+            var changed = new Radeon3DSettingsSnapshot { Chill = new RadeonChillState(false, 30, 60) };
+
+            Assert.Equal(changed.Chill, Radeon3DSettingsPolicy.ResolveRevert(changed, new Radeon3DSettingsSnapshot()).Chill);
+            Assert.Equal(changed.Chill, Radeon3DSettingsPolicy.ResolveRevert(changed, null).Chill);
+        }
+
+        [Fact]
+        public void Profile_RadeonSettingsCountAsConfigured()
+        {
+            var profile = new GameProfile { ChillEnabled = true, ChillMinFps = 30, ChillMaxFps = 45, RadeonBoostEnabled = true, ImageSharpeningEnabled = true };
+
+            Assert.True(profile.HasAnySettingsConfigured);
+            Assert.Equal("Chill 30-45 · Radeon Boost · Sharpening", profile.PerformanceLabel);
+
+            // Profiles saved before these settings existed
+            var old = JsonSerializer.Deserialize<GameProfile>("{\"HasProfile\":true}")!;
+            Assert.Null(old.ChillEnabled);
+            Assert.Equal(30, old.ChillMinFps);
+            Assert.Equal(80, old.ImageSharpness);
+            Assert.False(old.HasAnySettingsConfigured);
+        }
+    }
+}
@@ -0,0 +1,159 @@
+using HUDRA.Models;
+using HUDRA.Services.AMD;
+using System.Text.Json;
+using Xunit;
+
+namespace HUDRA.Tests.AMD
+{
+    public class Radeon3DSettingsServiceTests
+    {
+        private readonly FakeAdlx3DSettingsApi _adlx = new()
+        {
+            Chill = new RadeonChillState(false, 30, 60),
+            Boost = false,
+            Sharpening = new RadeonSharpeningState(true, 50)
+        };
+
+        private Radeon3DSettingsService Service() => new(_adlx);
+
+        [Fact]
+        public void Capture_ReadsEverySupportedFeature()
+        {
+            var snapshot = Service().Capture();
+
+            Assert.Equal(_adlx.Chill, snapshot.Chill);
+            Assert.False(snapshot.BoostEnabled);
+            Assert.Equal(_adlx.Sharpening, snapshot.ImageSharpening);
+
+            _adlx.Boost = null;
+            Assert.Null(Service().Capture().BoostEnabled);
+        }
+
+        [Fact]
+        public void Apply_WritesOnlyWhatChanges()
+        {
+            var result = Service().Apply(new GameProfile
+            {
+                ChillEnabled = true, ChillMinFps = 30, ChillMaxFps = 45,
+                RadeonBoostEnabled = false,
+                ImageSharpeningEnabled = true, ImageSharpness = 80
+            });
+
+            Assert.True(result.Success);
+            Assert.Equal("Chill 30-45 FPS, Sharpening 80%", result.Message);
+            Assert.Equal(new RadeonChillState(true, 30, 45), _adlx.Chill);
+            Assert.Equal(new RadeonSharpeningState(true, 80), _adlx.Sharpening);
+            Assert.Equal(0, _adlx.BoostWrites);
+
+            Assert.Equal(new RadeonChillState(false, 30, 60), result.Restore!.Chill);
+            Assert.Null(result.Restore.BoostEnabled);
+            Assert.Equal(new RadeonSharpeningState(true, 50), result.Restore.ImageSharpening);
+        }
+
+        [Fact]
+        public void Apply_AlreadySetHasNothingToRestore()
+        {
+            var result = Service().Apply(new GameProfile { ChillEnabled = false, RadeonBoostEnabled = false });
+
+            Assert.True(result.Success);
+            Assert.Null(result.Restore);
+            Assert.Equal("Already set", result.Message);
+        }
+
+        [Fact]
+        public void Revert_LeavesFeaturesTheProfileDidNotTouch()
+        {
+            var service = Service();
+            var captured = service.Capture();
+            var result = service.Apply(new GameProfile { ChillEnabled = true, ChillMinFps = 30, ChillMaxFps = 45, ImageSharpeningEnabled = false });
+
+            // Boost turned on in Adrenalin mid-game
+            _adlx.Boost = true;
+            Assert.True(service.Restore(Radeon3DSettingsPolicy.ResolveRevert(result.Restore!, captured)));
+
+            Assert.Equal(new RadeonChillState(false, 30, 60), _adlx.Chill);
+            Assert.Equal(new RadeonSharpeningState(true, 50), _adlx.Sharpening);
+            Assert.True(_adlx.Boost);
+            Assert.Equal(0, _adlx.BoostWrites);
+        }
+
+        [Fact]
+        public void Revert_SavedDefaultProfileWins()
+        {
+            var service = Service();
+            var result = service.Apply(new GameProfile { ChillEnabled = true });
+
+            service.Restore(Radeon3DSettingsPolicy.ResolveRevert(result.Restore!,
+                new Radeon3DSettingsSnapshot { Chill = new RadeonChillState(true, 40, 60) }));
+
+            Assert.Equal(new RadeonChillState(true, 40, 60), _adlx.Chill);
+        }
+
+        [Fact]
+        public void Apply_FailedWriteIsStillRestorable()
+        {
+            _adlx.Boost = null;
+            _adlx.Sharpening = new RadeonSharpeningState(false, 50);
+            _adlx.FailChill = true;
+            var service = Service();
+
+            var result = service.Apply(new GameProfile
+            {
+                ChillEnabled = true, ChillMinFps = 40, ChillMaxFps = 60,
+                RadeonBoostEnabled = true,
+                ImageSharpeningEnabled = true, ImageSharpness = 60
+            });
+
+            Assert.False(result.Success);
+            Assert.Equal("Failed: Boost unsupported, Chill", result.Message);
+            Assert.Equal(new RadeonChillState(false, 40, 60), _adlx.Chill);
+            Assert.Equal(new RadeonChillState(false, 30, 60), result.Restore!.Chill);
+            Assert.Equal(new RadeonSharpeningState(false, 50), result.Restore.ImageSharpening);
+            Assert.Null(result.Restore.BoostEnabled);
+
+            _adlx.FailChill = false;
+            Assert.True(service.Restore(result.Restore));
+            Assert.Equal(new RadeonChillState(false, 30, 60), _adlx.Chill);
+            Assert.Equal(new RadeonSharpeningState(false, 50), _adlx.Sharpening);
+        }
+
+        [Fact]
+        public void Restore_ReportsFeaturesItCouldNotWrite()
+        {
+            var service = Service();
+            var result = service.Apply(new GameProfile { ChillEnabled = true, RadeonBoostEnabled = true });
+            _adlx.FailChill = true;
+
+            Assert.False(service.Restore(result.Restore!));
+            // Boost is still written back
+            Assert.False(_adlx.Boost);
+        }
+
+        [Fact]
+        public void NoAmdDriver_CapturesNothingAndFailsApply()
+        {
+            var service = new Radeon3DSettingsService(new FakeAdlx3DSettingsApi());
+
+            Assert.True(service.Capture().IsEmpty);
+            var result = service.Apply(new GameProfile { RadeonBoostEnabled = true });
+            Assert.False(result.Success);
+            Assert.Null(result.Restore);
+            Assert.Equal("Failed: Boost unsupported", result.Message);
+        }
+
+        [Fact]
+        public void SavedDefaults_RoundTripRadeonSettings()
+        {
+            var captured = Service().Capture();
+
+            var json = JsonSerializer.Serialize(new SystemDefaults { Radeon3DSettings = captured });
+            var back = JsonSerializer.Deserialize<SystemDefaults>(json)!.Radeon3DSettings!;
+
+            Assert.Equal(captured.Chill, back.Chill);
+            Assert.False(back.BoostEnabled);
+            Assert.Equal(captured.ImageSharpening, back.ImageSharpening);
+            Assert.DoesNotContain("IsEmpty", json);
+            Assert.Null(JsonSerializer.Deserialize<SystemDefaults>("{\"RsrEnabled\":true}")!.Radeon3DSettings);
+        }
+    }
+}
@@ -0,0 +1,154 @@
+using HUDRA.Services;
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using System.Net;
+using System.Net.Http;
+using System.Threading;
+using System.Threading.Tasks;
+using Xunit;
+
+namespace HUDRA.Tests.Artwork
+{
+    public sealed class ArtworkPreviewDownloaderTests : IDisposable
+    {
+        private readonly string _directory = Directory.CreateTempSubdirectory("hudra-artdl-").FullName;
+
+        public void Dispose()
+        {
+            try { Directory.Delete(_directory, recursive: true); } catch { }
+        }
+
+        private List<ArtworkDownload> Downloads(int count) =>
+            Enumerable.Range(0, count)
+                .Select(i => new ArtworkDownload(i, FakeImageHandler.UrlFor(i), Path.Combine(_directory, $"{i}.png")))
+                .ToList();
+
+        [Fact]
+        public async Task YieldsInCompletionOrder()
+        {
+            var handler = new FakeImageHandler();
+            var downloader = new ArtworkPreviewDownloader(new HttpClient(handler), maxConcurrency: 4);
+            var order = new List<int>();
+
+            await using var results = downloader.DownloadAsync(Downloads(4)).GetAsyncEnumerator();
+            foreach (int next in new[] { 2, 0, 3, 1 })
+            {
+                handler.Release(next);
+                Assert.True(await results.MoveNextAsync());
+                order.Add(results.Current.Index);
+                Assert.True(File.Exists(results.Current.FilePath));
+            }
+            Assert.False(await results.MoveNextAsync());
+
+            Assert.Equal(new[] { 2, 0, 3, 1 }, order);
+        }
+
+        [Fact]
+        public async Task FirstPreviewDoesNotWaitForSlowerImages()
+        {
+            // The last tile is the fastest; with bounded concurrency it still starts in the first wave
+            var handler = new FakeImageHandler(i => TimeSpan.FromMilliseconds(i == 3 ? 20 : 600));
+            var downloader = new ArtworkPreviewDownloader(new HttpClient(handler), maxConcurrency: 4);
+
+            var first = -1;
+            await foreach (var result in downloader.DownloadAsync(Downloads(4)))
+            {
+                if (first < 0) first = result.Index;
+            }
+
+            Assert.Equal(3, first);
+            Assert.True(downloader.LastTimeToFirstResult < downloader.LastTotalTime);
+            Assert.True(downloader.LastTimeToFirstResult < TimeSpan.FromMilliseconds(500));
+        }
+
+        [Fact]
+        public async Task ConcurrencyIsBounded()
+        {
+            var handler = new FakeImageHandler(_ => TimeSpan.FromMilliseconds(30));
+            var downloader = new ArtworkPreviewDownloader(new HttpClient(handler), maxConcurrency: 2);
+
+            int count = 0;
+            await foreach (var _ in downloader.DownloadAsync(Downloads(8)))
+                count++;
+
+            Assert.Equal(8, count);
+            Assert.InRange(handler.MaxInFlight, 1, 2);
+        }
+
+        [Fact]
+        public async Task FailedDownloadsAreSkippedAndLeaveNoFile()
+        {
+            var handler = new FakeImageHandler();
+            handler.Failures[1] = HttpStatusCode.NotFound;
+            handler.ReleaseAll(3);
+            var downloader = new ArtworkPreviewDownloader(new HttpClient(handler));
+
+            var indices = new List<int>();
+            await foreach (var result in downloader.DownloadAsync(Downloads(3)))
+                indices.Add(result.Index);
+
+            Assert.Equal(new[] { 0, 2 }, indices.OrderBy(i => i));
+            Assert.False(File.Exists(Path.Combine(_directory, "1.png")));
+        }
+
+        [Fact]
+        public async Task StoppingEarlyDeletesUnclaimedFiles()
+        {
+            var handler = new FakeImageHandler();
+            var downloader = new ArtworkPreviewDownloader(new HttpClient(handler), maxConcurrency: 4);
+            handler.Release(0);
+            handler.Release(1);
+
+            string? kept = null;
+            await foreach (var result in downloader.DownloadAsync(Downloads(4)))
+            {
+                kept = result.FilePath;
+                break;
+            }
+
+            // The first result is the caller's; the other finished one and the two cancelled ones are gone
+            Assert.Equal(new[] { kept }, Directory.GetFiles(_directory));
+        }
+
+        [Fact]
+        public async Task CancellationThrowsAndLeavesNoFiles()
+        {
+            var handler = new FakeImageHandler();
+            var downloader = new ArtworkPreviewDownloader(new HttpClient(handler));
+            using var cts = new CancellationTokenSource();
+
+            var enumeration = Task.Run(async () =>
+            {
+                await foreach (var _ in downloader.DownloadAsync(Downloads(3), cts.Token))
+                {
+                }
+            });
+            cts.Cancel();
+
+            await Assert.ThrowsAnyAsync<OperationCanceledException>(() => enumeration);
+            Assert.Empty(Directory.GetFiles(_directory));
+            Assert.Null(downloader.LastTotalTime);
+        }
+
+        [Fact]
+        public async Task EmptyListYieldsNothing()
+        {
+            var handler = new FakeImageHandler();
+            var downloader = new ArtworkPreviewDownloader(new HttpClient(handler));
+
+            await foreach (var _ in downloader.DownloadAsync(Array.Empty<ArtworkDownload>()))
+                Assert.Fail("Nothing to download");
+
+            Assert.Equal(0, handler.Requests);
+            Assert.Null(downloader.LastTimeToFirstResult);
+        }
+
+        [Fact]
+        public void RejectsNonPositiveConcurrency()
+        {
+            Assert.Throws<ArgumentOutOfRangeException>(() => new ArtworkPreviewDownloader(new HttpClient(), 0));
+        }
+    }
+}
@@ -0,0 +1,84 @@
+using System;
+using System.Collections.Concurrent;
+using System.Net;
+using System.Net.Http;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace HUDRA.Tests.Artwork
+{
+    /// <summary>
+    /// Stands in for the SteamGridDB CDN. Each "/{index}.png" request waits until the test releases that
+    /// index (or its fixed latency elapses), then answers with a small body or the configured failure status.
+    /// </summary>
+    internal sealed class FakeImageHandler : HttpMessageHandler
+    {
+        private readonly ConcurrentDictionary<int, TaskCompletionSource> _gates = new();
+        private readonly Func<int, TimeSpan>? _latency;
+        private int _inFlight;
+        private int _maxInFlight;
+
+        public const int BodyLength = 4096;
+
+        public ConcurrentDictionary<int, HttpStatusCode> Failures { get; } = new();
+        public int MaxInFlight => Volatile.Read(ref _maxInFlight);
+        public int Requests;
+
+        /// <summary>
+        /// Gated mode: every request waits for <see cref="Release"/>.
+        /// </summary>
+        public FakeImageHandler()
+        {
+        }
+
+        /// <summary>
+        /// Latency mode: each request takes a fixed, index-dependent time.
+        /// </summary>
+        public FakeImageHandler(Func<int, TimeSpan> latency)
+        {
+            _latency = latency;
+        }
+
+        public static Uri UrlFor(int index) => new($"https://cdn.example.test/{index}.png");
+
+        public void Release(int index) => Gate(index).TrySetResult();
+
+        public void ReleaseAll(int count)
+        {
+            for (int i = 0; i < count; i++) Release(i);
+        }
+
+        private TaskCompletionSource Gate(int index) =>
+            _gates.GetOrAdd(index, _ => new TaskCompletionSource(TaskCreationOptions.RunContinuationsAsynchronously));
+
+        protected override async Task<HttpResponseMessage> SendAsync(HttpRequestMessage request, CancellationToken cancellationToken)
+        {
+            Interlocked.Increment(ref Requests);
+            int index = int.Parse(request.RequestUri!.Segments[^1].Split('.')[0]);
+
+            int inFlight = Interlocked.Increment(ref _inFlight);
+            int max;
+            while (inFlight > (max = Volatile.Read(ref _maxInFlight)) &&
+                   Interlocked.CompareExchange(ref _maxInFlight, inFlight, max) != max)
+            {
+            }
+
+            try
+            {
+                if (_latency != null)
+                    await Task.Delay(_latency(index), cancellationToken);
+                else
+                    await Gate(index).Task.WaitAsync(cancellationToken);
+            }
+            finally
+            {
+                Interlocked.Decrement(ref _inFlight);
+            }
+
+            if (Failures.TryGetValue(index, out var status))
+                return new HttpResponseMessage(status);
+
+            return new HttpResponseMessage(HttpStatusCode.OK) { Content = new ByteArrayContent(new byte[BodyLength]) };
+        }
+    }
+}
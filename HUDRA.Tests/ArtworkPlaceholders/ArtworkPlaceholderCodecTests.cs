@@ -0,0 +1,270 @@
+using HUDRA.Services.ArtworkPlaceholders;
+using System;
+using System.Linq;
+using Xunit;
+
+namespace HUDRA.Tests.ArtworkPlaceholders
+{
+    public class ArtworkPlaceholderCodecTests
+    {
+        // Sample size UpdateAsync decodes a 460x215 Steam header to
+        private const int Width = 32;
+        private const int Height = 15;
+
+        private static byte[] Solid(int width, int height, byte r, byte g, byte b, byte a = 255)
+        {
+            var pixels = new byte[width * height * 4];
+            for (int p = 0; p < pixels.Length; p += 4)
+            {
+                pixels[p] = b;
+                pixels[p + 1] = g;
+                pixels[p + 2] = r;
+                pixels[p + 3] = a;
+            }
+            return pixels;
+        }
+
+        /// <summary>
+        /// Red on the left fading to blue on the right, dark at the top and bright at the bottom.
+        /// </summary>
+        private static byte[] Gradient(int width, int height)
+        {
+            var pixels = new byte[width * height * 4];
+            for (int y = 0; y < height; y++)
+            {
+                for (int x = 0; x < width; x++)
+                {
+                    int p = (y * width + x) * 4;
+                    float light = 0.25f + 0.75f * y / (height - 1);
+                    pixels[p] = (byte)(255 * light * x / (width - 1));
+                    pixels[p + 1] = 40;
+                    pixels[p + 2] = (byte)(255 * light * (width - 1 - x) / (width - 1));
+                    pixels[p + 3] = 255;
+                }
+            }
+            return pixels;
+        }
+
+        private static (int R, int G, int B) PixelAt(byte[] bgra, int width, int x, int y)
+        {
+            int p = (y * width + x) * 4;
+            return (bgra[p + 2], bgra[p + 1], bgra[p]);
+        }
+
+        [Fact]
+        public void Encode_SolidColorStoresExactDc()
+        {
+            var hash = ArtworkPlaceholderCodec.Encode(Solid(Width, Height, 255, 0, 0), Width, Height, Width * 4);
+
+            // Size flag 3 + 2*9, then the DC 0xFF0000. The basis isn't zero-sum over the pixel grid, so the
+            // AC terms aren't all at the midpoint even for a flat image
+            Assert.StartsWith("L", hash);
+            Assert.Equal("TI:j", hash.Substring(2, 4));
+            Assert.Equal(hash, ArtworkPlaceholderCodec.Encode(Solid(Width, Height, 255, 0, 0), Width, Height, Width * 4));
+        }
+
+        [Fact]
+        public void Encode_SingleComponentIsAverageColor()
+        {
+            var hash = ArtworkPlaceholderCodec.Encode(Solid(Width, Height, 255, 0, 0), Width, Height, Width * 4, 1, 1);
+
+            Assert.Equal("00TI:j", hash);
+        }
+
+        [Theory]
+        [InlineData(1, 1)]
+        [InlineData(4, 3)]
+        [InlineData(9, 9)]
+        public void Encode_LengthMatchesComponentCount(int componentsX, int componentsY)
+        {
+            var hash = ArtworkPlaceholderCodec.Encode(Gradient(Width, Height), Width, Height, Width * 4, componentsX, componentsY);
+
+            Assert.Equal(ArtworkPlaceholderCodec.GetEncodedLength(componentsX, componentsY), hash.Length);
+            Assert.True(ArtworkPlaceholderCodec.IsValid(hash));
+        }
+
+        [Fact]
+        public void Encode_IgnoresStridePadding()
+        {
+            var tight = Gradient(Width, Height);
+            int stride = Width * 4 + 12;
+            var padded = new byte[stride * Height];
+            new Random(88).NextBytes(padded);
+            for (int y = 0; y < Height; y++)
+                tight.AsSpan(y * Width * 4, Width * 4).CopyTo(padded.AsSpan(y * stride));
+
+            Assert.Equal(
+                ArtworkPlaceholderCodec.Encode(tight, Width, Height, Width * 4),
+                ArtworkPlaceholderCodec.Encode(padded, Width, Height, stride));
+
+            // The last row needs no padding after it
+            Assert.Equal(
+                ArtworkPlaceholderCodec.Encode(tight, Width, Height, Width * 4),
+                ArtworkPlaceholderCodec.Encode(padded.AsSpan(0, stride * (Height - 1) + Width * 4), Width, Height, stride));
+        }
+
+        [Fact]
+        public void Encode_RejectsShortBufferAndBadComponents()
+        {
+            var pixels = Gradient(Width, Height);
+
+            Assert.Throws<ArgumentException>(() => ArtworkPlaceholderCodec.Encode(pixels.AsSpan(1), Width, Height, Width * 4));
+            Assert.Throws<ArgumentException>(() => ArtworkPlaceholderCodec.Encode(pixels, Width, Height, Width * 4 - 1));
+            Assert.Throws<ArgumentOutOfRangeException>(() => ArtworkPlaceholderCodec.Encode(pixels, Width, Height, Width * 4, 0, 3));
+            Assert.Throws<ArgumentOutOfRangeException>(() => ArtworkPlaceholderCodec.Encode(pixels, Width, Height, Width * 4, 4, 10));
+            Assert.Throws<ArgumentOutOfRangeException>(() => ArtworkPlaceholderCodec.Encode(pixels, 0, Height, Width * 4));
+        }
+
+        [Fact]
+        public void RoundTrip_SolidColorDecodesToSameColor()
+        {
+            var hash = ArtworkPlaceholderCodec.Encode(Solid(Width, Height, 27, 40, 56), Width, Height, Width * 4);
+            var decoded = new byte[32 * 21 * 4];
+
+            Assert.True(ArtworkPlaceholderCodec.TryDecode(hash, 32, 21, decoded));
+
+            Assert.All(Enumerable.Range(0, 32 * 21), i => Assert.Equal(255, decoded[i * 4 + 3]));
+            Assert.InRange(Enumerable.Range(0, 32 * 21).Average(i => (double)decoded[i * 4]), 54, 58);
+            Assert.InRange(Enumerable.Range(0, 32 * 21).Average(i => (double)decoded[i * 4 + 1]), 38, 42);
+            Assert.InRange(Enumerable.Range(0, 32 * 21).Average(i => (double)decoded[i * 4 + 2]), 25, 29);
+        }
+
+        [Fact]
+        public void RoundTrip_SingleComponentIsFlat()
+        {
+            var hash = ArtworkPlaceholderCodec.Encode(Gradient(Width, Height), Width, Height, Width * 4, 1, 1);
+            var decoded = new byte[8 * 4 * 4];
+
+            Assert.True(ArtworkPlaceholderCodec.TryDecode(hash, 8, 4, decoded));
+
+            Assert.All(Enumerable.Range(1, 31), i => Assert.Equal(decoded.AsSpan(0, 4).ToArray(), decoded.AsSpan(i * 4, 4).ToArray()));
+        }
+
+        [Fact]
+        public void RoundTrip_KeepsLayoutOfLightAndColor()
+        {
+            var source = Gradient(Width, Height);
+            var hash = ArtworkPlaceholderCodec.Encode(source, Width, Height, Width * 4);
+            var decoded = new byte[Width * Height * 4];
+
+            Assert.True(ArtworkPlaceholderCodec.TryDecode(hash, Width, Height, decoded));
+
+            var left = PixelAt(decoded, Width, 2, Height / 2);
+            var right = PixelAt(decoded, Width, Width - 3, Height / 2);
+            var top = PixelAt(decoded, Width, Width / 2, 1);
+            var bottom = PixelAt(decoded, Width, Width / 2, Height - 2);
+            Assert.True(left.R > right.R && left.B < right.B, $"left {left}, right {right}");
+            Assert.True(top.R + top.B < bottom.R + bottom.B, $"top {top}, bottom {bottom}");
+
+            // A blur, but no channel drifts far from the source on average
+            double error = Enumerable.Range(0, source.Length).Where(i => i % 4 != 3).Average(i => Math.Abs(source[i] - decoded[i]));
+            Assert.True(error < 12, $"mean error {error:F1}");
+        }
+
+        [Theory]
+        [InlineData((string?)null)]
+        [InlineData("")]
+        [InlineData("L0TI:")]
+        [InlineData("L0TI:jfQ")]                       // Size flag says 4x3, too short
+        [InlineData("00TI:jfQ")]                       // Size flag says 1x1, too long
+        [InlineData("L0TI:j\"QfQfQfQfQfQfQfQfQfQfQ")] // Not a base-83 character
+        [InlineData("L0TI:jéQfQfQfQfQfQfQfQfQfQfQ")]
+        public void IsValid_RejectsMalformedStrings(string? hash)
+        {
+            Assert.False(ArtworkPlaceholderCodec.IsValid(hash));
+            Assert.False(ArtworkPlaceholderCodec.TryDecode(hash, 4, 4, new byte[64]));
+        }
+
+        [Fact]
+        public void TryDecode_RejectsSmallBuffer()
+        {
+            var hash = ArtworkPlaceholderCodec.Encode(Gradient(Width, Height), Width, Height, Width * 4);
+
+            Assert.False(ArtworkPlaceholderCodec.TryDecode(hash, 32, 21, new byte[32 * 21 * 4 - 1]));
+            Assert.False(ArtworkPlaceholderCodec.TryDecode(hash, 0, 21, new byte[32 * 21 * 4]));
+        }
+
+        [Fact]
+        public void GetDominantColor_LargeFlatBackgroundWins()
+        {
+            // Dark blue background on 70% of the pixels, a busy foreground on the rest
+            var pixels = Solid(Width, Height, 20, 30, 90);
+            var random = new Random(7);
+            for (int p = 0; p < pixels.Length; p += 4)
+            {
+                if (random.NextDouble() < 0.3)
+                {
+                    pixels[p] = (byte)random.Next(256);
+                    pixels[p + 1] = (byte)random.Next(256);
+                    pixels[p + 2] = (byte)random.Next(256);
+                }
+            }
+
+            Assert.Equal(0x141E5A, ArtworkPlaceholderCodec.GetDominantColor(pixels, Width, Height, Width * 4));
+        }
+
+        [Fact]
+        public void GetDominantColor_AveragesWithinBin()
+        {
+            var pixels = Solid(2, 1, 0x40, 0x80, 0xC0);
+            pixels[4] = 0xC4;
+            pixels[5] = 0x84;
+            pixels[6] = 0x44;
+
+            Assert.Equal(0x4282C2, ArtworkPlaceholderCodec.GetDominantColor(pixels, 2, 1, 8));
+        }
+
+        [Fact]
+        public void GetDominantColor_IgnoresTransparentPixelsAndStridePadding()
+        {
+            int stride = Width * 4 + 8;
+            var pixels = new byte[stride * Height];
+            for (int y = 0; y < Height; y++)
+            {
+                for (int x = 0; x < Width; x++)
+                {
+                    int p = y * stride + x * 4;
+                    bool logo = x < 8;
+                    pixels[p] = logo ? (byte)200 : (byte)255;
+                    pixels[p + 1] = logo ? (byte)120 : (byte)255;
+                    pixels[p + 2] = logo ? (byte)10 : (byte)255;
+                    pixels[p + 3] = logo ? (byte)255 : (byte)20; // White but nearly transparent
+                }
+                pixels.AsSpan(y * stride + Width * 4, 8).Fill(0xFF); // Opaque white padding
+            }
+
+            Assert.Equal(0x0A78C8, ArtworkPlaceholderCodec.GetDominantColor(pixels, Width, Height, stride));
+            Assert.Equal(0, ArtworkPlaceholderCodec.GetDominantColor(Solid(4, 4, 255, 255, 255, 0), 4, 4, 16));
+        }
+
+        [Fact]
+        public void GetDominantColor_StartsEachCallFromAnEmptyHistogram()
+        {
+            // Three red pixels, then a single blue one: the reused histogram must not still hold the red
+            Assert.Equal(0xF00000, ArtworkPlaceholderCodec.GetDominantColor(Solid(3, 1, 0xF0, 0, 0), 3, 1, 12));
+            Assert.Equal(0x0000F0, ArtworkPlaceholderCodec.GetDominantColor(Solid(1, 1, 0, 0, 0xF0), 1, 1, 4));
+        }
+
+        [Fact]
+        public void GetDominantColor_RejectsImagesLargeEnoughToOverflowABin()
+        {
+            Assert.Throws<ArgumentOutOfRangeException>(() =>
+                ArtworkPlaceholderCodec.GetDominantColor(new byte[8], 2, int.MaxValue / 254, 8));
+        }
+
+        [Fact]
+        public void Colors_FormatAndParseRoundTrip()
+        {
+            Assert.Equal("#0A78C8", ArtworkPlaceholderCodec.FormatColor(0x0A78C8));
+            Assert.Equal("#0A78C8", ArtworkPlaceholderCodec.FormatColor(unchecked((int)0xFF0A78C8)));
+
+            Assert.True(ArtworkPlaceholderCodec.TryParseColor("#0a78c8", out byte r, out byte g, out byte b));
+            Assert.Equal((10, 120, 200), ((int)r, (int)g, (int)b));
+
+            Assert.False(ArtworkPlaceholderCodec.TryParseColor(null, out _, out _, out _));
+            Assert.False(ArtworkPlaceholderCodec.TryParseColor("0A78C8", out _, out _, out _));
+            Assert.False(ArtworkPlaceholderCodec.TryParseColor("#0A78C", out _, out _, out _));
+            Assert.False(ArtworkPlaceholderCodec.TryParseColor("#0A78CG", out _, out _, out _));
+        }
+    }
+}
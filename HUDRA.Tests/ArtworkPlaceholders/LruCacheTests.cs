@@ -0,0 +1,68 @@
+using HUDRA.Services.ArtworkPlaceholders;
+using System;
+using Xunit;
+
+namespace HUDRA.Tests.ArtworkPlaceholders
+{
+    public class LruCacheTests
+    {
+        [Fact]
+        public void EvictsLeastRecentlyUsedWhenFull()
+        {
+            var cache = new LruCache<string, int>(2);
+            cache.Set("a", 1);
+            cache.Set("b", 2);
+
+            Assert.True(cache.TryGetValue("a", out _)); // "b" is now least recent
+            cache.Set("c", 3);
+
+            Assert.Equal(2, cache.Count);
+            Assert.False(cache.TryGetValue("b", out _));
+            Assert.True(cache.TryGetValue("a", out int a));
+            Assert.True(cache.TryGetValue("c", out int c));
+            Assert.Equal((1, 3), (a, c));
+        }
+
+        [Fact]
+        public void SetExistingKeyReplacesWithoutEvicting()
+        {
+            var cache = new LruCache<string, int>(2);
+            cache.Set("a", 1);
+            cache.Set("b", 2);
+            cache.Set("a", 10);
+            cache.Set("c", 3); // Evicts "b", since "a" was just refreshed
+
+            Assert.Equal(2, cache.Count);
+            Assert.True(cache.TryGetValue("a", out int a));
+            Assert.Equal(10, a);
+            Assert.False(cache.TryGetValue("b", out _));
+        }
+
+        [Fact]
+        public void UsesComparerAndClears()
+        {
+            var cache = new LruCache<string, int>(4, StringComparer.OrdinalIgnoreCase);
+            cache.Set("Key", 1);
+
+            Assert.True(cache.TryGetValue("KEY", out _));
+
+            cache.Clear();
+            Assert.Equal(0, cache.Count);
+            Assert.False(cache.TryGetValue("Key", out _));
+        }
+
+        [Fact]
+        public void StaysAtCapacityUnderChurn()
+        {
+            var cache = new LruCache<int, int>(64);
+            for (int i = 0; i < 1000; i++)
+                cache.Set(i, i);
+
+            Assert.Equal(64, cache.Count);
+            Assert.True(cache.TryGetValue(999, out _));
+            Assert.True(cache.TryGetValue(936, out _));
+            Assert.False(cache.TryGetValue(935, out _));
+            Assert.Throws<ArgumentOutOfRangeException>(() => new LruCache<int, int>(0));
+        }
+    }
+}
@@ -0,0 +1,198 @@
+using HUDRA.Engine.Protocol;
+using HUDRA.Engine.State;
+using System;
+using System.Collections.Generic;
+using Xunit;
+
+namespace HUDRA.Tests.Engine
+{
+    public class EngineSessionTests
+    {
+        private sealed class RecordingHandler : IEngineCommandHandler
+        {
+            public List<(EngineCommand Command, StateValue Argument)> Calls { get; } = new();
+
+            public EngineCommandResult Execute(EngineCommand command, StateValue argument)
+            {
+                Calls.Add((command, argument));
+                return command switch
+                {
+                    EngineCommand.Ping => EngineCommandResult.Ok("pong"),
+                    EngineCommand.SetTdp when argument.AsInt64() > 30 => EngineCommandResult.Fail("TDP too high"),
+                    EngineCommand.SwitchToGame => throw new InvalidOperationException("No game running"),
+                    _ => EngineCommandResult.Ok()
+                };
+            }
+        }
+
+        private readonly EngineStateStore _store = new();
+        private readonly RecordingHandler _handler = new();
+        private readonly PayloadWriter _scratch = new();
+
+        private static List<(FrameType Type, byte[] Payload)> ReadFrames(PayloadWriter output)
+        {
+            var frames = new List<(FrameType, byte[])>();
+            var span = output.WrittenSpan;
+            while (span.Length > 0)
+            {
+                Assert.Equal(FrameReadStatus.Complete, FrameCodec.TryReadFrame(span, out var type, out int offset, out int length, out int frameLength));
+                frames.Add((type, span.Slice(offset, length).ToArray()));
+                span = span.Slice(frameLength);
+            }
+            output.Reset();
+            return frames;
+        }
+
+        private void Send(EngineSession session, PayloadWriter output, Action<PayloadWriter> write)
+        {
+            var frame = new PayloadWriter();
+            write(frame);
+            FrameCodec.TryReadFrame(frame.WrittenSpan, out var type, out int offset, out int length, out _);
+            session.HandleFrame(type, frame.WrittenSpan.Slice(offset, length), output);
+        }
+
+        private EngineSession Connect(PayloadWriter output)
+        {
+            var session = new EngineSession(_store, _handler);
+            Send(session, output, f => EngineMessages.WriteHello(f, _scratch, new HelloMessage(EngineProtocol.Version, "overlay")));
+            return session;
+        }
+
+        [Fact]
+        public void Hello_SendsWelcomeThenFullSnapshot()
+        {
+            _store.Set(StateKey.TdpTargetWatts, 15L);
+            _store.Set(StateKey.GameName, "Hollow Knight");
+            var output = new PayloadWriter();
+
+            var session = Connect(output);
+
+            Assert.Equal(EngineSessionState.Ready, session.State);
+            Assert.Equal("overlay", session.ClientName);
+            var frames = ReadFrames(output);
+            Assert.Equal(2, frames.Count);
+            Assert.Equal(FrameType.Welcome, frames[0].Type);
+            Assert.Equal(EngineProtocol.Version, EngineMessages.ReadWelcome(frames[0].Payload));
+            Assert.Equal(FrameType.StateSnapshot, frames[1].Type);
+
+            var snapshot = new List<StateEntry>();
+            EngineMessages.ReadState(frames[1].Payload, snapshot);
+            Assert.Equal(2, snapshot.Count);
+        }
+
+        [Fact]
+        public void WrongVersion_ClosesWithGoodbye()
+        {
+            var session = new EngineSession(_store, _handler);
+            var output = new PayloadWriter();
+
+            Send(session, output, f => EngineMessages.WriteHello(f, _scratch, new HelloMessage(EngineProtocol.Version + 1, "old")));
+
+            Assert.Equal(EngineSessionState.Closed, session.State);
+            var frame = Assert.Single(ReadFrames(output));
+            Assert.Equal(FrameType.Goodbye, frame.Type);
+            Assert.Contains("not supported", EngineMessages.ReadGoodbye(frame.Payload));
+        }
+
+        [Fact]
+        public void CommandBeforeHello_ClosesWithoutRunningIt()
+        {
+            var session = new EngineSession(_store, _handler);
+            var output = new PayloadWriter();
+
+            Send(session, output, f => EngineMessages.WriteCommand(f, _scratch, new CommandMessage(1, EngineCommand.SetTdp, StateValue.From(20L))));
+
+            Assert.Equal(EngineSessionState.Closed, session.State);
+            Assert.Empty(_handler.Calls);
+            Assert.Equal(FrameType.Goodbye, Assert.Single(ReadFrames(output)).Type);
+        }
+
+        [Fact]
+        public void Commands_ReturnResultsWithTheirRequestIds()
+        {
+            var output = new PayloadWriter();
+            var session = Connect(output);
+            ReadFrames(output);
+
+            Send(session, output, f => EngineMessages.WriteCommand(f, _scratch, new CommandMessage(11, EngineCommand.SetTdp, StateValue.From(18L))));
+            Send(session, output, f => EngineMessages.WriteCommand(f, _scratch, new CommandMessage(12, EngineCommand.SetTdp, StateValue.From(45L))));
+            Send(session, output, f => EngineMessages.WriteCommand(f, _scratch, new CommandMessage(13, EngineCommand.SwitchToGame, StateValue.None)));
+
+            var results = ReadFrames(output).ConvertAll(f => EngineMessages.ReadCommandResult(f.Payload));
+            Assert.Equal(new CommandResultMessage(11, true, ""), results[0]);
+            Assert.Equal(new CommandResultMessage(12, false, "TDP too high"), results[1]);
+            // A throwing handler is reported, not propagated
+            Assert.Equal(new CommandResultMessage(13, false, "No game running"), results[2]);
+            Assert.Equal(3, session.CommandsHandled);
+            Assert.Equal(StateValue.From(18L), _handler.Calls[0].Argument);
+        }
+
+        [Fact]
+        public void Flush_SendsOnlyChangesSinceLastBatch()
+        {
+            _store.Set(StateKey.FanRpm, 2800L);
+            var output = new PayloadWriter();
+            var session = Connect(output);
+            ReadFrames(output);
+
+            Assert.False(session.Flush(output));
+
+            for (int i = 0; i < 10; i++)
+                _store.Set(StateKey.GameFps, 55.0 + i);
+            _store.Set(StateKey.FanRpm, 2800L);
+
+            Assert.True(session.Flush(output));
+            var frame = Assert.Single(ReadFrames(output));
+            Assert.Equal(FrameType.StateBatch, frame.Type);
+            var batch = new List<StateEntry>();
+            EngineMessages.ReadState(frame.Payload, batch);
+            Assert.Equal(new[] { new StateEntry(StateKey.GameFps, StateValue.From(64.0)) }, batch);
+
+            Assert.False(session.Flush(output));
+            Assert.Equal(1, session.BatchesSent);
+        }
+
+        [Fact]
+        public void Flush_BeforeHandshake_SendsNothing()
+        {
+            _store.Set(StateKey.FanRpm, 2800L);
+            var session = new EngineSession(_store, _handler);
+            var output = new PayloadWriter();
+
+            Assert.False(session.Flush(output));
+            Assert.Equal(0, output.Length);
+        }
+
+        [Fact]
+        public void MalformedCommand_ClosesSession()
+        {
+            var output = new PayloadWriter();
+            var session = Connect(output);
+            ReadFrames(output);
+
+            session.HandleFrame(FrameType.Command, new byte[] { 0x05 }, output);
+
+            Assert.Equal(EngineSessionState.Closed, session.State);
+            Assert.StartsWith("Malformed Command frame", session.CloseReason);
+            Assert.Equal(FrameType.Goodbye, Assert.Single(ReadFrames(output)).Type);
+        }
+
+        [Fact]
+        public void ClientGoodbye_ClosesQuietly()
+        {
+            var output = new PayloadWriter();
+            var session = Connect(output);
+            ReadFrames(output);
+
+            Send(session, output, f => EngineMessages.WriteGoodbye(f, _scratch, "overlay closed"));
+
+            Assert.Equal(EngineSessionState.Closed, session.State);
+            Assert.Equal("overlay closed", session.CloseReason);
+            Assert.Equal(0, output.Length);
+
+            // Frames after close are ignored
+            Send(session, output, f => EngineMessages.WriteCommand(f, _scratch, new CommandMessage(1, EngineCommand.Ping, StateValue.None)));
+            Assert.Empty(_handler.Calls);
+        }
+    }
+}
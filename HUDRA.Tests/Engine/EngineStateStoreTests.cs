@@ -0,0 +1,125 @@
+using HUDRA.Engine.Protocol;
+using HUDRA.Engine.State;
+using System.Collections.Generic;
+using System.Linq;
+using System.Threading.Tasks;
+using Xunit;
+
+namespace HUDRA.Tests.Engine
+{
+    public class EngineStateStoreTests
+    {
+        [Fact]
+        public void RepeatedWrites_CoalesceToLatestValue()
+        {
+            var store = new EngineStateStore();
+            long since = store.CollectChanges(0, new List<StateEntry>());
+
+            for (int watts = 5; watts <= 15; watts++)
+                store.Set(StateKey.TdpTargetWatts, watts);
+            store.Set(StateKey.FanRpm, 3100L);
+
+            var changes = new List<StateEntry>();
+            store.CollectChanges(since, changes);
+
+            Assert.Equal(2, changes.Count);
+            Assert.Contains(new StateEntry(StateKey.TdpTargetWatts, StateValue.From(15L)), changes);
+            Assert.Contains(new StateEntry(StateKey.FanRpm, StateValue.From(3100L)), changes);
+        }
+
+        [Fact]
+        public void UnchangedWrite_DoesNotBumpVersionOrNotify()
+        {
+            var store = new EngineStateStore();
+            int notifications = 0;
+            store.Changed += (s, e) => notifications++;
+
+            Assert.True(store.Set(StateKey.BatteryPercent, 80L));
+            long version = store.Version;
+
+            Assert.False(store.Set(StateKey.BatteryPercent, 80L));
+            Assert.Equal(version, store.Version);
+            Assert.Equal(1, notifications);
+
+            // Same number as a different kind is a different value
+            Assert.True(store.Set(StateKey.BatteryPercent, 80.0));
+            Assert.Equal(2, notifications);
+        }
+
+        [Fact]
+        public void SetMany_NotifiesOnceAndCountsOnlyChanges()
+        {
+            var store = new EngineStateStore();
+            store.Set(StateKey.BatteryOnAc, true);
+            int notifications = 0;
+            store.Changed += (s, e) => notifications++;
+
+            int changed = store.SetMany(new[]
+            {
+                new StateEntry(StateKey.BatteryPercent, StateValue.From(55L)),
+                new StateEntry(StateKey.BatteryCharging, StateValue.From(true)),
+                new StateEntry(StateKey.BatteryOnAc, StateValue.From(true))
+            });
+
+            Assert.Equal(2, changed);
+            Assert.Equal(1, notifications);
+
+            Assert.Equal(0, store.SetMany(new[] { new StateEntry(StateKey.BatteryOnAc, StateValue.From(true)) }));
+            Assert.Equal(1, notifications);
+        }
+
+        [Fact]
+        public void CollectChanges_IsEmptyWhenUpToDate()
+        {
+            var store = new EngineStateStore();
+            store.Set(StateKey.GameName, "Balatro");
+            var changes = new List<StateEntry>();
+            long version = store.CollectChanges(0, changes);
+            changes.Clear();
+
+            Assert.Equal(version, store.CollectChanges(version, changes));
+            Assert.Empty(changes);
+        }
+
+        [Fact]
+        public void TwoReaders_EachSeeEveryChangeOnce()
+        {
+            var store = new EngineStateStore();
+            store.Set(StateKey.FanDutyPercent, 30.0);
+            long fast = store.CollectChanges(0, new List<StateEntry>());
+            long slow = fast;
+
+            store.Set(StateKey.FanDutyPercent, 35.0);
+            var fastChanges = new List<StateEntry>();
+            fast = store.CollectChanges(fast, fastChanges);
+
+            store.Set(StateKey.CpuTemperature, 71.5);
+            var slowChanges = new List<StateEntry>();
+            slow = store.CollectChanges(slow, slowChanges);
+
+            Assert.Single(fastChanges);
+            Assert.Equal(2, slowChanges.Count);
+            Assert.Equal(fast + 1, slow);
+        }
+
+        [Fact]
+        public async Task ConcurrentWriters_LeaveLatestValuePerKey()
+        {
+            var store = new EngineStateStore();
+            var keys = new[] { StateKey.TdpCurrentWatts, StateKey.FanRpm, StateKey.CpuTemperature, StateKey.GpuTemperature };
+
+            await Task.WhenAll(keys.Select(key => Task.Run(() =>
+            {
+                for (long i = 1; i <= 10000; i++)
+                    store.Set(key, i);
+            })));
+
+            var snapshot = new List<StateEntry>();
+            long version = store.CollectChanges(0, snapshot);
+
+            Assert.Equal(40000, version);
+            Assert.Equal(4, snapshot.Count);
+            Assert.All(snapshot, entry => Assert.Equal(10000L, entry.Value.AsInt64()));
+        }
+    }
+}
@@ -0,0 +1,182 @@
+using HUDRA.Engine.Protocol;
+using System;
+using System.Collections.Generic;
+using Xunit;
+
+namespace HUDRA.Tests.Engine
+{
+    public class FrameCodecTests
+    {
+        [Theory]
+        [InlineData(0UL, 1)]
+        [InlineData(1UL, 1)]
+        [InlineData(127UL, 1)]
+        [InlineData(128UL, 2)]
+        [InlineData(16383UL, 2)]
+        [InlineData(16384UL, 3)]
+        [InlineData(uint.MaxValue, 5)]
+        [InlineData(ulong.MaxValue, 10)]
+        public void VarUInt_RoundTripsWithLeb128Length(ulong value, int expectedLength)
+        {
+            var writer = new PayloadWriter();
+            writer.WriteVarUInt(value);
+
+            Assert.Equal(expectedLength, writer.Length);
+            var reader = new PayloadReader(writer.WrittenSpan);
+            Assert.Equal(value, reader.ReadVarUInt());
+            Assert.True(reader.IsAtEnd);
+        }
+
+        [Theory]
+        [InlineData(0L, 1)]
+        [InlineData(-1L, 1)]
+        [InlineData(63L, 1)]
+        [InlineData(-64L, 1)]
+        [InlineData(64L, 2)]
+        [InlineData(long.MaxValue, 10)]
+        [InlineData(long.MinValue, 10)]
+        public void VarInt_ZigZagKeepsSmallNegativesSmall(long value, int expectedLength)
+        {
+            var writer = new PayloadWriter();
+            writer.WriteVarInt(value);
+
+            Assert.Equal(expectedLength, writer.Length);
+            var reader = new PayloadReader(writer.WrittenSpan);
+            Assert.Equal(value, reader.ReadVarInt());
+        }
+
+        [Fact]
+        public void Values_RoundTripEveryKind()
+        {
+            var values = new[]
+            {
+                StateValue.None,
+                StateValue.From(-15L),
+                StateValue.From(17.25),
+                StateValue.From(double.NaN),
+                StateValue.From(true),
+                StateValue.From(false),
+                StateValue.From("Elden Ring™ – 日本語"),
+                StateValue.From("")
+            };
+
+            var writer = new PayloadWriter(16);
+            foreach (var value in values)
+                writer.WriteValue(value);
+
+            var reader = new PayloadReader(writer.WrittenSpan);
+            foreach (var value in values)
+                Assert.Equal(value, reader.ReadValue());
+            Assert.True(reader.IsAtEnd);
+        }
+
+        [Fact]
+        public void StateBatch_RoundTripsThroughFrame()
+        {
+            var entries = new List<StateEntry>
+            {
+                new(StateKey.TdpTargetWatts, StateValue.From(15L)),
+                new(StateKey.FanDutyPercent, StateValue.From(42.5)),
+                new(StateKey.BatteryCharging, StateValue.From(false)),
+                new(StateKey.GameName, StateValue.From("Hades II"))
+            };
+            var output = new PayloadWriter();
+            EngineMessages.WriteState(output, new PayloadWriter(), FrameType.StateBatch, entries);
+
+            var status = FrameCodec.TryReadFrame(output.WrittenSpan, out var type, out int offset, out int length, out int frameLength);
+
+            Assert.Equal(FrameReadStatus.Complete, status);
+            Assert.Equal(FrameType.StateBatch, type);
+            Assert.Equal(output.Length, frameLength);
+
+            var decoded = new List<StateEntry>();
+            EngineMessages.ReadState(output.WrittenSpan.Slice(offset, length), decoded);
+            Assert.Equal(entries, decoded);
+        }
+
+        [Fact]
+        public void CommandAndResult_RoundTrip()
+        {
+            var output = new PayloadWriter();
+            var scratch = new PayloadWriter();
+            EngineMessages.WriteCommand(output, scratch, new CommandMessage(7, EngineCommand.SetTdp, StateValue.From(18L)));
+            int commandLength = output.Length;
+            EngineMessages.WriteCommandResult(output, scratch, new CommandResultMessage(7, false, "TDP out of range"));
+
+            Assert.Equal(FrameReadStatus.Complete, FrameCodec.TryReadFrame(output.WrittenSpan, out var type, out int offset, out int length, out int frameLength));
+            Assert.Equal(FrameType.Command, type);
+            Assert.Equal(commandLength, frameLength);
+            Assert.Equal(new CommandMessage(7, EngineCommand.SetTdp, StateValue.From(18L)),
+                EngineMessages.ReadCommand(output.WrittenSpan.Slice(offset, length)));
+
+            var rest = output.WrittenSpan.Slice(frameLength);
+            Assert.Equal(FrameReadStatus.Complete, FrameCodec.TryReadFrame(rest, out type, out offset, out length, out _));
+            Assert.Equal(FrameType.CommandResult, type);
+            Assert.Equal(new CommandResultMessage(7, false, "TDP out of range"),
+                EngineMessages.ReadCommandResult(rest.Slice(offset, length)));
+        }
+
+        [Fact]
+        public void TruncatedFrame_NeedsMoreDataAtEveryCut()
+        {
+            var output = new PayloadWriter();
+            EngineMessages.WriteHello(output, new PayloadWriter(), new HelloMessage(EngineProtocol.Version, new string('x', 200)));
+            var frame = output.WrittenSpan.ToArray();
+
+            // The 200+ byte payload puts a two-byte varint in the header, so cuts land inside it too
+            for (int cut = 0; cut < frame.Length; cut++)
+            {
+                Assert.Equal(FrameReadStatus.NeedMoreData, FrameCodec.TryReadFrame(frame.AsSpan(0, cut), out _, out _, out _, out _));
+            }
+            Assert.Equal(FrameReadStatus.Complete, FrameCodec.TryReadFrame(frame, out _, out _, out _, out _));
+        }
+
+        [Fact]
+        public void UnknownFrameType_IsInvalid()
+        {
+            Assert.Equal(FrameReadStatus.Invalid, FrameCodec.TryReadFrame(new byte[] { 0x00, 0x00 }, out _, out _, out _, out _));
+            Assert.Equal(FrameReadStatus.Invalid, FrameCodec.TryReadFrame(new byte[] { 0x63, 0x01, 0x00 }, out _, out _, out _, out _));
+        }
+
+        [Fact]
+        public void OversizedOrOverlongLength_IsInvalid()
+        {
+            var output = new PayloadWriter();
+            output.WriteByte((byte)FrameType.StateBatch);
+            output.WriteVarUInt(EngineProtocol.MaxPayloadLength + 1);
+            Assert.Equal(FrameReadStatus.Invalid, FrameCodec.TryReadFrame(output.WrittenSpan, out _, out _, out _, out _));
+
+            // Six continuation bytes can't be a valid 32-bit length
+            var overlong = new byte[] { (byte)FrameType.StateBatch, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01 };
+            Assert.Equal(FrameReadStatus.Invalid, FrameCodec.TryReadFrame(overlong, out _, out _, out _, out _));
+        }
+
+        [Fact]
+        public void TruncatedPayload_ThrowsFormatException()
+        {
+            var output = new PayloadWriter();
+            EngineMessages.WriteState(output, new PayloadWriter(), FrameType.StateBatch, new List<StateEntry>
+            {
+                new(StateKey.GameName, StateValue.From("Celeste")),
+                new(StateKey.GameFps, StateValue.From(59.9))
+            });
+            FrameCodec.TryReadFrame(output.WrittenSpan, out _, out int offset, out int length, out _);
+            var payload = output.WrittenSpan.Slice(offset, length).ToArray();
+
+            for (int cut = 0; cut < payload.Length; cut++)
+            {
+                var truncated = payload.AsSpan(0, cut).ToArray();
+                Assert.Throws<FormatException>(() => EngineMessages.ReadState(truncated, new List<StateEntry>()));
+            }
+        }
+
+        [Fact]
+        public void StateCountLargerThanPayload_IsRejectedBeforeReading()
+        {
+            var payload = new PayloadWriter();
+            payload.WriteVarUInt(1_000_000);
+
+            Assert.Throws<FormatException>(() => EngineMessages.ReadState(payload.WrittenSpan.ToArray(), new List<StateEntry>()));
+        }
+    }
+}
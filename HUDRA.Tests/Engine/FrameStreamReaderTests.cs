@@ -0,0 +1,134 @@
+using HUDRA.Engine.Protocol;
+using HUDRA.Engine.Transport;
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Threading;
+using System.Threading.Tasks;
+using Xunit;
+
+namespace HUDRA.Tests.Engine
+{
+    public class FrameStreamReaderTests
+    {
+        /// <summary>
+        /// Hands out at most ChunkSize bytes per read, like a pipe delivering a frame in pieces.
+        /// </summary>
+        private sealed class ChunkedStream : MemoryStream
+        {
+            private readonly int _chunkSize;
+
+            public ChunkedStream(byte[] data, int chunkSize) : base(data)
+            {
+                _chunkSize = chunkSize;
+            }
+
+            public int Reads { get; private set; }
+
+            public override ValueTask<int> ReadAsync(Memory<byte> buffer, CancellationToken cancellationToken = default)
+            {
+                Reads++;
+                return base.ReadAsync(buffer.Slice(0, Math.Min(buffer.Length, _chunkSize)), cancellationToken);
+            }
+        }
+
+        private static byte[] BuildStream(out List<StateEntry> lastBatch)
+        {
+            var output = new PayloadWriter();
+            var scratch = new PayloadWriter();
+            EngineMessages.WriteHello(output, scratch, new HelloMessage(EngineProtocol.Version, "overlay"));
+
+            lastBatch = new List<StateEntry>();
+            for (int i = 0; i < 50; i++)
+            {
+                lastBatch = new List<StateEntry>
+                {
+                    new(StateKey.TdpCurrentWatts, StateValue.From(10.0 + i / 10.0)),
+                    new(StateKey.FanRpm, StateValue.From(2000L + i)),
+                    new(StateKey.GameName, StateValue.From(new string('g', i * 7)))
+                };
+                EngineMessages.WriteState(output, scratch, FrameType.StateBatch, lastBatch);
+            }
+
+            EngineMessages.WriteGoodbye(output, scratch, "done");
+            return output.WrittenSpan.ToArray();
+        }
+
+        [Theory]
+        [InlineData(1)]
+        [InlineData(2)]
+        [InlineData(3)]
+        [InlineData(7)]
+        [InlineData(64)]
+        [InlineData(100000)]
+        public async Task SplitReads_YieldTheSameFrames(int chunkSize)
+        {
+            var data = BuildStream(out var lastBatch);
+            var stream = new ChunkedStream(data, chunkSize);
+            var reader = new FrameStreamReader(stream, initialBufferSize: 16);
+            var types = new List<FrameType>();
+            var decoded = new List<StateEntry>();
+
+            while (await reader.ReadFrameAsync(CancellationToken.None))
+            {
+                types.Add(reader.CurrentType);
+                if (reader.CurrentType == FrameType.StateBatch)
+                {
+                    decoded.Clear();
+                    EngineMessages.ReadState(reader.CurrentPayload.Span, decoded);
+                }
+                else if (reader.CurrentType == FrameType.Hello)
+                {
+                    Assert.Equal("overlay", EngineMessages.ReadHello(reader.CurrentPayload.Span).ClientName);
+                }
+                else if (reader.CurrentType == FrameType.Goodbye)
+                {
+                    Assert.Equal("done", EngineMessages.ReadGoodbye(reader.CurrentPayload.Span));
+                }
+            }
+
+            Assert.Equal(52, types.Count);
+            Assert.Equal(FrameType.Hello, types[0]);
+            Assert.Equal(FrameType.Goodbye, types[^1]);
+            Assert.Equal(lastBatch, decoded);
+        }
+
+        [Fact]
+        public async Task FrameLargerThanBuffer_GrowsTheBuffer()
+        {
+            var output = new PayloadWriter();
+            EngineMessages.WriteGoodbye(output, new PayloadWriter(), new string('r', 20000));
+            var reader = new FrameStreamReader(new ChunkedStream(output.WrittenSpan.ToArray(), 1000), initialBufferSize: 64);
+
+            Assert.True(await reader.ReadFrameAsync(CancellationToken.None));
+            Assert.Equal(20000, EngineMessages.ReadGoodbye(reader.CurrentPayload.Span).Length);
+            Assert.False(await reader.ReadFrameAsync(CancellationToken.None));
+        }
+
+        [Fact]
+        public async Task StreamEndingMidFrame_ReturnsFalse()
+        {
+            var data = BuildStream(out _);
+            var reader = new FrameStreamReader(new ChunkedStream(data.AsSpan(0, data.Length - 3).ToArray(), 5));
+
+            int frames = 0;
+            while (await reader.ReadFrameAsync(CancellationToken.None))
+                frames++;
+
+            Assert.Equal(51, frames);
+        }
+
+        [Fact]
+        public async Task CorruptHeader_ThrowsInvalidData()
+        {
+            var output = new PayloadWriter();
+            EngineMessages.WriteGoodbye(output, new PayloadWriter(), "ok");
+            output.WriteByte(0xEE);
+            output.WriteByte(0x00);
+            var reader = new FrameStreamReader(new ChunkedStream(output.WrittenSpan.ToArray(), 2));
+
+            Assert.True(await reader.ReadFrameAsync(CancellationToken.None));
+            await Assert.ThrowsAsync<InvalidDataException>(async () => await reader.ReadFrameAsync(CancellationToken.None));
+        }
+    }
+}
@@ -0,0 +1,86 @@
+using HUDRA.Engine.Protocol;
+using HUDRA.Engine.State;
+using HUDRA.Engine.Transport;
+using System;
+using System.Threading;
+using System.Threading.Tasks;
+using Xunit;
+
+namespace HUDRA.Tests.Engine
+{
+    /// <summary>
+    /// Server and client over a real pipe. .NET maps named pipes to Unix domain sockets off Windows,
+    /// so this runs on every platform.
+    /// </summary>
+    public class PipeLoopbackTests
+    {
+        private sealed class TdpHandler : IEngineCommandHandler
+        {
+            private readonly EngineStateStore _store;
+
+            public TdpHandler(EngineStateStore store)
+            {
+                _store = store;
+            }
+
+            public EngineCommandResult Execute(EngineCommand command, StateValue argument)
+            {
+                if (command != EngineCommand.SetTdp)
+                    return EngineCommandResult.Fail($"{command} is not available");
+
+                _store.Set(StateKey.TdpTargetWatts, argument.AsInt64());
+                return EngineCommandResult.Ok();
+            }
+        }
+
+        private static string UniquePipeName() => $"HUDRA.Engine.Tests.{Guid.NewGuid():N}";
+
+        [Fact]
+        public async Task Client_ReceivesSnapshotBatchesAndCommandResults()
+        {
+            string pipeName = UniquePipeName();
+            var store = new EngineStateStore();
+            store.Set(StateKey.TdpTargetWatts, 12L);
+
+            using var server = new PipeEngineServer(store, new TdpHandler(store), pipeName) { FlushInterval = TimeSpan.FromMilliseconds(10) };
+            server.Start();
+
+            using var client = new PipeEngineClient("tests", pipeName);
+            await client.ConnectAsync(timeoutMs: 5000);
+
+            Assert.True(client.IsConnected);
+            Assert.True(client.State.TryGet(StateKey.TdpTargetWatts, out var initial));
+            Assert.Equal(12L, initial.AsInt64());
+
+            var batchReceived = new TaskCompletionSource<bool>(TaskCreationOptions.RunContinuationsAsynchronously);
+            client.StateReceived += (s, entries) =>
+            {
+                if (client.State.TryGet(StateKey.FanRpm, out var rpm) && rpm.AsInt64() == 3400)
+                    batchReceived.TrySetResult(true);
+            };
+
+            for (long rpm = 3000; rpm <= 3400; rpm += 100)
+                store.Set(StateKey.FanRpm, rpm);
+
+            await batchReceived.Task.WaitAsync(TimeSpan.FromSeconds(5));
+
+            var result = await client.SendCommandAsync(EngineCommand.SetTdp, StateValue.From(20L));
+            Assert.True(result.Success);
+
+            var rejected = await client.SendCommandAsync(EngineCommand.SetFanAuto, StateValue.None);
+            Assert.False(rejected.Success);
+            Assert.Equal("SetFanAuto is not available", rejected.Message);
+
+            Assert.True(store.TryGet(StateKey.TdpTargetWatts, out var tdp));
+            Assert.Equal(20L, tdp.AsInt64());
+        }
+
+        [Fact]
+        public async Task ConnectWithoutServer_TimesOut()
+        {
+            using var client = new PipeEngineClient("tests", UniquePipeName());
+
+            await Assert.ThrowsAsync<TimeoutException>(() => client.ConnectAsync(timeoutMs: 100));
+        }
+    }
+}
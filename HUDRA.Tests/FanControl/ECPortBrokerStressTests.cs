@@ -0,0 +1,170 @@
+using HUDRA.Services.FanControl;
+using System;
+using System.Collections.Concurrent;
+using System.Linq;
+using System.Threading;
+using System.Threading.Tasks;
+using Xunit;
+
+namespace HUDRA.Tests.FanControl
+{
+    /// <summary>
+    /// Fan writes, status polls and turbo setup from several threads against the simulated EC, which
+    /// yields inside every port access so unserialized sequences would overlap and corrupt addresses.
+    /// </summary>
+    public class ECPortBrokerStressTests
+    {
+        private const int Workers = 4;
+        private const int OperationsPerWorker = 400;
+
+        private readonly SimulatedEc _ec = new SimulatedEc { YieldOnAccess = true };
+
+        /// <summary>
+        /// Runs <paramref name="body"/> on dedicated threads released together; the thread pool would start
+        /// them one at a time on a small machine.
+        /// </summary>
+        private static void RunConcurrently(int count, Action<int> body)
+        {
+            using var start = new Barrier(count);
+            var threads = Enumerable.Range(0, count).Select(index => new Thread(() =>
+            {
+                start.SignalAndWait();
+                body(index);
+            })).ToArray();
+
+            foreach (var thread in threads)
+                thread.Start();
+            foreach (var thread in threads)
+                Assert.True(thread.Join(TimeSpan.FromSeconds(60)), "worker did not finish");
+        }
+
+        /// <summary>
+        /// Each worker owns its own 256-byte page and checks every write by reading it back, so a
+        /// transaction interleaved with another shows up as a wrong value or a write to a foreign page.
+        /// </summary>
+        private static void RunWorker(SimulatedEcDevice device, int worker, ConcurrentBag<string> errors)
+        {
+            var random = new Random(worker);
+            ushort page = (ushort)(0x0400 + worker * 0x100);
+            var priorities = new[] { ECPriority.High, ECPriority.Normal, ECPriority.Low };
+
+            for (int i = 0; i < OperationsPerWorker; i++)
+            {
+                var address = (ushort)(page + random.Next(256));
+                var value = (byte)random.Next(1, 256);
+                var priority = priorities[i % priorities.Length];
+
+                if (!device.Write(address, value, priority))
+                {
+                    errors.Add($"worker {worker}: write 0x{address:X4} failed");
+                    continue;
+                }
+
+                if (!device.TryRead(address, out byte readBack, priority) || readBack != value)
+                    errors.Add($"worker {worker}: 0x{address:X4} read {readBack:X2}, wrote {value:X2}");
+            }
+        }
+
+        [Fact]
+        public void ConcurrentDevicesNeverInterleave()
+        {
+            using var broker = new ECPortBroker(_ec.Open);
+            var errors = new ConcurrentBag<string>();
+
+            RunConcurrently(Workers, worker =>
+            {
+                var device = new SimulatedEcDevice(broker, _ec.RegisterMap);
+                if (!device.Initialize())
+                    errors.Add($"worker {worker}: initialize failed");
+                else
+                    RunWorker(device, worker, errors);
+            });
+
+            Assert.Empty(errors);
+            Assert.Equal(1, _ec.MaxConcurrentAccesses);
+            Assert.Equal(1, _ec.OpenCount);
+            Assert.Equal(Workers * OperationsPerWorker * 2, broker.GetMetrics().TransactionCount);
+            Assert.Equal(0, broker.GetMetrics().QueueDepth);
+
+            // Nothing landed outside the workers' pages
+            Assert.All(Enumerable.Range(0, 0x400).Concat(Enumerable.Range(0x400 + Workers * 0x100, 0x100)),
+                address => Assert.Equal(0, _ec[address]));
+        }
+
+        [Fact]
+        public void ReopenDuringTrafficNeverTouchesDisposedHandle()
+        {
+            using var broker = new ECPortBroker(_ec.Open);
+            var errors = new ConcurrentBag<string>();
+            using var done = new CancellationTokenSource();
+
+            var devices = Enumerable.Range(0, Workers).Select(_ => new SimulatedEcDevice(broker, _ec.RegisterMap)).ToArray();
+            Assert.All(devices, device => Assert.True(device.Initialize()));
+
+            // Resume: the handle is replaced repeatedly while fan writes and polls keep coming
+            int reopens = 0;
+            var resume = Task.Run(() =>
+            {
+                while (!done.IsCancellationRequested)
+                {
+                    if (!broker.Reopen())
+                        errors.Add("reopen failed");
+                    Interlocked.Increment(ref reopens);
+                    Thread.Sleep(1);
+                }
+            });
+
+            RunConcurrently(Workers, worker => RunWorker(devices[worker], worker, errors));
+            done.Cancel();
+            resume.Wait(TimeSpan.FromSeconds(5));
+
+            // A transaction on a disposed handle throws, which the device reports as a failed write or read
+            Assert.Empty(errors);
+            Assert.True(reopens > 0);
+            Assert.Equal(reopens + 1, _ec.OpenCount);
+            Assert.Single(_ec.Handles, handle => !handle.IsDisposed);
+            Assert.Equal(1, _ec.MaxConcurrentAccesses);
+        }
+
+        [Fact]
+        public void TurboSetupDuringPollingStaysIntact()
+        {
+            // TurboService's button mapping: 12 port writes in one High transaction, racing Low polls
+            using var broker = new ECPortBroker(_ec.Open);
+            var poller = new SimulatedEcDevice(broker, _ec.RegisterMap);
+            poller.Initialize();
+            var errors = new ConcurrentBag<string>();
+            using var done = new CancellationTokenSource();
+
+            var polling = Task.Run(() =>
+            {
+                while (!done.IsCancellationRequested)
+                {
+                    if (!poller.TryRead(0x044B, out _))
+                        errors.Add("poll failed");
+                }
+            });
+
+            for (int i = 0; i < 200; i++)
+            {
+                byte low = (byte)i;
+                broker.Execute(ECPriority.High, port =>
+                {
+                    port.WriteIoPortByte(0x4E, 0x2E); port.WriteIoPortByte(0x4F, 0x11);
+                    port.WriteIoPortByte(0x4E, 0x2F); port.WriteIoPortByte(0x4F, 0x0B);
+                    port.WriteIoPortByte(0x4E, 0x2E); port.WriteIoPortByte(0x4F, 0x10);
+                    port.WriteIoPortByte(0x4E, 0x2F); port.WriteIoPortByte(0x4F, low);
+                    port.WriteIoPortByte(0x4E, 0x2E); port.WriteIoPortByte(0x4F, 0x12);
+                    port.WriteIoPortByte(0x4E, 0x2F); port.WriteIoPortByte(0x4F, 0x40);
+                });
+            }
+
+            done.Cancel();
+            polling.Wait(TimeSpan.FromSeconds(5));
+
+            Assert.Empty(errors);
+            Assert.All(Enumerable.Range(0, 200), i => Assert.Equal(0x40, _ec[0x0B00 + i]));
+            Assert.Equal(1, _ec.MaxConcurrentAccesses);
+        }
+    }
+}
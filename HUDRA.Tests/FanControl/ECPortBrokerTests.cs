@@ -0,0 +1,232 @@
+using HUDRA.Services.FanControl;
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Threading;
+using System.Threading.Tasks;
+using Xunit;
+
+namespace HUDRA.Tests.FanControl
+{
+    public class ECPortBrokerTests
+    {
+        private readonly SimulatedEc _ec = new SimulatedEc();
+
+        private ECPortBroker CreateBroker() => new ECPortBroker(_ec.Open);
+
+        /// <summary>
+        /// Blocks the broker with a transaction until the returned event is set.
+        /// </summary>
+        private static (Task Holder, ManualResetEventSlim Release) Hold(ECPortBroker broker)
+        {
+            var entered = new ManualResetEventSlim();
+            var release = new ManualResetEventSlim();
+            var holder = Task.Run(() => broker.Execute(ECPriority.Normal, _ =>
+            {
+                entered.Set();
+                release.Wait();
+            }));
+            Assert.True(entered.Wait(TimeSpan.FromSeconds(5)));
+            return (holder, release);
+        }
+
+        private static void WaitForQueueDepth(ECPortBroker broker, int depth)
+        {
+            var deadline = DateTime.UtcNow + TimeSpan.FromSeconds(5);
+            while (broker.GetMetrics().QueueDepth < depth)
+            {
+                Assert.True(DateTime.UtcNow < deadline, $"queue never reached {depth}");
+                Thread.Sleep(1);
+            }
+        }
+
+        [Fact]
+        public void RegisterWriteAndReadRoundTrip()
+        {
+            using var broker = CreateBroker();
+            var device = new SimulatedEcDevice(broker, _ec.RegisterMap);
+
+            Assert.True(device.Initialize());
+            Assert.True(device.Write(0x044B, 0x7F));
+            Assert.True(device.TryRead(0x044B, out byte value));
+
+            Assert.Equal(0x7F, value);
+            Assert.Equal(0x7F, _ec[0x044B]);
+            Assert.Equal(2, broker.GetMetrics().TransactionCount);
+        }
+
+        [Fact]
+        public void OpenIsSharedByEveryDevice()
+        {
+            using var broker = CreateBroker();
+
+            Assert.True(new SimulatedEcDevice(broker, _ec.RegisterMap).Initialize());
+            Assert.True(new SimulatedEcDevice(broker, _ec.RegisterMap).Initialize());
+            Assert.True(broker.Open());
+
+            Assert.Equal(1, _ec.OpenCount);
+        }
+
+        [Fact]
+        public void OpenRetriesAfterMissingDriver()
+        {
+            using var broker = CreateBroker();
+            _ec.DriverAvailable = false;
+
+            Assert.False(broker.Open());
+            Assert.False(broker.IsOpen);
+            Assert.Throws<InvalidOperationException>(() => broker.Execute(ECPriority.High, port => port.ReadIoPortByte(0x4F)));
+
+            _ec.DriverAvailable = true;
+            Assert.True(broker.Open());
+        }
+
+        [Fact]
+        public void DeviceWithoutOpenHandleFailsCleanly()
+        {
+            using var broker = CreateBroker();
+            var device = new SimulatedEcDevice(broker, _ec.RegisterMap);
+
+            Assert.False(device.Write(0x044B, 1));
+            Assert.False(device.TryRead(0x044B, out _));
+            Assert.Equal(0, _ec.OpenCount);
+        }
+
+        [Fact]
+        public void ReopenReplacesAndDisposesOldHandle()
+        {
+            using var broker = CreateBroker();
+            var device = new SimulatedEcDevice(broker, _ec.RegisterMap);
+            device.Initialize();
+            device.Write(0x044B, 0x40);
+
+            Assert.True(broker.Reopen());
+
+            Assert.Equal(2, _ec.OpenCount);
+            Assert.True(_ec.Handles[0].IsDisposed);
+            Assert.False(_ec.Handles[1].IsDisposed);
+
+            // Devices keep working without re-initializing, against the new handle
+            Assert.True(device.TryRead(0x044B, out byte value));
+            Assert.Equal(0x40, value);
+            Assert.True(_ec.Handles[1].Accesses > 0);
+        }
+
+        [Fact]
+        public void FailedReopenLeavesNoStaleHandle()
+        {
+            using var broker = CreateBroker();
+            var device = new SimulatedEcDevice(broker, _ec.RegisterMap);
+            device.Initialize();
+            _ec.DriverAvailable = false;
+
+            Assert.False(broker.Reopen());
+
+            Assert.False(broker.IsOpen);
+            Assert.True(_ec.Handles[0].IsDisposed);
+            Assert.False(device.Write(0x044B, 1));
+        }
+
+        [Fact]
+        public void TransactionsQueuedDuringReopenRunOnNewHandle()
+        {
+            using var broker = CreateBroker();
+            broker.Open();
+            var (holder, release) = Hold(broker);
+
+            var reopen = Task.Run(() => broker.Reopen());
+            WaitForQueueDepth(broker, 1);
+            var write = Task.Run(() => broker.Execute(ECPriority.Low, port => port.WriteIoPortByte(SimulatedEc.CommandPort, 0x2E)));
+            WaitForQueueDepth(broker, 2);
+
+            release.Set();
+            Task.WaitAll(new[] { holder, reopen, write }, TimeSpan.FromSeconds(5));
+
+            Assert.True(reopen.Result);
+            Assert.Equal(0, _ec.Handles[0].Accesses);
+            Assert.Equal(1, _ec.Handles[1].Accesses);
+        }
+
+        [Fact]
+        public void WaitersRunByPriorityThenArrival()
+        {
+            using var broker = CreateBroker();
+            broker.Open();
+            var order = new List<string>();
+            var (holder, release) = Hold(broker);
+
+            var waiters = new List<Task>();
+            void Enqueue(string name, ECPriority priority)
+            {
+                int depth = broker.GetMetrics().QueueDepth;
+                waiters.Add(Task.Run(() => broker.Execute(priority, _ => order.Add(name))));
+                WaitForQueueDepth(broker, depth + 1);
+            }
+
+            Enqueue("poll 1", ECPriority.Low);
+            Enqueue("fan 1", ECPriority.Normal);
+            Enqueue("poll 2", ECPriority.Low);
+            Enqueue("turbo", ECPriority.High);
+            Enqueue("fan 2", ECPriority.Normal);
+
+            release.Set();
+            Assert.True(Task.WaitAll(waiters.Append(holder).ToArray(), TimeSpan.FromSeconds(5)));
+
+            Assert.Equal(new[] { "turbo", "fan 1", "fan 2", "poll 1", "poll 2" }, order);
+            Assert.Equal(5, broker.GetMetrics().MaxQueueDepth);
+            Assert.Equal(0, broker.GetMetrics().QueueDepth);
+        }
+
+        [Fact]
+        public void TransactionExceptionReleasesThePorts()
+        {
+            using var broker = CreateBroker();
+            broker.Open();
+
+            Assert.Throws<InvalidOperationException>(() =>
+                broker.Execute(ECPriority.Normal, _ => throw new InvalidOperationException("device fault")));
+
+            Assert.Equal(0x2E, broker.Execute(ECPriority.Normal, port =>
+            {
+                port.WriteIoPortByte(SimulatedEc.CommandPort, 0x2E);
+                return 0x2E;
+            }));
+        }
+
+        [Fact]
+        public void DisposeClosesHandleAndRejectsFurtherUse()
+        {
+            var broker = CreateBroker();
+            broker.Open();
+
+            broker.Dispose();
+
+            Assert.True(_ec.Handles[0].IsDisposed);
+            Assert.False(broker.Open());
+            Assert.False(broker.Reopen());
+            Assert.Throws<InvalidOperationException>(() => broker.Execute(ECPriority.High, port => port.ReadIoPortByte(0x4F)));
+            broker.Dispose();
+        }
+
+        [Fact]
+        public void UnbrokeredInterleavingCorruptsTheSimulator()
+        {
+            // Sanity check that the stress tests below would catch a missing lock: two register writes
+            // whose port sequences interleave land on the wrong address
+            var port = _ec.Open()!;
+            void Pair(byte command, byte data)
+            {
+                port.WriteIoPortByte(SimulatedEc.CommandPort, command);
+                port.WriteIoPortByte(SimulatedEc.DataPort, data);
+            }
+
+            Pair(0x2E, 0x11); Pair(0x2F, 0x01);  // A: address high 0x01
+            Pair(0x2E, 0x11); Pair(0x2F, 0x02);  // B: address high 0x02
+            Pair(0x2E, 0x10); Pair(0x2F, 0x10);  // A: address low 0x10
+            Pair(0x2E, 0x12); Pair(0x2F, 0xAA);  // A: data, now at 0x0210
+
+            Assert.Equal(0, _ec[0x0110]);
+            Assert.Equal(0xAA, _ec[0x0210]);
+        }
+    }
+}
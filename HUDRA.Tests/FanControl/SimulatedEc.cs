@@ -0,0 +1,238 @@
+using HUDRA.Services.FanControl;
+using System;
+using System.Collections.Generic;
+using System.Threading;
+
+namespace HUDRA.Tests.FanControl
+{
+    /// <summary>
+    /// An ITE-style embedded controller behind the 0x4E/0x4F index/data pair, as on GPD and OneXPlayer
+    /// handhelds. Writing 0x2E then a value to the data port selects a D2 register (0x11 address high,
+    /// 0x10 address low, 0x12 data); writing 0x2F then a value writes that register. Any other index
+    /// sequence in between lands on whatever register is selected, exactly like the real chip, so
+    /// interleaved transactions corrupt the address or the data. RAM survives handle reopening.
+    /// </summary>
+    internal sealed class SimulatedEc
+    {
+        public const ushort CommandPort = 0x4E;
+        public const ushort DataPort = 0x4F;
+
+        private readonly byte[] _ram = new byte[0x10000];
+        private readonly object _lock = new object();
+        private readonly List<Handle> _handles = new();
+        private byte _index;
+        private byte _d2Register;
+        private int _address;
+        private int _inFlight;
+        private int _maxInFlight;
+
+        /// <summary>
+        /// Gives up the time slice inside every port access, so unserialized sequences from other threads
+        /// get to run in between even on a single core.
+        /// </summary>
+        public bool YieldOnAccess { get; set; }
+
+        /// <summary>
+        /// When false, <see cref="Open"/> returns null like a missing WinRing0 driver.
+        /// </summary>
+        public bool DriverAvailable { get; set; } = true;
+
+        /// <summary>
+        /// Highest number of port accesses that overlapped; 1 when the broker serialized everything.
+        /// </summary>
+        public int MaxConcurrentAccesses => Volatile.Read(ref _maxInFlight);
+
+        public int OpenCount
+        {
+            get
+            {
+                lock (_lock)
+                {
+                    return _handles.Count;
+                }
+            }
+        }
+
+        public IReadOnlyList<Handle> Handles
+        {
+            get
+            {
+                lock (_lock)
+                {
+                    return _handles.ToArray();
+                }
+            }
+        }
+
+        public ECRegisterMap RegisterMap { get; } = new ECRegisterMap
+        {
+            StatusCommandPort = CommandPort,
+            DataPort = DataPort,
+            Protocol = new ECProtocolConfig
+            {
+                AddressSelectHigh = 0x2E,
+                AddressSetHigh = 0x11,
+                AddressSelectLow = 0x2E,
+                AddressSetLow = 0x10,
+                DataSelect = 0x2E,
+                DataCommand = 0x12,
+                AddressPort = 0x2F,
+                ReadDataSelect = 0x2F
+            }
+        };
+
+        public byte this[int address]
+        {
+            get
+            {
+                lock (_lock)
+                {
+                    return _ram[address];
+                }
+            }
+        }
+
+        /// <summary>
+        /// Port opener for <see cref="ECPortBroker"/>.
+        /// </summary>
+        public IPortIO? Open()
+        {
+            if (!DriverAvailable) return null;
+
+            var handle = new Handle(this);
+            lock (_lock)
+            {
+                _handles.Add(handle);
+            }
+            return handle;
+        }
+
+        private void Enter()
+        {
+            int inFlight = Interlocked.Increment(ref _inFlight);
+            int max;
+            while (inFlight > (max = Volatile.Read(ref _maxInFlight)) &&
+                   Interlocked.CompareExchange(ref _maxInFlight, inFlight, max) != max)
+            {
+            }
+
+            if (YieldOnAccess)
+                Thread.Yield();
+        }
+
+        private void Exit() => Interlocked.Decrement(ref _inFlight);
+
+        private void Write(ushort port, byte value)
+        {
+            // Each port access is atomic on the bus; only sequences of them can interleave
+            lock (_lock)
+            {
+                if (port == CommandPort)
+                {
+                    _index = value;
+                }
+                else if (port == DataPort)
+                {
+                    if (_index == 0x2E)
+                    {
+                        _d2Register = value;
+                    }
+                    else if (_index == 0x2F)
+                    {
+                        switch (_d2Register)
+                        {
+                            case 0x11: _address = (value << 8) | (_address & 0xFF); break;
+                            case 0x10: _address = (_address & 0xFF00) | value; break;
+                            case 0x12: _ram[_address] = value; break;
+                        }
+                    }
+                }
+            }
+        }
+
+        private byte Read(ushort port)
+        {
+            lock (_lock)
+            {
+                return port == DataPort && _index == 0x2F && _d2Register == 0x12 ? _ram[_address] : (byte)0xFF;
+            }
+        }
+
+        /// <summary>
+        /// One WinRing0 handle. Like a handle from before hibernation, it throws once disposed.
+        /// </summary>
+        public sealed class Handle : IPortIO
+        {
+            private readonly SimulatedEc _ec;
+            private volatile bool _disposed;
+            private long _accesses;
+
+            public Handle(SimulatedEc ec)
+            {
+                _ec = ec;
+            }
+
+            public bool IsDisposed => _disposed;
+
+            public long Accesses => Interlocked.Read(ref _accesses);
+
+            public byte ReadIoPortByte(ushort port)
+            {
+                _ec.Enter();
+                try
+                {
+                    ObjectDisposedException.ThrowIf(_disposed, this);
+                    Interlocked.Increment(ref _accesses);
+                    return _ec.Read(port);
+                }
+                finally
+                {
+                    _ec.Exit();
+                }
+            }
+
+            public void WriteIoPortByte(ushort port, byte value)
+            {
+                _ec.Enter();
+                try
+                {
+                    ObjectDisposedException.ThrowIf(_disposed, this);
+                    Interlocked.Increment(ref _accesses);
+                    _ec.Write(port, value);
+                }
+                finally
+                {
+                    _ec.Exit();
+                }
+            }
+
+            public void Dispose() => _disposed = true;
+        }
+    }
+
+    /// <summary>
+    /// Minimal EC device over the shared broker, to drive <see cref="ECCommunicationBase"/>'s real
+    /// register sequences against the simulator.
+    /// </summary>
+    internal sealed class SimulatedEcDevice : ECCommunicationBase
+    {
+        private readonly ECRegisterMap _registerMap;
+
+        public SimulatedEcDevice(ECPortBroker broker, ECRegisterMap registerMap) : base(broker)
+        {
+            _registerMap = registerMap;
+        }
+
+        public bool Initialize() => InitializeEC();
+
+        public bool Write(ushort address, byte value, ECPriority priority = ECPriority.Normal)
+        {
+            return WriteECRegister(address, _registerMap, value, priority);
+        }
+
+        public bool TryRead(ushort address, out byte value, ECPriority priority = ECPriority.Low)
+        {
+            return ReadECRegister(address, _registerMap, out value, priority);
+        }
+    }
+}
@@ -0,0 +1,130 @@
+using HUDRA.Services;
+using System.Collections.Generic;
+using Xunit;
+
+namespace HUDRA.Tests.Hardware
+{
+    public class HardwareFingerprintTests
+    {
+        // HARDWARE\DESCRIPTION\System\BIOS on a Legion Go
+        private static Dictionary<string, string?> LegionGo() => new()
+        {
+            ["SystemManufacturer"] = "LENOVO",
+            ["SystemProductName"] = "83E1",
+            ["SystemFamily"] = "Legion Go 8APU1",
+            ["BaseBoardManufacturer"] = "LENOVO",
+            ["BaseBoardProduct"] = "LNVNB161216",
+            ["BIOSVersion"] = "N3CN29WW"
+        };
+
+        private static HardwareFingerprint From(Dictionary<string, string?> values)
+        {
+            return HardwareFingerprint.FromValues(name => values.TryGetValue(name, out var value) ? value : null);
+        }
+
+        [Fact]
+        public void FromValues_JoinsFieldsInOrder()
+        {
+            var fingerprint = From(LegionGo());
+
+            Assert.Equal("LENOVO|83E1|Legion Go 8APU1|LENOVO|LNVNB161216|N3CN29WW", fingerprint.Value);
+            Assert.False(fingerprint.IsEmpty);
+            Assert.Equal(fingerprint.Value, fingerprint.ToString());
+        }
+
+        [Fact]
+        public void FromValues_TrimsAndReplacesSeparator()
+        {
+            var values = LegionGo();
+            values["SystemProductName"] = "  83E1 \t";
+            values["SystemFamily"] = "Legion|Go";
+
+            Assert.Equal("LENOVO|83E1|Legion Go|LENOVO|LNVNB161216|N3CN29WW", From(values).Value);
+        }
+
+        [Fact]
+        public void FromValues_MissingFieldsStayInPlace()
+        {
+            var values = LegionGo();
+            values.Remove("SystemFamily");
+            values["BaseBoardProduct"] = null;
+
+            Assert.Equal("LENOVO|83E1||LENOVO||N3CN29WW", From(values).Value);
+        }
+
+        [Fact]
+        public void FromValues_AllMissingIsEmpty()
+        {
+            var fingerprint = HardwareFingerprint.FromValues(_ => "  ");
+
+            Assert.Same(HardwareFingerprint.Empty, fingerprint);
+            Assert.True(fingerprint.IsEmpty);
+            Assert.Equal("(none)", fingerprint.ToString());
+        }
+
+        [Fact]
+        public void FromValues_ReadsExactlyTheSmbiosFields()
+        {
+            var requested = new List<string>();
+            HardwareFingerprint.FromValues(name =>
+            {
+                requested.Add(name);
+                return "x";
+            });
+
+            Assert.Equal(HardwareFingerprint.Fields, requested);
+        }
+
+        [Fact]
+        public void Compare_SameMachineMatchesIgnoringCase()
+        {
+            var fingerprint = From(LegionGo());
+
+            Assert.Equal(FingerprintMatch.Match, fingerprint.Compare(fingerprint.Value));
+            Assert.Equal(FingerprintMatch.Match, fingerprint.Compare("lenovo|83E1|LEGION GO 8APU1|Lenovo|LNVNB161216|n3cn29ww"));
+        }
+
+        [Fact]
+        public void Compare_BiosUpdateIsChanged()
+        {
+            var saved = From(LegionGo()).Value;
+            var values = LegionGo();
+            values["BIOSVersion"] = "N3CN31WW";
+
+            Assert.Equal(FingerprintMatch.Changed, From(values).Compare(saved));
+        }
+
+        [Fact]
+        public void Compare_DifferentBoardIsChanged()
+        {
+            var saved = From(LegionGo()).Value;
+            var rogAlly = new Dictionary<string, string?>
+            {
+                ["SystemManufacturer"] = "ASUSTeK COMPUTER INC.",
+                ["SystemProductName"] = "ROG Ally RC71L_RC71L",
+                ["SystemFamily"] = "ROG Ally",
+                ["BaseBoardManufacturer"] = "ASUSTeK COMPUTER INC.",
+                ["BaseBoardProduct"] = "RC71L",
+                ["BIOSVersion"] = "RC71L.341"
+            };
+
+            Assert.Equal(FingerprintMatch.Changed, From(rogAlly).Compare(saved));
+        }
+
+        [Theory]
+        [InlineData((string?)null)]
+        [InlineData("")]
+        public void Compare_NothingSavedIsNotRecorded(string? saved)
+        {
+            Assert.Equal(FingerprintMatch.NotRecorded, From(LegionGo()).Compare(saved));
+        }
+
+        [Theory]
+        [InlineData((string?)null)]
+        [InlineData("LENOVO|83E1|Legion Go 8APU1|LENOVO|LNVNB161216|N3CN29WW")]
+        public void Compare_UnreadableCurrentIsUnavailable(string? saved)
+        {
+            Assert.Equal(FingerprintMatch.Unavailable, HardwareFingerprint.Empty.Compare(saved));
+        }
+    }
+}
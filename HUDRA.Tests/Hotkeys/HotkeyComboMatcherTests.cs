@@ -0,0 +1,200 @@
+using HUDRA.Services.Hotkeys;
+using Xunit;
+
+namespace HUDRA.Tests.Hotkeys
+{
+    public class HotkeyComboMatcherTests
+    {
+        private const int VK_LWIN = 0x5B;
+        private const int VK_RWIN = 0x5C;
+        private const int VK_LCONTROL = 0xA2;
+        private const int VK_RCONTROL = 0xA3;
+        private const int VK_CONTROL = 0x11;
+        private const int VK_LMENU = 0xA4;
+        private const int VK_LSHIFT = 0xA0;
+        private const int VK_A = 0x41;
+        private const int VK_F10 = 0x79;
+
+        // Win+Alt+Ctrl with no main key: the turbo-button chord only the LL hook can see
+        private static readonly HotkeyCombo TurboChord = HotkeyCombo.Default;
+
+        private static readonly HotkeyCombo CtrlShiftF10 = new(HotkeyModifiers.Control | HotkeyModifiers.Shift, VK_F10);
+
+        [Fact]
+        public void ModifierOnlyChord_FiresOnceWhenLastModifierGoesDown()
+        {
+            var matcher = new HotkeyComboMatcher(TurboChord);
+
+            Assert.False(matcher.KeyDown(VK_LWIN));
+            Assert.False(matcher.KeyDown(VK_LMENU));
+            Assert.True(matcher.KeyDown(VK_LCONTROL));
+        }
+
+        [Theory]
+        [InlineData(VK_LWIN, VK_LMENU, VK_LCONTROL)]
+        [InlineData(VK_LCONTROL, VK_LMENU, VK_LWIN)]
+        [InlineData(VK_LMENU, VK_LWIN, VK_LCONTROL)]
+        [InlineData(VK_LCONTROL, VK_LWIN, VK_LMENU)]
+        public void ModifierOrder_DoesNotMatter(int first, int second, int third)
+        {
+            var matcher = new HotkeyComboMatcher(TurboChord);
+
+            Assert.False(matcher.KeyDown(first));
+            Assert.False(matcher.KeyDown(second));
+            Assert.True(matcher.KeyDown(third));
+        }
+
+        [Fact]
+        public void AutoRepeat_WhileHeld_DoesNotFireAgain()
+        {
+            var matcher = new HotkeyComboMatcher(TurboChord);
+            matcher.KeyDown(VK_LWIN);
+            matcher.KeyDown(VK_LMENU);
+            Assert.True(matcher.KeyDown(VK_LCONTROL));
+
+            for (int i = 0; i < 20; i++)
+            {
+                Assert.False(matcher.KeyDown(VK_LCONTROL));
+                Assert.False(matcher.KeyDown(VK_LMENU));
+            }
+        }
+
+        [Fact]
+        public void Rearms_OnlyAfterAComboKeyIsReleased()
+        {
+            var matcher = new HotkeyComboMatcher(TurboChord);
+            matcher.KeyDown(VK_LWIN);
+            matcher.KeyDown(VK_LMENU);
+            Assert.True(matcher.KeyDown(VK_LCONTROL));
+
+            matcher.KeyUp(VK_LCONTROL);
+            Assert.True(matcher.KeyDown(VK_LCONTROL));
+        }
+
+        [Fact]
+        public void UnrelatedKeyRelease_DoesNotRearm()
+        {
+            var matcher = new HotkeyComboMatcher(TurboChord);
+            matcher.KeyDown(VK_LWIN);
+            matcher.KeyDown(VK_LMENU);
+            Assert.True(matcher.KeyDown(VK_LCONTROL));
+
+            Assert.False(matcher.KeyDown(VK_A));
+            matcher.KeyUp(VK_A);
+            Assert.False(matcher.KeyDown(VK_LCONTROL));
+        }
+
+        [Fact]
+        public void ReleasingOneSide_KeepsModifierHeldByTheOther()
+        {
+            var matcher = new HotkeyComboMatcher(TurboChord);
+            matcher.KeyDown(VK_LWIN);
+            matcher.KeyDown(VK_LMENU);
+            Assert.True(matcher.KeyDown(VK_RCONTROL));
+            Assert.False(matcher.KeyDown(VK_LCONTROL));
+
+            // RCtrl still held, so the chord is still satisfied and stays disarmed
+            matcher.KeyUp(VK_LCONTROL);
+            Assert.False(matcher.KeyDown(VK_LCONTROL));
+
+            matcher.KeyUp(VK_LCONTROL);
+            matcher.KeyUp(VK_RCONTROL);
+            Assert.True(matcher.KeyDown(VK_RCONTROL));
+        }
+
+        [Fact]
+        public void GenericAndLeftVirtualKeys_AreTheSameSide()
+        {
+            var matcher = new HotkeyComboMatcher(TurboChord);
+            matcher.KeyDown(VK_RWIN);
+            matcher.KeyDown(VK_LMENU);
+            Assert.True(matcher.KeyDown(VK_CONTROL));
+
+            // Up on the side-specific code clears the generic one
+            matcher.KeyUp(VK_LCONTROL);
+            Assert.True(matcher.KeyDown(VK_LCONTROL));
+        }
+
+        [Fact]
+        public void MainKeyCombo_FiresOnMainKeyOnlyWithModifiersHeld()
+        {
+            var matcher = new HotkeyComboMatcher(CtrlShiftF10);
+
+            Assert.False(matcher.KeyDown(VK_F10));
+            matcher.KeyUp(VK_F10);
+
+            Assert.False(matcher.KeyDown(VK_LCONTROL));
+            Assert.False(matcher.KeyDown(VK_LSHIFT));
+            Assert.True(matcher.KeyDown(VK_F10));
+            Assert.False(matcher.KeyDown(VK_F10));
+
+            matcher.KeyUp(VK_F10);
+            Assert.True(matcher.KeyDown(VK_F10));
+        }
+
+        [Fact]
+        public void MainKeyCombo_ModifiersLast_StillFires()
+        {
+            var matcher = new HotkeyComboMatcher(CtrlShiftF10);
+
+            Assert.False(matcher.KeyDown(VK_F10));
+            Assert.False(matcher.KeyDown(VK_LSHIFT));
+            Assert.True(matcher.KeyDown(VK_LCONTROL));
+        }
+
+        [Fact]
+        public void ExtraModifiers_DoNotBlockTheCombo()
+        {
+            var matcher = new HotkeyComboMatcher(CtrlShiftF10);
+
+            matcher.KeyDown(VK_LMENU);
+            matcher.KeyDown(VK_LCONTROL);
+            matcher.KeyDown(VK_LSHIFT);
+            Assert.True(matcher.KeyDown(VK_F10));
+        }
+
+        [Fact]
+        public void Reset_ClearsKeysLostAcrossSleep()
+        {
+            var matcher = new HotkeyComboMatcher(TurboChord);
+            matcher.KeyDown(VK_LWIN);
+            matcher.KeyDown(VK_LMENU);
+            Assert.True(matcher.KeyDown(VK_LCONTROL));
+
+            // The key-ups never arrive; after Reset the chord must be pressed in full again
+            matcher.Reset();
+            Assert.False(matcher.KeyDown(VK_LCONTROL));
+            Assert.False(matcher.KeyDown(VK_LMENU));
+            Assert.True(matcher.KeyDown(VK_LWIN));
+        }
+
+        [Fact]
+        public void SetCombo_SwitchesComboAndClearsState()
+        {
+            var matcher = new HotkeyComboMatcher(TurboChord);
+            matcher.KeyDown(VK_LWIN);
+            matcher.KeyDown(VK_LMENU);
+
+            matcher.SetCombo(CtrlShiftF10);
+            Assert.Equal(CtrlShiftF10, matcher.Combo);
+
+            Assert.False(matcher.KeyDown(VK_LCONTROL));
+            Assert.False(matcher.KeyDown(VK_LSHIFT));
+            Assert.True(matcher.KeyDown(VK_F10));
+        }
+
+        [Theory]
+        [InlineData("Win+Alt+Ctrl", "", HotkeyModifiers.Win | HotkeyModifiers.Alt | HotkeyModifiers.Control, 0)]
+        [InlineData("ctrl + shift", "F10", HotkeyModifiers.Control | HotkeyModifiers.Shift, VK_F10)]
+        [InlineData("Alt", "a", HotkeyModifiers.Alt, VK_A)]
+        [InlineData("", "F24", HotkeyModifiers.None, 0x87)]
+        [InlineData("Hyper", "F25", HotkeyModifiers.Win | HotkeyModifiers.Alt | HotkeyModifiers.Control, 0)]
+        [InlineData(null, null, HotkeyModifiers.Win | HotkeyModifiers.Alt | HotkeyModifiers.Control, 0)]
+        public void Parse_ReadsSettingsAndFallsBackToDefault(string? modifiers, string? key, HotkeyModifiers expectedModifiers, int expectedKey)
+        {
+            var combo = HotkeyCombo.Parse(modifiers, key);
+
+            Assert.Equal(new HotkeyCombo(expectedModifiers, expectedKey), combo);
+        }
+    }
+}
@@ -0,0 +1,133 @@
+using HUDRA.Services.LibraryWatch;
+using System;
+using System.IO;
+using Xunit;
+
+namespace HUDRA.Tests.LibraryWatch
+{
+    public class LauncherManifestsTests : IDisposable
+    {
+        private readonly string _root;
+
+        public LauncherManifestsTests()
+        {
+            _root = Path.Combine(Path.GetTempPath(), "HUDRA.Tests", Guid.NewGuid().ToString("N"));
+            Directory.CreateDirectory(_root);
+        }
+
+        public void Dispose()
+        {
+            Directory.Delete(_root, recursive: true);
+        }
+
+        private string Write(string name, string text)
+        {
+            var path = Path.Combine(_root, name);
+            File.WriteAllText(path, text);
+            return path;
+        }
+
+        [Theory]
+        [InlineData(@"D:\SteamLibrary\steamapps\appmanifest_1091500.acf", ManifestKind.SteamApp)]
+        [InlineData(@"D:\SteamLibrary\steamapps\AppManifest_570.ACF", ManifestKind.SteamApp)]
+        [InlineData(@"C:\Steam\steamapps\libraryfolders.vdf", ManifestKind.SteamLibraryFolders)]
+        [InlineData(@"C:\ProgramData\Epic\EpicGamesLauncher\Data\Manifests\4F3B2A.item", ManifestKind.EpicItem)]
+        [InlineData(@"D:\SteamLibrary\steamapps\appmanifest_570.acf.tmp", ManifestKind.Unknown)]
+        [InlineData(@"D:\SteamLibrary\steamapps\appmanifest_beta.acf", ManifestKind.Unknown)]
+        [InlineData(@"D:\SteamLibrary\steamapps\downloading", ManifestKind.Unknown)]
+        public void Classify_RecognizesManifestNames(string path, ManifestKind expected)
+        {
+            Assert.Equal(expected, LauncherManifests.Classify(path.Replace('\\', Path.DirectorySeparatorChar)));
+        }
+
+        [Fact]
+        public void ReadSteamAppManifest_ReadsTopLevelValues()
+        {
+            var path = Write("appmanifest_1091500.acf",
+                "\"AppState\"\n{\n\t\"appid\"\t\t\"1091500\"\n\t\"name\"\t\t\"Cyberpunk 2077\"\n\t\"StateFlags\"\t\t\"4\"\n" +
+                "\t\"installdir\"\t\t\"Cyberpunk 2077\"\n\t\"buildid\"\t\t\"13948201\"\n" +
+                "\t\"InstalledDepots\"\n\t{\n\t\t\"1091501\"\n\t\t{\n\t\t\t\"manifest\"\t\t\"5140571410296483385\"\n\t\t}\n\t}\n}\n");
+
+            var manifest = LauncherManifests.ReadSteamAppManifest(path);
+
+            Assert.NotNull(manifest);
+            Assert.Equal("1091500", manifest!.AppId);
+            Assert.Equal("Cyberpunk 2077", manifest.Name);
+            Assert.Equal(Path.Combine(_root, "common", "Cyberpunk 2077"), manifest.InstallDir);
+            Assert.Equal("13948201", manifest.BuildId);
+            Assert.True(manifest.IsFullyInstalled);
+        }
+
+        [Theory]
+        [InlineData("4", true)]
+        [InlineData("6", true)]
+        [InlineData("1026", false)] // Update required + update running
+        [InlineData("", false)]
+        public void ReadSteamAppManifest_FullyInstalledFromStateFlags(string stateFlags, bool expected)
+        {
+            var path = Write("appmanifest_570.acf",
+                $"\"AppState\"\n{{\n\t\"StateFlags\"\t\t\"{stateFlags}\"\n\t\"installdir\"\t\t\"dota 2 beta\"\n}}\n");
+
+            var manifest = LauncherManifests.ReadSteamAppManifest(path);
+
+            // appid falls back to the file name
+            Assert.Equal("570", manifest?.AppId);
+            Assert.Equal(expected, manifest?.IsFullyInstalled);
+        }
+
+        [Fact]
+        public void ReadSteamAppManifest_WithoutInstallDirOrFileReturnsNull()
+        {
+            var path = Write("appmanifest_570.acf", "\"AppState\"\n{\n\t\"appid\"\t\t\"570\"\n}\n");
+
+            Assert.Null(LauncherManifests.ReadSteamAppManifest(path));
+            Assert.Null(LauncherManifests.ReadSteamAppManifest(Path.Combine(_root, "appmanifest_1.acf")));
+        }
+
+        [Fact]
+        public void ReadSteamLibraryFolders_UnescapesAndDeduplicatesPaths()
+        {
+            var path = Write("libraryfolders.vdf",
+                "\"libraryfolders\"\n{\n" +
+                "\t\"0\"\n\t{\n\t\t\"path\"\t\t\"C:\\\\Program Files (x86)\\\\Steam\"\n\t\t\"apps\"\n\t\t{\n\t\t\t\"228980\"\t\t\"0\"\n\t\t}\n\t}\n" +
+                "\t\"1\"\n\t{\n\t\t\"path\"\t\t\"D:\\\\SteamLibrary\"\n\t}\n" +
+                "\t\"2\"\n\t{\n\t\t\"path\"\t\t\"d:\\\\steamlibrary\"\n\t}\n}\n");
+
+            Assert.Equal(new[] { @"C:\Program Files (x86)\Steam", @"D:\SteamLibrary" },
+                LauncherManifests.ReadSteamLibraryFolders(path));
+            Assert.Empty(LauncherManifests.ReadSteamLibraryFolders(Path.Combine(_root, "missing.vdf")));
+        }
+
+        [Fact]
+        public void ReadEpicManifest_ReadsGameAndAddOn()
+        {
+            var game = Write("4F3B2A.item",
+                "{\"AppName\":\"Fortnite\",\"DisplayName\":\"Fortnite\",\"InstallLocation\":\"C:\\\\Epic\\\\Fortnite\"," +
+                "\"LaunchExecutable\":\"FortniteGame/Binaries/Win64/FortniteLauncher.exe\",\"MainGameAppName\":\"Fortnite\"," +
+                "\"bIsIncompleteInstall\":false}");
+            var addOn = Write("9C1D0E.item",
+                "{\"AppName\":\"FortniteDLC\",\"MainGameAppName\":\"Fortnite\",\"bIsIncompleteInstall\":true}");
+
+            var gameManifest = LauncherManifests.ReadEpicManifest(game);
+            var addOnManifest = LauncherManifests.ReadEpicManifest(addOn);
+
+            Assert.NotNull(gameManifest);
+            Assert.Equal("Fortnite", gameManifest!.AppName);
+            Assert.Equal(@"C:\Epic\Fortnite", gameManifest.InstallLocation);
+            Assert.Equal("FortniteGame/Binaries/Win64/FortniteLauncher.exe", gameManifest.LaunchExecutable);
+            Assert.False(gameManifest.IsAddOn);
+            Assert.False(gameManifest.IsIncompleteInstall);
+
+            Assert.True(addOnManifest?.IsAddOn);
+            Assert.True(addOnManifest?.IsIncompleteInstall);
+        }
+
+        [Fact]
+        public void ReadEpicManifest_HalfWrittenFileReturnsNull()
+        {
+            var path = Write("4F3B2A.item", "{\"AppName\":\"Fortnite\",\"Displ");
+
+            Assert.Null(LauncherManifests.ReadEpicManifest(path));
+        }
+    }
+}
@@ -0,0 +1,186 @@
+using HUDRA.Services.LibraryWatch;
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using System.Threading;
+using Xunit;
+
+namespace HUDRA.Tests.LibraryWatch
+{
+    /// <summary>
+    /// Runs real FileSystemWatchers on a temp dir. The debouncer's clock stays frozen while files are
+    /// written, so a burst can't settle early on a slow disk; advancing it lets the next timer tick deliver.
+    /// </summary>
+    public class LibraryManifestWatcherTests : IDisposable
+    {
+        private static readonly TimeSpan Quiet = TimeSpan.FromMilliseconds(100);
+        private static readonly TimeSpan EventDelivery = TimeSpan.FromMilliseconds(500);
+
+        private readonly string _root;
+        private readonly ManualClock _clock = new ManualClock();
+        private readonly List<ManifestChange> _changes = new();
+        private readonly LibraryManifestWatcher _watcher;
+        private readonly SemaphoreSlim _batches = new SemaphoreSlim(0);
+        private int _batchCount;
+
+        public LibraryManifestWatcherTests()
+        {
+            _root = Path.Combine(Path.GetTempPath(), "HUDRA.Tests", Guid.NewGuid().ToString("N"));
+            Directory.CreateDirectory(_root);
+
+            _watcher = new LibraryManifestWatcher(Quiet, () => _clock.Now);
+            _watcher.ManifestsChanged += (_, changes) =>
+            {
+                lock (_changes)
+                {
+                    _changes.AddRange(changes);
+                    _batchCount++;
+                }
+                _batches.Release();
+            };
+        }
+
+        public void Dispose()
+        {
+            _watcher.Dispose();
+            _batches.Dispose();
+            try
+            {
+                Directory.Delete(_root, recursive: true);
+            }
+            catch (IOException)
+            {
+            }
+        }
+
+        private string CreateDirectory(params string[] parts)
+        {
+            var path = Path.Combine(new[] { _root }.Concat(parts).ToArray());
+            Directory.CreateDirectory(path);
+            return path;
+        }
+
+        /// <summary>
+        /// Lets the raw events arrive, then moves the clock past the quiet period and waits for the batch.
+        /// </summary>
+        private List<ManifestChange> Settle()
+        {
+            Thread.Sleep(EventDelivery);
+            _clock.Advance(Quiet * 2);
+            Assert.True(_batches.Wait(TimeSpan.FromSeconds(5)), "no batch delivered");
+
+            // Anything arriving late would be a second batch
+            Thread.Sleep(EventDelivery);
+            _clock.Advance(Quiet * 2);
+            Thread.Sleep(Quiet * 3);
+
+            lock (_changes)
+            {
+                Assert.Equal(1, _batchCount);
+                return _changes.ToList();
+            }
+        }
+
+        private static string AcfText(string appId, string installDir, int stateFlags = 4)
+        {
+            return $"\"AppState\"\n{{\n\t\"appid\"\t\t\"{appId}\"\n\t\"name\"\t\t\"{installDir}\"\n" +
+                   $"\t\"StateFlags\"\t\t\"{stateFlags}\"\n\t\"installdir\"\t\t\"{installDir}\"\n\t\"buildid\"\t\t\"13948201\"\n}}\n";
+        }
+
+        [Fact]
+        public void TenRapidAcfWritesReportOneChange()
+        {
+            var steamApps = CreateDirectory("SteamLibrary", "steamapps");
+            Assert.True(_watcher.WatchManifests(steamApps, "appmanifest_*.acf"));
+            var manifest = Path.Combine(steamApps, "appmanifest_1091500.acf");
+
+            for (int i = 0; i < 10; i++)
+            {
+                File.WriteAllText(manifest, AcfText("1091500", "Cyberpunk 2077", stateFlags: i < 9 ? 1026 : 4));
+                Thread.Sleep(5);
+            }
+
+            var change = Assert.Single(Settle());
+            Assert.Equal(new ManifestChange(manifest, ManifestKind.SteamApp), change);
+
+            // The targeted re-read sees the final write
+            var parsed = LauncherManifests.ReadSteamAppManifest(change.Path);
+            Assert.NotNull(parsed);
+            Assert.True(parsed!.IsFullyInstalled);
+        }
+
+        [Fact]
+        public void FolderCopyReportsOneLibraryChange()
+        {
+            var library = CreateDirectory("Games");
+            var source = CreateDirectory("Staging", "Hades");
+            Directory.CreateDirectory(Path.Combine(source, "x64"));
+            Directory.CreateDirectory(Path.Combine(source, "Content", "Audio"));
+            File.WriteAllText(Path.Combine(source, "x64", "Hades.exe"), "MZ");
+            File.WriteAllText(Path.Combine(source, "Content", "Audio", "music.bank"), new string('a', 4096));
+            Assert.True(_watcher.WatchLibraryFolder(library));
+
+            CopyDirectory(source, Path.Combine(library, "Hades"));
+            Directory.CreateDirectory(Path.Combine(library, "Hades2"));
+
+            var change = Assert.Single(Settle());
+            Assert.Equal(new ManifestChange(library, ManifestKind.LibraryFolder), change);
+        }
+
+        [Fact]
+        public void InstallAndUninstallThatSettleTogetherShareABatch()
+        {
+            var steamApps = CreateDirectory("SteamLibrary", "steamapps");
+            var installed = Path.Combine(steamApps, "appmanifest_1091500.acf");
+            var uninstalled = Path.Combine(steamApps, "appmanifest_570.acf");
+            File.WriteAllText(uninstalled, AcfText("570", "dota 2 beta"));
+            _watcher.WatchManifests(steamApps, "appmanifest_*.acf");
+
+            File.WriteAllText(installed, AcfText("1091500", "Cyberpunk 2077"));
+            File.Delete(uninstalled);
+
+            var changes = Settle();
+            Assert.Equal(new[] { installed, uninstalled }, changes.Select(c => c.Path));
+            Assert.All(changes, c => Assert.Equal(ManifestKind.SteamApp, c.Kind));
+
+            // A deleted manifest can't be re-read, but still names the app to drop
+            Assert.Null(LauncherManifests.ReadSteamAppManifest(uninstalled));
+            Assert.Equal("570", LauncherManifests.GetSteamAppId(uninstalled));
+        }
+
+        [Fact]
+        public void UnrelatedFilesInManifestFolderAreIgnored()
+        {
+            var manifests = CreateDirectory("Epic", "Manifests");
+            _watcher.WatchManifests(manifests, "*");
+
+            File.WriteAllText(Path.Combine(manifests, "Pending.tmp"), "{}");
+            File.WriteAllText(Path.Combine(manifests, "4F3B2A.item"), "{}");
+
+            var change = Assert.Single(Settle());
+            Assert.Equal(ManifestKind.EpicItem, change.Kind);
+        }
+
+        [Fact]
+        public void WatchSkipsMissingAndDuplicateFolders()
+        {
+            var steamApps = CreateDirectory("steamapps");
+
+            Assert.False(_watcher.WatchManifests(Path.Combine(_root, "missing"), "*.acf"));
+            Assert.True(_watcher.WatchManifests(steamApps, "appmanifest_*.acf"));
+            Assert.False(_watcher.WatchManifests(steamApps, "appmanifest_*.acf"));
+            Assert.True(_watcher.WatchManifests(steamApps, "libraryfolders.vdf"));
+            Assert.Equal(2, _watcher.WatchedFolderCount);
+        }
+
+        private static void CopyDirectory(string source, string destination)
+        {
+            Directory.CreateDirectory(destination);
+            foreach (var file in Directory.GetFiles(source))
+                File.Copy(file, Path.Combine(destination, Path.GetFileName(file)));
+            foreach (var directory in Directory.GetDirectories(source))
+                CopyDirectory(directory, Path.Combine(destination, Path.GetFileName(directory)));
+        }
+    }
+}
@@ -0,0 +1,165 @@
+using HUDRA.Services.LibraryWatch;
+using System;
+using System.Collections.Generic;
+using System.Threading;
+using Xunit;
+
+namespace HUDRA.Tests.LibraryWatch
+{
+    public class ManifestChangeDebouncerTests
+    {
+        // Long enough that the internal timer never fires during a test; Flush is called directly
+        private static readonly TimeSpan Quiet = TimeSpan.FromMinutes(5);
+
+        private const string AppManifest = @"D:\SteamLibrary\steamapps\appmanifest_1091500.acf";
+        private const string OtherManifest = @"D:\SteamLibrary\steamapps\appmanifest_570.acf";
+
+        private readonly ManualClock _clock = new ManualClock();
+        private readonly List<IReadOnlyList<string>> _batches = new();
+
+        private ManifestChangeDebouncer Create()
+        {
+            return new ManifestChangeDebouncer(Quiet, paths => _batches.Add(paths), () => _clock.Now);
+        }
+
+        [Fact]
+        public void RapidWritesToOnePathSettleOnce()
+        {
+            using var debouncer = Create();
+
+            for (int i = 0; i < 10; i++)
+            {
+                debouncer.Notify(AppManifest);
+                _clock.Advance(TimeSpan.FromMilliseconds(5));
+            }
+
+            _clock.Advance(Quiet);
+            debouncer.Flush();
+
+            Assert.Single(_batches);
+            Assert.Equal(new[] { AppManifest }, _batches[0]);
+            Assert.Equal(9, debouncer.CoalescedEvents);
+            Assert.Equal(0, debouncer.PendingCount);
+        }
+
+        [Fact]
+        public void EachEventRestartsTheQuietPeriod()
+        {
+            using var debouncer = Create();
+
+            debouncer.Notify(AppManifest);
+            _clock.Advance(Quiet * 0.9);
+            debouncer.Notify(AppManifest);
+            _clock.Advance(Quiet * 0.5);
+            debouncer.Flush();
+
+            Assert.Empty(_batches);
+            Assert.Equal(1, debouncer.PendingCount);
+
+            _clock.Advance(Quiet * 0.5);
+            debouncer.Flush();
+
+            Assert.Single(_batches);
+        }
+
+        [Fact]
+        public void PathsSettleIndependently()
+        {
+            using var debouncer = Create();
+
+            debouncer.Notify(AppManifest);
+            _clock.Advance(Quiet * 0.5);
+            debouncer.Notify(OtherManifest);
+            _clock.Advance(Quiet * 0.5);
+            debouncer.Flush();
+
+            Assert.Equal(new[] { AppManifest }, Assert.Single(_batches));
+
+            _clock.Advance(Quiet * 0.5);
+            debouncer.Flush();
+
+            Assert.Equal(2, _batches.Count);
+            Assert.Equal(new[] { OtherManifest }, _batches[1]);
+        }
+
+        [Fact]
+        public void PathsSettlingTogetherAreOneBatchInFirstNotifiedOrder()
+        {
+            using var debouncer = Create();
+
+            debouncer.Notify(OtherManifest);
+            debouncer.Notify(AppManifest);
+            debouncer.Notify(OtherManifest);
+            _clock.Advance(Quiet);
+            debouncer.Flush();
+
+            Assert.Equal(new[] { OtherManifest, AppManifest }, Assert.Single(_batches));
+        }
+
+        [Fact]
+        public void PathsCompareCaseInsensitively()
+        {
+            using var debouncer = Create();
+
+            debouncer.Notify(AppManifest);
+            debouncer.Notify(AppManifest.ToUpperInvariant());
+            _clock.Advance(Quiet);
+            debouncer.Flush();
+
+            Assert.Single(Assert.Single(_batches));
+            Assert.Equal(1, debouncer.CoalescedEvents);
+        }
+
+        [Fact]
+        public void FailingHandlerDoesNotStopLaterBatches()
+        {
+            int calls = 0;
+            using var debouncer = new ManifestChangeDebouncer(Quiet, _ =>
+            {
+                calls++;
+                throw new InvalidOperationException("handler");
+            }, () => _clock.Now);
+
+            debouncer.Notify(AppManifest);
+            _clock.Advance(Quiet);
+            debouncer.Flush();
+            debouncer.Notify(OtherManifest);
+            _clock.Advance(Quiet);
+            debouncer.Flush();
+
+            Assert.Equal(2, calls);
+        }
+
+        [Fact]
+        public void NotifyAfterDisposeIsIgnored()
+        {
+            var debouncer = Create();
+            debouncer.Notify(AppManifest);
+            debouncer.Dispose();
+
+            debouncer.Notify(OtherManifest);
+            _clock.Advance(Quiet);
+            debouncer.Flush();
+
+            Assert.Empty(_batches);
+            Assert.Equal(0, debouncer.PendingCount);
+        }
+
+        [Fact]
+        public void RejectsNonPositiveQuietPeriod()
+        {
+            Assert.Throws<ArgumentOutOfRangeException>(() => new ManifestChangeDebouncer(TimeSpan.Zero, _ => { }));
+        }
+
+        [Fact]
+        public void TimerDeliversWithoutExplicitFlush()
+        {
+            using var delivered = new ManualResetEventSlim();
+            using var debouncer = new ManifestChangeDebouncer(TimeSpan.FromMilliseconds(50), _ => delivered.Set());
+
+            debouncer.Notify(AppManifest);
+
+            Assert.True(delivered.Wait(TimeSpan.FromSeconds(5)));
+        }
+    }
+}
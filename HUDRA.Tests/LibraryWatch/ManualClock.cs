@@ -0,0 +1,16 @@
+using System;
+
+namespace HUDRA.Tests.LibraryWatch
+{
+    /// <summary>
+    /// Clock for the debouncer that only moves when told to. Read from timer threads.
+    /// </summary>
+    internal sealed class ManualClock
+    {
+        private long _ticks = new DateTime(2025, 1, 1, 12, 0, 0, DateTimeKind.Utc).Ticks;
+
+        public DateTime Now => new DateTime(System.Threading.Interlocked.Read(ref _ticks), DateTimeKind.Utc);
+
+        public void Advance(TimeSpan by) => System.Threading.Interlocked.Add(ref _ticks, by.Ticks);
+    }
+}
@@ -0,0 +1,121 @@
+using HUDRA.Services.Power;
+using System;
+using System.Collections.Generic;
+using System.Linq;
+
+namespace HUDRA.Tests.Power
+{
+    /// <summary>
+    /// A 1 Hz run of classifier observations with the state a player would say the game was in, built
+    /// from stretches of gameplay, menus, loading screens and pauses. Noise is seeded, so a trace is the
+    /// same every run. Defaults follow a handheld at its profile TDP: gameplay at 60 FPS and 85% GPU,
+    /// uncapped menus at 200 FPS on cheap frames.
+    /// </summary>
+    internal sealed class ActivityTrace
+    {
+        public readonly record struct Segment(int Start, int End, GameActivityState Label);
+
+        private readonly List<ActivityObservation> _observations = new();
+        private readonly List<Segment> _segments = new();
+        private readonly Random _random;
+        private long _timestampMs = 1_760_000_000_000;
+
+        public ActivityTrace(int seed = 95)
+        {
+            _random = new Random(seed);
+        }
+
+        public IReadOnlyList<ActivityObservation> Observations => _observations;
+
+        public IReadOnlyList<Segment> Segments => _segments;
+
+        public ActivityTrace Gameplay(int seconds, double fps = 60, double gpuLoad = 85, int cap = 0) =>
+            AddSteady(GameActivityState.Gameplay, seconds, fps, gpuLoad, cap);
+
+        public ActivityTrace Menu(int seconds, double fps = 200, double gpuLoad = 95, int cap = 0) =>
+            AddSteady(GameActivityState.Menu, seconds, fps, gpuLoad, cap);
+
+        public ActivityTrace Loading(int seconds, int cap = 0) =>
+            AddLoading(GameActivityState.Loading, seconds, cap);
+
+        public ActivityTrace Paused(int seconds) =>
+            AddPaused(GameActivityState.Paused, seconds);
+
+        /// <summary>
+        /// A few seconds that look like <paramref name="looksLike"/> in the middle of play: a scene cut,
+        /// a shader-compile hitch, an inventory flicked open. Labeled gameplay; nothing should react.
+        /// </summary>
+        public ActivityTrace Blip(GameActivityState looksLike, int seconds) => looksLike switch
+        {
+            GameActivityState.Menu => AddSteady(GameActivityState.Gameplay, seconds, 200, 95, 0),
+            GameActivityState.Loading => AddLoading(GameActivityState.Gameplay, seconds, 0),
+            GameActivityState.Paused => AddPaused(GameActivityState.Gameplay, seconds),
+            _ => AddSteady(GameActivityState.Gameplay, seconds, 60, 85, 0)
+        };
+
+        public GameActivityState[] Replay(GameStateClassifier classifier) =>
+            _observations.Select(o => classifier.Add(o)).ToArray();
+
+        private ActivityTrace AddSteady(GameActivityState label, int seconds, double fps, double gpuLoad, int cap)
+        {
+            return Add(label, seconds, () =>
+            {
+                double frameRate = Jitter(cap > 0 ? Math.Min(fps, cap) : fps, 0.04);
+                return Observe(frameRate, 1000 / frameRate * Jitter(1, 0.08), Math.Min(100, Jitter(gpuLoad, 0.05)), cap);
+            });
+        }
+
+        private ActivityTrace AddLoading(GameActivityState label, int seconds, int cap)
+        {
+            return Add(label, seconds, () =>
+            {
+                // Stalls while assets stream in, bursts of fast frames in between. The frames themselves are
+                // cheap (a spinner or a still); the time goes to CPU and disk, so the GPU mostly waits.
+                double fps = 4 + _random.NextDouble() * 36;
+                if (cap > 0) fps = Math.Min(fps, cap);
+                double frameTime = 1000 / fps * (_random.NextDouble() < 0.3 ? 4 : 0.5 + _random.NextDouble());
+                return Observe(fps, frameTime, 5 + fps * (0.3 + _random.NextDouble() * 0.5), cap);
+            });
+        }
+
+        private ActivityTrace AddPaused(GameActivityState label, int seconds)
+        {
+            // The last cap stays in force while paused
+            int cap = _observations.Count > 0 ? _observations[^1].FpsCap : 0;
+            return Add(label, seconds, () =>
+            {
+                double fps = _random.NextDouble() * 1.5;
+                return Observe(fps, fps > 0 ? 1000 / fps : 0, 2 + _random.NextDouble() * 6, cap);
+            });
+        }
+
+        private ActivityTrace Add(GameActivityState label, int seconds, Func<ActivityObservation> next)
+        {
+            int start = _observations.Count;
+            for (int i = 0; i < seconds; i++)
+                _observations.Add(next());
+
+            if (_segments.Count > 0 && _segments[^1].Label == label)
+                _segments[^1] = _segments[^1] with { End = _observations.Count };
+            else
+                _segments.Add(new Segment(start, _observations.Count, label));
+            return this;
+        }
+
+        private ActivityObservation Observe(double fps, double frameTimeMs, double gpuLoad, int cap)
+        {
+            _timestampMs += 1_000;
+            return new ActivityObservation
+            {
+                TimestampMs = _timestampMs,
+                Fps = fps,
+                FrameTimeMs = frameTimeMs,
+                GpuLoadPercent = gpuLoad,
+                FpsCap = cap
+            };
+        }
+
+        private double Jitter(double value, double fraction) =>
+            value * (1 + (_random.NextDouble() * 2 - 1) * fraction);
+    }
+}
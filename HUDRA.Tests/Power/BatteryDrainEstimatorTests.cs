@@ -0,0 +1,149 @@
+using HUDRA.Services.Power;
+using System;
+using System.Linq;
+using Xunit;
+using static HUDRA.Tests.Power.DischargeTrace;
+
+namespace HUDRA.Tests.Power
+{
+    public class BatteryDrainEstimatorTests
+    {
+        private static BatteryDrainEstimator Replay(int end, Func<Row, BatteryReading>? map = null, BatteryDrainEstimator? estimator = null)
+        {
+            estimator ??= new BatteryDrainEstimator();
+            foreach (var row in Rows.Take(end))
+                estimator.Add(map?.Invoke(row) ?? row.ToReading());
+            return estimator;
+        }
+
+        private static BatteryReading WithoutPackage(Row row) => row.ToReading() with { PackagePowerWatts = double.NaN };
+
+        [Theory]
+        [InlineData(FifteenWattEnd)]
+        [InlineData(EightWattEnd)]
+        [InlineData(TwentyFiveWattEnd)]
+        public void Replay_SettlesOnEachTdpStep(int end)
+        {
+            var estimator = Replay(end);
+
+            // Last five minutes of the step, well past the battery's lag
+            double expected = MeanDischarge(end - 60, end);
+            Assert.InRange(estimator.SmoothedWatts, expected - 0.8, expected + 0.8);
+        }
+
+        [Fact]
+        public void Replay_LearnsOverheadBeyondPackagePower()
+        {
+            var estimator = Replay(FifteenWattEnd);
+
+            double expected = Rows.Skip(60).Take(FifteenWattEnd - 60)
+                .Where(r => !double.IsNaN(r.PackageWatts))
+                .Average(r => r.DischargeWatts - r.PackageWatts);
+            Assert.InRange(estimator.OverheadWatts, expected - 0.7, expected + 0.7);
+        }
+
+        [Fact]
+        public void Replay_PackagePowerFollowsTdpDropBeforeBatteryRate()
+        {
+            // A minute after 15 W drops to 8 W
+            int end = FifteenWattEnd + 12;
+            double target = MeanDischarge(EightWattEnd - 60, EightWattEnd);
+
+            double withPackage = Math.Abs(Replay(end).SmoothedWatts - target);
+            double batteryOnly = Math.Abs(Replay(end, WithoutPackage).SmoothedWatts - target);
+
+            Assert.True(withPackage < 1.0, $"with package {withPackage:F2} W off");
+            Assert.True(batteryOnly > 3 * withPackage, $"battery only {batteryOnly:F2} W off, with package {withPackage:F2}");
+        }
+
+        [Fact]
+        public void Replay_BatteryRateOnlySettlesOnReportedRate()
+        {
+            var estimator = Replay(FifteenWattEnd, WithoutPackage);
+
+            double expected = MeanDischarge(FifteenWattEnd - 60, FifteenWattEnd);
+            Assert.InRange(estimator.SmoothedWatts, expected - 0.8, expected + 0.8);
+            Assert.True(double.IsNaN(estimator.OverheadWatts));
+        }
+
+        [Fact]
+        public void Replay_CapacityOnlyFallsBackToCapacityDrop()
+        {
+            var estimator = Replay(FifteenWattEnd, r => BatteryReading.Empty(r.TimestampMs) with { RemainingWh = r.RemainingWh });
+
+            // Capacity is in 10 mWh steps, so the one-minute spans are only good to a few percent
+            double expected = MeanDischarge(FifteenWattEnd - 60, FifteenWattEnd);
+            Assert.InRange(estimator.SmoothedWatts, expected * 0.9, expected * 1.1);
+        }
+
+        [Fact]
+        public void Replay_NoEstimateBeforeFirstCapacitySpan()
+        {
+            // Under a minute of capacity readings can't give a rate
+            var estimator = Replay(12, r => BatteryReading.Empty(r.TimestampMs) with { RemainingWh = r.RemainingWh });
+
+            Assert.False(estimator.HasEstimate);
+            Assert.Null(estimator.EstimateRemaining(40));
+        }
+
+        [Fact]
+        public void Charging_ClearsEstimateButKeepsOverhead()
+        {
+            var estimator = Replay(TwentyFiveWattEnd);
+            double overhead = estimator.OverheadWatts;
+
+            estimator.Add(Rows[TwentyFiveWattEnd].ToReading());
+
+            Assert.False(estimator.HasEstimate);
+            Assert.Equal(overhead, estimator.OverheadWatts);
+
+            // Unplugged again: the learned overhead carries the estimate straight away
+            Replay(ChargingEnd, estimator: estimator);
+            var first = Rows.Skip(ChargingEnd).First(r => !double.IsNaN(r.PackageWatts));
+            estimator.Add(first.ToReading());
+            Assert.True(estimator.HasEstimate);
+            Assert.InRange(estimator.SmoothedWatts, first.PackageWatts, first.PackageWatts + overhead + 0.5);
+
+            Replay(Rows.Count, estimator: estimator);
+            double expected = MeanDischarge(Rows.Count - 36, Rows.Count);
+            Assert.InRange(estimator.SmoothedWatts, expected - 0.8, expected + 0.8);
+        }
+
+        [Fact]
+        public void Gap_RestartsSmoothingInsteadOfAveragingAcrossIt()
+        {
+            long last = Rows[TwentyFiveWattEnd - 1].TimestampMs;
+            var wake = new BatteryReading { TimestampMs = last, RemainingWh = 20, DischargeWatts = 9, PackagePowerWatts = double.NaN };
+
+            var afterSleep = Replay(TwentyFiveWattEnd);
+            afterSleep.Add(wake with { TimestampMs = last + (long)TimeSpan.FromMinutes(11).TotalMilliseconds });
+            var afterPause = Replay(TwentyFiveWattEnd);
+            afterPause.Add(wake with { TimestampMs = last + (long)TimeSpan.FromMinutes(5).TotalMilliseconds });
+
+            Assert.Equal(9, afterSleep.SmoothedWatts);
+            Assert.True(afterPause.SmoothedWatts > 9.5, $"{afterPause.SmoothedWatts:F2} W");
+        }
+
+        [Fact]
+        public void EstimateRemaining_DividesRemainingByRate()
+        {
+            var estimator = Replay(FifteenWattEnd);
+
+            Assert.Equal(TimeSpan.FromHours(40 / estimator.SmoothedWatts), estimator.EstimateRemaining(40));
+            Assert.Null(estimator.EstimateRemaining(0));
+            Assert.Null(estimator.EstimateRemaining(double.NaN));
+            Assert.Null(new BatteryDrainEstimator().EstimateRemaining(40));
+        }
+
+        [Fact]
+        public void Reset_ForgetsOverhead()
+        {
+            var estimator = Replay(FifteenWattEnd);
+
+            estimator.Reset();
+
+            Assert.False(estimator.HasEstimate);
+            Assert.True(double.IsNaN(estimator.OverheadWatts));
+        }
+    }
+}
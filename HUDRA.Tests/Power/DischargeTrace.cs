@@ -0,0 +1,76 @@
+using HUDRA.Services.Power;
+using HUDRA.Services.SessionHistory;
+using System;
+using System.Collections.Generic;
+using System.Globalization;
+using System.IO;
+using System.Linq;
+
+namespace HUDRA.Tests.Power
+{
+    /// <summary>
+    /// Fixtures\Power\discharge_trace.csv: 37 minutes of one game on battery at the recorder's 5 s rate.
+    /// 12 minutes at 15 W TDP, 12 at 8 W (frame-capped, package just under TDP), 6 at 25 W (package tops
+    /// out near 22 W), 2 on the charger, then 5 more at 15 W. The battery's rate lags package power by
+    /// most of a minute and is noisy; about one package reading in twenty is missing.
+    /// </summary>
+    internal static class DischargeTrace
+    {
+        public const int FifteenWattEnd = 144;
+        public const int EightWattEnd = 288;
+        public const int TwentyFiveWattEnd = 360;
+        public const int ChargingEnd = 384;
+
+        public readonly record struct Row(long TimestampMs, int TdpWatts, double PackageWatts, double DischargeWatts, double RemainingWh)
+        {
+            public BatteryReading ToReading() => new BatteryReading
+            {
+                TimestampMs = TimestampMs,
+                RemainingWh = RemainingWh,
+                DischargeWatts = DischargeWatts,
+                PackagePowerWatts = PackageWatts
+            };
+
+            public SessionSample ToSample()
+            {
+                var sample = SessionSample.Empty(TimestampMs);
+                sample.TdpWatts = TdpWatts;
+                sample.PackagePowerWatts = (float)PackageWatts;
+                sample.BatteryDischargeWatts = (float)DischargeWatts;
+                return sample;
+            }
+        }
+
+        private static readonly Lazy<Row[]> _rows = new(Load);
+
+        public static IReadOnlyList<Row> Rows => _rows.Value;
+
+        /// <summary>
+        /// Mean reported discharge over rows [start, end), the reference the smoothed value should settle on.
+        /// </summary>
+        public static double MeanDischarge(int start, int end) =>
+            Rows.Skip(start).Take(end - start).Average(r => r.DischargeWatts);
+
+        private static Row[] Load()
+        {
+            var path = Path.Combine(AppContext.BaseDirectory, "Fixtures", "Power", "discharge_trace.csv");
+            return File.ReadLines(path)
+                .Skip(1)
+                .Where(line => line.Length > 0)
+                .Select(line =>
+                {
+                    var f = line.Split(',');
+                    return new Row(
+                        long.Parse(f[0], CultureInfo.InvariantCulture),
+                        int.Parse(f[1], CultureInfo.InvariantCulture),
+                        Parse(f[2]),
+                        Parse(f[3]),
+                        Parse(f[4]));
+                })
+                .ToArray();
+        }
+
+        private static double Parse(string field) =>
+            field.Length == 0 ? double.NaN : double.Parse(field, CultureInfo.InvariantCulture);
+    }
+}
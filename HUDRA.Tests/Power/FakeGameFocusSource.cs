@@ -0,0 +1,20 @@
+using HUDRA.Services.Power;
+using System.Collections.Generic;
+
+namespace HUDRA.Tests.Power
+{
+    /// <summary>
+    /// Reports <see cref="Focus"/> for every process and records which PIDs were asked about.
+    /// </summary>
+    internal sealed class FakeGameFocusSource : IGameFocusSource
+    {
+        public GameFocus Focus { get; set; } = GameFocus.Foreground;
+        public List<int> Queried { get; } = new();
+
+        public GameFocus GetGameFocus(int processId)
+        {
+            Queried.Add(processId);
+            return Focus;
+        }
+    }
+}
@@ -0,0 +1,60 @@
+using HUDRA.Services.Power;
+using System;
+using System.Collections.Generic;
+
+namespace HUDRA.Tests.Power
+{
+    /// <summary>
+    /// TDP and cap as plain values, with every write recorded. The game renders <see cref="Fps"/> frames
+    /// of <see cref="GpuCostPerFrame"/> each, held down to the cap when one is set, so the saver sees its
+    /// own cap the way it would through RTSS: fewer frames and a lighter GPU load.
+    /// </summary>
+    internal sealed class FakePowerSaverControl : IPowerSaverControl
+    {
+        public int CurrentTdp { get; set; }
+        public int CurrentFpsLimit { get; set; }
+        public bool FailTdp { get; set; }
+        public bool FailFpsLimit { get; set; }
+
+        public double Fps { get; set; } = 60;
+        public double GpuCostPerFrame { get; set; } = 85 / 60.0; // GPU load percent per FPS
+
+        public List<int> TdpWrites { get; } = new();
+        public List<int> FpsLimitWrites { get; } = new();
+        public List<int> ObservedProcessIds { get; } = new();
+
+        public bool TrySetTdp(int watts)
+        {
+            if (FailTdp)
+                return false;
+
+            TdpWrites.Add(watts);
+            CurrentTdp = watts;
+            return true;
+        }
+
+        public bool TrySetFpsLimit(int fps)
+        {
+            if (FailFpsLimit)
+                return false;
+
+            FpsLimitWrites.Add(fps);
+            CurrentFpsLimit = fps;
+            return true;
+        }
+
+        public ActivityObservation Observe(int processId, long timestampMs)
+        {
+            ObservedProcessIds.Add(processId);
+            double fps = CurrentFpsLimit > 0 ? Math.Min(Fps, CurrentFpsLimit) : Fps;
+            return new ActivityObservation
+            {
+                TimestampMs = timestampMs,
+                Fps = fps,
+                FrameTimeMs = fps > 0 ? 1000 / fps : double.NaN,
+                GpuLoadPercent = Math.Min(100, GpuCostPerFrame * fps),
+                FpsCap = CurrentFpsLimit
+            };
+        }
+    }
+}
@@ -0,0 +1,60 @@
+using HUDRA.Models;
+using HUDRA.Services.Power;
+using System;
+using System.Collections.Generic;
+
+namespace HUDRA.Tests.Power
+{
+    /// <summary>
+    /// A power plan store holding several plans. A failing write lands the plugged-in index and then fails,
+    /// the way a PowerWriteACValueIndex / PowerWriteDCValueIndex pair can stop half way.
+    /// </summary>
+    internal sealed class FakeProcessorPowerApi : IProcessorPowerApi
+    {
+        private readonly Dictionary<(Guid, ProcessorPowerSetting), PowerSettingIndex> _values = new();
+
+        public FakeProcessorPowerApi(Guid? active)
+        {
+            Active = active;
+        }
+
+        public Guid? Active { get; set; }
+        public List<Guid> Activations { get; } = new();
+        public HashSet<ProcessorPowerSetting> FailWrites { get; } = new();
+        public bool FailActivate { get; set; }
+        public int Writes { get; private set; }
+
+        public FakeProcessorPowerApi Set(Guid schemeId, ProcessorPowerSetting setting, uint ac, uint dc)
+        {
+            _values[(schemeId, setting)] = new PowerSettingIndex(ac, dc);
+            return this;
+        }
+
+        public PowerSettingIndex Get(Guid schemeId, ProcessorPowerSetting setting) => _values[(schemeId, setting)];
+
+        public Guid? GetActiveScheme() => Active;
+
+        public bool TryRead(Guid schemeId, ProcessorPowerSetting setting, out PowerSettingIndex value) =>
+            _values.TryGetValue((schemeId, setting), out value);
+
+        public bool TryWrite(Guid schemeId, ProcessorPowerSetting setting, PowerSettingIndex value)
+        {
+            Writes++;
+            if (FailWrites.Contains(setting))
+            {
+                uint dc = _values.TryGetValue((schemeId, setting), out var old) ? old.Dc : 0;
+                _values[(schemeId, setting)] = new PowerSettingIndex(value.Ac, dc);
+                return false;
+            }
+
+            _values[(schemeId, setting)] = value;
+            return true;
+        }
+
+        public bool TryActivate(Guid schemeId)
+        {
+            Activations.Add(schemeId);
+            return !FailActivate;
+        }
+    }
+}
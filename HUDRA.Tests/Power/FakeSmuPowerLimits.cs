@@ -0,0 +1,79 @@
+using HUDRA.Services.Power;
+using System;
+using System.Collections.Generic;
+
+namespace HUDRA.Tests.Power
+{
+    /// <summary>
+    /// An SMU holding limits in watts (degrees C for Tctl). Accepted writes change the table unless the limit
+    /// is in <see cref="Ignores"/>, the way some firmware acknowledges and does nothing. Reads come from the
+    /// copy taken at the last successful refresh, as libryzenadj's PM table does.
+    /// </summary>
+    internal sealed class FakeSmuPowerLimits : ISmuPowerLimits
+    {
+        private readonly Dictionary<SmuLimit, double> _limits = new();
+        private Dictionary<SmuLimit, double> _table = new();
+
+        public FakeSmuPowerLimits(double stapm, double slow, double fast, double apuSlow = 25, double tctl = 95)
+        {
+            _limits[SmuLimit.Stapm] = stapm;
+            _limits[SmuLimit.Slow] = slow;
+            _limits[SmuLimit.Fast] = fast;
+            _limits[SmuLimit.ApuSlow] = apuSlow;
+            _limits[SmuLimit.Tctl] = tctl;
+        }
+
+        public List<(SmuLimit Limit, uint Value)> Writes { get; } = new();
+        public HashSet<SmuLimit> NoSetter { get; } = new();
+        public HashSet<SmuLimit> Ignores { get; } = new();
+        public HashSet<SmuLimit> Unreported { get; } = new();
+        public Dictionary<SmuLimit, int> Statuses { get; } = new();
+
+        /// <summary>
+        /// Added to each accepted watt limit, as the SMU rounding to its own steps does.
+        /// </summary>
+        public double StepError { get; set; }
+
+        public bool RefreshFails { get; set; }
+        public int Refreshes { get; private set; }
+
+        /// <summary>
+        /// Set once any write leaves STAPM above slow or slow above fast.
+        /// </summary>
+        public bool OrderViolated { get; private set; }
+
+        public double this[SmuLimit limit] => _limits[limit];
+
+        public bool CanWrite(SmuLimit limit) => !NoSetter.Contains(limit);
+
+        public int Write(SmuLimit limit, uint value)
+        {
+            if (NoSetter.Contains(limit))
+                throw new InvalidOperationException($"{limit} has no setter");
+
+            Writes.Add((limit, value));
+            if (Statuses.TryGetValue(limit, out int status) && status != 0)
+                return status;
+
+            if (!Ignores.Contains(limit))
+                _limits[limit] = limit == SmuLimit.Tctl ? value : value / 1000.0 + StepError;
+
+            if (_limits[SmuLimit.Stapm] > _limits[SmuLimit.Slow] || _limits[SmuLimit.Slow] > _limits[SmuLimit.Fast])
+                OrderViolated = true;
+            return 0;
+        }
+
+        public bool Refresh()
+        {
+            Refreshes++;
+            if (RefreshFails)
+                return false;
+
+            _table = new Dictionary<SmuLimit, double>(_limits);
+            return true;
+        }
+
+        public double Read(SmuLimit limit) =>
+            !Unreported.Contains(limit) && _table.TryGetValue(limit, out double value) ? value : double.NaN;
+    }
+}
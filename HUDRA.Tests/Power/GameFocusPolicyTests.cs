@@ -0,0 +1,110 @@
+using HUDRA.Services.Power;
+using System;
+using Xunit;
+
+namespace HUDRA.Tests.Power
+{
+    public class GameFocusPolicyTests
+    {
+        private static readonly long Grace = (long)GameFocusPolicy.DefaultGracePeriod.TotalMilliseconds;
+        private static readonly long MinimizedGrace = (long)GameFocusPolicy.DefaultMinimizedGracePeriod.TotalMilliseconds;
+
+        [Fact]
+        public void Background_ThrottlesOnceGracePeriodHasPassed()
+        {
+            var policy = new GameFocusPolicy();
+
+            Assert.False(policy.Update(1_000, GameFocus.Background));
+            Assert.False(policy.Update(1_000 + Grace - 1, GameFocus.Background));
+            Assert.True(policy.Update(1_000 + Grace, GameFocus.Background));
+            Assert.True(policy.IsThrottled);
+        }
+
+        [Fact]
+        public void Minimized_UsesShorterGracePeriod()
+        {
+            var policy = new GameFocusPolicy();
+
+            Assert.False(policy.Update(1_000, GameFocus.Minimized));
+            Assert.False(policy.Update(1_000 + MinimizedGrace - 1, GameFocus.Minimized));
+            Assert.True(policy.Update(1_000 + MinimizedGrace, GameFocus.Minimized));
+        }
+
+        [Fact]
+        public void Minimized_CountsFromFirstLeavingForeground()
+        {
+            // Alt-tabbed away, then minimized: the time in the background already counts
+            var policy = new GameFocusPolicy();
+
+            policy.Update(0, GameFocus.Background);
+            Assert.False(policy.Update(2_000, GameFocus.Background));
+            Assert.True(policy.Update(MinimizedGrace, GameFocus.Minimized));
+        }
+
+        [Fact]
+        public void ShortAltTab_NeverThrottlesAndRestartsGrace()
+        {
+            var policy = new GameFocusPolicy();
+
+            policy.Update(0, GameFocus.Background);
+            Assert.False(policy.Update(Grace - 1_000, GameFocus.Background));
+            Assert.False(policy.Update(Grace, GameFocus.Foreground));
+
+            // Away again: a fresh grace period, not the remainder of the last one
+            Assert.False(policy.Update(Grace + 1_000, GameFocus.Background));
+            Assert.False(policy.Update(2 * Grace, GameFocus.Background));
+            Assert.True(policy.Update(2 * Grace + 1_000, GameFocus.Background));
+        }
+
+        [Fact]
+        public void Refocus_RestoresOnSameUpdate()
+        {
+            var policy = new GameFocusPolicy();
+            policy.Update(0, GameFocus.Background);
+            policy.Update(Grace, GameFocus.Background);
+
+            Assert.False(policy.Update(Grace + 1, GameFocus.Foreground));
+            Assert.False(policy.IsThrottled);
+        }
+
+        [Fact]
+        public void Unknown_CountsAsForeground()
+        {
+            var policy = new GameFocusPolicy();
+            policy.Update(0, GameFocus.Background);
+
+            Assert.False(policy.Update(Grace - 1, GameFocus.Unknown));
+            Assert.False(policy.Update(Grace, GameFocus.Background));
+
+            // And it restores a throttled game, same as foreground
+            policy.Update(2 * Grace, GameFocus.Background);
+            Assert.True(policy.IsThrottled);
+            Assert.False(policy.Update(2 * Grace + 1, GameFocus.Unknown));
+        }
+
+        [Fact]
+        public void Reset_ClearsThrottleAndGraceClock()
+        {
+            var policy = new GameFocusPolicy();
+            policy.Update(0, GameFocus.Background);
+            policy.Update(Grace, GameFocus.Background);
+
+            policy.Reset();
+
+            Assert.False(policy.IsThrottled);
+            Assert.False(policy.Update(Grace + 1, GameFocus.Background));
+            Assert.True(policy.Update(2 * Grace + 1, GameFocus.Background));
+        }
+
+        [Fact]
+        public void CustomGracePeriods()
+        {
+            var policy = new GameFocusPolicy(TimeSpan.FromSeconds(30), TimeSpan.Zero);
+
+            Assert.True(policy.Update(0, GameFocus.Minimized));
+            policy.Update(1, GameFocus.Foreground);
+            Assert.False(policy.Update(2, GameFocus.Background));
+            Assert.True(policy.Update(30_002, GameFocus.Background));
+        }
+    }
+}
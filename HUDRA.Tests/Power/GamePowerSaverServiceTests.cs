@@ -0,0 +1,343 @@
+using HUDRA.Models;
+using HUDRA.Services.Power;
+using System;
+using System.Linq;
+using System.Threading;
+using Xunit;
+
+namespace HUDRA.Tests.Power
+{
+    public class GamePowerSaverServiceTests : IDisposable
+    {
+        private const int GamePid = 4242;
+        private const int ProfileTdp = 15;
+
+        // Enough gameplay to fill the classifier's window and learn a baseline
+        private const int WarmUpSeconds = GameStateClassifier.WindowSize + GameStateClassifier.BaselineObservations + 2;
+        private const int MenuEnterSeconds = GameStateClassifier.WindowSize + GameStateClassifier.EnterObservations;
+
+        private static readonly int GraceSeconds = (int)GameFocusPolicy.DefaultGracePeriod.TotalSeconds;
+        private static readonly int MinimizedGraceSeconds = (int)GameFocusPolicy.DefaultMinimizedGracePeriod.TotalSeconds;
+
+        private readonly FakePowerSaverControl _control = new() { CurrentTdp = ProfileTdp };
+        private readonly FakeGameFocusSource _focus = new();
+        private readonly GamePowerSaverService _saver;
+        private PowerSaverSettings _settings = new()
+        {
+            MenuEnabled = true,
+            MenuTdp = 8,
+            MenuFpsLimit = 30,
+            BackgroundEnabled = true,
+            BackgroundTdp = 5,
+            BackgroundFpsLimit = 10
+        };
+        private long _now = 1_760_000_000_000;
+
+        public GamePowerSaverServiceTests()
+        {
+            _saver = new GamePowerSaverService(_control, () => _focus, () => _settings, Timeout.InfiniteTimeSpan);
+        }
+
+        public void Dispose() => _saver.Dispose();
+
+        private void Start() => _saver.Start(new GameInfo { ProcessId = GamePid, ProcessName = "Game.exe" });
+
+        private void Run(int seconds)
+        {
+            for (int i = 0; i < seconds; i++)
+            {
+                _now += 1_000;
+                _saver.Poll(_now);
+            }
+        }
+
+        private void Play()
+        {
+            _control.Fps = 60;
+            _control.GpuCostPerFrame = 85 / 60.0;
+        }
+
+        // Uncapped menu: flat out on cheap frames
+        private void OpenMenu()
+        {
+            _control.Fps = 200;
+            _control.GpuCostPerFrame = 95 / 200.0;
+        }
+
+        private void AssertProfile()
+        {
+            Assert.Equal(ProfileTdp, _control.CurrentTdp);
+            Assert.Equal(0, _control.CurrentFpsLimit);
+        }
+
+        private void AssertBackgroundThrottled()
+        {
+            Assert.True(_saver.IsBackgroundThrottled);
+            Assert.Equal(_settings.BackgroundTdp, _control.CurrentTdp);
+            Assert.Equal(_settings.BackgroundFpsLimit, _control.CurrentFpsLimit);
+        }
+
+        [Fact]
+        public void Background_ThrottlesAfterGraceAndRestoresOnRefocus()
+        {
+            Start();
+            Run(5);
+            _focus.Focus = GameFocus.Background;
+
+            // The first background poll starts the clock
+            Run(GraceSeconds);
+            Assert.False(_saver.IsBackgroundThrottled);
+            Assert.Empty(_control.TdpWrites);
+
+            Run(1);
+            AssertBackgroundThrottled();
+
+            _focus.Focus = GameFocus.Foreground;
+            Run(1);
+            Assert.False(_saver.IsBackgroundThrottled);
+            AssertProfile();
+            Assert.Equal(new[] { 5, ProfileTdp }, _control.TdpWrites);
+            Assert.Equal(new[] { 10, 0 }, _control.FpsLimitWrites);
+            Assert.All(_focus.Queried, pid => Assert.Equal(GamePid, pid));
+        }
+
+        [Fact]
+        public void Minimized_ThrottlesAfterShorterGrace()
+        {
+            Start();
+            _focus.Focus = GameFocus.Minimized;
+
+            Run(MinimizedGraceSeconds);
+            Assert.False(_saver.IsBackgroundThrottled);
+
+            Run(1);
+            AssertBackgroundThrottled();
+        }
+
+        [Fact]
+        public void ShortAltTab_ChangesNothing()
+        {
+            Start();
+            for (int i = 0; i < 3; i++)
+            {
+                _focus.Focus = GameFocus.Background;
+                Run(GraceSeconds);
+                _focus.Focus = GameFocus.Foreground;
+                Run(1);
+            }
+
+            Assert.False(_saver.IsBackgroundThrottled);
+            Assert.Empty(_control.TdpWrites);
+            Assert.Empty(_control.FpsLimitWrites);
+        }
+
+        [Fact]
+        public void UnknownFocus_TreatedAsForeground()
+        {
+            Start();
+            _focus.Focus = GameFocus.Unknown;
+            Run(3 * GraceSeconds);
+
+            Assert.False(_saver.IsBackgroundThrottled);
+            Assert.Empty(_control.TdpWrites);
+        }
+
+        [Fact]
+        public void NoFocusSource_TreatedAsForeground()
+        {
+            using var saver = new GamePowerSaverService(_control, () => null, () => _settings, Timeout.InfiniteTimeSpan);
+            saver.Start(new GameInfo { ProcessId = GamePid, ProcessName = "Game.exe" });
+
+            for (int i = 0; i < 3 * GraceSeconds; i++)
+                saver.Poll(_now += 1_000);
+
+            Assert.False(saver.IsBackgroundThrottled);
+            Assert.Empty(_control.TdpWrites);
+        }
+
+        [Fact]
+        public void HoldAndRelease_RestoreProfileAndRestartGrace()
+        {
+            Start();
+            _focus.Focus = GameFocus.Background;
+            Run(GraceSeconds + 1);
+            AssertBackgroundThrottled();
+
+            _saver.Hold();
+            AssertProfile();
+            Run(GraceSeconds);
+            AssertProfile();
+
+            // Time away before and during the hold doesn't count
+            _saver.Release();
+            Run(GraceSeconds);
+            Assert.False(_saver.IsBackgroundThrottled);
+            AssertProfile();
+            Run(1);
+            AssertBackgroundThrottled();
+        }
+
+        [Fact]
+        public void Start_NewGameResetsFocusAndClassifier()
+        {
+            Start();
+            _focus.Focus = GameFocus.Background;
+            Run(GraceSeconds - 2);
+
+            _saver.Start(new GameInfo { ProcessId = GamePid + 1, ProcessName = "Other.exe" });
+            Run(GraceSeconds);
+
+            Assert.False(_saver.IsBackgroundThrottled);
+            Assert.Equal(GamePid + 1, _focus.Queried[^1]);
+        }
+
+        [Fact]
+        public void MenuThenBackgroundThenMenu_DeeperWinsAndProfileComesBack()
+        {
+            Start();
+            Run(WarmUpSeconds);
+            Assert.Empty(_control.TdpWrites);
+
+            OpenMenu();
+            Run(MenuEnterSeconds);
+            Assert.Equal(GameActivityState.Menu, _saver.State);
+            Assert.Equal(_settings.MenuTdp, _control.CurrentTdp);
+            Assert.Equal(_settings.MenuFpsLimit, _control.CurrentFpsLimit);
+
+            // Alt-tab out of the menu: background is the deeper saving
+            _focus.Focus = GameFocus.Background;
+            Run(GraceSeconds + 1);
+            AssertBackgroundThrottled();
+
+            // Back in: the game is still on its menu, seen through the background cap
+            _focus.Focus = GameFocus.Foreground;
+            Run(1);
+            Assert.False(_saver.IsBackgroundThrottled);
+            Assert.Equal(GameActivityState.Menu, _saver.State);
+            Assert.Equal(_settings.MenuTdp, _control.CurrentTdp);
+            Assert.Equal(_settings.MenuFpsLimit, _control.CurrentFpsLimit);
+
+            // The profile's values, not an intermediate saver level, on the first gameplay frame
+            Play();
+            Run(1);
+            Assert.Equal(GameActivityState.Gameplay, _saver.State);
+            AssertProfile();
+            Assert.Equal(new[] { 8, 5, 8, ProfileTdp }, _control.TdpWrites);
+            Assert.Equal(new[] { 30, 10, 30, 0 }, _control.FpsLimitWrites);
+        }
+
+        [Fact]
+        public void Background_ClassifierPausedWhileThrottled()
+        {
+            Start();
+            Run(WarmUpSeconds);
+            _focus.Focus = GameFocus.Background;
+            Run(GraceSeconds + 1);
+            int observed = _control.ObservedProcessIds.Count;
+
+            // Whatever the throttled game renders now isn't read as a menu
+            OpenMenu();
+            Run(3 * MenuEnterSeconds);
+
+            Assert.Equal(observed, _control.ObservedProcessIds.Count);
+            Assert.Equal(GameActivityState.Gameplay, _saver.State);
+        }
+
+        [Fact]
+        public void UserChangesWhileThrottled_AreKept()
+        {
+            Start();
+            _focus.Focus = GameFocus.Background;
+            Run(GraceSeconds + 1);
+
+            _control.CurrentTdp = 12;
+            _control.CurrentFpsLimit = 20;
+            Run(3);
+            _focus.Focus = GameFocus.Foreground;
+            Run(1);
+
+            Assert.Equal(12, _control.CurrentTdp);
+            Assert.Equal(20, _control.CurrentFpsLimit);
+            Assert.Equal(new[] { 5 }, _control.TdpWrites);
+            Assert.Equal(new[] { 10 }, _control.FpsLimitWrites);
+        }
+
+        [Fact]
+        public void ProfileAlreadyLower_IsLeftAlone()
+        {
+            _control.CurrentTdp = 4;
+            _control.CurrentFpsLimit = 8;
+            Start();
+            _focus.Focus = GameFocus.Background;
+            Run(GraceSeconds + 1);
+            _focus.Focus = GameFocus.Foreground;
+            Run(1);
+
+            Assert.Empty(_control.TdpWrites);
+            Assert.Empty(_control.FpsLimitWrites);
+        }
+
+        [Fact]
+        public void BothSaversDisabled_DoesNotWatch()
+        {
+            _settings = _settings with { MenuEnabled = false, BackgroundEnabled = false };
+            Start();
+            _focus.Focus = GameFocus.Minimized;
+            Run(3 * GraceSeconds);
+
+            Assert.Empty(_focus.Queried);
+            Assert.Empty(_control.ObservedProcessIds);
+            Assert.Empty(_control.TdpWrites);
+        }
+
+        [Fact]
+        public void BackgroundOnly_NeverReadsFrames()
+        {
+            _settings = _settings with { MenuEnabled = false };
+            Start();
+            OpenMenu();
+            Run(WarmUpSeconds + MenuEnterSeconds);
+
+            Assert.Empty(_control.ObservedProcessIds);
+            Assert.Empty(_control.TdpWrites);
+        }
+
+        [Fact]
+        public void StopAsync_RestoresAndReportsSaving()
+        {
+            Start();
+            for (int i = 0; i < 20; i++)
+            {
+                _saver.ReportPackagePower(_now, 15);
+                Run(1);
+            }
+
+            _focus.Focus = GameFocus.Background;
+            for (int i = 0; i < 60; i++)
+            {
+                _saver.ReportPackagePower(_now, _saver.IsBackgroundThrottled ? 4 : 15);
+                Run(1);
+            }
+
+            var report = _saver.StopAsync().GetAwaiter().GetResult();
+
+            AssertProfile();
+            Assert.NotNull(report);
+            Assert.InRange(report!.Value.SavingTime.TotalSeconds, 49, 50);
+            Assert.True(report.Value.EnergySavedWh > 0);
+            Assert.Null(_saver.StopAsync().GetAwaiter().GetResult());
+        }
+
+        [Fact]
+        public void Dispose_RestoresProfile()
+        {
+            Start();
+            _focus.Focus = GameFocus.Background;
+            Run(GraceSeconds + 1);
+
+            _saver.Dispose();
+
+            AssertProfile();
+        }
+    }
+}
@@ -0,0 +1,212 @@
+using HUDRA.Services.Power;
+using System;
+using System.Linq;
+using Xunit;
+
+namespace HUDRA.Tests.Power
+{
+    public class GameStateClassifierTests
+    {
+        // Long enough to fill the window and learn a baseline
+        private const int WarmUp = 60;
+
+        // A full window of the new state and the agreeing streak, plus one more streak for a loading screen
+        // whose first window doesn't stutter enough yet
+        private const int EnterLatency = GameStateClassifier.WindowSize + 2 * GameStateClassifier.EnterObservations;
+
+        private static int ExitLatency(GameActivityState from) =>
+            from == GameActivityState.Loading ? GameStateClassifier.LoadingExitObservations - 1 : 0;
+
+        /// <summary>
+        /// Every observation carries its segment's label, except while a transition is still allowed to
+        /// be in progress; during that stretch the state is either the old label or the new one.
+        /// </summary>
+        private static void AssertFollowsLabels(ActivityTrace trace, GameActivityState[] states)
+        {
+            for (int s = 0; s < trace.Segments.Count; s++)
+            {
+                var segment = trace.Segments[s];
+                var previous = s > 0 ? trace.Segments[s - 1].Label : segment.Label;
+                int allowance = previous == segment.Label ? 0
+                    : segment.Label == GameActivityState.Gameplay ? ExitLatency(previous)
+                    : EnterLatency;
+
+                for (int i = segment.Start; i < segment.End; i++)
+                {
+                    bool settled = i >= segment.Start + allowance;
+                    bool ok = settled ? states[i] == segment.Label : states[i] == segment.Label || states[i] == previous;
+                    Assert.True(ok, $"t={i}s in {segment.Label} ({segment.Start}-{segment.End}): {states[i]}");
+                }
+            }
+        }
+
+        [Fact]
+        public void Gameplay_StaysGameplayAndLearnsBaseline()
+        {
+            var trace = new ActivityTrace().Gameplay(300);
+            var classifier = new GameStateClassifier();
+
+            var states = trace.Replay(classifier);
+
+            Assert.All(states, s => Assert.Equal(GameActivityState.Gameplay, s));
+            Assert.True(classifier.HasBaseline);
+            Assert.InRange(classifier.GameplayFps, 57, 63);
+            Assert.InRange(classifier.GameplayCost, 85 / 60.0 * 0.9, 85 / 60.0 * 1.1);
+        }
+
+        [Fact]
+        public void UncappedMenu_EnteredWithinLatencyAndLeftOnFirstGameplayFrame()
+        {
+            var trace = new ActivityTrace().Gameplay(WarmUp).Menu(40).Gameplay(30);
+
+            var states = trace.Replay(new GameStateClassifier());
+
+            AssertFollowsLabels(trace, states);
+            Assert.Equal(GameActivityState.Gameplay, states[WarmUp + 40]);
+        }
+
+        [Fact]
+        public void CappedMenu_RecognizedByCostPerFrame()
+        {
+            // Profile caps at 40: menu and gameplay run at the same frame rate, only GPU cost tells them apart
+            var trace = new ActivityTrace()
+                .Gameplay(WarmUp, gpuLoad: 60, cap: 40)
+                .Menu(40, gpuLoad: 10, cap: 40)
+                .Gameplay(30, gpuLoad: 60, cap: 40);
+
+            AssertFollowsLabels(trace, trace.Replay(new GameStateClassifier()));
+        }
+
+        [Fact]
+        public void Loading_EnteredAndLeftAfterSteadyFrames()
+        {
+            var trace = new ActivityTrace().Gameplay(WarmUp).Loading(30).Gameplay(30);
+
+            AssertFollowsLabels(trace, trace.Replay(new GameStateClassifier()));
+        }
+
+        [Fact]
+        public void Loading_SingleFastFrameDoesNotEndIt()
+        {
+            var trace = new ActivityTrace().Gameplay(WarmUp).Loading(30).Blip(GameActivityState.Gameplay, 1).Loading(10);
+            var classifier = new GameStateClassifier();
+
+            var states = trace.Replay(classifier);
+
+            Assert.Equal(GameActivityState.Loading, states[WarmUp + 30]);
+            Assert.Equal(GameActivityState.Loading, states[^1]);
+        }
+
+        [Fact]
+        public void Paused_EnteredAndLeftOnFirstFrame()
+        {
+            var trace = new ActivityTrace().Gameplay(WarmUp).Paused(30).Gameplay(30);
+
+            AssertFollowsLabels(trace, trace.Replay(new GameStateClassifier()));
+        }
+
+        [Fact]
+        public void Blips_DoNotLeaveGameplay()
+        {
+            var trace = new ActivityTrace()
+                .Gameplay(WarmUp)
+                .Blip(GameActivityState.Menu, 3).Gameplay(20)
+                .Blip(GameActivityState.Loading, 3).Gameplay(20)
+                .Blip(GameActivityState.Paused, 2).Gameplay(20)
+                .Blip(GameActivityState.Menu, 2).Blip(GameActivityState.Loading, 2).Gameplay(20)
+                // A heavy scene: slower frames that each cost more
+                .Gameplay(30, fps: 40, gpuLoad: 99).Gameplay(20);
+
+            var states = trace.Replay(new GameStateClassifier());
+
+            Assert.Single(trace.Segments);
+            Assert.All(states, s => Assert.Equal(GameActivityState.Gameplay, s));
+        }
+
+        [Fact]
+        public void WithoutBaseline_MenusAreNotGuessed()
+        {
+            // A game that opens on its menu: nothing to compare the menu's frames against yet
+            var classifier = new GameStateClassifier();
+
+            var states = new ActivityTrace().Menu(GameStateClassifier.BaselineObservations).Replay(classifier);
+
+            Assert.All(states, s => Assert.Equal(GameActivityState.Gameplay, s));
+            Assert.False(classifier.HasBaseline);
+        }
+
+        [Fact]
+        public void SaverFeedback_CapAndLowerTdpKeepMenu()
+        {
+            // Once the menu is recognized the saver caps at 30 and drops TDP: the menu slows and, at lower
+            // clocks, costs more per frame. It has to stay a menu until the player is back in play, which at
+            // the same cap and TDP makes each frame cost far more.
+            int enter = WarmUp + EnterLatency;
+            var trace = new ActivityTrace()
+                .Gameplay(WarmUp)
+                .Menu(EnterLatency)
+                .Menu(60, gpuLoad: 26, cap: 30)
+                .Gameplay(2, gpuLoad: 77, cap: 30)
+                .Gameplay(60);
+            var classifier = new GameStateClassifier();
+
+            var states = trace.Replay(classifier);
+
+            Assert.Equal(GameActivityState.Menu, states[enter - 1]);
+            Assert.All(states.Skip(enter).Take(60), s => Assert.Equal(GameActivityState.Menu, s));
+            Assert.All(states.Skip(enter + 60), s => Assert.Equal(GameActivityState.Gameplay, s));
+
+            // Gameplay under the saver's cap isn't learned as the game's frame rate
+            Assert.InRange(classifier.GameplayFps, 57, 63);
+        }
+
+        [Fact]
+        public void SaverFeedback_LoadingUnderCapEndsWhenCappedGameplayResumes()
+        {
+            // Loading only gets the cap; gameplay resumes pinned at it with full-price frames
+            int enter = WarmUp + EnterLatency;
+            var trace = new ActivityTrace()
+                .Gameplay(WarmUp)
+                .Loading(EnterLatency)
+                .Loading(30, cap: 30)
+                .Gameplay(GameStateClassifier.LoadingExitObservations, gpuLoad: 42, cap: 30)
+                .Gameplay(30);
+
+            var states = trace.Replay(new GameStateClassifier());
+
+            Assert.All(states.Skip(enter - 1).Take(31), s => Assert.Equal(GameActivityState.Loading, s));
+            Assert.All(states.Skip(enter + 30 + GameStateClassifier.LoadingExitObservations - 1), s => Assert.Equal(GameActivityState.Gameplay, s));
+        }
+
+        [Fact]
+        public void Session_FollowsEveryLabel()
+        {
+            var trace = new ActivityTrace(7)
+                .Gameplay(90)
+                .Loading(25).Gameplay(120)
+                .Menu(45).Gameplay(60)
+                .Blip(GameActivityState.Loading, 2).Gameplay(40)
+                .Paused(60).Gameplay(30)
+                .Menu(30).Gameplay(45)
+                .Blip(GameActivityState.Menu, 3).Gameplay(30)
+                .Loading(20).Gameplay(60);
+
+            AssertFollowsLabels(trace, trace.Replay(new GameStateClassifier()));
+        }
+
+        [Fact]
+        public void Replay_IsDeterministicAndResetStartsOver()
+        {
+            var trace = new ActivityTrace(11).Gameplay(WarmUp).Menu(30).Gameplay(20).Loading(25).Gameplay(20);
+            var classifier = new GameStateClassifier();
+
+            var first = trace.Replay(classifier);
+            classifier.Reset();
+
+            Assert.False(classifier.HasBaseline);
+            Assert.True(double.IsNaN(classifier.GameplayFps));
+            Assert.Equal(first, trace.Replay(classifier));
+            Assert.Equal(first, trace.Replay(new GameStateClassifier()));
+        }
+    }
+}
@@ -0,0 +1,219 @@
+using HUDRA.Models;
+using HUDRA.Services.Power;
+using System.Linq;
+using Xunit;
+
+namespace HUDRA.Tests.Power
+{
+    public class PowerEnvelopeApplierTests
+    {
+        private static PowerEnvelope Envelope(int stapm, int slow, int fast) =>
+            new PowerEnvelope { StapmWatts = stapm, SlowWatts = slow, FastWatts = fast };
+
+        private static SmuLimit[] WriteOrder(FakeSmuPowerLimits smu) => smu.Writes.Select(w => w.Limit).ToArray();
+
+        [Fact]
+        public void Apply_RaisingWritesWidestFirst()
+        {
+            var smu = new FakeSmuPowerLimits(15, 15, 15);
+
+            var result = PowerEnvelopeApplier.Apply(smu, Envelope(25, 30, 35));
+
+            Assert.Equal(new[] { SmuLimit.Fast, SmuLimit.Slow, SmuLimit.Stapm }, WriteOrder(smu));
+            Assert.Equal(new uint[] { 35000, 30000, 25000 }, smu.Writes.Select(w => w.Value).ToArray());
+            Assert.False(smu.OrderViolated);
+            Assert.True(result.Success);
+            Assert.True(result.IsComplete);
+            Assert.Equal("Fast:Applied Slow:Applied STAPM:Applied", result.Summary);
+        }
+
+        [Fact]
+        public void Apply_LoweringWritesNarrowestFirst()
+        {
+            var smu = new FakeSmuPowerLimits(30, 35, 41);
+
+            var result = PowerEnvelopeApplier.Apply(smu, Envelope(10, 12, 15));
+
+            Assert.Equal(new[] { SmuLimit.Stapm, SmuLimit.Slow, SmuLimit.Fast }, WriteOrder(smu));
+            Assert.False(smu.OrderViolated);
+            Assert.Equal((10.0, 12.0, 15.0), (smu[SmuLimit.Stapm], smu[SmuLimit.Slow], smu[SmuLimit.Fast]));
+            // Results stay in the fixed widest-first order whatever order they were written in
+            Assert.Equal(new[] { SmuLimit.Fast, SmuLimit.Slow, SmuLimit.Stapm }, result.Limits.Select(l => l.Limit).ToArray());
+        }
+
+        [Fact]
+        public void Apply_MixedChangeKeepsOrderAfterEveryWrite()
+        {
+            // Fast and slow go up while STAPM comes down
+            var smu = new FakeSmuPowerLimits(20, 25, 30);
+
+            PowerEnvelopeApplier.Apply(smu, Envelope(15, 28, 40));
+
+            Assert.Equal(new[] { SmuLimit.Fast, SmuLimit.Slow, SmuLimit.Stapm }, WriteOrder(smu));
+            Assert.False(smu.OrderViolated);
+
+            // Boost narrowing under a higher STAPM: lowered limits go STAPM-side first, after the raise
+            smu = new FakeSmuPowerLimits(15, 28, 40);
+            PowerEnvelopeApplier.Apply(smu, Envelope(22, 24, 26));
+
+            Assert.Equal(new[] { SmuLimit.Stapm, SmuLimit.Slow, SmuLimit.Fast }, WriteOrder(smu));
+            Assert.False(smu.OrderViolated);
+        }
+
+        [Fact]
+        public void Apply_UnreadableCurrentIsTreatedAsRaise()
+        {
+            var smu = new FakeSmuPowerLimits(30, 35, 41) { RefreshFails = true };
+
+            var result = PowerEnvelopeApplier.Apply(smu, Envelope(10, 12, 15));
+
+            Assert.Equal(new[] { SmuLimit.Fast, SmuLimit.Slow, SmuLimit.Stapm }, WriteOrder(smu));
+            // Accepted but never read back
+            Assert.All(result.Limits, l => Assert.Equal(SmuLimitOutcome.Unverified, l.Outcome));
+            Assert.True(result.Success);
+        }
+
+        [Fact]
+        public void Apply_SkipsUnsetLimitsAndWritesTctlInDegrees()
+        {
+            var smu = new FakeSmuPowerLimits(15, 15, 15);
+
+            var result = PowerEnvelopeApplier.Apply(smu, new PowerEnvelope { ApuSlowWatts = 12, TctlCelsius = 85 });
+
+            // Both come down from 25 W and 95 °C, so narrowest first
+            Assert.Equal(new[] { (SmuLimit.Tctl, 85u), (SmuLimit.ApuSlow, 12000u) }, smu.Writes.ToArray());
+            Assert.Equal(SmuLimitOutcome.Applied, result.OutcomeOf(SmuLimit.Tctl));
+            Assert.Null(result.OutcomeOf(SmuLimit.Stapm));
+            Assert.True(result.Success);
+        }
+
+        [Fact]
+        public void Apply_ToleratesSmuRounding()
+        {
+            var close = new FakeSmuPowerLimits(15, 15, 15) { StepError = 1.75 };
+            var far = new FakeSmuPowerLimits(15, 15, 15) { StepError = 2.5 };
+
+            var applied = PowerEnvelopeApplier.Apply(close, Envelope(20, 20, 20));
+            var ignored = PowerEnvelopeApplier.Apply(far, Envelope(20, 20, 20));
+
+            Assert.Equal(SmuLimitOutcome.Applied, applied.OutcomeOf(SmuLimit.Stapm));
+            Assert.Equal(21.75, applied.Limits.Single(l => l.Limit == SmuLimit.Stapm).Actual, 9);
+            Assert.Equal(SmuLimitOutcome.Ignored, ignored.OutcomeOf(SmuLimit.Stapm));
+        }
+
+        [Fact]
+        public void Apply_MissingSetterIsUnsupportedAndNotWritten()
+        {
+            var smu = new FakeSmuPowerLimits(15, 15, 15);
+            smu.NoSetter.Add(SmuLimit.ApuSlow);
+
+            var result = PowerEnvelopeApplier.Apply(smu, new PowerEnvelope { StapmWatts = 20, SlowWatts = 20, FastWatts = 20, ApuSlowWatts = 18 });
+
+            Assert.DoesNotContain(SmuLimit.ApuSlow, WriteOrder(smu));
+            Assert.Equal(SmuLimitOutcome.Unsupported, result.OutcomeOf(SmuLimit.ApuSlow));
+            Assert.True(result.Success);
+            Assert.False(result.IsComplete);
+        }
+
+        [Fact]
+        public void Apply_RejectedStapmIsAFailure()
+        {
+            var smu = new FakeSmuPowerLimits(15, 15, 15);
+            smu.Statuses[SmuLimit.Stapm] = -3;
+
+            var result = PowerEnvelopeApplier.Apply(smu, Envelope(20, 25, 30));
+
+            Assert.Equal(SmuLimitOutcome.Rejected, result.OutcomeOf(SmuLimit.Stapm));
+            Assert.Equal(SmuLimitOutcome.Applied, result.OutcomeOf(SmuLimit.Fast));
+            Assert.False(result.Success);
+            Assert.False(result.NeedsWmiFallback);
+        }
+
+        [Fact]
+        public void Apply_RejectedOptionalLimitStillSucceeds()
+        {
+            var smu = new FakeSmuPowerLimits(15, 15, 15);
+            smu.Statuses[SmuLimit.Tctl] = -1;
+
+            var result = PowerEnvelopeApplier.Apply(smu, new PowerEnvelope { StapmWatts = 20, SlowWatts = 20, FastWatts = 20, TctlCelsius = 90 });
+
+            Assert.True(result.Success);
+            Assert.False(result.IsComplete);
+            Assert.Equal(95, smu[SmuLimit.Tctl]);
+        }
+
+        [Fact]
+        public void Apply_UnreportedLimitStaysUnverified()
+        {
+            var smu = new FakeSmuPowerLimits(15, 15, 15);
+            smu.Unreported.Add(SmuLimit.ApuSlow);
+
+            var result = PowerEnvelopeApplier.Apply(smu, new PowerEnvelope { ApuSlowWatts = 12 });
+
+            var apuSlow = result.Limits.Single();
+            Assert.Equal(SmuLimitOutcome.Unverified, apuSlow.Outcome);
+            Assert.True(double.IsNaN(apuSlow.Actual));
+            Assert.True(result.Success);
+        }
+
+        [Fact]
+        public void Apply_WaitsForSmuOnlyWhenSomethingWasAccepted()
+        {
+            int waits = 0;
+            var smu = new FakeSmuPowerLimits(15, 15, 15);
+            PowerEnvelopeApplier.Apply(smu, Envelope(20, 20, 20), () => waits++);
+            Assert.Equal(1, waits);
+            Assert.Equal(2, smu.Refreshes);
+
+            var rejecting = new FakeSmuPowerLimits(15, 15, 15);
+            rejecting.Statuses[SmuLimit.Stapm] = rejecting.Statuses[SmuLimit.Slow] = rejecting.Statuses[SmuLimit.Fast] = -1;
+            var result = PowerEnvelopeApplier.Apply(rejecting, Envelope(20, 20, 20), () => waits++);
+
+            Assert.Equal(1, waits);
+            Assert.Equal(1, rejecting.Refreshes);
+            Assert.False(result.Success);
+        }
+
+        [Fact]
+        public void WmiFallback_OnlyWhenStapmWasAcceptedButIgnored()
+        {
+            // Driver updates can leave the DLL acknowledging limits it doesn't apply
+            var smu = new FakeSmuPowerLimits(15, 15, 15);
+            smu.Ignores.Add(SmuLimit.Stapm);
+            var ignored = PowerEnvelopeApplier.Apply(smu, Envelope(20, 25, 30));
+
+            Assert.Equal(SmuLimitOutcome.Ignored, ignored.OutcomeOf(SmuLimit.Stapm));
+            Assert.Equal(15, ignored.Limits.Single(l => l.Limit == SmuLimit.Stapm).Actual);
+            Assert.True(ignored.NeedsWmiFallback);
+            Assert.False(ignored.Success);
+
+            smu = new FakeSmuPowerLimits(15, 15, 15);
+            smu.Ignores.Add(SmuLimit.Fast);
+            var fastIgnored = PowerEnvelopeApplier.Apply(smu, Envelope(20, 25, 30));
+
+            Assert.False(fastIgnored.NeedsWmiFallback);
+            Assert.True(fastIgnored.Success);
+
+            var tctlOnly = PowerEnvelopeApplier.Apply(new FakeSmuPowerLimits(15, 15, 15), new PowerEnvelope { TctlCelsius = 90 });
+            Assert.False(tctlOnly.NeedsWmiFallback);
+        }
+
+        [Fact]
+        public void WmiLimits_MapEnvelopeToLenovoCapabilities()
+        {
+            Assert.Equal(new[]
+            {
+                (LenovoWmiPowerLimits.CpuShortTermPowerLimit, 20),
+                (LenovoWmiPowerLimits.CpuLongTermPowerLimit, 25),
+                (LenovoWmiPowerLimits.CpuPeakPowerLimit, 30),
+                (LenovoWmiPowerLimits.ApuSpptPowerLimit, 25)
+            }, LenovoWmiPowerLimits.For(Envelope(20, 25, 30)));
+
+            Assert.Equal((LenovoWmiPowerLimits.ApuSpptPowerLimit, 18),
+                LenovoWmiPowerLimits.For(new PowerEnvelope { StapmWatts = 20, SlowWatts = 25, FastWatts = 30, ApuSlowWatts = 18 })[3]);
+            Assert.Equal(new[] { (LenovoWmiPowerLimits.ApuSpptPowerLimit, 12) },
+                LenovoWmiPowerLimits.For(new PowerEnvelope { ApuSlowWatts = 12 }));
+            Assert.Empty(LenovoWmiPowerLimits.For(new PowerEnvelope { TctlCelsius = 90 }));
+        }
+    }
+}
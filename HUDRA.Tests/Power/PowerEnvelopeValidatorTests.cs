@@ -0,0 +1,150 @@
+using HUDRA.Configuration;
+using HUDRA.Models;
+using HUDRA.Services.Power;
+using System;
+using Xunit;
+
+namespace HUDRA.Tests.Power
+{
+    public class PowerEnvelopeValidatorTests
+    {
+        private static readonly PowerEnvelopeLimits LegionGo =
+            PowerEnvelopeLimits.ForDevice(new DetectedDevice { Manufacturer = DeviceManufacturer.Lenovo, DeviceName = "Legion Go" });
+
+        [Fact]
+        public void Validate_StapmOnlyIsFlat()
+        {
+            var validation = PowerEnvelopeValidator.Validate(new PowerEnvelope { StapmWatts = 15 }, PowerEnvelopeLimits.Generic);
+
+            Assert.Equal(new PowerEnvelope { StapmWatts = 15, SlowWatts = 15, FastWatts = 15 }, validation.Envelope);
+            Assert.False(validation.WasAdjusted);
+            Assert.False(validation.Envelope.IsShaped);
+        }
+
+        [Fact]
+        public void Validate_InRangeEnvelopeIsKept()
+        {
+            var requested = new PowerEnvelope { StapmWatts = 20, SlowWatts = 28, FastWatts = 35, ApuSlowWatts = 22, TctlCelsius = 85 };
+
+            var validation = PowerEnvelopeValidator.Validate(requested, LegionGo);
+
+            Assert.Equal(requested, validation.Envelope);
+            Assert.Empty(validation.Adjustments);
+        }
+
+        [Fact]
+        public void Validate_ClampsStapmToDeviceRange()
+        {
+            var high = PowerEnvelopeValidator.Validate(new PowerEnvelope { StapmWatts = 35 }, LegionGo);
+            var low = PowerEnvelopeValidator.Validate(new PowerEnvelope { StapmWatts = 2 }, LegionGo);
+
+            Assert.Equal(30, high.Envelope.StapmWatts);
+            Assert.Equal(30, high.Envelope.FastWatts);
+            Assert.Equal(new[] { "TDP 35W -> 30W (5-30W allowed)" }, high.Adjustments);
+            Assert.Equal(HudraSettings.MIN_TDP, low.Envelope.StapmWatts);
+            Assert.Single(low.Adjustments);
+        }
+
+        [Fact]
+        public void Validate_RaisesSlowAndFastToKeepOrder()
+        {
+            var validation = PowerEnvelopeValidator.Validate(
+                new PowerEnvelope { StapmWatts = 20, SlowWatts = 15, FastWatts = 18 }, LegionGo);
+
+            Assert.Equal(20, validation.Envelope.SlowWatts);
+            Assert.Equal(20, validation.Envelope.FastWatts);
+            Assert.Equal(2, validation.Adjustments.Count);
+            Assert.StartsWith("Slow limit 15W -> 20W", validation.Adjustments[0]);
+            Assert.StartsWith("Fast limit 18W -> 20W", validation.Adjustments[1]);
+        }
+
+        [Fact]
+        public void Validate_BoostLimitsFollowTheDevice()
+        {
+            var requested = new PowerEnvelope { StapmWatts = 25, SlowWatts = 40, FastWatts = 50 };
+
+            var legion = PowerEnvelopeValidator.Validate(requested, LegionGo).Envelope;
+            var generic = PowerEnvelopeValidator.Validate(requested, PowerEnvelopeLimits.Generic).Envelope;
+
+            Assert.Equal((25, 35, 41), (legion.StapmWatts, legion.SlowWatts, legion.FastWatts));
+            Assert.Equal((25, 30, 30), (generic.StapmWatts, generic.SlowWatts, generic.FastWatts));
+        }
+
+        [Fact]
+        public void Validate_SlowAndFastNeedStapm()
+        {
+            var validation = PowerEnvelopeValidator.Validate(
+                new PowerEnvelope { SlowWatts = 20, FastWatts = 25, TctlCelsius = 90 }, LegionGo);
+
+            Assert.Equal(new PowerEnvelope { TctlCelsius = 90 }, validation.Envelope);
+            Assert.Equal(new[] { "Slow and fast limits need a TDP; ignored" }, validation.Adjustments);
+        }
+
+        [Fact]
+        public void Validate_ApuSlowStaysUnderSlow()
+        {
+            var capped = PowerEnvelopeValidator.Validate(
+                new PowerEnvelope { StapmWatts = 15, SlowWatts = 18, ApuSlowWatts = 25 }, LegionGo);
+            var alone = PowerEnvelopeValidator.Validate(new PowerEnvelope { ApuSlowWatts = 50 }, LegionGo);
+
+            Assert.Equal(18, capped.Envelope.ApuSlowWatts);
+            Assert.Equal(35, alone.Envelope.ApuSlowWatts);
+            Assert.Equal(0, alone.Envelope.StapmWatts);
+        }
+
+        [Fact]
+        public void Validate_ClampsTctl()
+        {
+            Assert.Equal(100, PowerEnvelopeValidator.Validate(new PowerEnvelope { TctlCelsius = 105 }, LegionGo).Envelope.TctlCelsius);
+            Assert.Equal(95, PowerEnvelopeValidator.Validate(new PowerEnvelope { TctlCelsius = 105 }, PowerEnvelopeLimits.Generic).Envelope.TctlCelsius);
+
+            var low = PowerEnvelopeValidator.Validate(new PowerEnvelope { TctlCelsius = 40 }, LegionGo);
+            Assert.Equal(60, low.Envelope.TctlCelsius);
+            Assert.Equal(new[] { "Tctl 40°C -> 60°C (60-100°C allowed)" }, low.Adjustments);
+        }
+
+        [Fact]
+        public void Validate_AnyRequestComesOutOrderedAndInRange()
+        {
+            var random = new Random(98);
+            for (int i = 0; i < 2000; i++)
+            {
+                var requested = new PowerEnvelope
+                {
+                    StapmWatts = random.Next(-5, 60),
+                    SlowWatts = random.Next(-5, 60),
+                    FastWatts = random.Next(-5, 60),
+                    ApuSlowWatts = random.Next(-5, 60),
+                    TctlCelsius = random.Next(-5, 120)
+                };
+                var e = PowerEnvelopeValidator.Validate(requested, LegionGo).Envelope;
+
+                if (e.StapmWatts > 0)
+                {
+                    Assert.True(e.StapmWatts <= e.SlowWatts && e.SlowWatts <= e.FastWatts, $"{requested} -> {e}");
+                    Assert.InRange(e.StapmWatts, LegionGo.MinWatts, LegionGo.MaxStapmWatts);
+                    Assert.True(e.SlowWatts <= LegionGo.MaxSlowWatts && e.FastWatts <= LegionGo.MaxFastWatts, $"{requested} -> {e}");
+                }
+                else
+                {
+                    Assert.Equal(0, e.SlowWatts + e.FastWatts);
+                }
+
+                if (e.ApuSlowWatts > 0)
+                    Assert.True(e.ApuSlowWatts <= LegionGo.MaxApuSlowWatts && (e.SlowWatts == 0 || e.ApuSlowWatts <= e.SlowWatts), $"{requested} -> {e}");
+                if (e.TctlCelsius > 0)
+                    Assert.InRange(e.TctlCelsius, LegionGo.MinTctlCelsius, LegionGo.MaxTctlCelsius);
+            }
+        }
+
+        [Fact]
+        public void ForDevice_UnknownHandheldGetsPickerRange()
+        {
+            var gpd = PowerEnvelopeLimits.ForDevice(new DetectedDevice { Manufacturer = DeviceManufacturer.GPD, DeviceName = "Win 4 Series" });
+
+            Assert.Same(PowerEnvelopeLimits.Generic, PowerEnvelopeLimits.ForDevice(new DetectedDevice()));
+            Assert.Equal(HudraSettings.MAX_TDP, PowerEnvelopeLimits.Generic.MaxFastWatts);
+            Assert.Equal((30, 32, 35), (gpd.MaxStapmWatts, gpd.MaxSlowWatts, gpd.MaxFastWatts));
+        }
+    }
+}
@@ -0,0 +1,111 @@
+using HUDRA.Models;
+using HUDRA.Services.Power;
+using System;
+using Xunit;
+
+namespace HUDRA.Tests.Power
+{
+    public class ProcessorPowerPolicyTests
+    {
+        private static readonly Guid Balanced = new("381b4222-f694-41f0-9685-ff5bb260df2e");
+        private static readonly Guid Vendor = new("52521609-efc9-4268-b9ba-67dea73f18b2");
+
+        [Fact]
+        public void Resolve_DefaultProfileChangesNothing()
+        {
+            Assert.Empty(ProcessorPowerPolicy.Resolve(new GameProfile()));
+        }
+
+        [Fact]
+        public void Resolve_MapsAllThreeSettings()
+        {
+            var targets = ProcessorPowerPolicy.Resolve(new GameProfile { MaxProcessorState = 99, EnergyPreference = "Efficiency", CpuBoostMode = "Disabled" });
+
+            Assert.Equal(3, targets.Count);
+            Assert.Equal(99u, targets[ProcessorPowerSetting.MaxProcessorState]);
+            Assert.Equal(80u, targets[ProcessorPowerSetting.EnergyPerformancePreference]);
+            Assert.Equal(0u, targets[ProcessorPowerSetting.BoostMode]);
+        }
+
+        [Theory]
+        [InlineData(10, 50u)]
+        [InlineData(50, 50u)]
+        [InlineData(150, 100u)]
+        public void Resolve_ClampsMaxProcessorState(int requested, uint expected)
+        {
+            var targets = ProcessorPowerPolicy.Resolve(new GameProfile { MaxProcessorState = requested });
+
+            Assert.Equal(expected, targets[ProcessorPowerSetting.MaxProcessorState]);
+        }
+
+        [Theory]
+        [InlineData("Performance", 0u)]
+        [InlineData("Balanced", 50u)]
+        [InlineData("Efficiency", 80u)]
+        [InlineData("MaxEfficiency", 100u)]
+        public void Resolve_MapsEnergyPreference(string preference, uint expected)
+        {
+            Assert.Equal(expected, ProcessorPowerPolicy.Resolve(new GameProfile { EnergyPreference = preference })[ProcessorPowerSetting.EnergyPerformancePreference]);
+        }
+
+        [Theory]
+        [InlineData("Disabled", 0u)]
+        [InlineData("Aggressive", 2u)]
+        [InlineData("Efficient", 3u)]
+        public void Resolve_MapsBoostMode(string mode, uint expected)
+        {
+            Assert.Equal(expected, ProcessorPowerPolicy.Resolve(new GameProfile { CpuBoostMode = mode })[ProcessorPowerSetting.BoostMode]);
+        }
+
+        [Fact]
+        public void Resolve_IgnoresUnknownAndDefaultNames()
+        {
+            var targets = ProcessorPowerPolicy.Resolve(new GameProfile { EnergyPreference = "Bogus", CpuBoostMode = ProcessorPowerPolicy.BoostDefault });
+
+            Assert.Empty(targets);
+        }
+
+        [Fact]
+        public void ResolveRevert_SavedDefaultsFromSamePlanWinForChangedSettingsOnly()
+        {
+            var changed = new ProcessorPowerSnapshot
+            {
+                SchemeId = Balanced,
+                Values = { [ProcessorPowerSetting.BoostMode] = new(2, 3), [ProcessorPowerSetting.MaxProcessorState] = new(100, 100) }
+            };
+            var saved = new ProcessorPowerSnapshot
+            {
+                SchemeId = Balanced,
+                Values = { [ProcessorPowerSetting.BoostMode] = new(4, 4), [ProcessorPowerSetting.EnergyPerformancePreference] = new(1, 1) }
+            };
+
+            var revert = ProcessorPowerPolicy.ResolveRevert(changed, saved);
+
+            Assert.Equal(Balanced, revert.SchemeId);
+            Assert.Equal(2, revert.Values.Count);
+            Assert.Equal(new PowerSettingIndex(4, 4), revert.Values[ProcessorPowerSetting.BoostMode]);
+            // Not in the saved defaults, so the value from before the profile
+            Assert.Equal(new PowerSettingIndex(100, 100), revert.Values[ProcessorPowerSetting.MaxProcessorState]);
+        }
+
+        [Fact]
+        public void ResolveRevert_SavedDefaultsFromAnotherPlanAreIgnored()
+        {
+            var changed = new ProcessorPowerSnapshot { SchemeId = Balanced, Values = { [ProcessorPowerSetting.BoostMode] = new(2, 3) } };
+            var saved = new ProcessorPowerSnapshot { SchemeId = Vendor, Values = { [ProcessorPowerSetting.BoostMode] = new(4, 4) } };
+
+            Assert.Equal(new PowerSettingIndex(2, 3), ProcessorPowerPolicy.ResolveRevert(changed, saved).Values[ProcessorPowerSetting.BoostMode]);
+            Assert.Equal(new PowerSettingIndex(2, 3), ProcessorPowerPolicy.ResolveRevert(changed, null).Values[ProcessorPowerSetting.BoostMode]);
+        }
+
+        [Fact]
+        public void Profile_ProcessorSettingsCountAsConfigured()
+        {
+            var profile = new GameProfile { MaxProcessorState = 99, CpuBoostMode = "Disabled" };
+
+            Assert.True(profile.HasAnySettingsConfigured);
+            Assert.Equal("CPU 99% · Boost Disabled", profile.PerformanceLabel);
+            Assert.True(new GameProfile { EnergyPreference = "Efficiency" }.HasAnySettingsConfigured);
+        }
+    }
+}
@@ -0,0 +1,163 @@
+using HUDRA.Models;
+using HUDRA.Services.Power;
+using System;
+using System.Collections.Generic;
+using System.Text.Json;
+using Xunit;
+
+namespace HUDRA.Tests.Power
+{
+    public class ProcessorPowerServiceTests
+    {
+        private static readonly Guid Balanced = new("381b4222-f694-41f0-9685-ff5bb260df2e");
+        private static readonly Guid Vendor = new("52521609-efc9-4268-b9ba-67dea73f18b2");
+
+        private readonly FakeProcessorPowerApi _api;
+        private readonly ProcessorPowerService _service;
+
+        public ProcessorPowerServiceTests()
+        {
+            _api = new FakeProcessorPowerApi(Balanced)
+                .Set(Balanced, ProcessorPowerSetting.BoostMode, 2, 3)
+                .Set(Balanced, ProcessorPowerSetting.MaxProcessorState, 100, 100)
+                .Set(Balanced, ProcessorPowerSetting.EnergyPerformancePreference, 33, 50)
+                .Set(Vendor, ProcessorPowerSetting.BoostMode, 2, 2);
+            _service = new ProcessorPowerService(_api);
+        }
+
+        private static Dictionary<ProcessorPowerSetting, uint> Targets(GameProfile profile) => ProcessorPowerPolicy.Resolve(profile);
+
+        [Fact]
+        public void Capture_ReadsEverySettingOfActivePlan()
+        {
+            var snapshot = _service.Capture();
+
+            Assert.NotNull(snapshot);
+            Assert.Equal(Balanced, snapshot!.SchemeId);
+            Assert.Equal(3, snapshot.Values.Count);
+            Assert.Equal(new PowerSettingIndex(33, 50), snapshot.Values[ProcessorPowerSetting.EnergyPerformancePreference]);
+
+            _api.Active = Vendor;
+            Assert.Single(_service.Capture()!.Values);
+
+            _api.Active = null;
+            Assert.Null(_service.Capture());
+        }
+
+        [Fact]
+        public void Apply_WritesBothIndexesAndActivatesOnce()
+        {
+            var result = _service.Apply(Targets(new GameProfile { MaxProcessorState = 100, CpuBoostMode = "Disabled", EnergyPreference = "Efficiency" }));
+
+            Assert.True(result.Success);
+            Assert.Equal(new PowerSettingIndex(0, 0), _api.Get(Balanced, ProcessorPowerSetting.BoostMode));
+            Assert.Equal(new PowerSettingIndex(80, 80), _api.Get(Balanced, ProcessorPowerSetting.EnergyPerformancePreference));
+            Assert.Equal(new[] { Balanced }, _api.Activations);
+            // Max state was already 100 on both
+            Assert.Equal(2, _api.Writes);
+            Assert.Equal(2, result.Restore!.Values.Count);
+            Assert.DoesNotContain(ProcessorPowerSetting.MaxProcessorState, result.Restore.Values.Keys);
+            Assert.Equal(new PowerSettingIndex(2, 3), result.Restore.Values[ProcessorPowerSetting.BoostMode]);
+        }
+
+        [Fact]
+        public void Apply_NothingToChangeLeavesPlanAlone()
+        {
+            var already = _service.Apply(Targets(new GameProfile { MaxProcessorState = 100 }));
+            var empty = _service.Apply(new Dictionary<ProcessorPowerSetting, uint>());
+
+            Assert.True(already.Success);
+            Assert.Null(already.Restore);
+            Assert.True(empty.Success);
+            Assert.Null(empty.Restore);
+            Assert.Equal(0, _api.Writes);
+            Assert.Empty(_api.Activations);
+        }
+
+        [Fact]
+        public void Apply_WithoutActivePlanFails()
+        {
+            _api.Active = null;
+
+            var result = _service.Apply(Targets(new GameProfile { CpuBoostMode = "Disabled" }));
+
+            Assert.False(result.Success);
+            Assert.Null(result.Restore);
+            Assert.Equal("No active power plan", result.Message);
+        }
+
+        [Fact]
+        public void Apply_HalfWrittenSettingIsStillRestorable()
+        {
+            _api.Active = Vendor;
+            _api.FailWrites.Add(ProcessorPowerSetting.BoostMode);
+
+            // EPP isn't in the vendor plan, so it can't be read and isn't touched
+            var result = _service.Apply(Targets(new GameProfile { CpuBoostMode = "Disabled", EnergyPreference = "Efficiency" }));
+
+            Assert.False(result.Success);
+            Assert.Equal("Failed: EnergyPerformancePreference, BoostMode", result.Message);
+            Assert.Equal(new PowerSettingIndex(0, 2), _api.Get(Vendor, ProcessorPowerSetting.BoostMode));
+            Assert.Single(result.Restore!.Values);
+            Assert.False(_api.TryRead(Vendor, ProcessorPowerSetting.EnergyPerformancePreference, out _));
+
+            _api.FailWrites.Clear();
+            Assert.True(_service.Restore(result.Restore));
+            Assert.Equal(new PowerSettingIndex(2, 2), _api.Get(Vendor, ProcessorPowerSetting.BoostMode));
+        }
+
+        [Fact]
+        public void Apply_ActivationFailureKeepsRestore()
+        {
+            _api.FailActivate = true;
+
+            var result = _service.Apply(Targets(new GameProfile { CpuBoostMode = "Disabled" }));
+
+            Assert.False(result.Success);
+            Assert.Equal("Failed: activate", result.Message);
+            Assert.NotNull(result.Restore);
+        }
+
+        [Fact]
+        public void Restore_WritesToChangedPlanAfterUserSwitches()
+        {
+            var captured = _service.Capture()!;
+            var result = _service.Apply(Targets(new GameProfile { CpuBoostMode = "Disabled", EnergyPreference = "Efficiency" }));
+            _api.Active = Vendor;
+            _api.Activations.Clear();
+
+            Assert.True(_service.Restore(ProcessorPowerPolicy.ResolveRevert(result.Restore!, captured)));
+
+            Assert.Equal(new PowerSettingIndex(2, 3), _api.Get(Balanced, ProcessorPowerSetting.BoostMode));
+            Assert.Equal(new PowerSettingIndex(33, 50), _api.Get(Balanced, ProcessorPowerSetting.EnergyPerformancePreference));
+            // The user's new plan keeps its own values and isn't re-activated under them
+            Assert.Equal(new PowerSettingIndex(2, 2), _api.Get(Vendor, ProcessorPowerSetting.BoostMode));
+            Assert.Empty(_api.Activations);
+        }
+
+        [Fact]
+        public void Restore_ReactivatesPlanStillInUse()
+        {
+            var result = _service.Apply(Targets(new GameProfile { CpuBoostMode = "Disabled" }));
+            _api.Activations.Clear();
+
+            Assert.True(_service.Restore(result.Restore!));
+
+            Assert.Equal(new PowerSettingIndex(2, 3), _api.Get(Balanced, ProcessorPowerSetting.BoostMode));
+            Assert.Equal(new[] { Balanced }, _api.Activations);
+        }
+
+        [Fact]
+        public void SavedDefaults_RoundTripProcessorPower()
+        {
+            var defaults = new SystemDefaults { ProcessorPower = _service.Capture() };
+
+            var back = JsonSerializer.Deserialize<SystemDefaults>(JsonSerializer.Serialize(defaults))!;
+
+            Assert.Equal(Balanced, back.ProcessorPower!.SchemeId);
+            Assert.Equal(new PowerSettingIndex(33, 50), back.ProcessorPower.Values[ProcessorPowerSetting.EnergyPerformancePreference]);
+            // Defaults saved before processor settings existed
+            Assert.Null(JsonSerializer.Deserialize<SystemDefaults>("{\"TdpWatts\":15}")!.ProcessorPower);
+        }
+    }
+}
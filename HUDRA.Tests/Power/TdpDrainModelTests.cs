@@ -0,0 +1,119 @@
+using HUDRA.Services.Power;
+using HUDRA.Services.SessionHistory;
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using Xunit;
+using static HUDRA.Tests.Power.DischargeTrace;
+
+namespace HUDRA.Tests.Power
+{
+    public class TdpDrainModelTests
+    {
+        private static IEnumerable<SessionSample> History(int start = 0, int end = int.MaxValue) =>
+            Rows.Skip(start).Take(end - start).Select(r => r.ToSample());
+
+        private static IEnumerable<SessionSample> Step(int tdpWatts, float dischargeWatts, int count, long startMs = 0)
+        {
+            for (int i = 0; i < count; i++)
+            {
+                var sample = SessionSample.Empty(startMs + i * 5_000L);
+                sample.TdpWatts = tdpWatts;
+                sample.BatteryDischargeWatts = dischargeWatts;
+                yield return sample;
+            }
+        }
+
+        [Fact]
+        public void Fit_MeasuresEachRecordedStep()
+        {
+            var model = TdpDrainModel.Fit(History());
+
+            Assert.True(model.HasData);
+            Assert.Equal(new[] { 8, 15, 25 }, model.MeasuredSteps.OrderBy(t => t));
+
+            // Charging rows don't count toward the 15 W step
+            foreach (int tdp in new[] { 8, 15, 25 })
+            {
+                double expected = Rows.Where(r => r.TdpWatts == tdp && r.DischargeWatts > 0).Average(r => (double)(float)r.DischargeWatts);
+                Assert.Equal(expected, model.PredictWatts(tdp), 4);
+            }
+        }
+
+        [Fact]
+        public void Fit_FrameCappedGameDrainsLessThanOneWattPerTdpWatt()
+        {
+            var model = TdpDrainModel.Fit(History());
+
+            double low = model.PredictWatts(10);
+            double high = model.PredictWatts(20);
+            Assert.InRange(low, model.PredictWatts(8), model.PredictWatts(15));
+            Assert.InRange((high - low) / 10, 0.1, 0.99);
+        }
+
+        [Fact]
+        public void Fit_IgnoresStepsShorterThanAMinute()
+        {
+            var history = History(0, FifteenWattEnd).Concat(Step(20, 30, TdpDrainModel.MinSamplesPerStep - 1, Rows[FifteenWattEnd].TimestampMs));
+
+            var model = TdpDrainModel.Fit(history);
+
+            Assert.Equal(new[] { 15 }, model.MeasuredSteps);
+            Assert.False(model.Predict(20, 40).IsMeasured);
+        }
+
+        [Fact]
+        public void Fit_SingleStepAssumesOneWattPerTdpWatt()
+        {
+            var model = TdpDrainModel.Fit(History(0, FifteenWattEnd));
+
+            Assert.Equal(5, model.PredictWatts(20) - model.PredictWatts(15), 6);
+            Assert.Equal(3, model.PredictWatts(18) - model.PredictWatts(15), 6);
+        }
+
+        [Fact]
+        public void Fit_ClampsSlopeAndFloorsPrediction()
+        {
+            var steep = TdpDrainModel.Fit(Step(10, 5, 12).Concat(Step(20, 60, 12)));
+            Assert.Equal(4, steep.PredictWatts(16) - steep.PredictWatts(14), 6);
+
+            var falling = TdpDrainModel.Fit(Step(10, 20, 12).Concat(Step(20, 1, 12)));
+            Assert.Equal(0.2, falling.PredictWatts(16) - falling.PredictWatts(14), 6);
+
+            // Slope 0.1 through the origin: 0.1 W at 1 W TDP, floored to 1 W
+            var flat = TdpDrainModel.Fit(Step(20, 2, 12).Concat(Step(30, 3, 12)));
+            Assert.Equal(1.0, flat.PredictWatts(1), 6);
+        }
+
+        [Fact]
+        public void Fit_WithoutDischargeIsEmpty()
+        {
+            var charging = History(TwentyFiveWattEnd, ChargingEnd);
+            var noBattery = History().Select(s => { s.BatteryDischargeWatts = float.NaN; return s; });
+
+            foreach (var model in new[] { TdpDrainModel.Fit(charging), TdpDrainModel.Fit(noBattery), TdpDrainModel.Fit(Array.Empty<SessionSample>()) })
+            {
+                Assert.Same(TdpDrainModel.Empty, model);
+                Assert.False(model.HasData);
+                Assert.True(double.IsNaN(model.PredictWatts(15)));
+                Assert.Null(model.Predict(15, 40).Playtime);
+            }
+        }
+
+        [Fact]
+        public void Predict_ReportsPlaytimeAndWhetherMeasured()
+        {
+            var model = TdpDrainModel.Fit(History());
+
+            var steps = model.Predict(new[] { 8, 12, 15 }, 40);
+
+            Assert.Equal(new[] { 8, 12, 15 }, steps.Select(s => s.TdpWatts));
+            Assert.Equal(new[] { true, false, true }, steps.Select(s => s.IsMeasured));
+            Assert.Equal(Rows.Count(r => r.TdpWatts == 8), steps[0].SampleCount);
+            Assert.All(steps, s => Assert.Equal(TimeSpan.FromHours(40 / s.DischargeWatts), s.Playtime));
+
+            // Longer playtime at lower TDP
+            Assert.True(steps[0].Playtime > steps[1].Playtime && steps[1].Playtime > steps[2].Playtime);
+        }
+    }
+}
@@ -0,0 +1,78 @@
+using HUDRA.Services.QuickPause;
+using System;
+using System.Collections.Generic;
+using System.Linq;
+
+namespace HUDRA.Tests.QuickPause
+{
+    /// <summary>
+    /// In-memory process table with per-process suspend counts. Suspends and resumes are appended to
+    /// <see cref="Log"/>, which the fake power control writes to as well, so tests can check ordering.
+    /// </summary>
+    internal sealed class FakeProcessSuspendApi : IProcessSuspendApi
+    {
+        public static readonly DateTime Boot = new DateTime(2026, 10, 18, 8, 0, 0, DateTimeKind.Utc);
+
+        private readonly List<ProcessTreeEntry> _processes = new();
+
+        public FakeProcessSuspendApi(List<string> log)
+        {
+            Log = log;
+        }
+
+        public List<string> Log { get; }
+        public Dictionary<int, int> SuspendCounts { get; } = new();
+        public HashSet<int> SuspendFailures { get; } = new();
+        public HashSet<int> ResumeFailures { get; } = new();
+
+        public FakeProcessSuspendApi Add(int processId, int parentProcessId, string name, int startedSecondsAfterBoot)
+        {
+            _processes.Add(new ProcessTreeEntry
+            {
+                ProcessId = processId,
+                ParentProcessId = parentProcessId,
+                ProcessName = name,
+                StartTimeUtc = startedSecondsAfterBoot < 0 ? DateTime.MinValue : Boot.AddSeconds(startedSecondsAfterBoot)
+            });
+            return this;
+        }
+
+        public void Kill(int processId) => _processes.RemoveAll(p => p.ProcessId == processId);
+
+        /// <summary>
+        /// The PID exits and Windows hands it to an unrelated, newer process.
+        /// </summary>
+        public void Reuse(int processId, string newName, int startedSecondsAfterBoot)
+        {
+            Kill(processId);
+            Add(processId, 4, newName, startedSecondsAfterBoot);
+        }
+
+        public int SuspendCount(int processId) => SuspendCounts.TryGetValue(processId, out int count) ? count : 0;
+
+        public IReadOnlyList<ProcessTreeEntry> GetProcessTree() => _processes.ToList();
+
+        public bool TrySuspend(int processId)
+        {
+            if (SuspendFailures.Contains(processId) || !_processes.Any(p => p.ProcessId == processId))
+                return false;
+
+            SuspendCounts[processId] = SuspendCount(processId) + 1;
+            Log.Add($"suspend {processId}");
+            return true;
+        }
+
+        public bool TryResume(int processId)
+        {
+            if (ResumeFailures.Contains(processId) || SuspendCount(processId) == 0)
+                return false;
+
+            SuspendCounts[processId]--;
+            Log.Add($"resume {processId}");
+            return true;
+        }
+
+        public string? GetProcessName(int processId) =>
+            _processes.FirstOrDefault(p => p.ProcessId == processId)?.ProcessName;
+    }
+}
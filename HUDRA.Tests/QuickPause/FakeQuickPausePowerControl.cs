@@ -0,0 +1,37 @@
+using HUDRA.Services.QuickPause;
+using System;
+using System.Collections.Generic;
+
+namespace HUDRA.Tests.QuickPause
+{
+    /// <summary>
+    /// Records idle and restore into the same log as <see cref="FakeProcessSuspendApi"/>.
+    /// </summary>
+    internal sealed class FakeQuickPausePowerControl : IQuickPausePowerControl
+    {
+        private readonly List<string> _log;
+
+        public FakeQuickPausePowerControl(List<string> log)
+        {
+            _log = log;
+        }
+
+        public bool ThrowOnIdle { get; set; }
+        public bool IsIdle { get; private set; }
+
+        public void EnterIdle()
+        {
+            if (ThrowOnIdle)
+                throw new InvalidOperationException("ryzenadj unavailable");
+
+            _log.Add("idle");
+            IsIdle = true;
+        }
+
+        public void Restore()
+        {
+            _log.Add("restore");
+            IsIdle = false;
+        }
+    }
+}
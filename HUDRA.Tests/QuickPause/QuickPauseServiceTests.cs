@@ -0,0 +1,249 @@
+using HUDRA.Services.Power;
+using HUDRA.Services.QuickPause;
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using Xunit;
+
+namespace HUDRA.Tests.QuickPause
+{
+    public class QuickPauseServiceTests : IDisposable
+    {
+        private const int Game = 1000;
+        private const int Launcher = 900;
+        private const int CrashHandler = 1100;
+        private const int Helper = 1200;
+        private const int Renderer = 1300;
+        private const long PausedAt = 1_760_000_000_000;
+
+        private readonly List<string> _log = new();
+        private readonly FakeProcessSuspendApi _api;
+        private readonly FakeQuickPausePowerControl _power;
+        private readonly QuickPauseService _service;
+
+        public QuickPauseServiceTests()
+        {
+            // launcher -> game -> crash handler, helper -> renderer; the launcher is the game's parent, not its child
+            _api = new FakeProcessSuspendApi(_log)
+                .Add(4, 0, "System", 0)
+                .Add(Launcher, 4, "Launcher.exe", 10)
+                .Add(Game, Launcher, "Game.exe", 20)
+                .Add(CrashHandler, Game, "CrashHandler.exe", 21)
+                .Add(Helper, Game, "Helper.exe", 22)
+                .Add(Renderer, Helper, "Renderer.exe", 23);
+            _power = new FakeQuickPausePowerControl(_log);
+            _service = new QuickPauseService(_api, _power);
+        }
+
+        public void Dispose() => _service.Dispose();
+
+        private bool Pause() => _service.Pause(Game, "Game.exe", PausedAt);
+
+        [Fact]
+        public void Pause_SuspendsGameFirstThenDescendantsThenIdles()
+        {
+            Assert.True(Pause());
+
+            Assert.Equal(new[] { $"suspend {Game}", $"suspend {CrashHandler}", $"suspend {Helper}", $"suspend {Renderer}", "idle" }, _log);
+            Assert.True(_service.IsPaused);
+            Assert.Equal(Game, _service.PausedProcessId);
+            Assert.Equal(0, _api.SuspendCount(Launcher));
+        }
+
+        [Fact]
+        public void Resume_RestoresPowerThenResumesInReverse()
+        {
+            Pause();
+            _log.Clear();
+
+            var report = _service.Resume(PausedAt + 90_000);
+
+            Assert.Equal(new[] { "restore", $"resume {Renderer}", $"resume {Helper}", $"resume {CrashHandler}", $"resume {Game}" }, _log);
+            Assert.NotNull(report);
+            Assert.Equal(4, report!.Value.ProcessCount);
+            Assert.Equal(TimeSpan.FromSeconds(90), report.Value.Duration);
+            Assert.All(new[] { Game, CrashHandler, Helper, Renderer }, pid => Assert.Equal(0, _api.SuspendCount(pid)));
+            Assert.False(_service.IsPaused);
+            Assert.Equal(0, _service.PausedProcessId);
+            Assert.Null(_service.Resume(PausedAt + 91_000));
+        }
+
+        [Fact]
+        public void Pause_OrphanOlderThanReusedParentPidIsNotAChild()
+        {
+            // Started before the game, its parent PID points at whatever held the PID back then
+            _api.Add(1400, Game, "Updater.exe", 5);
+
+            Pause();
+
+            Assert.Equal(0, _api.SuspendCount(1400));
+        }
+
+        [Fact]
+        public void Pause_UnknownStartTimesAreNotFrozen()
+        {
+            _api.Add(1400, Game, "AntiCheat.exe", -1);
+            _api.Add(1500, 1400, "AntiCheatWorker.exe", 30);
+
+            Pause();
+
+            Assert.Equal(0, _api.SuspendCount(1400));
+            Assert.Equal(0, _api.SuspendCount(1500));
+            Assert.Equal(1, _api.SuspendCount(Renderer));
+        }
+
+        [Fact]
+        public void Pause_RefusesWhenPidNowBelongsToAnotherProcess()
+        {
+            _api.Reuse(Game, "notepad.exe", 500);
+
+            Assert.False(Pause());
+
+            Assert.Empty(_log);
+            Assert.False(_service.IsPaused);
+        }
+
+        [Fact]
+        public void Pause_RefusesExitedGameAndMatchesNameIgnoringCase()
+        {
+            Assert.True(_service.Pause(Game, "GAME.EXE", PausedAt));
+            _service.Resume(PausedAt + 1_000);
+
+            _api.Kill(Game);
+            _log.Clear();
+            Assert.False(Pause());
+            Assert.Empty(_log);
+        }
+
+        [Fact]
+        public void Pause_NeverSuspendsOwnProcess()
+        {
+            int self = Environment.ProcessId;
+            _api.Add(self, Game, "HUDRA.exe", 40);
+            _api.Add(self + 1, self, "HUDRA.Engine.exe", 41);
+
+            Assert.False(_service.Pause(self, "HUDRA.exe", PausedAt));
+            Assert.Empty(_log);
+
+            // Started by the game (e.g. through a launcher overlay): still left running, and so is its subtree
+            Assert.True(Pause());
+            Assert.Equal(0, _api.SuspendCount(self));
+            Assert.Equal(0, _api.SuspendCount(self + 1));
+        }
+
+        [Fact]
+        public void Pause_FailedGameSuspendLeavesNothingChanged()
+        {
+            _api.SuspendFailures.Add(Game);
+
+            Assert.False(Pause());
+
+            Assert.Empty(_log);
+            Assert.All(new[] { Game, CrashHandler, Helper, Renderer }, pid => Assert.Equal(0, _api.SuspendCount(pid)));
+            Assert.False(_power.IsIdle);
+            Assert.False(_service.IsPaused);
+            Assert.Null(_service.Resume(PausedAt + 1_000));
+        }
+
+        [Fact]
+        public void Pause_ChildThatCannotBeSuspendedIsLeftOut()
+        {
+            _api.SuspendFailures.Add(CrashHandler);
+
+            Assert.True(Pause());
+            _log.Clear();
+            var report = _service.Resume(PausedAt + 1_000);
+
+            Assert.Equal(3, report!.Value.ProcessCount);
+            Assert.DoesNotContain($"resume {CrashHandler}", _log);
+            Assert.Contains($"resume {Game}", _log);
+        }
+
+        [Fact]
+        public void Resume_SkipsKilledAndReusedPids()
+        {
+            Pause();
+            _api.Kill(Renderer);
+            _api.Reuse(Helper, "Calculator.exe", 600);
+            _log.Clear();
+
+            var report = _service.Resume(PausedAt + 60_000);
+
+            // A reused PID belongs to a process that was never suspended; resuming it would unbalance its count
+            Assert.Equal(new[] { "restore", $"resume {CrashHandler}", $"resume {Game}" }, _log);
+            Assert.Equal(4, report!.Value.ProcessCount);
+        }
+
+        [Fact]
+        public void Pause_WhilePausedDoesNotSuspendTwice()
+        {
+            Pause();
+            _log.Clear();
+
+            Assert.True(Pause());
+            Assert.False(_service.Pause(Launcher, "Launcher.exe", PausedAt));
+
+            Assert.Empty(_log);
+            Assert.Equal(1, _api.SuspendCount(Game));
+        }
+
+        [Fact]
+        public void PowerIdleFailure_StillPausesAndSkipsRestore()
+        {
+            _power.ThrowOnIdle = true;
+
+            Assert.True(Pause());
+            _log.Clear();
+            _service.Resume(PausedAt + 1_000);
+
+            Assert.DoesNotContain("restore", _log);
+            Assert.Equal(0, _api.SuspendCount(Game));
+        }
+
+        [Fact]
+        public void Dispose_ResumesEverythingAndRefusesLaterPauses()
+        {
+            Pause();
+            _log.Clear();
+
+            _service.Dispose();
+
+            Assert.Equal(new[] { "restore", $"resume {Renderer}", $"resume {Helper}", $"resume {CrashHandler}", $"resume {Game}" }, _log);
+            Assert.False(_service.IsPaused);
+            Assert.False(Pause());
+            Assert.Equal(0, _api.SuspendCount(Game));
+        }
+
+        [Fact]
+        public void BatteryReadings_GiveDrainWhilePaused()
+        {
+            Assert.True(double.IsNaN(_service.CurrentDrainWatts));
+            _service.AddBatteryReading(new BatteryReading { TimestampMs = PausedAt, DischargeWatts = 20, RemainingWh = 40 });
+
+            Pause();
+            // The first 30 s still carry the game's draw in the battery's rate
+            for (long t = 0; t <= 120_000; t += 5_000)
+                _service.AddBatteryReading(new BatteryReading { TimestampMs = PausedAt + t, DischargeWatts = t < 30_000 ? 18 : 3.5, RemainingWh = double.NaN });
+
+            Assert.Equal(3.5, _service.CurrentDrainWatts, 9);
+            var report = _service.Resume(PausedAt + 120_000);
+            Assert.Equal(3.5, report!.Value.AverageDrainWatts, 9);
+            Assert.Equal(3.5 * 2 / 60, report.Value.EnergyWh, 9);
+            Assert.True(double.IsNaN(_service.CurrentDrainWatts));
+        }
+
+        [Fact]
+        public void CollectDescendants_SurvivesCyclesAndSelfParents()
+        {
+            var processes = new List<ProcessTreeEntry>
+            {
+                new() { ProcessId = 0, ParentProcessId = 0, ProcessName = "Idle", StartTimeUtc = FakeProcessSuspendApi.Boot },
+                new() { ProcessId = 10, ParentProcessId = 20, ProcessName = "A.exe", StartTimeUtc = FakeProcessSuspendApi.Boot },
+                new() { ProcessId = 20, ParentProcessId = 10, ProcessName = "B.exe", StartTimeUtc = FakeProcessSuspendApi.Boot }
+            };
+
+            Assert.Equal(new[] { 20 }, QuickPauseService.CollectDescendants(10, processes, -1).Select(p => p.ProcessId));
+            Assert.Empty(QuickPauseService.CollectDescendants(0, processes, -1));
+        }
+    }
+}
@@ -0,0 +1,192 @@
+using HUDRA.Services.Scheduling;
+using System;
+using System.Linq;
+using Xunit;
+
+namespace HUDRA.Tests.Scheduling
+{
+    public class BackgroundThrottlePolicyTests
+    {
+        private static int[] Select(params string[] rules) =>
+            BackgroundThrottlePolicy.SelectTargets(new BackgroundThrottleRuleSet(rules), ProcessTables.Handheld, ProcessTables.Game)
+                .Select(p => p.ProcessId)
+                .ToArray();
+
+        [Fact]
+        public void ExactRule_MatchesEveryInstanceCaseInsensitively()
+        {
+            Assert.Equal(new[] { 4120, 4121, 4122 }, Select("SteamWebHelper"));
+        }
+
+        [Fact]
+        public void ExeSuffix_IsIgnored()
+        {
+            Assert.Equal(new[] { 5200, 5201 }, Select("discord.exe"));
+            Assert.Equal(new[] { 5200, 5201 }, Select("Discord.EXE"));
+        }
+
+        [Fact]
+        public void PrefixRule_MatchesByPrefixOnly()
+        {
+            Assert.Equal(new[] { 5100, 5101 }, Select("Adobe*"));
+            Assert.Equal(new[] { 4300, 4310 }, Select("epic*"));
+            Assert.Empty(Select("*Helper"));
+        }
+
+        [Theory]
+        [InlineData("*")]
+        [InlineData("  *  ")]
+        [InlineData("*.exe")]
+        [InlineData("")]
+        [InlineData(".exe")]
+        public void BareWildcardAndBlankRules_AreDropped(string rule)
+        {
+            var rules = new BackgroundThrottleRuleSet(new[] { rule });
+
+            Assert.True(rules.IsEmpty);
+            Assert.Empty(Select(rule));
+        }
+
+        [Fact]
+        public void ProtectedProcesses_AreNeverSelected()
+        {
+            var targets = Select("explorer", "dwm", "svchost", "audiodg", "HUDRA", "RTSS", "csrss", "OneDrive");
+
+            Assert.Equal(new[] { 5000 }, targets);
+        }
+
+        [Fact]
+        public void PrefixCoveringProtectedProcesses_StillSkipsThem()
+        {
+            // "s*" reaches System, svchost and steam; only the unprotected ones are taken
+            Assert.Equal(new[] { 4100, 4120, 4121, 4122 }, Select("s*"));
+        }
+
+        [Fact]
+        public void LowPids_AreNeverSelected()
+        {
+            var table = new[] { new ProcessSnapshot { ProcessId = 4, ProcessName = "OneDrive" }, ProcessTables.Game };
+
+            var targets = BackgroundThrottlePolicy.SelectTargets(new BackgroundThrottleRuleSet(new[] { "OneDrive" }), table, ProcessTables.Game);
+
+            Assert.Empty(targets);
+        }
+
+        [Fact]
+        public void GameAndProcessesSharingItsName_AreExcluded()
+        {
+            var table = ProcessTables.Handheld
+                .Append(new ProcessSnapshot { ProcessId = 9130, ProcessName = "cyberpunk2077" })
+                .ToArray();
+
+            var targets = BackgroundThrottlePolicy.SelectTargets(
+                new BackgroundThrottleRuleSet(new[] { "Cyber*", "OneDrive" }), table, ProcessTables.Game);
+
+            Assert.Equal(new[] { 5000 }, targets.Select(p => p.ProcessId));
+        }
+
+        [Fact]
+        public void DefaultRules_LeaveSteamClientAndUnlistedAppsAlone()
+        {
+            var targets = BackgroundThrottlePolicy.SelectTargets(
+                new BackgroundThrottleRuleSet(BackgroundThrottlePolicy.DefaultRules), ProcessTables.Handheld, ProcessTables.Game);
+
+            Assert.Equal(
+                new[] { "steamwebhelper", "steamwebhelper", "steamwebhelper", "EpicGamesLauncher", "EpicWebHelper", "OneDrive", "AdobeARM", "MicrosoftEdgeUpdate" },
+                targets.Select(p => p.ProcessName));
+        }
+
+        [Theory]
+        [InlineData("Efficiency", true, false)]
+        [InlineData("efficiencylowio", true, true)]
+        [InlineData("Default", false, false)]
+        [InlineData(null, false, false)]
+        public void Modes(string? mode, bool enabled, bool lowIo)
+        {
+            Assert.Equal(enabled, BackgroundThrottlePolicy.IsEnabled(mode));
+            Assert.Equal(lowIo, BackgroundThrottlePolicy.LowersIoPriority(mode));
+        }
+
+        [Fact]
+        public void BuildReport_ComparesUsedCpuToLifetimeAverageRate()
+        {
+            var sessionStart = new DateTime(2025, 3, 1, 20, 0, 0, DateTimeKind.Utc);
+            var sessionEnd = sessionStart.AddMinutes(30);
+            var samples = new[]
+            {
+                // Ran 10 min before the game at 6s CPU per minute; used 12s over the 30 min session instead of 180s
+                new ThrottledProcessSample
+                {
+                    ProcessName = "steamwebhelper",
+                    ProcessStartTime = sessionStart.AddMinutes(-10),
+                    CpuTimeAtStart = TimeSpan.FromSeconds(60),
+                    CpuTimeAtEnd = TimeSpan.FromSeconds(72)
+                },
+                // Up for 2h at 1s CPU per minute; used 20s against an expected 30s
+                new ThrottledProcessSample
+                {
+                    ProcessName = "OneDrive",
+                    ProcessStartTime = sessionStart.AddHours(-2),
+                    CpuTimeAtStart = TimeSpan.FromSeconds(120),
+                    CpuTimeAtEnd = TimeSpan.FromSeconds(140)
+                },
+                // Exited while throttled: counted, but contributes no CPU figures
+                new ThrottledProcessSample
+                {
+                    ProcessName = "AdobeARM",
+                    ProcessStartTime = sessionStart.AddMinutes(-1),
+                    CpuTimeAtStart = TimeSpan.FromSeconds(5),
+                    CpuTimeAtEnd = null
+                },
+                // Start time unreadable
+                new ThrottledProcessSample
+                {
+                    ProcessName = "EpicWebHelper",
+                    CpuTimeAtStart = TimeSpan.FromSeconds(5),
+                    CpuTimeAtEnd = TimeSpan.FromSeconds(9)
+                }
+            };
+
+            var report = BackgroundThrottlePolicy.BuildReport(samples, sessionStart, sessionEnd);
+
+            Assert.Equal(4, report.ProcessCount);
+            Assert.Equal(TimeSpan.FromMinutes(30), report.Duration);
+            Assert.Equal(TimeSpan.FromSeconds(32), report.CpuTimeUsed);
+            Assert.Equal(TimeSpan.FromSeconds(210), report.ExpectedCpuTime);
+            Assert.Equal(TimeSpan.FromSeconds(178), report.CpuTimeReclaimed);
+        }
+
+        [Fact]
+        public void BuildReport_NeverReportsNegativeReclaim()
+        {
+            var sessionStart = new DateTime(2025, 3, 1, 20, 0, 0, DateTimeKind.Utc);
+            var samples = new[]
+            {
+                new ThrottledProcessSample
+                {
+                    ProcessName = "Discord",
+                    ProcessStartTime = sessionStart.AddMinutes(-60),
+                    CpuTimeAtStart = TimeSpan.FromSeconds(60),
+                    CpuTimeAtEnd = TimeSpan.FromSeconds(120)
+                }
+            };
+
+            var report = BackgroundThrottlePolicy.BuildReport(samples, sessionStart, sessionStart.AddMinutes(10));
+
+            Assert.Equal(TimeSpan.FromSeconds(60), report.CpuTimeUsed);
+            Assert.Equal(TimeSpan.FromSeconds(10), report.ExpectedCpuTime);
+            Assert.Equal(TimeSpan.Zero, report.CpuTimeReclaimed);
+        }
+
+        [Fact]
+        public void BuildReport_EmptySessionIsZero()
+        {
+            var at = new DateTime(2025, 3, 1, 20, 0, 0, DateTimeKind.Utc);
+
+            var report = BackgroundThrottlePolicy.BuildReport(Array.Empty<ThrottledProcessSample>(), at, at);
+
+            Assert.Equal(0, report.ProcessCount);
+            Assert.Equal(TimeSpan.Zero, report.CpuTimeReclaimed);
+        }
+    }
+}
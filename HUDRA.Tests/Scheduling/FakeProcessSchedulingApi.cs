@@ -0,0 +1,88 @@
+using HUDRA.Services.Scheduling;
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Linq;
+
+namespace HUDRA.Tests.Scheduling
+{
+    /// <summary>
+    /// In-memory process table. Trimming a working set drops it to TrimmedWorkingSetBytes.
+    /// </summary>
+    internal sealed class FakeProcessSchedulingApi : IProcessSchedulingApi
+    {
+        private readonly Dictionary<int, string> _names = new();
+
+        public Dictionary<int, long> WorkingSets { get; } = new();
+        public HashSet<int> TrimFailures { get; } = new();
+        public HashSet<int> ExitOnTrim { get; } = new();
+        public List<int> Trimmed { get; } = new();
+        public int GetProcessesCalls { get; private set; }
+        public long TrimmedWorkingSetBytes { get; set; } = 4L * 1024 * 1024;
+
+        public FakeProcessSchedulingApi(IEnumerable<ProcessSnapshot> processes)
+        {
+            foreach (var process in processes)
+                _names[process.ProcessId] = process.ProcessName;
+        }
+
+        /// <summary>
+        /// Simulates the PID being recycled by another process after the snapshot was taken.
+        /// </summary>
+        public void Reuse(int processId, string newName) => _names[processId] = newName;
+
+        public IReadOnlyList<CpuSetInfo> GetCpuSets() => Array.Empty<CpuSetInfo>();
+
+        public IReadOnlyList<ProcessSnapshot> GetProcesses()
+        {
+            GetProcessesCalls++;
+            return _names.Select(p => new ProcessSnapshot { ProcessId = p.Key, ProcessName = p.Value }).ToList();
+        }
+
+        public string? GetProcessName(int processId) => _names.TryGetValue(processId, out var name) ? name : null;
+
+        public bool TryGetWorkingSet(int processId, out long bytes) => WorkingSets.TryGetValue(processId, out bytes);
+
+        public bool TryTrimWorkingSet(int processId)
+        {
+            if (TrimFailures.Contains(processId) || !WorkingSets.ContainsKey(processId))
+                return false;
+
+            Trimmed.Add(processId);
+            if (ExitOnTrim.Contains(processId))
+            {
+                // The trim succeeded but the process is gone before its working set can be read back
+                WorkingSets.Remove(processId);
+                return true;
+            }
+
+            WorkingSets[processId] = Math.Min(WorkingSets[processId], TrimmedWorkingSetBytes);
+            return true;
+        }
+
+        public bool TryGetPriority(int processId, out ProcessPriorityClass priority)
+        {
+            priority = ProcessPriorityClass.Normal;
+            return _names.ContainsKey(processId);
+        }
+
+        public bool TrySetPriority(int processId, ProcessPriorityClass priority) => _names.ContainsKey(processId);
+        public bool TrySetDefaultCpuSets(int processId, IReadOnlyList<uint>? cpuSetIds) => _names.ContainsKey(processId);
+        public bool TrySetEfficiencyMode(int processId, bool enabled) => _names.ContainsKey(processId);
+
+        public bool TryGetIoPriority(int processId, out IoPriority priority)
+        {
+            priority = IoPriority.Normal;
+            return _names.ContainsKey(processId);
+        }
+
+        public bool TrySetIoPriority(int processId, IoPriority priority) => _names.ContainsKey(processId);
+
+        public bool TryGetCpuTime(int processId, out TimeSpan cpuTime, out DateTime startTime)
+        {
+            cpuTime = TimeSpan.Zero;
+            startTime = default;
+            return false;
+        }
+    }
+}
@@ -0,0 +1,94 @@
+using HUDRA.Models;
+using HUDRA.Services.Scheduling;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Linq;
+using Xunit;
+
+namespace HUDRA.Tests.Scheduling
+{
+    public class GameSchedulingPolicyTests
+    {
+        private static readonly ProcessSnapshot Game = new() { ProcessId = 4000, ProcessName = "eldenring" };
+
+        private static readonly ProcessSnapshot[] Running =
+        {
+            Game,
+            new() { ProcessId = 1200, ProcessName = "steam" },
+            new() { ProcessId = 1210, ProcessName = "steamwebhelper" },
+            new() { ProcessId = 1211, ProcessName = "steamwebhelper" },
+            new() { ProcessId = 1300, ProcessName = "EpicGamesLauncher" },
+            new() { ProcessId = 1400, ProcessName = "explorer" }
+        };
+
+        // 4 cores x 2 SMT siblings, core 0 holding logical processors 0 and 1
+        private static readonly CpuSetInfo[] FourCores = Enumerable.Range(0, 8)
+            .Select(i => new CpuSetInfo { Id = (uint)(256 + i), LogicalProcessorIndex = i, CoreIndex = i / 2 })
+            .ToArray();
+
+        [Fact]
+        public void DemoteLaunchers_LeavesSteamClientAlone()
+        {
+            var profile = new GameProfile { HasProfile = true, DemoteLaunchers = true };
+
+            var plan = GameSchedulingPolicy.Resolve(profile, Game, FourCores, Running);
+
+            // steam.exe hosts Steam Input, which has to keep pace with the game
+            Assert.DoesNotContain(1200, plan.Background.Select(t => t.ProcessId));
+            Assert.Equal(new[] { 1210, 1211, 1300 }, plan.Background.Select(t => t.ProcessId));
+            Assert.All(plan.Background, t => Assert.Equal(ProcessPriorityClass.BelowNormal, t.Priority));
+            Assert.Null(plan.Game);
+        }
+
+        [Fact]
+        public void DemoteLaunchers_SkipsGameSharingALauncherName()
+        {
+            var game = new ProcessSnapshot { ProcessId = 1300, ProcessName = "EpicGamesLauncher" };
+            var running = new List<ProcessSnapshot>(Running) { new() { ProcessId = 1301, ProcessName = "EpicGamesLauncher" } };
+            var profile = new GameProfile { HasProfile = true, DemoteLaunchers = true };
+
+            var plan = GameSchedulingPolicy.Resolve(profile, game, FourCores, running);
+
+            Assert.DoesNotContain("EpicGamesLauncher", plan.Background.Select(t => t.ProcessName));
+        }
+
+        [Fact]
+        public void ReserveFirstCore_GivesCoreZeroToLaunchers()
+        {
+            var profile = new GameProfile
+            {
+                HasProfile = true,
+                CpuCoreAssignment = GameSchedulingPolicy.CoresReserveFirst,
+                CpuPriority = GameSchedulingPolicy.PriorityHigh,
+                DemoteLaunchers = true
+            };
+
+            var plan = GameSchedulingPolicy.Resolve(profile, Game, FourCores, Running);
+
+            Assert.NotNull(plan.Game);
+            Assert.Equal(ProcessPriorityClass.High, plan.Game!.Priority);
+            Assert.Equal(new uint[] { 258, 259, 260, 261, 262, 263 }, plan.Game.CpuSetIds!);
+            Assert.All(plan.Background, t => Assert.Equal(new uint[] { 256, 257 }, t.CpuSetIds!));
+        }
+
+        [Fact]
+        public void ReserveFirstCore_NeedsFourCores()
+        {
+            var profile = new GameProfile { HasProfile = true, CpuCoreAssignment = GameSchedulingPolicy.CoresReserveFirst };
+
+            var plan = GameSchedulingPolicy.Resolve(profile, Game, FourCores.Take(6).ToArray(), Running);
+
+            Assert.True(plan.IsEmpty);
+        }
+
+        [Theory]
+        [InlineData("Default", null)]
+        [InlineData("AboveNormal", ProcessPriorityClass.AboveNormal)]
+        [InlineData("high", ProcessPriorityClass.High)]
+        [InlineData("RealTime", null)]
+        public void ParsePriority_NeverReturnsRealtime(string value, ProcessPriorityClass? expected)
+        {
+            Assert.Equal(expected, GameSchedulingPolicy.ParsePriority(value));
+        }
+    }
+}
@@ -0,0 +1,56 @@
+using HUDRA.Services.Scheduling;
+using System.Linq;
+using Xunit;
+
+namespace HUDRA.Tests.Scheduling
+{
+    public class KnownProcessesTests
+    {
+        [Theory]
+        [InlineData("dwm")]
+        [InlineData("SVCHOST")]
+        [InlineData("notepad")]
+        [InlineData("chrome")]
+        public void IsSystemProcess_CoversWindowsAndEverydayApps(string name)
+        {
+            Assert.True(KnownProcesses.IsSystemProcess(name));
+        }
+
+        [Theory]
+        [InlineData("steam")]
+        [InlineData("HUDRA")]
+        [InlineData("EpicGamesLauncher")]
+        public void IsSystemProcess_LeavesLaunchersAndHudraToTheirOwnLists(string name)
+        {
+            Assert.False(KnownProcesses.IsSystemProcess(name));
+        }
+
+        [Fact]
+        public void SteamClient_IsNotALauncher()
+        {
+            // Steam Input runs in steam.exe, so demotion and throttling must never reach it
+            Assert.False(KnownProcesses.IsLauncher(KnownProcesses.SteamClient));
+            Assert.True(KnownProcesses.IsLauncher("STEAMWEBHELPER"));
+        }
+
+        [Fact]
+        public void ThrottleDefaults_IncludeEveryLauncherButNotSteam()
+        {
+            Assert.All(KnownProcesses.Launchers, launcher => Assert.Contains(launcher, BackgroundThrottlePolicy.DefaultRules));
+            Assert.DoesNotContain(KnownProcesses.SteamClient, BackgroundThrottlePolicy.DefaultRules);
+        }
+
+        [Fact]
+        public void TrimDefaults_AreSteamPlusEveryLauncher()
+        {
+            Assert.Equal(new[] { KnownProcesses.SteamClient }.Concat(KnownProcesses.Launchers), WorkingSetTrimPolicy.DefaultRules);
+        }
+
+        [Fact]
+        public void NoLauncherIsProtected()
+        {
+            // A launcher in the protected sets would silently drop out of every default rule list
+            Assert.DoesNotContain(KnownProcesses.Launchers, BackgroundThrottlePolicy.IsProtected);
+        }
+    }
+}
@@ -0,0 +1,40 @@
+using HUDRA.Services.Scheduling;
+
+namespace HUDRA.Tests.Scheduling
+{
+    /// <summary>
+    /// Process tables as the detection service snapshots them on a handheld with a game running.
+    /// </summary>
+    internal static class ProcessTables
+    {
+        public static readonly ProcessSnapshot Game = new() { ProcessId = 9120, ProcessName = "Cyberpunk2077" };
+
+        public static readonly ProcessSnapshot[] Handheld =
+        {
+            new() { ProcessId = 0, ProcessName = "Idle" },
+            new() { ProcessId = 4, ProcessName = "System" },
+            new() { ProcessId = 144, ProcessName = "Registry" },
+            new() { ProcessId = 612, ProcessName = "csrss" },
+            new() { ProcessId = 988, ProcessName = "dwm" },
+            new() { ProcessId = 1044, ProcessName = "svchost" },
+            new() { ProcessId = 1050, ProcessName = "svchost" },
+            new() { ProcessId = 2210, ProcessName = "audiodg" },
+            new() { ProcessId = 3100, ProcessName = "explorer" },
+            new() { ProcessId = 3312, ProcessName = "HUDRA" },
+            new() { ProcessId = 3400, ProcessName = "RTSS" },
+            new() { ProcessId = 4100, ProcessName = "steam" },
+            new() { ProcessId = 4120, ProcessName = "steamwebhelper" },
+            new() { ProcessId = 4121, ProcessName = "steamwebhelper" },
+            new() { ProcessId = 4122, ProcessName = "steamwebhelper" },
+            new() { ProcessId = 4300, ProcessName = "EpicGamesLauncher" },
+            new() { ProcessId = 4310, ProcessName = "EpicWebHelper" },
+            new() { ProcessId = 5000, ProcessName = "OneDrive" },
+            new() { ProcessId = 5100, ProcessName = "AdobeARM" },
+            new() { ProcessId = 5101, ProcessName = "AdobeCollabSync" },
+            new() { ProcessId = 5200, ProcessName = "Discord" },
+            new() { ProcessId = 5201, ProcessName = "Discord" },
+            new() { ProcessId = 5300, ProcessName = "MicrosoftEdgeUpdate" },
+            Game
+        };
+    }
+}
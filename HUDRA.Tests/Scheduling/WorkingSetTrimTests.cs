@@ -0,0 +1,135 @@
+using HUDRA.Services.Scheduling;
+using System;
+using System.Linq;
+using Xunit;
+
+namespace HUDRA.Tests.Scheduling
+{
+    public class WorkingSetTrimTests
+    {
+        private const long MB = 1024 * 1024;
+
+        private static FakeProcessSchedulingApi CreateApi()
+        {
+            var api = new FakeProcessSchedulingApi(ProcessTables.Handheld);
+            api.WorkingSets[4100] = 180 * MB;  // steam
+            api.WorkingSets[4120] = 310 * MB;  // steamwebhelper
+            api.WorkingSets[4121] = 32 * MB;   // steamwebhelper, exactly at the threshold
+            api.WorkingSets[4122] = 31 * MB;   // steamwebhelper, just under
+            api.WorkingSets[4300] = 240 * MB;  // EpicGamesLauncher
+            api.WorkingSets[3100] = 150 * MB;  // explorer, protected
+            api.WorkingSets[9120] = 6000 * MB; // the game
+            return api;
+        }
+
+        [Theory]
+        [InlineData(0L, false)]
+        [InlineData(32L * 1024 * 1024 - 1, false)]
+        [InlineData(32L * 1024 * 1024, true)]
+        [InlineData(2L * 1024 * 1024 * 1024, true)]
+        public void ShouldTrim_UsesMinimumWorkingSet(long bytes, bool expected)
+        {
+            Assert.Equal(expected, WorkingSetTrimPolicy.ShouldTrim(bytes));
+        }
+
+        [Fact]
+        public void SelectCandidates_DefaultRulesPickLaunchersOnly()
+        {
+            var candidates = WorkingSetTrimPolicy.SelectCandidates(
+                new BackgroundThrottleRuleSet(WorkingSetTrimPolicy.DefaultRules), ProcessTables.Handheld, ProcessTables.Game);
+
+            // Trimming only pages memory out, so steam.exe is a candidate here unlike for throttling
+            Assert.Equal(new[] { 4100, 4120, 4121, 4122, 4300, 4310 }, candidates.Select(p => p.ProcessId));
+        }
+
+        [Fact]
+        public void SelectCandidates_NeverIncludesGameOrProtectedProcesses()
+        {
+            var candidates = WorkingSetTrimPolicy.SelectCandidates(
+                new BackgroundThrottleRuleSet(new[] { "Cyberpunk2077", "explorer", "dwm", "HUDRA", "steam" }),
+                ProcessTables.Handheld,
+                ProcessTables.Game);
+
+            Assert.Equal(new[] { 4100 }, candidates.Select(p => p.ProcessId));
+        }
+
+        [Fact]
+        public void TrimForGame_TrimsCandidatesAtOrAboveThreshold()
+        {
+            var api = CreateApi();
+            var service = new WorkingSetTrimService(api);
+
+            var report = service.TrimForGame(9120, "Cyberpunk2077", ProcessTables.Handheld, WorkingSetTrimPolicy.DefaultRules);
+
+            Assert.NotNull(report);
+            // 4122 is under the threshold and 4310 has no readable working set
+            Assert.Equal(new[] { 4100, 4120, 4121, 4300 }, api.Trimmed);
+            Assert.Equal((180 + 310 + 32 + 240 - 4 * 4) * MB, report!.TotalBytesFreed);
+            Assert.Equal(0, api.GetProcessesCalls);
+        }
+
+        [Fact]
+        public void TrimForGame_SkipsPidsReusedSinceTheSnapshot()
+        {
+            var api = CreateApi();
+            api.Reuse(4120, "notepad");
+            var service = new WorkingSetTrimService(api);
+
+            var report = service.TrimForGame(9120, "Cyberpunk2077", ProcessTables.Handheld, WorkingSetTrimPolicy.DefaultRules);
+
+            Assert.DoesNotContain(4120, api.Trimmed);
+            Assert.DoesNotContain(4120, report!.Results.Select(r => r.ProcessId));
+        }
+
+        [Fact]
+        public void TrimForGame_FailedTrimIsLeftOutOfReport()
+        {
+            var api = CreateApi();
+            api.TrimFailures.Add(4300);
+            var service = new WorkingSetTrimService(api);
+
+            var report = service.TrimForGame(9120, "Cyberpunk2077", ProcessTables.Handheld, WorkingSetTrimPolicy.DefaultRules);
+
+            Assert.Equal(new[] { 4100, 4120, 4121 }, report!.Results.Select(r => r.ProcessId));
+        }
+
+        [Fact]
+        public void TrimForGame_UnreadableWorkingSetAfterTrimIsLeftOutOfReport()
+        {
+            var api = CreateApi();
+            api.ExitOnTrim.Add(4300);
+            var service = new WorkingSetTrimService(api);
+
+            var report = service.TrimForGame(9120, "Cyberpunk2077", ProcessTables.Handheld, WorkingSetTrimPolicy.DefaultRules);
+
+            Assert.Contains(4300, api.Trimmed);
+            Assert.Equal(new[] { 4100, 4120, 4121 }, report!.Results.Select(r => r.ProcessId));
+            Assert.Equal((180 - 4 + 310 - 4 + 32 - 4) * MB, report.TotalBytesFreed);
+        }
+
+        [Fact]
+        public void TrimForGame_OncePerGamePidUntilRearmed()
+        {
+            var api = CreateApi();
+            var service = new WorkingSetTrimService(api);
+
+            Assert.NotNull(service.TrimForGame(9120, "Cyberpunk2077", ProcessTables.Handheld, WorkingSetTrimPolicy.DefaultRules));
+            Assert.Null(service.TrimForGame(9120, "Cyberpunk2077", ProcessTables.Handheld, WorkingSetTrimPolicy.DefaultRules));
+
+            service.Rearm();
+            Assert.NotNull(service.TrimForGame(9120, "Cyberpunk2077", ProcessTables.Handheld, WorkingSetTrimPolicy.DefaultRules));
+        }
+
+        [Fact]
+        public void TrimForGame_EmptySnapshotFallsBackToProcessList()
+        {
+            var api = CreateApi();
+            var service = new WorkingSetTrimService(api);
+
+            var report = service.TrimForGame(9120, "Cyberpunk2077", Array.Empty<ProcessSnapshot>(), WorkingSetTrimPolicy.DefaultRules);
+
+            Assert.Equal(1, api.GetProcessesCalls);
+            Assert.Equal(4, report!.Results.Count);
+        }
+    }
+}
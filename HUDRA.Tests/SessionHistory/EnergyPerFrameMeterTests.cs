@@ -0,0 +1,201 @@
+using HUDRA.Services.SessionHistory;
+using System;
+using Xunit;
+
+namespace HUDRA.Tests.SessionHistory
+{
+    public class EnergyPerFrameMeterTests
+    {
+        private const long SampleMs = 5_000;
+        private const long MaxIntervalMs = 60_000;
+
+        private static long Feed(EnergyPerFrameMeter meter, long startMs, int samples, double watts, double fps)
+        {
+            long t = startMs;
+            for (int i = 0; i < samples; i++, t += SampleMs)
+                meter.Add(t, watts, fps);
+            return t;
+        }
+
+        [Fact]
+        public void ConstantTrace_GivesPowerOverFrameRate()
+        {
+            var meter = new EnergyPerFrameMeter();
+
+            Feed(meter, 1_000, 121, 10, 50);
+
+            Assert.Equal(0.2, meter.LiveJoulesPerFrame, 12);
+            Assert.Equal(0.2, meter.TotalJoulesPerFrame, 12);
+            Assert.Equal(10 * 600, meter.TotalJoules, 9);
+            Assert.Equal(50 * 600, meter.TotalFrames, 9);
+
+            var windows = meter.WindowStats;
+            Assert.Equal(10, windows.Count);
+            Assert.Equal(0.2, windows.Mean, 12);
+            Assert.Equal(0, windows.Variance, 12);
+        }
+
+        [Fact]
+        public void FirstSample_GivesNothingYet()
+        {
+            var meter = new EnergyPerFrameMeter();
+
+            meter.Add(1_000, 10, 50);
+
+            Assert.True(double.IsNaN(meter.LiveJoulesPerFrame));
+            Assert.True(double.IsNaN(meter.TotalJoulesPerFrame));
+            Assert.False(meter.WindowStats.HasValue);
+        }
+
+        [Fact]
+        public void Interval_IsTrapezoidOfBothEnds()
+        {
+            var meter = new EnergyPerFrameMeter();
+
+            meter.Add(0, 10, 40);
+            meter.Add(SampleMs, 20, 60);
+
+            Assert.Equal(75, meter.TotalJoules, 12);
+            Assert.Equal(250, meter.TotalFrames, 12);
+            Assert.Equal(0.3, meter.LiveJoulesPerFrame, 12);
+        }
+
+        [Fact]
+        public void Live_IsRatioOfSumsOverRecentIntervals()
+        {
+            var meter = new EnergyPerFrameMeter(liveIntervals: 4);
+
+            long t = Feed(meter, 0, 20, 10, 50);
+            // One transition interval, then three at 15 W / 30 FPS
+            Feed(meter, t, 4, 15, 30);
+
+            double joules = 12.5 * 5 + 3 * 15 * 5;
+            double frames = 40 * 5 + 3 * 30 * 5;
+            Assert.Equal(joules / frames, meter.LiveJoulesPerFrame, 12);
+
+            // A mean of per-interval ratios would weight the slow stretch more
+            double meanOfRatios = (12.5 / 40 + 3 * 0.5) / 4;
+            Assert.True(meanOfRatios - meter.LiveJoulesPerFrame > 0.01);
+        }
+
+        [Fact]
+        public void Live_StaysExactOverLongSession()
+        {
+            var meter = new EnergyPerFrameMeter(liveIntervals: 12);
+            var random = new Random(94);
+            var watts = new double[10_001];
+            var fps = new double[watts.Length];
+            for (int i = 0; i < watts.Length; i++)
+            {
+                watts[i] = 8 + random.NextDouble() * 20;
+                fps[i] = 30 + random.NextDouble() * 90;
+                meter.Add(i * SampleMs, watts[i], fps[i]);
+            }
+
+            double joules = 0, frames = 0;
+            for (int i = watts.Length - 12; i < watts.Length; i++)
+            {
+                joules += (watts[i - 1] + watts[i]) / 2 * 5;
+                frames += (fps[i - 1] + fps[i]) / 2 * 5;
+            }
+            Assert.Equal(joules / frames, meter.LiveJoulesPerFrame, 12);
+        }
+
+        [Fact]
+        public void Gap_AtMaxIntervalIsIntegrated()
+        {
+            var meter = new EnergyPerFrameMeter(windowIntervals: 2);
+
+            meter.Add(0, 10, 50);
+            meter.Add(SampleMs, 10, 50);
+            meter.Add(SampleMs + MaxIntervalMs, 10, 50);
+
+            Assert.Equal(10 * 65, meter.TotalJoules, 9);
+            Assert.Equal(0.2, meter.LiveJoulesPerFrame, 12);
+            Assert.Equal(1, meter.WindowStats.Count);
+        }
+
+        [Fact]
+        public void Gap_PastMaxIntervalSplitsLiveAndWindow()
+        {
+            var meter = new EnergyPerFrameMeter(windowIntervals: 2);
+
+            meter.Add(0, 10, 50);
+            meter.Add(SampleMs, 10, 50);
+            long resume = SampleMs + MaxIntervalMs + 1;
+            meter.Add(resume, 30, 50);
+
+            // Nothing across the gap, and the half-filled window is dropped
+            Assert.Equal(50, meter.TotalJoules, 9);
+            Assert.True(double.IsNaN(meter.LiveJoulesPerFrame));
+            Assert.False(meter.WindowStats.HasValue);
+
+            meter.Add(resume + SampleMs, 30, 50);
+            Assert.Equal(0.6, meter.LiveJoulesPerFrame, 12);
+            meter.Add(resume + 2 * SampleMs, 30, 50);
+            Assert.Equal(1, meter.WindowStats.Count);
+            Assert.Equal(0.6, meter.WindowStats.Mean, 12);
+        }
+
+        [Theory]
+        [InlineData(0, 50)]
+        [InlineData(10, 0)]
+        [InlineData(double.NaN, 50)]
+        [InlineData(10, double.NaN)]
+        [InlineData(double.PositiveInfinity, 50)]
+        public void InvalidSample_BreaksTheRun(double watts, double fps)
+        {
+            var meter = new EnergyPerFrameMeter(windowIntervals: 2);
+            long t = Feed(meter, 0, 4, 10, 50);
+
+            meter.Add(t, watts, fps);
+            meter.Add(t + SampleMs, 10, 50);
+
+            // Windows close at intervals 2; the third interval's partial window went with the bad sample
+            Assert.Equal(1, meter.WindowStats.Count);
+            Assert.Equal(10 * 15, meter.TotalJoules, 9);
+            Assert.True(double.IsNaN(meter.LiveJoulesPerFrame));
+        }
+
+        [Fact]
+        public void WindowStats_OneValuePerCompletedWindow()
+        {
+            var meter = new EnergyPerFrameMeter(windowIntervals: 12);
+
+            long t = Feed(meter, 0, 13, 10, 50);
+            // Same frame rate, power doubled from the next interval on; the transition interval averages 15 W
+            t = Feed(meter, t, 12, 20, 50);
+            Feed(meter, t, 6, 20, 50);
+
+            var windows = meter.WindowStats;
+            Assert.Equal(2, windows.Count);
+            double second = (15 * 5 + 11 * 20 * 5) / (12 * 50 * 5.0);
+            Assert.Equal((0.2 + second) / 2, windows.Mean, 12);
+            Assert.Equal((second - 0.2) * (second - 0.2) / 2, windows.Variance, 12);
+        }
+
+        [Fact]
+        public void Reset_StartsOver()
+        {
+            var meter = new EnergyPerFrameMeter();
+            long t = Feed(meter, 0, 30, 10, 50);
+
+            meter.Reset();
+            meter.Add(t, 20, 50);
+
+            Assert.Equal(0, meter.TotalJoules);
+            Assert.True(double.IsNaN(meter.LiveJoulesPerFrame));
+            Assert.False(meter.WindowStats.HasValue);
+
+            meter.Add(t + SampleMs, 20, 50);
+            Assert.Equal(0.4, meter.LiveJoulesPerFrame, 12);
+        }
+
+        [Fact]
+        public void Constructor_RejectsEmptyBuffers()
+        {
+            Assert.Throws<ArgumentOutOfRangeException>(() => new EnergyPerFrameMeter(liveIntervals: 0));
+            Assert.Throws<ArgumentOutOfRangeException>(() => new EnergyPerFrameMeter(windowIntervals: 0));
+        }
+    }
+}
@@ -0,0 +1,78 @@
+using HUDRA.Models;
+using HUDRA.Services.SessionHistory;
+using System;
+using System.IO;
+using System.Linq;
+using System.Threading;
+using Xunit;
+
+namespace HUDRA.Tests.SessionHistory
+{
+    public class GameSessionRecorderTests : IDisposable
+    {
+        private readonly string _root;
+        private readonly SessionHistoryStore _store;
+
+        public GameSessionRecorderTests()
+        {
+            _root = Path.Combine(Path.GetTempPath(), "HUDRA.Tests", Guid.NewGuid().ToString("N"));
+            _store = new SessionHistoryStore(_root);
+        }
+
+        public void Dispose()
+        {
+            if (Directory.Exists(_root))
+                Directory.Delete(_root, recursive: true);
+        }
+
+        /// <summary>
+        /// Steady 60 FPS at 15 W; timestamps come from the recorder.
+        /// </summary>
+        private sealed class SteadySource : ISessionSampleSource
+        {
+            public SessionSample Read(int processId, long timestampMs)
+            {
+                var sample = SessionSample.Empty(timestampMs);
+                sample.Fps = 60;
+                sample.BatteryDischargeWatts = 15;
+                return sample;
+            }
+        }
+
+        private static GameInfo Game => new() { ProcessName = "eldenring.exe", ProcessId = 42, WindowTitle = "ELDEN RING" };
+
+        [Fact]
+        public void Dispose_WritesEverySampleThenTheSummary()
+        {
+            var recorder = new GameSessionRecorder(_store, new SteadySource(), TimeSpan.FromMilliseconds(1));
+            SessionSummary? recorded = null;
+            recorder.SessionRecorded += (_, summary) => recorded = summary;
+
+            recorder.Start(Game);
+            // Past the 120-sample flush, so both the timer's batch writes and the final write run
+            SpinWait.SpinUntil(() => recorder.Store.GetFileSize("eldenring") > 0, TimeSpan.FromSeconds(10));
+            Thread.Sleep(20);
+            recorder.Dispose();
+
+            Assert.NotNull(recorded);
+            Assert.Equal("ELDEN RING", recorded!.GameName);
+            var samples = _store.GetSessionSamples("eldenring", recorded.SessionId);
+            Assert.True(recorded.SampleCount > 120, $"{recorded.SampleCount} samples");
+            Assert.Equal(recorded.SampleCount, samples.Count);
+            Assert.Equal(samples.Select(s => s.TimestampMs).OrderBy(t => t), samples.Select(s => s.TimestampMs));
+            Assert.Single(_store.GetSummaries("eldenring"));
+        }
+
+        [Fact]
+        public void StopWithoutSamples_WritesNothing()
+        {
+            var recorder = new GameSessionRecorder(_store, new SteadySource(), TimeSpan.FromHours(1));
+
+            recorder.Start(Game);
+            recorder.Dispose();
+
+            Assert.False(recorder.IsRecording);
+            Assert.Empty(_store.GetGameKeys());
+        }
+    }
+}
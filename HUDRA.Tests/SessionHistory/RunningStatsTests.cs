@@ -0,0 +1,107 @@
+using HUDRA.Services.SessionHistory;
+using System;
+using System.Linq;
+using Xunit;
+
+namespace HUDRA.Tests.SessionHistory
+{
+    public class RunningStatsTests
+    {
+        private static RunningStats Of(params double[] values)
+        {
+            var stats = new RunningStats();
+            foreach (var value in values)
+                stats.Add(value);
+            return stats;
+        }
+
+        private static double[] Values(int count, int seed)
+        {
+            var random = new Random(seed);
+            return Enumerable.Range(0, count).Select(_ => 0.15 + random.NextDouble() * 0.1).ToArray();
+        }
+
+        [Fact]
+        public void Add_MatchesTwoPassMeanAndVariance()
+        {
+            var values = Values(200, 1);
+            double mean = values.Average();
+            double variance = values.Sum(v => (v - mean) * (v - mean)) / (values.Length - 1);
+
+            var stats = Of(values);
+
+            Assert.Equal(200, stats.Count);
+            Assert.Equal(mean, stats.Mean, 12);
+            Assert.Equal(variance, stats.Variance, 12);
+            Assert.Equal(Math.Sqrt(variance / 200), stats.StandardError, 12);
+        }
+
+        [Fact]
+        public void Add_LargeOffsetKeepsVariance()
+        {
+            // Joules per frame around a large constant: the naive sum-of-squares form loses every digit here
+            var stats = Of(1e9 + 4, 1e9 + 7, 1e9 + 13, 1e9 + 16);
+
+            Assert.Equal(30, stats.Variance, 6);
+        }
+
+        [Theory]
+        [InlineData(0)]
+        [InlineData(1)]
+        [InlineData(37)]
+        [InlineData(99)]
+        [InlineData(100)]
+        public void Merge_EqualsAddingEverything(int split)
+        {
+            var values = Values(100, 2);
+
+            var merged = RunningStats.Merge(Of(values[..split]), Of(values[split..]));
+            var all = Of(values);
+
+            Assert.Equal(all.Count, merged.Count);
+            Assert.Equal(all.Mean, merged.Mean, 12);
+            Assert.Equal(all.M2, merged.M2, 12);
+        }
+
+        [Fact]
+        public void Merge_IsOrderIndependentAcrossSessions()
+        {
+            var a = Of(Values(10, 3));
+            var b = Of(Values(25, 4));
+            var c = Of(Values(3, 5));
+
+            var left = RunningStats.Merge(RunningStats.Merge(a, b), c);
+            var right = RunningStats.Merge(c, RunningStats.Merge(b, a));
+
+            Assert.Equal(left.Count, right.Count);
+            Assert.Equal(left.Mean, right.Mean, 12);
+            Assert.Equal(left.M2, right.M2, 12);
+        }
+
+        [Fact]
+        public void Empty_HasNoValueOrSpread()
+        {
+            var empty = new RunningStats();
+            var one = Of(0.2);
+
+            Assert.False(empty.HasValue);
+            Assert.True(one.HasValue);
+            Assert.True(double.IsNaN(one.Variance));
+            Assert.True(double.IsNaN(one.StandardError));
+            Assert.True(double.IsNaN(one.ConfidenceHalfWidth95));
+        }
+
+        [Theory]
+        [InlineData(2, 12.706)]
+        [InlineData(11, 2.228)]
+        [InlineData(31, 2.042)]
+        [InlineData(101, 1.9837)]
+        public void ConfidenceHalfWidth95_UsesStudentT(int count, double t)
+        {
+            // Alternating 0.1/0.3 keeps the standard error easy to state
+            var stats = Of(Enumerable.Range(0, count).Select(i => i % 2 == 0 ? 0.1 : 0.3).ToArray());
+
+            Assert.Equal(stats.StandardError * t, stats.ConfidenceHalfWidth95, 10);
+        }
+    }
+}
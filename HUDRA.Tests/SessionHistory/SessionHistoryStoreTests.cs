@@ -0,0 +1,224 @@
+using HUDRA.Services.SessionHistory;
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using Xunit;
+
+namespace HUDRA.Tests.SessionHistory
+{
+    public class SessionHistoryStoreTests : IDisposable
+    {
+        private const long SampleIntervalMs = 5000;
+
+        private readonly string _root;
+        private readonly SessionHistoryStore _store;
+
+        public SessionHistoryStoreTests()
+        {
+            _root = Path.Combine(Path.GetTempPath(), "HUDRA.Tests", Guid.NewGuid().ToString("N"));
+            _store = new SessionHistoryStore(_root);
+        }
+
+        public void Dispose()
+        {
+            if (Directory.Exists(_root))
+                Directory.Delete(_root, recursive: true);
+        }
+
+        private static long DaysAgo(int days) => DateTimeOffset.UtcNow.AddDays(-days).ToUnixTimeMilliseconds();
+
+        /// <summary>
+        /// A 15 W handheld session: noisy package power, temperatures and FPS, a steady battery draw.
+        /// </summary>
+        internal static SessionSample[] Session(long startMs, int count, int seed)
+        {
+            var random = new Random(seed);
+            return Enumerable.Range(0, count).Select(i =>
+            {
+                var sample = SessionSample.Empty(startMs + i * SampleIntervalMs);
+                sample.TdpWatts = 15;
+                sample.PackagePowerWatts = 14.3f + (float)random.NextDouble();
+                sample.CpuTemperature = 70 + random.Next(10);
+                sample.GpuTemperature = 65;
+                sample.FanDutyPercent = 45;
+                sample.Fps = 60 + random.Next(-3, 3);
+                sample.BatteryDischargeWatts = 18.2f;
+                return sample;
+            }).ToArray();
+        }
+
+        private static SessionSummary Summarize(long sessionId, IEnumerable<SessionSample> samples)
+        {
+            var builder = new SessionSummaryBuilder(sessionId, "Elden Ring");
+            foreach (var sample in samples)
+                builder.Add(sample);
+            return builder.Build();
+        }
+
+        private static void AssertSameSamples(IReadOnlyList<SessionSample> expected, IReadOnlyList<SessionSample> actual)
+        {
+            Assert.Equal(expected.Count, actual.Count);
+            for (int i = 0; i < expected.Count; i++)
+            {
+                Assert.Equal(expected[i].TimestampMs, actual[i].TimestampMs);
+                for (int channel = 0; channel < SessionSample.ChannelCount; channel++)
+                {
+                    float want = expected[i][(SessionChannel)channel];
+                    float got = actual[i][(SessionChannel)channel];
+                    if (float.IsNaN(want))
+                        Assert.True(float.IsNaN(got), $"sample {i} channel {(SessionChannel)channel}: {got}, expected NaN");
+                    else
+                        Assert.InRange(got, want - 0.051f, want + 0.051f); // Stored at 0.1 resolution
+                }
+            }
+        }
+
+        [Fact]
+        public void Samples_RoundTripAtTenthResolution()
+        {
+            long start = DaysAgo(1);
+            var samples = Session(start, 500, 1);
+
+            _store.AppendSamples("eldenring", start, samples);
+
+            AssertSameSamples(samples, _store.GetSessionSamples("eldenring", start));
+        }
+
+        [Fact]
+        public void MissingReadings_RoundTripAsNaN()
+        {
+            long start = DaysAgo(1);
+            var samples = Session(start, 200, 2);
+            for (int i = 0; i < samples.Length; i += 7)
+                samples[i].Fps = float.NaN;
+            samples[3] = SessionSample.Empty(samples[3].TimestampMs);
+
+            _store.AppendSamples("eldenring", start, samples);
+
+            AssertSameSamples(samples, _store.GetSessionSamples("eldenring", start));
+        }
+
+        [Fact]
+        public void Summary_RoundTrips()
+        {
+            long start = DaysAgo(1);
+            var samples = Session(start, 500, 3);
+            _store.AppendSamples("eldenring", start, samples);
+            _store.AppendSummary("eldenring", Summarize(start, samples));
+
+            var summary = Assert.Single(_store.GetSummaries("eldenring"));
+
+            Assert.Equal(start, summary.SessionId);
+            Assert.Equal("Elden Ring", summary.GameName);
+            Assert.Equal(500, summary.SampleCount);
+            Assert.Equal(18.2 * 499 * 5 / 3600, summary.BatteryEnergyWh, 2);
+        }
+
+        [Fact]
+        public void GetSamples_ReturnsOnlyTheRequestedRange()
+        {
+            long start = DaysAgo(1);
+            _store.AppendSamples("eldenring", start, Session(start, 500, 4));
+
+            var range = _store.GetSamples("eldenring",
+                DateTimeOffset.FromUnixTimeMilliseconds(start + 100 * SampleIntervalMs).UtcDateTime,
+                DateTimeOffset.FromUnixTimeMilliseconds(start + 199 * SampleIntervalMs).UtcDateTime);
+
+            Assert.Equal(100, range.Count);
+            Assert.Equal(start + 100 * SampleIntervalMs, range[0].TimestampMs);
+        }
+
+        [Fact]
+        public void TornTail_IsIgnoredOnReadAndCutBeforeTheNextAppend()
+        {
+            long start = DaysAgo(1);
+            var samples = Session(start, 500, 5);
+            _store.AppendSamples("eldenring", start, samples);
+            _store.AppendSummary("eldenring", Summarize(start, samples));
+
+            // A crash part way through the next block header
+            var path = Path.Combine(_root, "eldenring.hsess");
+            long intact = new FileInfo(path).Length;
+            using (var file = new FileStream(path, FileMode.Append))
+                file.Write(new byte[] { 1, 0, 5, 0, 99, 99 });
+
+            var reopened = new SessionHistoryStore(_root);
+            Assert.Equal(500, reopened.GetSessionSamples("eldenring", start).Count);
+
+            var next = Session(start + 1, 1, 6);
+            reopened.AppendSamples("eldenring", start + 1, next);
+
+            Assert.Single(reopened.GetSessionSamples("eldenring", start + 1));
+            Assert.Single(reopened.GetSummaries("eldenring"));
+            Assert.Equal(500, reopened.GetSessionSamples("eldenring", start).Count);
+            Assert.True(new FileInfo(path).Length > intact);
+        }
+
+        [Fact]
+        public void Downsample_AveragesOldSessionsAndKeepsRecentOnes()
+        {
+            long recent = DaysAgo(1);
+            long old = DaysAgo(60);
+            var recentSamples = Session(recent, 500, 7);
+            var oldSamples = Session(old, 720, 8); // One hour
+            _store.AppendSamples("eldenring", old, oldSamples);
+            _store.AppendSummary("eldenring", Summarize(old, oldSamples));
+            _store.AppendSamples("eldenring", recent, recentSamples);
+
+            var result = _store.Downsample("eldenring", DateTime.UtcNow.AddDays(-30), TimeSpan.FromMinutes(1));
+
+            Assert.Equal(1, result.SessionsDownsampled);
+            Assert.Equal(720, result.SamplesBefore);
+            Assert.Equal(60, result.SamplesAfter);
+            Assert.True(result.BytesAfter < result.BytesBefore);
+
+            var reduced = _store.GetSessionSamples("eldenring", old);
+            Assert.Equal(60, reduced.Count);
+            Assert.Equal(oldSamples.Take(12).Average(s => s.PackagePowerWatts), reduced[0].PackagePowerWatts, 1);
+            Assert.Equal(15f, reduced[0].TdpWatts, 1);
+
+            AssertSameSamples(recentSamples, _store.GetSessionSamples("eldenring", recent));
+            Assert.Equal(720, Assert.Single(_store.GetSummaries("eldenring")).SampleCount);
+        }
+
+        [Fact]
+        public void Downsample_SkipsNaNAndRunsOnce()
+        {
+            long old = DaysAgo(60);
+            var samples = Session(old, 24, 9);
+            for (int i = 0; i < 12; i++)
+                samples[i].Fps = float.NaN; // First minute had no FPS source
+            samples[12].Fps = float.NaN;
+            _store.AppendSamples("eldenring", old, samples);
+
+            _store.Downsample("eldenring", DateTime.UtcNow.AddDays(-30), TimeSpan.FromMinutes(1));
+            var again = _store.Downsample("eldenring", DateTime.UtcNow.AddDays(-30), TimeSpan.FromMinutes(1));
+
+            var reduced = _store.GetSessionSamples("eldenring", old);
+            Assert.Equal(0, again.SessionsDownsampled);
+            Assert.Equal(2, reduced.Count);
+            Assert.True(float.IsNaN(reduced[0].Fps));
+            Assert.Equal(samples.Skip(13).Average(s => s.Fps), reduced[1].Fps, 1);
+        }
+
+        [Fact]
+        public void UnknownGame_HasNoHistory()
+        {
+            Assert.Empty(_store.GetSummaries("nothing"));
+            Assert.Empty(_store.GetSessionSamples("nothing", 1));
+            Assert.Equal(0, _store.GetFileSize("nothing"));
+            Assert.Equal(0, _store.Downsample("nothing", DateTime.UtcNow, TimeSpan.FromMinutes(1)).SessionsDownsampled);
+        }
+
+        [Theory]
+        [InlineData("eldenring.exe", "eldenring")]
+        [InlineData("  Cyberpunk2077.EXE ", "cyberpunk2077")]
+        [InlineData("a\0b", "a_b")]
+        [InlineData(".exe", "_")]
+        public void GetGameKey_IsFileSafeAndLowercase(string processName, string expected)
+        {
+            Assert.Equal(expected, SessionHistoryStore.GetGameKey(processName));
+        }
+    }
+}
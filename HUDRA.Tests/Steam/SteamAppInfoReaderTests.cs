@@ -0,0 +1,139 @@
+using HUDRA.Services.Steam;
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using Xunit;
+
+namespace HUDRA.Tests.Steam
+{
+    /// <summary>
+    /// Fixtures\Steam\appinfo_v27/28/29.vdf hold the same three apps in order: Cyberpunk 2077 (1091500)
+    /// with four launch entries, 1245620 whose body is 1 KB of 0xFF (not valid KeyValues, so it only
+    /// reads if it's skipped by size), and Dota 2 (570). The v29 file keeps its keys in the trailing table.
+    /// </summary>
+    public class SteamAppInfoReaderTests
+    {
+        private const uint Cyberpunk = 1091500;
+        private const uint Unparseable = 1245620;
+        private const uint Dota = 570;
+
+        private static byte[] LoadFixture(int version)
+        {
+            return File.ReadAllBytes(Path.Combine(AppContext.BaseDirectory, "Fixtures", "Steam", $"appinfo_v{version}.vdf"));
+        }
+
+        private static Dictionary<uint, SteamAppLaunchInfo> Read(byte[] data, params uint[] appIds)
+        {
+            return SteamAppInfoReader.Read(new MemoryStream(data), appIds.ToHashSet());
+        }
+
+        [Theory]
+        [InlineData(27)]
+        [InlineData(28)]
+        [InlineData(29)]
+        public void Read_ParsesLaunchEntriesAndPublicBuild(int version)
+        {
+            var info = Read(LoadFixture(version), Cyberpunk)[Cyberpunk];
+
+            Assert.Equal(Cyberpunk, info.AppId);
+            Assert.Equal("13948201", info.BuildId);
+            Assert.Equal(4, info.LaunchConfigs.Count);
+
+            var play = info.LaunchConfigs[1];
+            Assert.Equal("bin/x64/Cyberpunk2077.exe", play.Executable);
+            Assert.Equal("--launcher-skip", play.Arguments);
+            Assert.Equal("option1", play.Type);
+            Assert.Equal("Play Cyberpunk 2077", play.Description);
+            Assert.Equal("windows", play.OsList);
+            Assert.Equal("64", play.OsArch);
+            Assert.Equal(string.Empty, play.BetaKey);
+
+            Assert.Equal("mod_support", info.LaunchConfigs[2].BetaKey);
+            Assert.Equal("tool", info.LaunchConfigs[3].Type);
+        }
+
+        [Fact]
+        public void Read_V29KeyTableGivesSameResultAsInlineKeys()
+        {
+            var inline = Read(LoadFixture(28), Cyberpunk, Dota);
+            var table = Read(LoadFixture(29), Cyberpunk, Dota);
+
+            Assert.Equal(inline.Keys.OrderBy(id => id), table.Keys.OrderBy(id => id));
+            foreach (var (appId, expected) in inline)
+            {
+                var actual = table[appId];
+                Assert.Equal(expected.BuildId, actual.BuildId);
+                Assert.Equal(
+                    expected.LaunchConfigs.Select(c => (c.Executable, c.Arguments, c.Type, c.OsList, c.OsArch, c.BetaKey)),
+                    actual.LaunchConfigs.Select(c => (c.Executable, c.Arguments, c.Type, c.OsList, c.OsArch, c.BetaKey)));
+            }
+        }
+
+        [Theory]
+        [InlineData(27)]
+        [InlineData(29)]
+        public void Read_SkipsUnrequestedAppsBySize(int version)
+        {
+            var results = Read(LoadFixture(version), Dota);
+
+            Assert.Equal(new[] { Dota }, results.Keys);
+            Assert.Equal("15211057", results[Dota].BuildId);
+            Assert.Equal(
+                new[] { "game/bin/linuxsteamrt64/dota2", "game\\bin\\win64\\dota2.exe", "game\\bin\\win32\\dota2.exe" },
+                results[Dota].LaunchConfigs.Select(c => c.Executable));
+        }
+
+        [Fact]
+        public void Read_RequestedUnparseableAppThrowsInvalidData()
+        {
+            Assert.Throws<InvalidDataException>(() => Read(LoadFixture(28), Unparseable));
+        }
+
+        [Fact]
+        public void Read_MissingAppIsLeftOut()
+        {
+            var results = Read(LoadFixture(29), Cyberpunk, 999999);
+
+            Assert.Equal(new[] { Cyberpunk }, results.Keys);
+        }
+
+        [Fact]
+        public void Read_UnknownVersionThrowsInvalidData()
+        {
+            var data = LoadFixture(28);
+            data[0] = 0x30; // 0x07564430, a future format
+
+            Assert.Throws<InvalidDataException>(() => Read(data, Cyberpunk));
+        }
+
+        [Theory]
+        [InlineData(27)]
+        [InlineData(28)]
+        [InlineData(29)]
+        public void Read_TruncatedFileThrowsEndOfStream(int version)
+        {
+            var data = LoadFixture(version);
+
+            // Reading stops after the last requested app, so only the 0 terminator may be cut without
+            // it being noticed; v29 reads its key table from the end of the file first
+            int minimumLength = version == 29 ? data.Length : data.Length - sizeof(uint);
+            for (int length = 0; length < minimumLength; length++)
+            {
+                var truncated = data.AsSpan(0, length).ToArray();
+                Assert.Throws<EndOfStreamException>(() => Read(truncated, Cyberpunk, Dota));
+            }
+        }
+
+        [Fact]
+        public void Read_StopsAfterLastRequestedApp()
+        {
+            var data = LoadFixture(28);
+
+            // Cut in the middle of the unparseable app, past the end of Cyberpunk's entry
+            var results = Read(data.AsSpan(0, data.Length - 600).ToArray(), Cyberpunk);
+
+            Assert.Equal(new[] { Cyberpunk }, results.Keys);
+        }
+    }
+}
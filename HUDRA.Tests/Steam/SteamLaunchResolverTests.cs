@@ -0,0 +1,180 @@
+using HUDRA.Services.Steam;
+using System;
+using System.IO;
+using System.Linq;
+using Xunit;
+
+namespace HUDRA.Tests.Steam
+{
+    public class SteamLaunchResolverTests
+    {
+        private static SteamLaunchConfig Entry(string executable, string type = "", string osList = "windows",
+            string osArch = "", string betaKey = "")
+        {
+            return new SteamLaunchConfig
+            {
+                Executable = executable,
+                Type = type,
+                OsList = osList,
+                OsArch = osArch,
+                BetaKey = betaKey
+            };
+        }
+
+        [Fact]
+        public void SelectLaunchConfig_PrefersGameBinaryOverStub()
+        {
+            var configs = new[]
+            {
+                Entry("REDprelauncher.exe", type: "default"),
+                Entry("bin/x64/Cyberpunk2077.exe", type: "option1", osArch: "64")
+            };
+
+            // Stub avoidance outweighs the default type
+            Assert.Same(configs[1], SteamLaunchResolver.SelectLaunchConfig(configs, is64BitOs: true));
+        }
+
+        [Theory]
+        [InlineData("EasyAntiCheat_Launcher.exe")]
+        [InlineData("Game_BE.exe")]
+        [InlineData("start_protected_game.exe")]
+        [InlineData("_CommonRedist/vcredist/vcredist_x64.exe")]
+        [InlineData("bin\\CrashReportClient.exe")]
+        public void SelectLaunchConfig_StubIsUsedOnlyWithoutAlternative(string stub)
+        {
+            var stubOnly = new[] { Entry(stub, type: "default") };
+            var withGame = new[] { Entry(stub, type: "default"), Entry("Game.exe", type: "vr") };
+
+            Assert.Same(stubOnly[0], SteamLaunchResolver.SelectLaunchConfig(stubOnly, is64BitOs: true));
+            Assert.Same(withGame[1], SteamLaunchResolver.SelectLaunchConfig(withGame, is64BitOs: true));
+        }
+
+        [Fact]
+        public void SelectLaunchConfig_RanksArchitectureFor64BitOs()
+        {
+            var configs = new[]
+            {
+                Entry("win32/game.exe", osArch: "32"),
+                Entry("game.exe"),
+                Entry("win64/game.exe", osArch: "64")
+            };
+
+            Assert.Same(configs[2], SteamLaunchResolver.SelectLaunchConfig(configs, is64BitOs: true));
+            Assert.Same(configs[1], SteamLaunchResolver.SelectLaunchConfig(configs.Take(2).ToArray(), is64BitOs: true));
+        }
+
+        [Fact]
+        public void SelectLaunchConfig_SkipsX64EntriesOn32BitOs()
+        {
+            var configs = new[]
+            {
+                Entry("win64/game.exe", osArch: "64"),
+                Entry("win32/game.exe", osArch: "32")
+            };
+
+            Assert.Same(configs[1], SteamLaunchResolver.SelectLaunchConfig(configs, is64BitOs: false));
+            Assert.Null(SteamLaunchResolver.SelectLaunchConfig(configs.Take(1).ToArray(), is64BitOs: false));
+        }
+
+        [Theory]
+        [InlineData("", true)]
+        [InlineData("windows", true)]
+        [InlineData("macos, Windows", true)]
+        [InlineData("linux", false)]
+        [InlineData("macos,linux", false)]
+        public void SelectLaunchConfig_RequiresWindowsInOsList(string osList, bool selected)
+        {
+            var configs = new[] { Entry("game.exe", osList: osList) };
+
+            Assert.Equal(selected, SteamLaunchResolver.SelectLaunchConfig(configs, is64BitOs: true) != null);
+        }
+
+        [Theory]
+        [InlineData("server")]
+        [InlineData("Editor")]
+        [InlineData("tool")]
+        [InlineData("config")]
+        [InlineData("manual")]
+        [InlineData("benchmark")]
+        [InlineData("demo")]
+        [InlineData("othertype")]
+        public void SelectLaunchConfig_SkipsNonGameTypes(string type)
+        {
+            var configs = new[] { Entry("game.exe", type: type) };
+
+            Assert.Null(SteamLaunchResolver.SelectLaunchConfig(configs, is64BitOs: true));
+        }
+
+        [Fact]
+        public void SelectLaunchConfig_SkipsBetaOnlyAndNonExeEntries()
+        {
+            var configs = new[]
+            {
+                Entry("game_beta.exe", type: "default", betaKey: "experimental"),
+                Entry("game.bat", type: "default"),
+                Entry("", type: "default"),
+                Entry("Game.EXE", type: "option1")
+            };
+
+            Assert.Same(configs[3], SteamLaunchResolver.SelectLaunchConfig(configs, is64BitOs: true));
+        }
+
+        [Fact]
+        public void SelectLaunchConfig_RanksDefaultThenOptionThenVr()
+        {
+            var configs = new[]
+            {
+                Entry("game_vr.exe", type: "vr"),
+                Entry("game_dx11.exe", type: "option1"),
+                Entry("game.exe", type: "none")
+            };
+
+            Assert.Same(configs[2], SteamLaunchResolver.SelectLaunchConfig(configs, is64BitOs: true));
+            Assert.Same(configs[1], SteamLaunchResolver.SelectLaunchConfig(configs.Take(2).ToArray(), is64BitOs: true));
+        }
+
+        [Fact]
+        public void SelectLaunchConfig_TypeOutweighsArchitecture()
+        {
+            var configs = new[]
+            {
+                Entry("win64/game_dx12.exe", type: "option1", osArch: "64"),
+                Entry("game.exe", type: "default", osArch: "32")
+            };
+
+            Assert.Same(configs[1], SteamLaunchResolver.SelectLaunchConfig(configs, is64BitOs: true));
+        }
+
+        [Fact]
+        public void SelectLaunchConfig_TieGoesToFirstEntry()
+        {
+            var configs = new[]
+            {
+                Entry("game_dx12.exe", type: "option1"),
+                Entry("game_dx11.exe", type: "option2")
+            };
+
+            Assert.Same(configs[0], SteamLaunchResolver.SelectLaunchConfig(configs, is64BitOs: true));
+        }
+
+        [Fact]
+        public void SelectLaunchConfig_EmptyListReturnsNull()
+        {
+            Assert.Null(SteamLaunchResolver.SelectLaunchConfig(Array.Empty<SteamLaunchConfig>(), is64BitOs: true));
+        }
+
+        [Fact]
+        public void SelectLaunchConfig_FixtureAppsResolveToGameExecutable()
+        {
+            var path = Path.Combine(AppContext.BaseDirectory, "Fixtures", "Steam", "appinfo_v29.vdf");
+            var apps = SteamAppInfoReader.ReadFile(path, new[] { 1091500u, 570u }.ToHashSet());
+
+            var cyberpunk = SteamLaunchResolver.SelectLaunchConfig(apps[1091500].LaunchConfigs, is64BitOs: true);
+            var dota = SteamLaunchResolver.SelectLaunchConfig(apps[570].LaunchConfigs, is64BitOs: true);
+
+            Assert.Equal("bin/x64/Cyberpunk2077.exe", cyberpunk?.Executable);
+            Assert.Equal("--launcher-skip", cyberpunk?.Arguments);
+            Assert.Equal("game\\bin\\win64\\dota2.exe", dota?.Executable);
+        }
+    }
+}
@@ -0,0 +1,80 @@
+using HUDRA.Models;
+using HUDRA.Services.TitleMatching;
+using Xunit;
+
+namespace HUDRA.Tests.TitleMatching
+{
+    public class CrossProviderDuplicatesTests
+    {
+        private readonly TitleMatcher _matcher = new();
+
+        private static DetectedGame Game(string name, GameSource source, string installLocation, string process) => new()
+        {
+            DisplayName = name,
+            Source = source,
+            ProcessName = process,
+            ExecutablePath = installLocation + @"\" + process + ".exe",
+            InstallLocation = installLocation
+        };
+
+        private static readonly DetectedGame XboxForza =
+            Game("Forza Horizon 5", GameSource.Xbox, @"C:\XboxGames\Forza Horizon 5\Content", "ForzaHorizon5");
+
+        private DetectedGame? Find(DetectedGame game, params DetectedGame[] library) =>
+            CrossProviderDuplicates.Find(_matcher, game, CrossProviderDuplicates.BuildInstallLocationIndex(library));
+
+        [Fact]
+        public void SameFolderAndMatchingTitleFromAnotherSource_IsADuplicate()
+        {
+            var gameLib = Game("Forza Horizon 5 Premium Edition", GameSource.Directory, @"c:\xboxgames\forza horizon 5\content\", "forza_gamingdesktop");
+
+            Assert.Same(XboxForza, Find(gameLib, XboxForza));
+        }
+
+        [Fact]
+        public void SameSource_IsNeverADuplicate()
+        {
+            var second = Game("Forza Horizon 5", GameSource.Xbox, XboxForza.InstallLocation, "ForzaHorizon5_Launcher");
+
+            Assert.Null(Find(second, XboxForza));
+        }
+
+        [Fact]
+        public void DifferentFolder_IsNotADuplicate()
+        {
+            // A separate install of the same title is kept
+            var steamCopy = Game("Forza Horizon 5", GameSource.Steam, @"D:\Steam\steamapps\common\ForzaHorizon5", "ForzaHorizon5");
+
+            Assert.Null(Find(steamCopy, XboxForza));
+        }
+
+        [Theory]
+        [InlineData("Forza Horizon 4")]            // Sequel number differs
+        [InlineData("Forza Horizon 5: Hot Wheels")] // Subset only, below SameGameScore
+        public void SameFolderWithDifferentTitle_IsNotADuplicate(string title)
+        {
+            var other = Game(title, GameSource.Epic, XboxForza.InstallLocation, "Other");
+
+            Assert.Null(Find(other, XboxForza));
+        }
+
+        [Fact]
+        public void GameWithoutInstallLocation_IsNotADuplicate()
+        {
+            var manual = Game("Forza Horizon 5", GameSource.Manual, "", "ForzaHorizon5");
+            manual.ExecutablePath = @"C:\Elsewhere\ForzaHorizon5.exe";
+
+            Assert.Null(Find(manual, XboxForza));
+        }
+
+        [Theory]
+        [InlineData(@"C:\Games\Celeste\", @"C:\Games\Celeste")]
+        [InlineData(@"  C:\Games\Celeste/  ", @"C:\Games\Celeste")]
+        [InlineData("   ", null)]
+        [InlineData(null, null)]
+        public void NormalizeInstallLocation_TrimsWhitespaceAndTrailingSeparators(string? input, string? expected)
+        {
+            Assert.Equal(expected, CrossProviderDuplicates.NormalizeInstallLocation(input));
+        }
+    }
+}
@@ -0,0 +1,134 @@
+using HUDRA.Services.TitleMatching;
+using System.Linq;
+using Xunit;
+
+namespace HUDRA.Tests.TitleMatching
+{
+    public class TitleMatcherTests
+    {
+        // SteamGridDbArtworkService.MinimumMatchScore
+        private const int ArtworkSearchThreshold = 50;
+
+        private readonly TitleMatcher _matcher = new();
+
+        [Fact]
+        public void Corpus_ClassifiesAllButTheKnownExpansionPairs()
+        {
+            var misses = TitlePairCorpus.Pairs
+                .Where(p => (_matcher.Score(p.TitleA, p.TitleB) >= ArtworkSearchThreshold) != p.SameGame)
+                .Select(p => $"{p.TitleA} | {p.TitleB}")
+                .ToArray();
+
+            Assert.Equal(50, TitlePairCorpus.Pairs.Count);
+
+            // Base game vs a sequel or expansion with its own subtitle and no number: indistinguishable from
+            // "Title: Subtitle" naming the same game, so these stay above the search threshold
+            Assert.Equal(new[]
+            {
+                "DOOM Eternal | DOOM",
+                "Elden Ring | Elden Ring Nightreign",
+                "Hollow Knight | Hollow Knight: Silksong"
+            }, misses);
+        }
+
+        [Fact]
+        public void Corpus_ScoreIsSymmetric()
+        {
+            Assert.All(TitlePairCorpus.Pairs, p =>
+                Assert.Equal(_matcher.Score(p.TitleA, p.TitleB), _matcher.Score(p.TitleB, p.TitleA)));
+        }
+
+        [Theory]
+        [InlineData("DOOM Eternal", "DOOM Eternal Deluxe Edition")]
+        [InlineData("Cyberpunk 2077", "Cyberpunk 2077: Ultimate Edition")]
+        [InlineData("Sekiro: Shadows Die Twice", "Sekiro Shadows Die Twice - GOTY Edition")]
+        [InlineData("Death Stranding Director's Cut", "DEATH STRANDING")]
+        [InlineData("Elden Ring", "ELDEN RING™")]
+        [InlineData("Pokémon Legends", "Pokemon Legends")]
+        public void EditionsAndSymbols_ScoreAsTheSameGame(string a, string b)
+        {
+            Assert.True(_matcher.Score(a, b) >= TitleMatcher.SameGameScore);
+        }
+
+        [Theory]
+        [InlineData("Grand Theft Auto V", "Grand Theft Auto 5")]
+        [InlineData("Final Fantasy VII", "Final Fantasy 7")]
+        [InlineData("Baldur's Gate 3", "Baldurs Gate III")]
+        [InlineData("Dark Souls III", "DARK SOULS™ III")]
+        public void RomanNumerals_MatchDigits(string a, string b)
+        {
+            Assert.True(_matcher.Score(a, b) >= TitleMatcher.SameGameScore);
+        }
+
+        [Fact]
+        public void LeadingSingleLetterNumeral_StaysAWord()
+        {
+            // "V Rising" isn't "5 Rising", so it has no sequel number to clash with
+            var key = _matcher.Prepare("V Rising");
+
+            Assert.Equal("v rising", key.SearchText);
+            Assert.Equal(TitleMatcher.ExactScore, _matcher.Score("V Rising", "V Rising"));
+            Assert.True(_matcher.Score("V Rising", "5 Rising") < ArtworkSearchThreshold);
+        }
+
+        [Theory]
+        [InlineData("Portal", "Portal 2")]
+        [InlineData("Hades", "Hades II")]
+        [InlineData("Forza Horizon 5", "Forza Horizon 4")]
+        [InlineData("Grand Theft Auto V", "Grand Theft Auto IV")]
+        [InlineData("The Last of Us Part I", "The Last of Us Part II")]
+        public void DifferentSequelNumbers_AreCappedBelowTheSearchThreshold(string a, string b)
+        {
+            Assert.InRange(_matcher.Score(a, b), 0, ArtworkSearchThreshold - 1);
+        }
+
+        [Theory]
+        [InlineData("Monster Hunter: World", "Monster Hunter World: Iceborne")]
+        [InlineData("Sekiro: Shadows Die Twice", "Sekiro")]
+        [InlineData("Disco Elysium", "Disco Elysium - The Final Cut")]
+        public void Subtitles_ScoreAsSubsets(string a, string b)
+        {
+            Assert.InRange(_matcher.Score(a, b), TitleMatcher.SubsetScore, TitleMatcher.SameGameScore);
+        }
+
+        [Theory]
+        [InlineData("Marvel's Spider-Man Remastered", "Marvel’s Spiderman Remastered")]
+        [InlineData("Counter-Strike 2", "Counter Strike 2")]
+        [InlineData("Half-Life 2", "Half Life 2")]
+        public void SpacingAndHyphenation_ScoreAsTheSameGame(string a, string b)
+        {
+            Assert.True(_matcher.Score(a, b) >= ArtworkSearchThreshold);
+        }
+
+        [Theory]
+        [InlineData("", "Portal")]
+        [InlineData("The", "The")]
+        [InlineData("™", "Portal")]
+        public void TitlesWithoutSignificantWords_ScoreZero(string a, string b)
+        {
+            Assert.Equal(0, _matcher.Score(a, b));
+        }
+
+        [Fact]
+        public void Rank_OrdersBestFirstAndKeepsProviderOrderOnTies()
+        {
+            var candidates = new[] { "Portal 2", "Portal", "Portal: Revolution", "PORTAL", "Stardew Valley" };
+
+            var ranked = _matcher.Rank("Portal", candidates, c => c, ArtworkSearchThreshold);
+
+            Assert.Equal(new[] { "Portal", "PORTAL", "Portal: Revolution" }, ranked.Select(m => m.Item));
+            Assert.Equal(TitleMatcher.ExactScore, ranked[0].Score);
+        }
+
+        [Fact]
+        public void Prepare_InternsTokensOncePerMatcher()
+        {
+            _matcher.Prepare("Halo Infinite");
+            int afterFirst = _matcher.TokenCount;
+
+            _matcher.Prepare("HALO: Infinite");
+
+            Assert.Equal(afterFirst, _matcher.TokenCount);
+        }
+    }
+}
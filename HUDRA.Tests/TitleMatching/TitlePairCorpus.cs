@@ -0,0 +1,35 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+
+namespace HUDRA.Tests.TitleMatching
+{
+    /// <summary>
+    /// Fixtures\TitleMatching\title_pairs.tsv: 50 labelled title pairs as they appear across Steam, Epic, Xbox,
+    /// GOG and SteamGridDB - editions, subtitles, roman numerals, trademark symbols, sequels and near-miss
+    /// names - each marked with whether both titles name the same game.
+    /// </summary>
+    internal static class TitlePairCorpus
+    {
+        public readonly record struct Pair(string TitleA, string TitleB, bool SameGame);
+
+        private static readonly Lazy<Pair[]> _pairs = new(Load);
+
+        public static IReadOnlyList<Pair> Pairs => _pairs.Value;
+
+        private static Pair[] Load()
+        {
+            var path = Path.Combine(AppContext.BaseDirectory, "Fixtures", "TitleMatching", "title_pairs.tsv");
+            return File.ReadLines(path)
+                .Skip(1)
+                .Where(line => line.Length > 0)
+                .Select(line =>
+                {
+                    var f = line.Split('\t');
+                    return new Pair(f[0], f[1], bool.Parse(f[2]));
+                })
+                .ToArray();
+        }
+    }
+}
@@ -0,0 +1,182 @@
+using HUDRA.Services.UiDispatch;
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Threading;
+using System.Threading.Tasks;
+using Xunit;
+
+namespace HUDRA.Tests.UiDispatch
+{
+    public class UiUpdateCoalescerTests
+    {
+        private readonly UiUpdateCoalescer _coalescer = new();
+        private readonly List<string> _applied = new();
+
+        private bool Post(string key, string value) => _coalescer.Post(key, () => _applied.Add($"{key}={value}"));
+
+        [Fact]
+        public void FirstPost_RequestsDrain_LaterPostsRideAlong()
+        {
+            Assert.True(Post("Fan", "1"));
+            Assert.False(Post("Temp", "1"));
+            Assert.False(Post("Fan", "2"));
+            Assert.True(_coalescer.HasPending);
+        }
+
+        [Fact]
+        public void LaterPost_SupersedesPendingUpdateForSameKey()
+        {
+            for (int i = 1; i <= 10; i++)
+                Post("Fan", i.ToString());
+
+            Assert.Equal(1, _coalescer.Drain());
+            Assert.Equal(new[] { "Fan=10" }, _applied);
+
+            var stats = _coalescer.Stats;
+            Assert.Equal(10, stats.Posted);
+            Assert.Equal(1, stats.Applied);
+            Assert.Equal(9, stats.Superseded);
+            Assert.Equal(1, stats.Batches);
+        }
+
+        [Fact]
+        public void Drain_RunsSlotsInFirstPostOrder()
+        {
+            Post("Temp", "70");
+            Post("Fan", "30");
+            Post("Battery", "80");
+            Post("Temp", "71"); // Keeps Temp's original slot
+            Post("Fan", "35");
+
+            _coalescer.Drain();
+
+            Assert.Equal(new[] { "Temp=71", "Fan=35", "Battery=80" }, _applied);
+        }
+
+        [Fact]
+        public void ProgressThenSummary_SummaryStillLast()
+        {
+            // Scan progress and DatabaseReady share a batch; a superseding progress line must not jump ahead
+            Post("ScanProgress", "scanning");
+            Post("DatabaseReady", "true");
+            Post("ScanProgress", "complete");
+
+            _coalescer.Drain();
+
+            Assert.Equal(new[] { "ScanProgress=complete", "DatabaseReady=true" }, _applied);
+        }
+
+        [Fact]
+        public void PostDuringDrain_LandsInNextBatchAndRequestsDrain()
+        {
+            bool? requestedDuringDrain = null;
+            _coalescer.Post("Fan", () =>
+            {
+                _applied.Add("Fan=1");
+                requestedDuringDrain = Post("Fan", "2");
+            });
+            Post("Temp", "1");
+
+            Assert.Equal(2, _coalescer.Drain());
+            Assert.Equal(new[] { "Fan=1", "Temp=1" }, _applied);
+            Assert.True(requestedDuringDrain);
+            Assert.True(_coalescer.HasPending);
+
+            Assert.Equal(1, _coalescer.Drain());
+            Assert.Equal("Fan=2", _applied[^1]);
+            Assert.Equal(2, _coalescer.Stats.Batches);
+        }
+
+        [Fact]
+        public void EmptyDrain_ClearsRequestWithoutCountingABatch()
+        {
+            Assert.Equal(0, _coalescer.Drain());
+            Assert.Equal(0, _coalescer.Stats.Batches);
+
+            // After any drain the next post asks for a new one
+            Assert.True(Post("Fan", "1"));
+        }
+
+        [Fact]
+        public void ThrowingUpdate_DoesNotStopTheRest()
+        {
+            var errors = new List<Exception>();
+            Post("Fan", "1");
+            _coalescer.Post("Temp", () => throw new InvalidOperationException("sensor gone"));
+            Post("Battery", "1");
+
+            Assert.Equal(3, _coalescer.Drain(errors.Add));
+
+            Assert.Equal(new[] { "Fan=1", "Battery=1" }, _applied);
+            Assert.Equal("sensor gone", Assert.Single(errors).Message);
+            Assert.Equal(3, _coalescer.Stats.Applied);
+        }
+
+        [Fact]
+        public void NullArguments_Throw()
+        {
+            Assert.Throws<ArgumentNullException>(() => _coalescer.Post(null!, () => { }));
+            Assert.Throws<ArgumentNullException>(() => _coalescer.Post("Fan", null!));
+        }
+
+        [Fact]
+        public void StatsSince_IsTheDifference()
+        {
+            Post("Fan", "1");
+            Post("Fan", "2");
+            _coalescer.Drain();
+            var earlier = _coalescer.Stats;
+
+            Post("Fan", "3");
+            Post("Temp", "1");
+            _coalescer.Drain();
+
+            var delta = _coalescer.Stats.Since(earlier);
+            Assert.Equal(2, delta.Posted);
+            Assert.Equal(2, delta.Applied);
+            Assert.Equal(0, delta.Superseded);
+            Assert.Equal(1, delta.Batches);
+        }
+
+        [Fact]
+        public async Task ConcurrentPosters_ExactlyOneDrainRequestPerBatchAndLatestValueWins()
+        {
+            const int Writers = 4;
+            const int PostsPerWriter = 20000;
+            var latest = new int[Writers];
+            var drainRequests = 0;
+            using var stop = new CancellationTokenSource();
+
+            // Stand-in for the UI thread: drains whenever a poster asks
+            var drainer = Task.Run(() =>
+            {
+                while (!stop.IsCancellationRequested || _coalescer.HasPending)
+                {
+                    _coalescer.Drain();
+                    Thread.Yield();
+                }
+            });
+
+            await Task.WhenAll(Enumerable.Range(0, Writers).Select(writer => Task.Run(() =>
+            {
+                for (int i = 1; i <= PostsPerWriter; i++)
+                {
+                    int value = i;
+                    if (_coalescer.Post($"Sensor{writer}", () => latest[writer] = value))
+                        Interlocked.Increment(ref drainRequests);
+                }
+            })));
+
+            stop.Cancel();
+            await drainer;
+            _coalescer.Drain();
+
+            var stats = _coalescer.Stats;
+            Assert.Equal(Writers * PostsPerWriter, stats.Posted);
+            Assert.Equal(stats.Posted, stats.Applied + stats.Superseded);
+            Assert.All(latest, value => Assert.Equal(PostsPerWriter, value));
+            Assert.InRange(stats.Batches, 1, drainRequests);
+        }
+    }
+}
@@ -1,8 +1,8 @@
 ﻿using HUDRA.Configuration;
 using HUDRA.Services;
+using HUDRA.Services.FanControl;
 using Microsoft.UI.Xaml;
 using System;
-using System.Collections.Generic;
 using System.Runtime.InteropServices;
 using System.Threading;
 using System.Threading.Tasks;
@@ -349,30 +349,27 @@ namespace HUDRA
                 // Delay briefly to allow Windows to stabilize after resume
                 await Task.Delay(2000);
 
-                var reinitTasks = new List<Task>();
+                // One fresh WinRing0 handle for every EC user, before any of them touches the EC again.
+                // The re-inits then run one after the other so fan detection and the turbo button setup
+                // both see the new handle.
+                if (ECPortBroker.Shared.IsOpen && !ECPortBroker.Shared.Reopen())
+                {
+                    System.Diagnostics.Debug.WriteLine("⚠️ Failed to reopen EC port I/O after resume");
+                }
 
                 // Reinitialize hardware-dependent services
                 if (TurboService != null)
                 {
-                    reinitTasks.Add(Task.Run(() =>
-                    {
-                        var result = TurboService.ReinitializeAfterResume();
-                        System.Diagnostics.Debug.WriteLine($"⚡ TurboService reinitialization: {result.Message}");
-                    }));
+                    var result = await Task.Run(() => TurboService.ReinitializeAfterResume());
+                    System.Diagnostics.Debug.WriteLine($"⚡ TurboService reinitialization: {result.Message}");
                 }
 
                 if (FanControlService != null)
                 {
-                    reinitTasks.Add(Task.Run(async () =>
-                    {
-                        var result = await FanControlService.ReinitializeAfterResumeAsync();
-                        System.Diagnostics.Debug.WriteLine($"⚡ FanControlService reinitialization: {result.Message}");
-                    }));
+                    var result = await Task.Run(() => FanControlService.ReinitializeAfterResumeAsync());
+                    System.Diagnostics.Debug.WriteLine($"⚡ FanControlService reinitialization: {result.Message}");
                 }
 
-                // Wait for all reinitializations to complete
-                await Task.WhenAll(reinitTasks);
-
                 // Reinitialize TDP and apply last used settings
                 await ReinitializeTdpAfterResume();
 
@@ -471,6 +468,7 @@ namespace HUDRA
                 TemperatureMonitor?.Dispose();
                 FanControlService?.Dispose();
                 TurboService?.Dispose();
+                ECPortBroker.Shared.Dispose();
 
                 // Release the single instance mutex
                 _instanceMutex?.ReleaseMutex();
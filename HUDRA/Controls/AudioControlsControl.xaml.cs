@@ -150,13 +150,16 @@ namespace HUDRA.Controls
 
         private void SetupEventHandlers()
         {
+            // Unsubscribe first - Initialize runs again on every visit to a cached MainPage
             if (MuteButton != null)
             {
+                MuteButton.Click -= OnMuteButtonClick;
                 MuteButton.Click += OnMuteButtonClick;
             }
 
             if (VolumeSlider != null)
             {
+                VolumeSlider.ValueChanged -= OnVolumeSliderValueChanged;
                 VolumeSlider.ValueChanged += OnVolumeSliderValueChanged;
             }
         }
@@ -112,8 +112,10 @@ namespace HUDRA.Controls
 
         private void SetupEventHandlers()
         {
+            // Unsubscribe first - Initialize runs again on every visit to a cached MainPage
             if (BrightnessSlider != null)
             {
+                BrightnessSlider.ValueChanged -= OnBrightnessSliderValueChanged;
                 BrightnessSlider.ValueChanged += OnBrightnessSliderValueChanged;
             }
         }
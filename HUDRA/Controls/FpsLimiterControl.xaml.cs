@@ -231,10 +231,13 @@ namespace HUDRA.Controls
             }
 
             // Set up ComboBox event handlers for dropdown state tracking
+            // Unsubscribe first - Initialize runs again on every visit to a cached MainPage
             if (FpsLimitComboBox != null)
             {
-                FpsLimitComboBox.DropDownOpened += (s, e) => { IsComboBoxOpen = true; };
-                FpsLimitComboBox.DropDownClosed += (s, e) => { IsComboBoxOpen = false; };
+                FpsLimitComboBox.DropDownOpened -= OnFpsComboBoxDropDownOpened;
+                FpsLimitComboBox.DropDownClosed -= OnFpsComboBoxDropDownClosed;
+                FpsLimitComboBox.DropDownOpened += OnFpsComboBoxDropDownOpened;
+                FpsLimitComboBox.DropDownClosed += OnFpsComboBoxDropDownClosed;
             }
 
             // Only check running status - installation status already set in constructor from cache
@@ -264,6 +267,9 @@ namespace HUDRA.Controls
             StartHdrPolling();
         }
 
+        private void OnFpsComboBoxDropDownOpened(object? sender, object e) => IsComboBoxOpen = true;
+        private void OnFpsComboBoxDropDownClosed(object? sender, object e) => IsComboBoxOpen = false;
+
         private void LoadHdrState()
         {
             if (_hdrService == null) return;
@@ -293,6 +299,13 @@ namespace HUDRA.Controls
 
         private void StartHdrPolling()
         {
+            // Re-initialization on a cached page would otherwise leave the old timer running
+            if (_hdrPollTimer != null)
+            {
+                _hdrPollTimer.Stop();
+                _hdrPollTimer.Tick -= OnHdrPollTimerTick;
+            }
+
             _hdrPollTimer = new DispatcherTimer
             {
                 Interval = TimeSpan.FromSeconds(2)
@@ -2,6 +2,7 @@ using HUDRA.AttachedProperties;
 using HUDRA.Interfaces;
 using HUDRA.Models;
 using HUDRA.Services;
+using HUDRA.Services.Power;
 using Microsoft.UI;
 using Microsoft.UI.Xaml;
 using Microsoft.UI.Xaml.Controls;
@@ -39,16 +40,19 @@ namespace HUDRA.Controls
         private bool _isSliderActivated = false;
 
         // Focus elements mapping (dynamic based on feature availability):
-        // Base: 0=TdpPicker, 1=AutoRevert, 2=Resolution, 3=RefreshRate, 4=Hdr (always present, may be disabled)
-        // Conditional: FpsLimit (if RTSS), FanCurve (if fan), RSR (if AMD), AFMF (if AMD), AntiLag (if AMD)
+        // Base: 0=TdpPicker, 1=SlowLimit, 2=FastLimit, 3=ApuSlowLimit, 4=TctlLimit, 5=AutoRevert, 6=Resolution, 7=RefreshRate,
+        //       Hdr (always present, may be disabled)
+        // Conditional: FpsLimit (if RTSS), FanCurve (if fan), RSR, AFMF, AntiLag, Chill, RadeonBoost, ImageSharpening (if AMD)
+        // Trailing: CpuMaxState, CpuEnergy, CpuBoost, CpuPriority, CpuCores, Launchers, BackgroundThrottle, TrimLauncherMemory (always present)
         private int MaxFocusIndex
         {
             get
             {
-                int count = 5; // TdpPicker, AutoRevert, Resolution, RefreshRate, Hdr
+                int count = 9; // TdpPicker, SlowLimit, FastLimit, ApuSlowLimit, TctlLimit, AutoRevert, Resolution, RefreshRate, Hdr
                 if (_isRtssAvailable) count++; // FpsLimit
                 if (_isFanControlAvailable) count++; // FanCurve
-                if (_isAmdAvailable) count += 4; // RSR, RsrSharpness, AFMF, AntiLag
+                if (_isAmdAvailable) count += 7; // RSR, RsrSharpness, AFMF, AntiLag, Chill, RadeonBoost, ImageSharpening
+                count += 8; // CpuMaxState, CpuEnergy, CpuBoost, CpuPriority, CpuCores, Launchers, BackgroundThrottle, TrimLauncherMemory
                 return count - 1;
             }
         }
@@ -70,17 +74,21 @@ namespace HUDRA.Controls
         public Visibility FanControlAvailableVisibility => _isFanControlAvailable ? Visibility.Visible : Visibility.Collapsed;
 
         // Helper to get element type from focus index
-        private enum FocusElement { TdpPicker, AutoRevert, Resolution, RefreshRate, FpsLimit, Hdr, FanCurve, Rsr, RsrSharpness, Afmf, AntiLag }
+        private enum FocusElement { TdpPicker, SlowLimit, FastLimit, ApuSlowLimit, TctlLimit, AutoRevert, Resolution, RefreshRate, FpsLimit, Hdr, FanCurve, Rsr, RsrSharpness, Afmf, AntiLag, Chill, RadeonBoost, ImageSharpening, CpuMaxState, CpuEnergy, CpuBoost, CpuPriority, CpuCores, Launchers, BackgroundThrottle, TrimLauncherMemory }
 
         private FocusElement GetElementAtIndex(int index)
         {
-            // Base elements: 0-3
+            // Base elements: 0-7
             if (index == 0) return FocusElement.TdpPicker;
-            if (index == 1) return FocusElement.AutoRevert;
-            if (index == 2) return FocusElement.Resolution;
-            if (index == 3) return FocusElement.RefreshRate;
+            if (index == 1) return FocusElement.SlowLimit;
+            if (index == 2) return FocusElement.FastLimit;
+            if (index == 3) return FocusElement.ApuSlowLimit;
+            if (index == 4) return FocusElement.TctlLimit;
+            if (index == 5) return FocusElement.AutoRevert;
+            if (index == 6) return FocusElement.Resolution;
+            if (index == 7) return FocusElement.RefreshRate;
 
-            int offset = 4;
+            int offset = 8;
 
             // FpsLimit (if RTSS)
             if (_isRtssAvailable)
@@ -107,13 +115,31 @@ namespace HUDRA.Controls
                 if (index == offset + 1) return FocusElement.RsrSharpness;
                 if (index == offset + 2) return FocusElement.Afmf;
                 if (index == offset + 3) return FocusElement.AntiLag;
+                if (index == offset + 4) return FocusElement.Chill;
+                if (index == offset + 5) return FocusElement.RadeonBoost;
+                if (index == offset + 6) return FocusElement.ImageSharpening;
+                offset += 7;
             }
 
+            // CPU power and scheduling (always present)
+            if (index == offset) return FocusElement.CpuMaxState;
+            if (index == offset + 1) return FocusElement.CpuEnergy;
+            if (index == offset + 2) return FocusElement.CpuBoost;
+            if (index == offset + 3) return FocusElement.CpuPriority;
+            if (index == offset + 4) return FocusElement.CpuCores;
+            if (index == offset + 5) return FocusElement.Launchers;
+            if (index == offset + 6) return FocusElement.BackgroundThrottle;
+            if (index == offset + 7) return FocusElement.TrimLauncherMemory;
+
             return FocusElement.TdpPicker; // Fallback
         }
 
         // Focus brush properties for gamepad navigation
         public Brush TdpFocusBrush => GetFocusBrush(FocusElement.TdpPicker);
+        public Brush SlowLimitFocusBrush => GetFocusBrush(FocusElement.SlowLimit);
+        public Brush FastLimitFocusBrush => GetFocusBrush(FocusElement.FastLimit);
+        public Brush ApuSlowLimitFocusBrush => GetFocusBrush(FocusElement.ApuSlowLimit);
+        public Brush TctlLimitFocusBrush => GetFocusBrush(FocusElement.TctlLimit);
         public Brush AutoRevertFocusBrush => GetFocusBrush(FocusElement.AutoRevert);
         public Brush ResolutionFocusBrush => GetFocusBrush(FocusElement.Resolution);
         public Brush RefreshRateFocusBrush => GetFocusBrush(FocusElement.RefreshRate);
@@ -124,6 +150,17 @@ namespace HUDRA.Controls
         public Brush RsrSharpnessFocusBrush => GetFocusBrush(FocusElement.RsrSharpness);
         public Brush AfmfFocusBrush => GetFocusBrush(FocusElement.Afmf);
         public Brush AntiLagFocusBrush => GetFocusBrush(FocusElement.AntiLag);
+        public Brush ChillFocusBrush => GetFocusBrush(FocusElement.Chill);
+        public Brush RadeonBoostFocusBrush => GetFocusBrush(FocusElement.RadeonBoost);
+        public Brush ImageSharpeningFocusBrush => GetFocusBrush(FocusElement.ImageSharpening);
+        public Brush CpuMaxStateFocusBrush => GetFocusBrush(FocusElement.CpuMaxState);
+        public Brush CpuEnergyFocusBrush => GetFocusBrush(FocusElement.CpuEnergy);
+        public Brush CpuBoostFocusBrush => GetFocusBrush(FocusElement.CpuBoost);
+        public Brush CpuPriorityFocusBrush => GetFocusBrush(FocusElement.CpuPriority);
+        public Brush CpuCoresFocusBrush => GetFocusBrush(FocusElement.CpuCores);
+        public Brush LaunchersFocusBrush => GetFocusBrush(FocusElement.Launchers);
+        public Brush BackgroundThrottleFocusBrush => GetFocusBrush(FocusElement.BackgroundThrottle);
+        public Brush TrimLauncherMemoryFocusBrush => GetFocusBrush(FocusElement.TrimLauncherMemory);
 
         // HDR properties
         public bool IsHdrSupported => _isHdrSupported;
@@ -187,6 +224,10 @@ namespace HUDRA.Controls
             var element = GetElementAtIndex(_currentFocusedElement);
             return element switch
             {
+                FocusElement.SlowLimit => SlowLimitComboBox,
+                FocusElement.FastLimit => FastLimitComboBox,
+                FocusElement.ApuSlowLimit => ApuSlowLimitComboBox,
+                FocusElement.TctlLimit => TctlLimitComboBox,
                 FocusElement.Resolution => ResolutionComboBox,
                 FocusElement.RefreshRate => RefreshRateComboBox,
                 FocusElement.FpsLimit => FpsLimitComboBox,
@@ -195,6 +236,17 @@ namespace HUDRA.Controls
                 FocusElement.Rsr => RsrComboBox,
                 FocusElement.Afmf => AfmfComboBox,
                 FocusElement.AntiLag => AntiLagComboBox,
+                FocusElement.Chill => ChillComboBox,
+                FocusElement.RadeonBoost => RadeonBoostComboBox,
+                FocusElement.ImageSharpening => ImageSharpeningComboBox,
+                FocusElement.CpuMaxState => CpuMaxStateComboBox,
+                FocusElement.CpuEnergy => CpuEnergyComboBox,
+                FocusElement.CpuBoost => CpuBoostComboBox,
+                FocusElement.CpuPriority => CpuPriorityComboBox,
+                FocusElement.CpuCores => CpuCoresComboBox,
+                FocusElement.Launchers => LaunchersComboBox,
+                FocusElement.BackgroundThrottle => BackgroundThrottleComboBox,
+                FocusElement.TrimLauncherMemory => TrimLauncherMemoryComboBox,
                 _ => null
             };
         }
@@ -255,6 +307,18 @@ namespace HUDRA.Controls
             var element = GetElementAtIndex(_currentFocusedElement);
             switch (element)
             {
+                case FocusElement.SlowLimit:
+                    SlowLimitComboBox.IsDropDownOpen = true;
+                    break;
+                case FocusElement.FastLimit:
+                    FastLimitComboBox.IsDropDownOpen = true;
+                    break;
+                case FocusElement.ApuSlowLimit:
+                    ApuSlowLimitComboBox.IsDropDownOpen = true;
+                    break;
+                case FocusElement.TctlLimit:
+                    TctlLimitComboBox.IsDropDownOpen = true;
+                    break;
                 case FocusElement.AutoRevert:
                     AutoRevertToggle.IsOn = !AutoRevertToggle.IsOn;
                     break;
@@ -290,6 +354,39 @@ namespace HUDRA.Controls
                 case FocusElement.AntiLag:
                     AntiLagComboBox.IsDropDownOpen = true;
                     break;
+                case FocusElement.Chill:
+                    ChillComboBox.IsDropDownOpen = true;
+                    break;
+                case FocusElement.RadeonBoost:
+                    RadeonBoostComboBox.IsDropDownOpen = true;
+                    break;
+                case FocusElement.ImageSharpening:
+                    ImageSharpeningComboBox.IsDropDownOpen = true;
+                    break;
+                case FocusElement.CpuMaxState:
+                    CpuMaxStateComboBox.IsDropDownOpen = true;
+                    break;
+                case FocusElement.CpuEnergy:
+                    CpuEnergyComboBox.IsDropDownOpen = true;
+                    break;
+                case FocusElement.CpuBoost:
+                    CpuBoostComboBox.IsDropDownOpen = true;
+                    break;
+                case FocusElement.CpuPriority:
+                    CpuPriorityComboBox.IsDropDownOpen = true;
+                    break;
+                case FocusElement.CpuCores:
+                    CpuCoresComboBox.IsDropDownOpen = true;
+                    break;
+                case FocusElement.Launchers:
+                    LaunchersComboBox.IsDropDownOpen = true;
+                    break;
+                case FocusElement.BackgroundThrottle:
+                    BackgroundThrottleComboBox.IsDropDownOpen = true;
+                    break;
+                case FocusElement.TrimLauncherMemory:
+                    TrimLauncherMemoryComboBox.IsDropDownOpen = true;
+                    break;
                 // TdpPicker doesn't use activation
             }
         }
@@ -333,6 +430,10 @@ namespace HUDRA.Controls
             DispatcherQueue.TryEnqueue(() =>
             {
                 OnPropertyChanged(nameof(TdpFocusBrush));
+                OnPropertyChanged(nameof(SlowLimitFocusBrush));
+                OnPropertyChanged(nameof(FastLimitFocusBrush));
+                OnPropertyChanged(nameof(ApuSlowLimitFocusBrush));
+                OnPropertyChanged(nameof(TctlLimitFocusBrush));
                 OnPropertyChanged(nameof(AutoRevertFocusBrush));
                 OnPropertyChanged(nameof(ResolutionFocusBrush));
                 OnPropertyChanged(nameof(RefreshRateFocusBrush));
@@ -343,6 +444,17 @@ namespace HUDRA.Controls
                 OnPropertyChanged(nameof(RsrSharpnessFocusBrush));
                 OnPropertyChanged(nameof(AfmfFocusBrush));
                 OnPropertyChanged(nameof(AntiLagFocusBrush));
+                OnPropertyChanged(nameof(ChillFocusBrush));
+                OnPropertyChanged(nameof(RadeonBoostFocusBrush));
+                OnPropertyChanged(nameof(ImageSharpeningFocusBrush));
+                OnPropertyChanged(nameof(CpuMaxStateFocusBrush));
+                OnPropertyChanged(nameof(CpuEnergyFocusBrush));
+                OnPropertyChanged(nameof(CpuBoostFocusBrush));
+                OnPropertyChanged(nameof(CpuPriorityFocusBrush));
+                OnPropertyChanged(nameof(CpuCoresFocusBrush));
+                OnPropertyChanged(nameof(LaunchersFocusBrush));
+                OnPropertyChanged(nameof(BackgroundThrottleFocusBrush));
+                OnPropertyChanged(nameof(TrimLauncherMemoryFocusBrush));
 
                 // Scroll current element into view
                 ScrollCurrentElementIntoView();
@@ -354,6 +466,10 @@ namespace HUDRA.Controls
             FrameworkElement? elementToScroll = GetElementAtIndex(_currentFocusedElement) switch
             {
                 FocusElement.TdpPicker => TdpPicker,
+                FocusElement.SlowLimit => SlowLimitComboBox,
+                FocusElement.FastLimit => FastLimitComboBox,
+                FocusElement.ApuSlowLimit => ApuSlowLimitComboBox,
+                FocusElement.TctlLimit => TctlLimitComboBox,
                 FocusElement.AutoRevert => AutoRevertToggle,
                 FocusElement.Resolution => ResolutionComboBox,
                 FocusElement.RefreshRate => RefreshRateComboBox,
@@ -364,6 +480,17 @@ namespace HUDRA.Controls
                 FocusElement.RsrSharpness => RsrSharpnessSlider,
                 FocusElement.Afmf => AfmfComboBox,
                 FocusElement.AntiLag => AntiLagComboBox,
+                FocusElement.Chill => ChillComboBox,
+                FocusElement.RadeonBoost => RadeonBoostComboBox,
+                FocusElement.ImageSharpening => ImageSharpeningComboBox,
+                FocusElement.CpuMaxState => CpuMaxStateComboBox,
+                FocusElement.CpuEnergy => CpuEnergyComboBox,
+                FocusElement.CpuBoost => CpuBoostComboBox,
+                FocusElement.CpuPriority => CpuPriorityComboBox,
+                FocusElement.CpuCores => CpuCoresComboBox,
+                FocusElement.Launchers => LaunchersComboBox,
+                FocusElement.BackgroundThrottle => BackgroundThrottleComboBox,
+                FocusElement.TrimLauncherMemory => TrimLauncherMemoryComboBox,
                 _ => null
             };
 
@@ -443,6 +570,7 @@ namespace HUDRA.Controls
             PopulateResolutionComboBox();
             PopulateRefreshRateComboBox();
             PopulateFpsLimitComboBox();
+            PopulatePowerEnvelopeComboBoxes();
 
             // Initialize TDP picker
             InitializeTdpPicker();
@@ -490,6 +618,47 @@ namespace HUDRA.Controls
             NotifyProfileChanged();
         }
 
+        /// <summary>
+        /// Fills the envelope combo boxes with the values this device allows. Combinations that break
+        /// STAPM ≤ slow ≤ fast are still selectable; they're corrected when the profile is applied.
+        /// </summary>
+        private void PopulatePowerEnvelopeComboBoxes()
+        {
+            var limits = PowerEnvelopeLimits.ForDevice(HardwareDetectionService.GetDetectedDevice());
+
+            PopulateLimitComboBox(SlowLimitComboBox, limits.MinWatts, limits.MaxSlowWatts, 1, "W");
+            PopulateLimitComboBox(FastLimitComboBox, limits.MinWatts, limits.MaxFastWatts, 1, "W");
+            PopulateLimitComboBox(ApuSlowLimitComboBox, limits.MinWatts, limits.MaxApuSlowWatts, 1, "W");
+            PopulateLimitComboBox(TctlLimitComboBox, limits.MinTctlCelsius, limits.MaxTctlCelsius, 5, "°C");
+        }
+
+        private void PopulateLimitComboBox(ComboBox comboBox, int min, int max, int step, string unit)
+        {
+            _suppressEvents = true;
+            comboBox.Items.Clear();
+
+            // Add "Default" option first (0 = not set)
+            comboBox.Items.Add(new ComboBoxItem
+            {
+                Content = "Default",
+                Tag = 0,
+                Style = (Style)Application.Current.Resources["HudraComboBoxItemStyle"]
+            });
+
+            for (int value = min; value <= max; value += step)
+            {
+                comboBox.Items.Add(new ComboBoxItem
+                {
+                    Content = $"{value}{unit}",
+                    Tag = value,
+                    Style = (Style)Application.Current.Resources["HudraComboBoxItemStyle"]
+                });
+            }
+
+            comboBox.SelectedIndex = 0;
+            _suppressEvents = false;
+        }
+
         private void PopulateResolutionComboBox()
         {
             _suppressEvents = true;
@@ -657,6 +826,12 @@ namespace HUDRA.Controls
                 TdpPicker.SetSelectedTdpWhenReady(_profile.TdpWatts);
             }
 
+            // Load power envelope
+            SelectComboBoxByTag(SlowLimitComboBox, _profile.SlowLimitWatts);
+            SelectComboBoxByTag(FastLimitComboBox, _profile.FastLimitWatts);
+            SelectComboBoxByTag(ApuSlowLimitComboBox, _profile.ApuSlowLimitWatts);
+            SelectComboBoxByTag(TctlLimitComboBox, _profile.TctlLimitCelsius);
+
             // Load Resolution
             if (_profile.ResolutionWidth > 0 && _profile.ResolutionHeight > 0)
             {
@@ -699,9 +874,36 @@ namespace HUDRA.Controls
             // Load Anti-Lag
             SelectTriStateComboBox(AntiLagComboBox, _profile.AntiLagEnabled);
 
+            // Load Chill, Radeon Boost and Image Sharpening
+            SelectComboBoxByTag(ChillComboBox, _profile.ChillEnabled switch
+            {
+                true => $"{_profile.ChillMinFps}-{_profile.ChillMaxFps}",
+                false => "Off",
+                null => "Default"
+            });
+            SelectTriStateComboBox(RadeonBoostComboBox, _profile.RadeonBoostEnabled);
+            SelectComboBoxByTag(ImageSharpeningComboBox, _profile.ImageSharpeningEnabled switch
+            {
+                true => _profile.ImageSharpness.ToString(),
+                false => "Off",
+                null => "Default"
+            });
+
             // Load Fan Curve
             SelectComboBoxByTag(FanCurvePresetComboBox, _profile.FanCurvePreset);
 
+            // Load CPU power
+            SelectComboBoxByTag(CpuMaxStateComboBox, _profile.MaxProcessorState);
+            SelectComboBoxByTag(CpuEnergyComboBox, _profile.EnergyPreference);
+            SelectComboBoxByTag(CpuBoostComboBox, _profile.CpuBoostMode);
+
+            // Load CPU scheduling
+            SelectComboBoxByTag(CpuPriorityComboBox, _profile.CpuPriority);
+            SelectComboBoxByTag(CpuCoresComboBox, _profile.CpuCoreAssignment);
+            SelectTriStateComboBox(LaunchersComboBox, _profile.DemoteLaunchers);
+            SelectComboBoxByTag(BackgroundThrottleComboBox, _profile.BackgroundThrottleMode);
+            SelectTriStateComboBox(TrimLauncherMemoryComboBox, _profile.TrimLauncherMemory);
+
             _suppressEvents = false;
         }
 
@@ -767,6 +969,50 @@ namespace HUDRA.Controls
         }
 
         // ComboBox event handlers
+        private void SlowLimitComboBox_SelectionChanged(object sender, SelectionChangedEventArgs e)
+        {
+            if (_suppressEvents) return;
+
+            if (SlowLimitComboBox.SelectedItem is ComboBoxItem item && item.Tag is int watts)
+            {
+                _profile.SlowLimitWatts = watts;
+                NotifyProfileChanged();
+            }
+        }
+
+        private void FastLimitComboBox_SelectionChanged(object sender, SelectionChangedEventArgs e)
+        {
+            if (_suppressEvents) return;
+
+            if (FastLimitComboBox.SelectedItem is ComboBoxItem item && item.Tag is int watts)
+            {
+                _profile.FastLimitWatts = watts;
+                NotifyProfileChanged();
+            }
+        }
+
+        private void ApuSlowLimitComboBox_SelectionChanged(object sender, SelectionChangedEventArgs e)
+        {
+            if (_suppressEvents) return;
+
+            if (ApuSlowLimitComboBox.SelectedItem is ComboBoxItem item && item.Tag is int watts)
+            {
+                _profile.ApuSlowLimitWatts = watts;
+                NotifyProfileChanged();
+            }
+        }
+
+        private void TctlLimitComboBox_SelectionChanged(object sender, SelectionChangedEventArgs e)
+        {
+            if (_suppressEvents) return;
+
+            if (TctlLimitComboBox.SelectedItem is ComboBoxItem item && item.Tag is int celsius)
+            {
+                _profile.TctlLimitCelsius = celsius;
+                NotifyProfileChanged();
+            }
+        }
+
         private void ResolutionComboBox_SelectionChanged(object sender, SelectionChangedEventArgs e)
         {
             if (_suppressEvents) return;
@@ -869,6 +1115,54 @@ namespace HUDRA.Controls
             NotifyProfileChanged();
         }
 
+        private void ChillComboBox_SelectionChanged(object sender, SelectionChangedEventArgs e)
+        {
+            if (_suppressEvents) return;
+
+            if (ChillComboBox.SelectedItem is not ComboBoxItem item || item.Tag is not string tag) return;
+
+            // Tag is "Default", "Off" or the FPS range as "min-max"
+            var range = tag.Split('-');
+            if (range.Length == 2 && int.TryParse(range[0], out int minFps) && int.TryParse(range[1], out int maxFps))
+            {
+                _profile.ChillEnabled = true;
+                _profile.ChillMinFps = minFps;
+                _profile.ChillMaxFps = maxFps;
+            }
+            else
+            {
+                _profile.ChillEnabled = GetTriStateValue(item);
+            }
+            NotifyProfileChanged();
+        }
+
+        private void RadeonBoostComboBox_SelectionChanged(object sender, SelectionChangedEventArgs e)
+        {
+            if (_suppressEvents) return;
+
+            _profile.RadeonBoostEnabled = GetTriStateValue(RadeonBoostComboBox.SelectedItem as ComboBoxItem);
+            NotifyProfileChanged();
+        }
+
+        private void ImageSharpeningComboBox_SelectionChanged(object sender, SelectionChangedEventArgs e)
+        {
+            if (_suppressEvents) return;
+
+            if (ImageSharpeningComboBox.SelectedItem is not ComboBoxItem item || item.Tag is not string tag) return;
+
+            // Tag is "Default", "Off" or the sharpness percent
+            if (int.TryParse(tag, out int sharpness))
+            {
+                _profile.ImageSharpeningEnabled = true;
+                _profile.ImageSharpness = sharpness;
+            }
+            else
+            {
+                _profile.ImageSharpeningEnabled = GetTriStateValue(item);
+            }
+            NotifyProfileChanged();
+        }
+
         private void FanCurvePresetComboBox_SelectionChanged(object sender, SelectionChangedEventArgs e)
         {
             if (_suppressEvents) return;
@@ -880,6 +1174,88 @@ namespace HUDRA.Controls
             }
         }
 
+        private void CpuMaxStateComboBox_SelectionChanged(object sender, SelectionChangedEventArgs e)
+        {
+            if (_suppressEvents) return;
+
+            if (CpuMaxStateComboBox.SelectedItem is ComboBoxItem item && item.Tag is string tag && int.TryParse(tag, out int percent))
+            {
+                _profile.MaxProcessorState = percent;
+                NotifyProfileChanged();
+            }
+        }
+
+        private void CpuEnergyComboBox_SelectionChanged(object sender, SelectionChangedEventArgs e)
+        {
+            if (_suppressEvents) return;
+
+            if (CpuEnergyComboBox.SelectedItem is ComboBoxItem item && item.Tag is string preference)
+            {
+                _profile.EnergyPreference = preference;
+                NotifyProfileChanged();
+            }
+        }
+
+        private void CpuBoostComboBox_SelectionChanged(object sender, SelectionChangedEventArgs e)
+        {
+            if (_suppressEvents) return;
+
+            if (CpuBoostComboBox.SelectedItem is ComboBoxItem item && item.Tag is string mode)
+            {
+                _profile.CpuBoostMode = mode;
+                NotifyProfileChanged();
+            }
+        }
+
+        private void CpuPriorityComboBox_SelectionChanged(object sender, SelectionChangedEventArgs e)
+        {
+            if (_suppressEvents) return;
+
+            if (CpuPriorityComboBox.SelectedItem is ComboBoxItem item && item.Tag is string priority)
+            {
+                _profile.CpuPriority = priority;
+                NotifyProfileChanged();
+            }
+        }
+
+        private void CpuCoresComboBox_SelectionChanged(object sender, SelectionChangedEventArgs e)
+        {
+            if (_suppressEvents) return;
+
+            if (CpuCoresComboBox.SelectedItem is ComboBoxItem item && item.Tag is string assignment)
+            {
+                _profile.CpuCoreAssignment = assignment;
+                NotifyProfileChanged();
+            }
+        }
+
+        private void LaunchersComboBox_SelectionChanged(object sender, SelectionChangedEventArgs e)
+        {
+            if (_suppressEvents) return;
+
+            _profile.DemoteLaunchers = GetTriStateValue(LaunchersComboBox.SelectedItem as ComboBoxItem);
+            NotifyProfileChanged();
+        }
+
+        private void BackgroundThrottleComboBox_SelectionChanged(object sender, SelectionChangedEventArgs e)
+        {
+            if (_suppressEvents) return;
+
+            if (BackgroundThrottleComboBox.SelectedItem is ComboBoxItem item && item.Tag is string mode)
+            {
+                _profile.BackgroundThrottleMode = mode;
+                NotifyProfileChanged();
+            }
+        }
+
+        private void TrimLauncherMemoryComboBox_SelectionChanged(object sender, SelectionChangedEventArgs e)
+        {
+            if (_suppressEvents) return;
+
+            _profile.TrimLauncherMemory = GetTriStateValue(TrimLauncherMemoryComboBox.SelectedItem as ComboBoxItem);
+            NotifyProfileChanged();
+        }
+
         private void NotifyProfileChanged()
         {
             _profile.HasProfile = _profile.HasAnySettingsConfigured;
@@ -17,6 +17,23 @@ namespace HUDRA.Controls
         private GamepadNavigationService? _gamepadNavigationService;
         private bool _isFocused = false;
 
+        // Diagnostics: how many deferred bodies were skipped vs realized, and how many were built from
+        // BodyTemplate (plus the time spent doing so) across all expanders
+        public static int DeferredBodyCount { get; private set; }
+        public static int RealizedBodyCount { get; private set; }
+        public static int ConstructedBodyCount { get; private set; }
+        public static TimeSpan BodyConstructionTime { get; private set; }
+
+        /// <summary>
+        /// True once Body has been placed in the visual tree (and received Loaded).
+        /// </summary>
+        public bool IsBodyRealized { get; private set; }
+
+        /// <summary>
+        /// Raised when Body enters the visual tree. Use it to start service queries for deferred sections.
+        /// </summary>
+        public event EventHandler? BodyRealized;
+
         public NavigableExpander()
         {
             this.InitializeComponent();
@@ -28,6 +45,55 @@ namespace HUDRA.Controls
         {
             // Ensure content visibility is set correctly when loaded
             UpdateContentVisibility();
+
+            if (!DeferBody || IsExpanded)
+            {
+                RealizeBody("load");
+            }
+            else if (!IsBodyRealized)
+            {
+                DeferredBodyCount++;
+            }
+        }
+
+        /// <summary>
+        /// Puts Body into the visual tree, building it from BodyTemplate first if needed. A templated body's
+        /// constructor and Loaded handler (ADLX, power plans, secure storage, settings reads) only run from
+        /// this point on.
+        /// </summary>
+        private void RealizeBody(string trigger)
+        {
+            if (IsBodyRealized || BodyContentPresenter == null) return;
+
+            if (Body == null && BodyTemplate != null)
+            {
+                var stopwatch = System.Diagnostics.Stopwatch.StartNew();
+                Body = BodyTemplate.LoadContent();
+                stopwatch.Stop();
+
+                ConstructedBodyCount++;
+                BodyConstructionTime += stopwatch.Elapsed;
+                System.Diagnostics.Debug.WriteLine($"🎮 NavigableExpander: Built body {Name} from template in {stopwatch.Elapsed.TotalMilliseconds:F1}ms");
+            }
+
+            // Setting Body realizes it directly when DeferBody is off
+            if (Body == null || IsBodyRealized) return;
+
+            BodyContentPresenter.Content = Body;
+            IsBodyRealized = true;
+            RealizedBodyCount++;
+            System.Diagnostics.Debug.WriteLine($"🎮 NavigableExpander: Realized body {Name} on {trigger} ({RealizedBodyCount} realized, {DeferredBodyCount} deferred)");
+
+            BodyRealized?.Invoke(this, EventArgs.Empty);
+        }
+
+        private void ReleaseBody()
+        {
+            if (!IsBodyRealized || KeepBodyAlive || BodyContentPresenter == null) return;
+
+            BodyContentPresenter.Content = null;
+            IsBodyRealized = false;
+            System.Diagnostics.Debug.WriteLine($"🎮 NavigableExpander: Released body {Name}");
         }
 
         private void UpdateContentVisibility()
@@ -61,10 +127,36 @@ namespace HUDRA.Controls
         {
             if (d is NavigableExpander expander)
             {
+                if ((bool)e.NewValue)
+                {
+                    expander.RealizeBody("expand");
+                }
+                else
+                {
+                    expander.ReleaseBody();
+                }
                 expander.UpdateContentVisibility();
             }
         }
 
+        // DeferBody DP - keep Body out of the visual tree until first expand or gamepad focus
+        public static readonly DependencyProperty DeferBodyProperty =
+            DependencyProperty.Register(nameof(DeferBody), typeof(bool), typeof(NavigableExpander), new PropertyMetadata(false));
+        public bool DeferBody
+        {
+            get => (bool)GetValue(DeferBodyProperty);
+            set => SetValue(DeferBodyProperty, value);
+        }
+
+        // KeepBodyAlive DP - when false, a deferred body leaves the visual tree again on collapse
+        public static readonly DependencyProperty KeepBodyAliveProperty =
+            DependencyProperty.Register(nameof(KeepBodyAlive), typeof(bool), typeof(NavigableExpander), new PropertyMetadata(true));
+        public bool KeepBodyAlive
+        {
+            get => (bool)GetValue(KeepBodyAliveProperty);
+            set => SetValue(KeepBodyAliveProperty, value);
+        }
+
         // Focus visuals
         public Brush FocusBorderBrush => (IsFocused && _gamepadNavigationService?.IsGamepadActive == true)
             ? new SolidColorBrush(Microsoft.UI.Colors.DarkViolet)
@@ -76,13 +168,45 @@ namespace HUDRA.Controls
 
         // Body DP to host page-provided content
         public static readonly DependencyProperty BodyProperty =
-            DependencyProperty.Register(nameof(Body), typeof(object), typeof(NavigableExpander), new PropertyMetadata(null));
+            DependencyProperty.Register(nameof(Body), typeof(object), typeof(NavigableExpander), new PropertyMetadata(null, OnBodyChanged));
         public object? Body
         {
             get => GetValue(BodyProperty);
             set => SetValue(BodyProperty, value);
         }
 
+        // BodyTemplate DP - with DeferBody, Body is built from this on first realization instead of at XAML parse
+        public static readonly DependencyProperty BodyTemplateProperty =
+            DependencyProperty.Register(nameof(BodyTemplate), typeof(DataTemplate), typeof(NavigableExpander), new PropertyMetadata(null));
+        public DataTemplate? BodyTemplate
+        {
+            get => (DataTemplate?)GetValue(BodyTemplateProperty);
+            set => SetValue(BodyTemplateProperty, value);
+        }
+
+        /// <summary>
+        /// One-line summary of the body diagnostics, for page-open logging.
+        /// </summary>
+        public static string DescribeBodies() =>
+            $"{ConstructedBodyCount} built from template in {BodyConstructionTime.TotalMilliseconds:F1}ms, " +
+            $"{RealizedBodyCount} realized, {DeferredBodyCount} deferred";
+
+        private static void OnBodyChanged(DependencyObject d, DependencyPropertyChangedEventArgs e)
+        {
+            if (d is not NavigableExpander expander || expander.BodyContentPresenter == null) return;
+
+            if (expander.IsBodyRealized)
+            {
+                // Swap in place; the new body is already wanted in the tree
+                expander.BodyContentPresenter.Content = e.NewValue;
+                expander.IsBodyRealized = e.NewValue != null;
+            }
+            else if (!expander.DeferBody)
+            {
+                expander.RealizeBody("init");
+            }
+        }
+
         private void InitializeGamepadNavigation()
         {
             GamepadNavigation.SetIsEnabled(this, true);
@@ -170,6 +294,9 @@ namespace HUDRA.Controls
                 InitializeGamepadNavigationService();
             }
             IsFocused = true;
+
+            // Focus usually precedes an expand, so build the body now while the user is still on the header
+            RealizeBody("focus");
         }
 
         public void OnGamepadFocusLost()
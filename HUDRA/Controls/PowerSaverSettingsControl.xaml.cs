@@ -0,0 +1,382 @@
+using HUDRA.AttachedProperties;
+using HUDRA.Configuration;
+using HUDRA.Interfaces;
+using HUDRA.Services;
+using Microsoft.UI.Xaml;
+using Microsoft.UI.Xaml.Controls;
+using Microsoft.UI.Xaml.Media;
+using System;
+using System.ComponentModel;
+using System.Runtime.CompilerServices;
+
+namespace HUDRA.Controls
+{
+    /// <summary>
+    /// Settings for the game power saver. Values are written straight to <see cref="SettingsService"/>;
+    /// the saver reads them on every poll, so only the on/off toggles wait for the next game launch.
+    /// </summary>
+    public sealed partial class PowerSaverSettingsControl : UserControl, INotifyPropertyChanged, IGamepadNavigable
+    {
+        public event PropertyChangedEventHandler? PropertyChanged;
+
+        private const int FpsCapIncrement = 5;
+
+        private GamepadNavigationService? _gamepadNavigationService;
+        private int _currentFocusedElement = 0; // 0-2=Menu Toggle/TDP/FPS, 3-5=Background Toggle/TDP/FPS
+        private bool _isFocused = false;
+        private const int MaxFocusIndex = 5;
+
+        // IGamepadNavigable implementation
+        public bool CanNavigateUp => _currentFocusedElement > 0;
+        public bool CanNavigateDown => _currentFocusedElement < MaxFocusIndex;
+        public bool CanNavigateLeft => _isSliderActivated;
+        public bool CanNavigateRight => _isSliderActivated;
+        public bool CanActivate => true;
+        public FrameworkElement NavigationElement => this;
+
+        // Slider interface implementations
+        private bool _isSliderActivated = false;
+        public bool IsSlider => GetFocusedSlider()?.IsEnabled == true; // Sliders are disabled while their saver is off
+        public bool IsSliderActivated
+        {
+            get => _isSliderActivated;
+            set
+            {
+                _isSliderActivated = value;
+                OnPropertyChanged();
+                UpdateFocusVisuals();
+            }
+        }
+
+        public void AdjustSliderValue(int direction)
+        {
+            if (!_isSliderActivated) return;
+
+            var slider = GetFocusedSlider();
+            if (slider != null)
+            {
+                double newValue = slider.Value + (direction * slider.StepFrequency);
+                newValue = Math.Clamp(newValue, slider.Minimum, slider.Maximum);
+                slider.Value = newValue;
+                System.Diagnostics.Debug.WriteLine($"🎮 PowerSaverSettings: Adjusted {slider.Name} to {newValue}");
+            }
+        }
+
+        // ComboBox interface implementations - PowerSaverSettings has no ComboBoxes
+        public bool HasComboBoxes => false;
+        public bool IsComboBoxOpen { get; set; } = false;
+        public ComboBox? GetFocusedComboBox() => null;
+        public int ComboBoxOriginalIndex { get; set; } = -1;
+        public bool IsNavigatingComboBox { get; set; } = false;
+        public void ProcessCurrentSelection() { /* Not applicable - no ComboBoxes */ }
+
+        // Slider ranges for XAML binding
+        public double MinTdp => HudraSettings.MIN_TDP;
+        public double MaxTdp => HudraSettings.MAX_TDP;
+        public double MaxFpsCap => 60;
+        public double FpsCapStep => FpsCapIncrement;
+
+        // Focus brush properties for XAML binding
+        public Brush MenuToggleFocusBrush => GetFocusBrush(0);
+        public Brush MenuTdpSliderFocusBrush => GetFocusBrush(1);
+        public Brush MenuFpsSliderFocusBrush => GetFocusBrush(2);
+        public Brush BackgroundToggleFocusBrush => GetFocusBrush(3);
+        public Brush BackgroundTdpSliderFocusBrush => GetFocusBrush(4);
+        public Brush BackgroundFpsSliderFocusBrush => GetFocusBrush(5);
+
+        // Data binding properties
+        private bool _menuEnabled;
+        public bool MenuEnabled
+        {
+            get => _menuEnabled;
+            set
+            {
+                if (_menuEnabled != value)
+                {
+                    _menuEnabled = value;
+                    SettingsService.SetMenuPowerSaverEnabled(value);
+                    OnPropertyChanged();
+                }
+            }
+        }
+
+        private int _menuTdp;
+        public int MenuTdp
+        {
+            get => _menuTdp;
+            set
+            {
+                if (_menuTdp != value)
+                {
+                    _menuTdp = value;
+                    SettingsService.SetMenuPowerSaverTdp(value);
+                    OnPropertyChanged();
+                    OnPropertyChanged(nameof(MenuTdpText));
+                }
+            }
+        }
+
+        private int _menuFps;
+        public int MenuFps
+        {
+            get => _menuFps;
+            set
+            {
+                if (_menuFps != value)
+                {
+                    _menuFps = value;
+                    SettingsService.SetMenuPowerSaverFps(value);
+                    OnPropertyChanged();
+                    OnPropertyChanged(nameof(MenuFpsText));
+                }
+            }
+        }
+
+        private bool _backgroundEnabled;
+        public bool BackgroundEnabled
+        {
+            get => _backgroundEnabled;
+            set
+            {
+                if (_backgroundEnabled != value)
+                {
+                    _backgroundEnabled = value;
+                    SettingsService.SetBackgroundPowerSaverEnabled(value);
+                    OnPropertyChanged();
+                }
+            }
+        }
+
+        private int _backgroundTdp;
+        public int BackgroundTdp
+        {
+            get => _backgroundTdp;
+            set
+            {
+                if (_backgroundTdp != value)
+                {
+                    _backgroundTdp = value;
+                    SettingsService.SetBackgroundPowerSaverTdp(value);
+                    OnPropertyChanged();
+                    OnPropertyChanged(nameof(BackgroundTdpText));
+                }
+            }
+        }
+
+        private int _backgroundFps;
+        public int BackgroundFps
+        {
+            get => _backgroundFps;
+            set
+            {
+                if (_backgroundFps != value)
+                {
+                    _backgroundFps = value;
+                    SettingsService.SetBackgroundPowerSaverFps(value);
+                    OnPropertyChanged();
+                    OnPropertyChanged(nameof(BackgroundFpsText));
+                }
+            }
+        }
+
+        public string MenuTdpText => $"{_menuTdp}W";
+        public string MenuFpsText => FormatFpsCap(_menuFps);
+        public string BackgroundTdpText => $"{_backgroundTdp}W";
+        public string BackgroundFpsText => FormatFpsCap(_backgroundFps);
+
+        public PowerSaverSettingsControl()
+        {
+            // Read before the template binds so the sliders don't write their defaults back
+            _menuEnabled = SettingsService.GetMenuPowerSaverEnabled();
+            _menuTdp = Math.Clamp(SettingsService.GetMenuPowerSaverTdp(), HudraSettings.MIN_TDP, HudraSettings.MAX_TDP);
+            _menuFps = Math.Clamp(SettingsService.GetMenuPowerSaverFps(), 0, (int)MaxFpsCap);
+            _backgroundEnabled = SettingsService.GetBackgroundPowerSaverEnabled();
+            _backgroundTdp = Math.Clamp(SettingsService.GetBackgroundPowerSaverTdp(), HudraSettings.MIN_TDP, HudraSettings.MAX_TDP);
+            _backgroundFps = Math.Clamp(SettingsService.GetBackgroundPowerSaverFps(), 0, (int)MaxFpsCap);
+
+            this.InitializeComponent();
+            this.DataContext = this;
+            InitializeGamepadNavigation();
+        }
+
+        // A cap of 0 leaves the profile's cap in place
+        private static string FormatFpsCap(int fps) => fps > 0 ? $"{fps} FPS" : "Profile";
+
+        private Slider? GetFocusedSlider()
+        {
+            return _currentFocusedElement switch
+            {
+                1 => MenuTdpSlider,
+                2 => MenuFpsSlider,
+                4 => BackgroundTdpSlider,
+                5 => BackgroundFpsSlider,
+                _ => null
+            };
+        }
+
+        private Brush GetFocusBrush(int element)
+        {
+            if (_isFocused && _gamepadNavigationService?.IsGamepadActive == true && _currentFocusedElement == element)
+            {
+                bool activeSlider = _isSliderActivated && GetFocusedSlider() != null;
+                return new SolidColorBrush(activeSlider ? Microsoft.UI.Colors.DodgerBlue : Microsoft.UI.Colors.DarkViolet);
+            }
+            return new SolidColorBrush(Microsoft.UI.Colors.Transparent);
+        }
+
+        private void InitializeGamepadNavigation()
+        {
+            GamepadNavigation.SetIsEnabled(this, true);
+            GamepadNavigation.SetNavigationGroup(this, "MainControls");
+            GamepadNavigation.SetNavigationOrder(this, 1);
+            // Not directly navigable at page level - only accessible through parent expander
+            GamepadNavigation.SetCanNavigate(this, false);
+        }
+
+        private void InitializeGamepadNavigationService()
+        {
+            if (Application.Current is App app && app.MainWindow is MainWindow mainWindow)
+            {
+                _gamepadNavigationService = mainWindow.GamepadNavigationService;
+            }
+        }
+
+        // IGamepadNavigable event handlers
+        public void OnGamepadNavigateUp()
+        {
+            // If slider is activated, adjust value instead of navigating
+            if (_isSliderActivated)
+            {
+                AdjustSliderValue(1);
+                return;
+            }
+
+            if (_currentFocusedElement > 0)
+            {
+                _currentFocusedElement--;
+                UpdateFocusVisuals();
+                System.Diagnostics.Debug.WriteLine($"🎮 PowerSaverSettings: Moved up to element {_currentFocusedElement}");
+            }
+        }
+
+        public void OnGamepadNavigateDown()
+        {
+            // If slider is activated, adjust value instead of navigating
+            if (_isSliderActivated)
+            {
+                AdjustSliderValue(-1);
+                return;
+            }
+
+            if (_currentFocusedElement < MaxFocusIndex)
+            {
+                _currentFocusedElement++;
+                UpdateFocusVisuals();
+                System.Diagnostics.Debug.WriteLine($"🎮 PowerSaverSettings: Moved down to element {_currentFocusedElement}");
+            }
+        }
+
+        public void OnGamepadNavigateLeft()
+        {
+            if (_isSliderActivated)
+            {
+                AdjustSliderValue(-1);
+            }
+        }
+
+        public void OnGamepadNavigateRight()
+        {
+            if (_isSliderActivated)
+            {
+                AdjustSliderValue(1);
+            }
+        }
+
+        public void OnGamepadActivate()
+        {
+            switch (_currentFocusedElement)
+            {
+                case 0: // Menu Toggle
+                    if (MenuPowerSaverToggle != null)
+                    {
+                        MenuPowerSaverToggle.IsOn = !MenuPowerSaverToggle.IsOn;
+                        System.Diagnostics.Debug.WriteLine($"🎮 PowerSaverSettings: Toggled menu power saver to {MenuPowerSaverToggle.IsOn}");
+                    }
+                    break;
+
+                case 3: // Background Toggle
+                    if (BackgroundPowerSaverToggle != null)
+                    {
+                        BackgroundPowerSaverToggle.IsOn = !BackgroundPowerSaverToggle.IsOn;
+                        System.Diagnostics.Debug.WriteLine($"🎮 PowerSaverSettings: Toggled background power saver to {BackgroundPowerSaverToggle.IsOn}");
+                    }
+                    break;
+
+                default: // Sliders
+                    var slider = GetFocusedSlider();
+                    if (slider != null && slider.IsEnabled)
+                    {
+                        IsSliderActivated = !_isSliderActivated;
+                        System.Diagnostics.Debug.WriteLine($"🎮 PowerSaverSettings: {(_isSliderActivated ? "Activated" : "Deactivated")} {slider.Name} for adjustment");
+                    }
+                    break;
+            }
+        }
+
+        public void OnGamepadBack() { }
+
+        public void OnGamepadFocusReceived()
+        {
+            // Initialize gamepad service if needed
+            if (_gamepadNavigationService == null)
+            {
+                InitializeGamepadNavigationService();
+            }
+
+            _currentFocusedElement = 0;
+            _isFocused = true;
+            UpdateFocusVisuals();
+            System.Diagnostics.Debug.WriteLine($"🎮 PowerSaverSettings: Received gamepad focus");
+        }
+
+        public void OnGamepadFocusLost()
+        {
+            _isFocused = false;
+            _isSliderActivated = false;
+            UpdateFocusVisuals();
+            System.Diagnostics.Debug.WriteLine($"🎮 PowerSaverSettings: Lost gamepad focus");
+        }
+
+        public void FocusLastElement()
+        {
+            if (_gamepadNavigationService == null)
+            {
+                InitializeGamepadNavigationService();
+            }
+
+            _currentFocusedElement = MaxFocusIndex;
+            _isFocused = true;
+            UpdateFocusVisuals();
+            System.Diagnostics.Debug.WriteLine($"🎮 PowerSaverSettings: Focused last element ({_currentFocusedElement})");
+        }
+
+        private void UpdateFocusVisuals()
+        {
+            // Dispatch on UI thread to ensure bindings update reliably with gamepad navigation
+            DispatcherQueue.TryEnqueue(() =>
+            {
+                OnPropertyChanged(nameof(MenuToggleFocusBrush));
+                OnPropertyChanged(nameof(MenuTdpSliderFocusBrush));
+                OnPropertyChanged(nameof(MenuFpsSliderFocusBrush));
+                OnPropertyChanged(nameof(BackgroundToggleFocusBrush));
+                OnPropertyChanged(nameof(BackgroundTdpSliderFocusBrush));
+                OnPropertyChanged(nameof(BackgroundFpsSliderFocusBrush));
+            });
+        }
+
+        private void OnPropertyChanged([CallerMemberName] string? propertyName = null)
+        {
+            PropertyChanged?.Invoke(this, new PropertyChangedEventArgs(propertyName));
+        }
+    }
+}
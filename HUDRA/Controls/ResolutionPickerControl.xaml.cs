@@ -222,21 +222,31 @@ namespace HUDRA.Controls
 
         private void SetupEventHandlers()
         {
+            // Unsubscribe first - Initialize runs again on every visit to a cached MainPage
             if (ResolutionComboBox != null)
             {
+                ResolutionComboBox.SelectionChanged -= OnResolutionSelectionChanged;
+                ResolutionComboBox.DropDownOpened -= OnComboBoxDropDownOpened;
+                ResolutionComboBox.DropDownClosed -= OnComboBoxDropDownClosed;
                 ResolutionComboBox.SelectionChanged += OnResolutionSelectionChanged;
-                ResolutionComboBox.DropDownOpened += (s, e) => { IsComboBoxOpen = true; };
-                ResolutionComboBox.DropDownClosed += (s, e) => { IsComboBoxOpen = false; };
+                ResolutionComboBox.DropDownOpened += OnComboBoxDropDownOpened;
+                ResolutionComboBox.DropDownClosed += OnComboBoxDropDownClosed;
             }
 
             if (RefreshRateComboBox != null)
             {
+                RefreshRateComboBox.SelectionChanged -= OnRefreshRateSelectionChanged;
+                RefreshRateComboBox.DropDownOpened -= OnComboBoxDropDownOpened;
+                RefreshRateComboBox.DropDownClosed -= OnComboBoxDropDownClosed;
                 RefreshRateComboBox.SelectionChanged += OnRefreshRateSelectionChanged;
-                RefreshRateComboBox.DropDownOpened += (s, e) => { IsComboBoxOpen = true; };
-                RefreshRateComboBox.DropDownClosed += (s, e) => { IsComboBoxOpen = false; };
+                RefreshRateComboBox.DropDownOpened += OnComboBoxDropDownOpened;
+                RefreshRateComboBox.DropDownClosed += OnComboBoxDropDownClosed;
             }
         }
 
+        private void OnComboBoxDropDownOpened(object? sender, object e) => IsComboBoxOpen = true;
+        private void OnComboBoxDropDownClosed(object? sender, object e) => IsComboBoxOpen = false;
+
         private void OnResolutionSelectionChanged(object sender, SelectionChangedEventArgs e)
         {
             if (ResolutionComboBox?.SelectedIndex < 0 ||
@@ -818,6 +818,10 @@ namespace HUDRA.Controls
 
         private void SetupMouseDragSupport()
         {
+            // Initialize runs again on every visit to a cached MainPage - unsubscribe first to avoid duplicates
+            TdpScrollViewer.PointerPressed -= TdpScrollViewer_PointerPressed;
+            TdpScrollViewer.PointerMoved -= TdpScrollViewer_PointerMoved;
+            TdpScrollViewer.PointerReleased -= TdpScrollViewer_PointerReleased;
             TdpScrollViewer.PointerPressed += TdpScrollViewer_PointerPressed;
             TdpScrollViewer.PointerMoved += TdpScrollViewer_PointerMoved;
             TdpScrollViewer.PointerReleased += TdpScrollViewer_PointerReleased;
@@ -0,0 +1,25 @@
+using System;
+using HUDRA.Services.UiDispatch;
+using Microsoft.UI.Dispatching;
+
+namespace HUDRA.Extensions
+{
+    /// <summary>
+    /// Extension methods for DispatcherQueue to coalesce high-frequency service updates
+    /// </summary>
+    public static class DispatcherQueueExtensions
+    {
+        /// <summary>
+        /// Queues a latest-value UI update. Any earlier update with the same key that hasn't run yet is
+        /// dropped, and all pending updates run together on the next rendered frame.
+        /// </summary>
+        /// <param name="dispatcher">The UI thread's DispatcherQueue</param>
+        /// <param name="key">Identifies the value being updated, e.g. "FanStatus"</param>
+        /// <param name="apply">The UI update, typically raising the service's changed event</param>
+        /// <returns>False if the update could not be queued to the UI thread</returns>
+        public static bool TryEnqueueLatest(this DispatcherQueue dispatcher, string key, Action apply)
+        {
+            return UiUpdateDispatcher.For(dispatcher).Post(key, apply);
+        }
+    }
+}
@@ -4,8 +4,13 @@ using HUDRA.Extensions;
 using HUDRA.Models;
 using HUDRA.Pages;
 using HUDRA.Services;
+using HUDRA.Services.AMD;
 using HUDRA.Services.FanControl;
 using HUDRA.Services.Power;
+using HUDRA.Services.QuickPause;
+using HUDRA.Services.Scheduling;
+using HUDRA.Services.SessionHistory;
+using HUDRA.Services.UiDispatch;
 using Microsoft.UI;
 using Microsoft.UI.Composition.SystemBackdrops;
 using Microsoft.UI.Xaml;
@@ -49,6 +54,16 @@ namespace HUDRA
         private EnhancedGameDatabase? _gameDatabase;
         private SteamGridDbArtworkService? _artworkService;
         private GameProfileService? _gameProfileService;
+        private GameSchedulingService? _gameSchedulingService;
+        private BackgroundThrottleService? _backgroundThrottleService;
+        private WorkingSetTrimService? _workingSetTrimService;
+        private Task _gameSchedulingTask = Task.CompletedTask; // Apply and revert run one after another, in call order
+        private GameSessionRecorder? _sessionRecorder;
+        private LiveSessionSampleSource? _sessionSampleSource;
+        private GamePowerSaverService? _powerSaver;
+        private PowerSaverControl? _powerSaverControl;
+        private QuickPausePowerControl? _quickPausePower;
+        private QuickPauseService? _quickPause;
         private bool _userOverrodeTdpDuringProfile = false; // Tracks if user manually changed TDP while a profile was active
         private int _activeProfileFpsLimit = -1; // Stores FPS limit from active profile for sync on Home page navigation
 
@@ -61,6 +76,7 @@ namespace HUDRA
 
         // Public gamepad navigation service access for controls
         public GamepadNavigationService GamepadNavigationService => _gamepadNavigationService;
+        public SessionHistoryStore? SessionHistory => _sessionRecorder?.Store;
 
         // Public game detection service access for settings controls
         public EnhancedGameDetectionService? EnhancedGameDetectionService => _enhancedGameDetectionService;
@@ -71,6 +87,7 @@ namespace HUDRA
         //Navigation events
         private bool _mainPageInitialized = false;
         private EventHandler<int>? _tdpChangedHandler; // Stored handler to prevent duplicate subscriptions
+        private TdpPickerControl? _tdpMonitorPicker; // Picker the TDP monitor is currently hooked to
         // Tracks if the next page navigation was initiated via gamepad (L1/R1)
         private bool _isGamepadPageNavPending = false;
         // Latched flag for the page that just became active
@@ -163,6 +180,13 @@ namespace HUDRA
             set { _losslessScalingButtonVisible = value; OnPropertyChanged(); }
         }
 
+        private bool _quickPauseButtonVisible = false;
+        public bool QuickPauseButtonVisible
+        {
+            get => _quickPauseButtonVisible;
+            set { _quickPauseButtonVisible = value; OnPropertyChanged(); }
+        }
+
         private bool _forceQuitButtonVisible = false;
         public bool ForceQuitButtonVisible
         {
@@ -212,6 +236,8 @@ namespace HUDRA
             // Initialize services
             _dpiService = new DpiScalingService(this);
             _windowManager = new WindowManagementService(this, _dpiService);
+            // Coalesced service updates drain once per frame while visible, at a capped rate while hidden
+            UiUpdateDispatcher.For(DispatcherQueue).IsWindowVisible = () => _windowManager.IsVisible;
             _audioService = new AudioService();
             _brightnessService = new BrightnessService();
             _resolutionService = new ResolutionService();
@@ -355,18 +381,19 @@ namespace HUDRA
             // Mark that this navigation originated from gamepad buttons
             _isGamepadPageNavPending = true;
 
-            // Define page order for navigation
-            var pageOrder = new List<Type>
-            {
-                typeof(MainPage),
-                typeof(LibraryPage),
-                typeof(FanCurvePage),
-                typeof(ScalingPage),
-                typeof(SettingsPage)
-            };
+            // Page order for navigation (shared with NavigationService prewarming)
+            var pageOrder = NavigationService.PageOrder;
 
             // Find current page index
-            int currentIndex = pageOrder.IndexOf(_currentPageType);
+            int currentIndex = -1;
+            for (int i = 0; i < pageOrder.Count; i++)
+            {
+                if (pageOrder[i] == _currentPageType)
+                {
+                    currentIndex = i;
+                    break;
+                }
+            }
             if (currentIndex == -1) return; // Current page not in order, ignore
 
             // Calculate target page index with wrap-around
@@ -421,11 +448,12 @@ namespace HUDRA
 
         private void RegisterNavbarButtons()
         {
-            // Register navbar buttons in order: Back to Game, Force Quit, Lossless Scaling, Hide
+            // Register navbar buttons in order: Back to Game, Quick Pause, Force Quit, Lossless Scaling, Hide
             // This order matches the recommended top-to-bottom layout for spatial navigation
             var navbarButtons = new List<Button>
             {
                 AltTabButton,          // Back to Game (top)
+                QuickPauseButton,      // Quick Pause
                 ForceQuitButton,       // Force Quit
                 LosslessScalingButton, // Lossless Scaling
                 CloseButton            // Hide (bottom)
@@ -926,12 +954,15 @@ namespace HUDRA
             _windowManager.ToggleVisibility();
         }
 
-        private void AltTabButton_Click(object sender, RoutedEventArgs e)
+        private async void AltTabButton_Click(object sender, RoutedEventArgs e)
         {
             // Clear gamepad focus to prevent lingering borders
             _gamepadNavigationService?.ClearFocus();
             _gamepadNavigationService?.DeactivateGamepadMode();
 
+            // A frozen window can't take focus or repaint, so thaw the game before switching to it
+            await ResumeQuickPauseAsync();
+
             _windowManager.ToggleVisibility();
 
             if (_enhancedGameDetectionService?.SwitchToGame() == true)
@@ -985,6 +1016,9 @@ namespace HUDRA
                 // User confirmed - proceed with force quit
                 System.Diagnostics.Debug.WriteLine($"Force quitting game: {gameName} (PID: {currentGame.ProcessId})");
 
+                // A suspended game can't answer the close request, and its helpers would stay frozen
+                await ResumeQuickPauseAsync();
+
                 try
                 {
                     var process = System.Diagnostics.Process.GetProcessById(currentGame.ProcessId);
@@ -1032,6 +1066,68 @@ namespace HUDRA
             }
         }
 
+        private async void QuickPauseButton_Click(object sender, RoutedEventArgs e)
+        {
+            if (_quickPause == null)
+                return;
+
+            if (_quickPause.IsPaused)
+            {
+                await ResumeQuickPauseAsync();
+                return;
+            }
+
+            var currentGame = _enhancedGameDetectionService?.CurrentGame;
+            if (currentGame == null)
+            {
+                System.Diagnostics.Debug.WriteLine("No active game to pause");
+                return;
+            }
+
+            long now = DateTimeOffset.UtcNow.ToUnixTimeMilliseconds();
+            bool paused = await Task.Run(() => _quickPause.Pause(currentGame.ProcessId, currentGame.ProcessName, now));
+            UpdateQuickPauseButton();
+
+            if (!paused)
+            {
+                var errorDialog = new ContentDialog()
+                {
+                    Title = "Pause Failed",
+                    Content = "The game could not be paused. It may be running as administrator.",
+                    CloseButtonText = "OK",
+                    XamlRoot = this.Content.XamlRoot
+                };
+
+                await errorDialog.ShowWithGamepadSupportAsync(_gamepadNavigationService);
+            }
+        }
+
+        private async Task ResumeQuickPauseAsync()
+        {
+            if (_quickPause?.IsPaused != true)
+                return;
+
+            long now = DateTimeOffset.UtcNow.ToUnixTimeMilliseconds();
+            await Task.Run(() => _quickPause.Resume(now));
+            UpdateQuickPauseButton();
+        }
+
+        private void UpdateQuickPauseButton()
+        {
+            var currentGame = _enhancedGameDetectionService?.CurrentGame;
+            bool paused = _quickPause?.IsPaused == true;
+            QuickPauseButtonVisible = currentGame != null || paused;
+            QuickPauseIcon.Glyph = paused ? "\uE768" : "\uE769";
+
+            string gameName = currentGame == null ? "Game"
+                : !string.IsNullOrWhiteSpace(currentGame.WindowTitle) ? currentGame.WindowTitle : currentGame.ProcessName;
+            string toolTip = paused ? $"Resume {gameName}" : $"Pause {gameName}";
+            double drainWatts = _quickPause?.CurrentDrainWatts ?? double.NaN;
+            if (paused && !double.IsNaN(drainWatts))
+                toolTip += $"\nDrawing {drainWatts:F1} W while paused";
+            ToolTipService.SetToolTip(QuickPauseButton, toolTip);
+        }
+
         private async void LosslessScalingButton_Click(object sender, RoutedEventArgs e)
         {
             if (_losslessScalingService == null || _enhancedGameDetectionService == null)
@@ -1309,6 +1405,11 @@ namespace HUDRA
         {
             if (_tdpMonitor == null || _mainPage == null) return;
 
+            // MainPage is cached, so the same picker comes back on every visit - hook it only once
+            if (ReferenceEquals(_tdpMonitorPicker, _mainPage.TdpPicker)) return;
+            bool isFirstHook = _tdpMonitorPicker == null;
+            _tdpMonitorPicker = _mainPage.TdpPicker;
+
             bool tdpMonitorStarted = false;
 
             _mainPage.TdpPicker.TdpChanged += (s, value) =>
@@ -1334,10 +1435,13 @@ namespace HUDRA
                 }
             }
 
-            _tdpMonitor.TdpDriftDetected += (s, args) =>
+            if (isFirstHook)
             {
-                System.Diagnostics.Debug.WriteLine($"TDP drift {args.CurrentTdp}W -> {args.TargetTdp}W (corrected: {args.CorrectionApplied})");
-            };
+                _tdpMonitor.TdpDriftDetected += (s, args) =>
+                {
+                    System.Diagnostics.Debug.WriteLine($"TDP drift {args.CurrentTdp}W -> {args.TargetTdp}W (corrected: {args.CorrectionApplied})");
+                };
+            }
         }
 
         // Main border drag handling for window movement
@@ -1425,12 +1529,55 @@ namespace HUDRA
             BatteryIcon.Foreground = new SolidColorBrush(info.IsCharging ? Microsoft.UI.Colors.DarkGreen : Microsoft.UI.Colors.White);
             BatteryTextBrush = new SolidColorBrush(info.IsCharging ? Microsoft.UI.Colors.White : Microsoft.UI.Colors.White);
 
-            string timeStr = info.RemainingDischargeTime == TimeSpan.Zero ? "--" : info.RemainingDischargeTime.ToString(@"hh\:mm");
-            BatteryToolTip = $"{info.Percent}% - {(info.IsCharging ? "Charging" : info.OnAc ? "Plugged in" : "On battery")}\nTime remaining: {timeStr}";
+            // Prefer the estimator's figure: it follows TDP changes instead of Windows' long average
+            TimeSpan? remaining = info.EstimatedRemaining ??
+                (info.RemainingDischargeTime == TimeSpan.Zero ? null : info.RemainingDischargeTime);
+            string timeStr = remaining?.ToString(@"hh\:mm") ?? "--";
+            string toolTip = $"{info.Percent}% - {(info.IsCharging ? "Charging" : info.OnAc ? "Plugged in" : "On battery")}\nTime remaining: {timeStr}";
+            if (!info.OnAc)
+            {
+                if (!double.IsNaN(info.DischargeWatts))
+                    toolTip += $" ({info.DischargeWatts:F1} W)";
+
+                var predictions = FormatPlaytimePredictions();
+                if (predictions != null)
+                    toolTip += $"\n{predictions}";
+            }
+            BatteryToolTip = toolTip;
+
+            if (_quickPause?.IsPaused == true)
+                UpdateQuickPauseButton();
+        }
+
+        /// <summary>
+        /// Playtime the running game's history predicts one step either side of the current TDP,
+        /// e.g. "At 10W 3:05 · 15W 2:20 · 20W 1:50". Null without history.
+        /// </summary>
+        private string? FormatPlaytimePredictions()
+        {
+            int target = _tdpMonitor?.TargetTdp ?? 0;
+            if (target <= 0) return null;
+
+            const int step = 5;
+            var steps = new List<int>(3);
+            foreach (var tdp in new[] { target - step, target, target + step })
+            {
+                if (tdp >= HudraSettings.MIN_TDP && tdp <= HudraSettings.MAX_TDP)
+                    steps.Add(tdp);
+            }
+
+            var parts = _batteryService.PredictPlaytime(steps)
+                .Where(p => p.Playtime.HasValue)
+                .Select(p => $"{p.TdpWatts}W {p.Playtime!.Value:h\\:mm}")
+                .ToList();
+            return parts.Count > 0 ? "At " + string.Join(" · ", parts) : null;
         }
 
         private void OnWindowShown(object? sender, EventArgs e)
         {
+            // Catch up on sensor/status updates held back while hidden before the first frame shows
+            UiUpdateDispatcher.For(DispatcherQueue).Flush();
+
             // When window is unhidden and made active, force input focus to the app
             // This ensures gamepad and keyboard input will be received by HUDRA
             try
@@ -1463,6 +1610,8 @@ namespace HUDRA
 
         private void Cleanup()
         {
+            // Before anything it restores is torn down; a game must never be left suspended
+            _quickPause?.Dispose();
             _mainPage?.TdpPicker?.Dispose();
             _windowManager?.Dispose();
             _turboService?.Dispose();
@@ -1472,6 +1621,14 @@ namespace HUDRA
             _navigationService?.Dispose();
             _gamepadNavigationService?.Dispose();
             _enhancedGameDetectionService?.Dispose();
+            _gameSchedulingTask.Wait(TimeSpan.FromSeconds(2));
+            _gameSchedulingService?.Revert();
+            _backgroundThrottleService?.Restore();
+            _powerSaver?.Dispose();
+            _powerSaverControl?.Dispose();
+            _quickPausePower?.Dispose();
+            _sessionRecorder?.Dispose();
+            _sessionSampleSource?.Dispose();
             _losslessScalingService?.Dispose();
             _powerProfileService?.Dispose();
             _artworkService?.Dispose();
@@ -1626,13 +1783,20 @@ namespace HUDRA
                 // Set current active profile as selected
                 SelectedPowerProfile = profiles.FirstOrDefault(p => p.IsActive);
 
-                // Initialize power profile control in settings page if available
-                if (_settingsPage?.PowerProfileControl != null)
+                // Initialize power profile control in settings page if available. The section is deferred,
+                // so its power plan queries wait until the user opens (or gamepad-focuses) it.
+                var powerExpander = _settingsPage?.PowerProfileExpander;
+                if (powerExpander != null)
                 {
-                    await _settingsPage.PowerProfileControl.InitializeAsync();
-
-                    // Set up event handler for power profile changes
-                    _settingsPage.PowerProfileControl.PowerProfileChanged += OnPowerProfileControlChanged;
+                    powerExpander.BodyRealized -= OnPowerProfileSectionRealized;
+                    if (powerExpander.IsBodyRealized)
+                    {
+                        await InitializePowerProfileControlAsync();
+                    }
+                    else
+                    {
+                        powerExpander.BodyRealized += OnPowerProfileSectionRealized;
+                    }
                 }
 
                 // Initialize intelligent power switching with enhanced game detection service
@@ -1647,6 +1811,33 @@ namespace HUDRA
             }
         }
 
+        private async void OnPowerProfileSectionRealized(object? sender, EventArgs e)
+        {
+            if (sender is NavigableExpander expander)
+            {
+                expander.BodyRealized -= OnPowerProfileSectionRealized;
+            }
+            await InitializePowerProfileControlAsync();
+        }
+
+        private async Task InitializePowerProfileControlAsync()
+        {
+            if (_settingsPage?.PowerProfileControl == null) return;
+
+            try
+            {
+                await _settingsPage.PowerProfileControl.InitializeAsync();
+
+                // Set up event handler for power profile changes (page is cached, so unsubscribe first)
+                _settingsPage.PowerProfileControl.PowerProfileChanged -= OnPowerProfileControlChanged;
+                _settingsPage.PowerProfileControl.PowerProfileChanged += OnPowerProfileControlChanged;
+            }
+            catch (Exception ex)
+            {
+                System.Diagnostics.Debug.WriteLine($"Failed to initialize power profile control: {ex.Message}");
+            }
+        }
+
         private async Task OnPowerProfileSelectionChanged(PowerProfile? profile)
         {
             if (profile == null) return;
@@ -1741,8 +1932,40 @@ namespace HUDRA
                         fanControlService,
                         _hdrService,
                         _gameDatabase);
+
+                    _gameSchedulingService = new GameSchedulingService();
+                    _backgroundThrottleService = new BackgroundThrottleService();
+                    _workingSetTrimService = new WorkingSetTrimService();
                 }
 
+                // Record per-game telemetry history; every source is read off the UI thread
+                _sessionSampleSource = new LiveSessionSampleSource(
+                    () => _tdpMonitor?.TargetTdp ?? 0,
+                    () => (Application.Current as App)?.TemperatureMonitor,
+                    () => (Application.Current as App)?.FanControlService);
+                _sessionRecorder = new GameSessionRecorder(new SessionHistoryStore(), _sessionSampleSource);
+                _sessionRecorder.SampleTaken += (_, sample) =>
+                {
+                    _batteryService.AddTelemetry(sample);
+                    _powerSaver?.ReportPackagePower(sample.TimestampMs, sample.PackagePowerWatts);
+                };
+
+                _powerSaverControl = new PowerSaverControl(
+                    _fpsLimiterService,
+                    () => _tdpMonitor,
+                    () => (Application.Current as App)?.TemperatureMonitor);
+                _powerSaver = new GamePowerSaverService(
+                    _powerSaverControl,
+                    () => _enhancedGameDetectionService,
+                    SettingsService.GetPowerSaverSettings);
+
+                _quickPausePower = new QuickPausePowerControl(
+                    () => _tdpMonitor,
+                    () => (Application.Current as App)?.FanControlService,
+                    () => (Application.Current as App)?.TemperatureMonitor,
+                    () => _powerSaver);
+                _quickPause = new QuickPauseService(new Win32ProcessSuspendApi(), _quickPausePower, BatteryService.ReadBatteryReport);
+
                 // Initialize artwork service with user's API key (if configured)
                 await InitializeArtworkServiceAsync();
 
@@ -1827,6 +2050,7 @@ namespace HUDRA
 
                 // Update Force Quit button visibility
                 UpdateForceQuitButtonVisibility();
+                UpdateQuickPauseButton();
 
                 // Update FPS limiter for game detection
                 if (_mainPage?.FpsLimiter != null)
@@ -1849,6 +2073,22 @@ namespace HUDRA
 
                 // Apply per-game profile if configured (pass gameName for InfoBar display)
                 await ApplyGameProfileAsync(gameInfo.ProcessName, gameName);
+
+                // Apply per-game CPU scheduling (needs the PID, so it lives outside GameProfileService)
+                ApplyGameScheduling(gameInfo);
+
+                if (_sessionRecorder != null)
+                {
+                    // Label sessions by the profile's settings so they can be compared per profile later
+                    var profileLabel = _gameProfileService?.IsProfileActive == true
+                        ? _gameProfileService.GetProfileForGame(gameInfo.ProcessName)?.PerformanceLabel ?? ""
+                        : "";
+                    _sessionRecorder.Start(gameInfo, profileLabel);
+                    _batteryService.LoadDrainModel(_sessionRecorder.Store, SessionHistoryStore.GetGameKey(gameInfo.ProcessName));
+                }
+
+                // Started after the profile so the TDP and cap it saves are the profile's; no-op unless enabled
+                _powerSaver?.Start(gameInfo);
             }
             catch (Exception ex)
             {
@@ -1872,12 +2112,30 @@ namespace HUDRA
                 // Update Force Quit button visibility
                 UpdateForceQuitButtonVisibility();
 
+                // Killed while paused: still put power back and forget the suspended processes
+                await ResumeQuickPauseAsync();
+                UpdateQuickPauseButton();
+
                 // Update FPS limiter for game stopped
                 if (_mainPage?.FpsLimiter != null)
                 {
                     _mainPage.FpsLimiter.IsGameRunning = false;
                 }
 
+                // Put back the profile's TDP and cap before anything reverts the profile itself
+                if (_powerSaver != null)
+                {
+                    var saved = await _powerSaver.StopAsync();
+                    if (saved.HasValue)
+                        _sessionRecorder?.SetPowerSaverResult(saved.Value.EnergySavedWh, saved.Value.SavingTime);
+                }
+
+                // Scheduling changes are tied to the game process, so always restore them on exit
+                RevertGameScheduling();
+
+                _sessionRecorder?.Stop();
+                _batteryService.ClearDrainModel();
+
                 // Check if auto-revert is enabled for the active profile
                 if (_gameProfileService?.IsProfileActive == true)
                 {
@@ -1902,6 +2160,69 @@ namespace HUDRA
             }
         }
 
+        private void ApplyGameScheduling(GameInfo gameInfo)
+        {
+            if (_gameSchedulingService == null || _gameProfileService == null) return;
+
+            var profile = _gameProfileService.GetProfileForGame(gameInfo.ProcessName);
+            var schedulingService = _gameSchedulingService;
+            var throttleService = _backgroundThrottleService;
+            var throttleMode = profile?.HasProfile == true ? profile.BackgroundThrottleMode : null;
+            var trimService = profile?.HasProfile == true && profile.TrimLauncherMemory == true ? _workingSetTrimService : null;
+            var processSnapshot = _enhancedGameDetectionService?.LastProcessSnapshot ?? Array.Empty<ProcessSnapshot>();
+
+            // Process enumeration and OpenProcess calls stay off the UI thread
+            var previous = _gameSchedulingTask;
+            _gameSchedulingTask = Task.Run(async () =>
+            {
+                await previous;
+                try
+                {
+                    schedulingService.ApplyForGame(gameInfo, profile);
+                    throttleService?.ApplyForGame(
+                        gameInfo.ProcessId,
+                        gameInfo.ProcessName,
+                        throttleMode,
+                        SettingsService.GetBackgroundThrottleProcesses());
+                    trimService?.TrimForGame(
+                        gameInfo.ProcessId,
+                        gameInfo.ProcessName,
+                        processSnapshot,
+                        SettingsService.GetWorkingSetTrimProcesses());
+                }
+                catch (Exception ex)
+                {
+                    System.Diagnostics.Debug.WriteLine($"Error applying game scheduling: {ex.Message}");
+                }
+            });
+        }
+
+        private void RevertGameScheduling()
+        {
+            // Re-arm launcher trimming so the next game session trims again
+            _workingSetTrimService?.Rearm();
+
+            var schedulingService = _gameSchedulingService;
+            var throttleService = _backgroundThrottleService;
+            if (schedulingService == null && throttleService == null) return;
+
+            // Queued behind a pending apply, so a game that exits right after launch is still reverted
+            var previous = _gameSchedulingTask;
+            _gameSchedulingTask = Task.Run(async () =>
+            {
+                await previous;
+                try
+                {
+                    schedulingService?.Revert();
+                    throttleService?.Restore();
+                }
+                catch (Exception ex)
+                {
+                    System.Diagnostics.Debug.WriteLine($"Error reverting game scheduling: {ex.Message}");
+                }
+            });
+        }
+
         /// <summary>
         /// Automatically reverts the profile to defaults (called when AutoRevertOnClose is enabled).
         /// </summary>
@@ -2480,7 +2801,7 @@ namespace HUDRA
                     System.Diagnostics.Debug.WriteLine("  FPS Limit: Unlimited - OK");
                 }
 
-                // Apply AMD features (RSR, AFMF, Anti-Lag)
+                // Apply AMD features (RSR, AFMF, Anti-Lag, Chill, Boost, Image Sharpening)
                 var amdService = new AmdAdlxService();
                 if (amdService.IsAmdGpuAvailable())
                 {
@@ -2513,6 +2834,20 @@ namespace HUDRA
                     {
                         System.Diagnostics.Debug.WriteLine($"  Anti-Lag failed: {ex.Message}");
                     }
+
+                    if (defaultProfile.Radeon3DSettings != null)
+                    {
+                        try
+                        {
+                            var radeon3D = defaultProfile.Radeon3DSettings;
+                            bool restored = await Task.Run(() => new Radeon3DSettingsService().Restore(radeon3D));
+                            System.Diagnostics.Debug.WriteLine($"  Chill/Boost/Sharpening: {(restored ? "OK" : "FAILED")}");
+                        }
+                        catch (Exception ex)
+                        {
+                            System.Diagnostics.Debug.WriteLine($"  Chill/Boost/Sharpening failed: {ex.Message}");
+                        }
+                    }
                 }
 
                 // Apply HDR
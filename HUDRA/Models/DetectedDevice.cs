@@ -23,6 +23,10 @@ namespace HUDRA.Models
         public bool SupportsFanControl { get; set; } = false;
         public bool SupportsLenovoWmi { get; set; } = false; // For TDP via WMI
 
+        // Cached detection outcome, valid while the fingerprint matches
+        public string Fingerprint { get; set; } = "";        // HardwareFingerprint.Value at detection time
+        public string FanControlDeviceType { get; set; } = ""; // IFanControlDevice type that initialized last time
+
         // Convenience properties
         public bool IsLenovo => Manufacturer == DeviceManufacturer.Lenovo;
         public bool IsGPD => Manufacturer == DeviceManufacturer.GPD;
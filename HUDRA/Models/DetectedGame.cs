@@ -3,8 +3,15 @@ using System.Collections.Generic;
 
 namespace HUDRA.Models
 {
+    /// <summary>
+    /// A game in the library. Alternative executable names come from <see cref="LibraryStringPool"/>, since
+    /// the same crash handlers and redistributables turn up in most installs; every other string is stored as
+    /// read so the tile bindings don't allocate. The JSON shape is unchanged.
+    /// </summary>
     public class DetectedGame
     {
+        private string[] _alternativeExecutables = Array.Empty<string>();
+
         public string ProcessName { get; set; } = string.Empty;
 
         public string DisplayName { get; set; } = string.Empty;
@@ -20,11 +27,20 @@ namespace HUDRA.Models
 
         // List of all executable names found in game folder (up to 5 levels deep)
         // Used for matching running processes, especially for Xbox games where actual exe differs from config
-        public List<string> AlternativeExecutables { get; set; } = new List<string>();
+        public IReadOnlyList<string> AlternativeExecutables
+        {
+            get => _alternativeExecutables;
+            set => _alternativeExecutables = LibraryStringPool.Shared.InternAll(value);
+        }
 
         // Path to downloaded SteamGridDB artwork (grid image)
         public string? ArtworkPath { get; set; }
 
+        // Blurred placeholder (28-char BlurHash-style string) and dominant color ("#RRGGBB") of the artwork,
+        // computed when artwork is saved so library tiles can paint before the image decodes
+        public string? ArtworkPlaceholder { get; set; }
+        public string? ArtworkColor { get; set; }
+
         // Per-game profile settings (JSON serialized GameProfile)
         // Null or empty if no profile is configured
         public string? ProfileJson { get; set; }
@@ -1,3 +1,4 @@
+using System.Collections.Generic;
 using System.Text.Json.Serialization;
 
 namespace HUDRA.Models
@@ -16,6 +17,12 @@ namespace HUDRA.Models
         // TDP Settings (0 = not set/use system default)
         public int TdpWatts { get; set; } = 0;
 
+        // Power envelope (0 = not set; slow/fast follow the TDP, sPPT/Tctl are left as they are)
+        public int SlowLimitWatts { get; set; } = 0;
+        public int FastLimitWatts { get; set; } = 0;
+        public int ApuSlowLimitWatts { get; set; } = 0;
+        public int TctlLimitCelsius { get; set; } = 0;
+
         // Resolution Settings (0x0 = not set/use system default)
         public int ResolutionWidth { get; set; } = 0;
         public int ResolutionHeight { get; set; } = 0;
@@ -39,9 +46,56 @@ namespace HUDRA.Models
         // AMD Anti-Lag Settings (null = don't change/default, true = on, false = off)
         public bool? AntiLagEnabled { get; set; } = null;
 
+        // AMD Radeon Chill, FPS falls toward the minimum without input (null = don't change/default, true = on, false = off)
+        public bool? ChillEnabled { get; set; } = null;
+        public int ChillMinFps { get; set; } = 30;
+        public int ChillMaxFps { get; set; } = 60;
+
+        // AMD Radeon Boost (null = don't change/default, true = on, false = off)
+        public bool? RadeonBoostEnabled { get; set; } = null;
+
+        // AMD Image Sharpening (null = don't change/default, true = on, false = off)
+        public bool? ImageSharpeningEnabled { get; set; } = null;
+        public int ImageSharpness { get; set; } = 80;
+
         // Fan Curve Settings ("Default" = don't change)
         public string FanCurvePreset { get; set; } = "Default";
 
+        // CPU Scheduling ("Default" = don't change)
+        public string CpuPriority { get; set; } = "Default";        // Default, AboveNormal, High
+        public string CpuCoreAssignment { get; set; } = "Default";  // Default, ReserveFirstCore
+
+        // Lower launcher/overlay priority while the game runs (null = don't change/default)
+        public bool? DemoteLaunchers { get; set; } = null;
+
+        // Background process throttling ("Default" = don't change, "Efficiency", "EfficiencyLowIo")
+        public string BackgroundThrottleMode { get; set; } = "Default";
+
+        // Trim launcher working sets at game start (null = don't change/default, true = trim)
+        public bool? TrimLauncherMemory { get; set; } = null;
+
+        // Processor power, written to the active power plan (0 / "Default" = don't change)
+        public int MaxProcessorState { get; set; } = 0;              // Percent
+        public string EnergyPreference { get; set; } = "Default";    // Default, Performance, Balanced, Efficiency, MaxEfficiency
+        public string CpuBoostMode { get; set; } = "Default";        // Default, Disabled, Efficient, Aggressive
+
+        [JsonIgnore]
+        public bool HasPowerEnvelope =>
+            SlowLimitWatts > 0 || FastLimitWatts > 0 || ApuSlowLimitWatts > 0 || TctlLimitCelsius > 0;
+
+        /// <summary>
+        /// The TDP and envelope as requested; validate against the device before applying.
+        /// </summary>
+        [JsonIgnore]
+        public PowerEnvelope PowerEnvelope => new PowerEnvelope
+        {
+            StapmWatts = TdpWatts,
+            SlowWatts = SlowLimitWatts,
+            FastWatts = FastLimitWatts,
+            ApuSlowWatts = ApuSlowLimitWatts,
+            TctlCelsius = TctlLimitCelsius
+        };
+
         /// <summary>
         /// Returns true if any profile setting is actually configured
         /// </summary>
@@ -49,6 +103,7 @@ namespace HUDRA.Models
         public bool HasAnySettingsConfigured =>
             AutoRevertOnClose || // Auto-revert counts as a configured setting
             TdpWatts > 0 ||
+            HasPowerEnvelope ||
             (ResolutionWidth > 0 && ResolutionHeight > 0) ||
             RefreshRateHz > 0 ||
             FpsLimit >= 0 || // -1 = default (not configured), 0+ = configured
@@ -56,6 +111,51 @@ namespace HUDRA.Models
             RsrEnabled.HasValue ||
             AfmfEnabled.HasValue ||
             AntiLagEnabled.HasValue ||
-            (FanCurvePreset != "Default" && !string.IsNullOrEmpty(FanCurvePreset));
+            ChillEnabled.HasValue ||
+            RadeonBoostEnabled.HasValue ||
+            ImageSharpeningEnabled.HasValue ||
+            (FanCurvePreset != "Default" && !string.IsNullOrEmpty(FanCurvePreset)) ||
+            (CpuPriority != "Default" && !string.IsNullOrEmpty(CpuPriority)) ||
+            (CpuCoreAssignment != "Default" && !string.IsNullOrEmpty(CpuCoreAssignment)) ||
+            DemoteLaunchers.HasValue ||
+            (BackgroundThrottleMode != "Default" && !string.IsNullOrEmpty(BackgroundThrottleMode)) ||
+            TrimLauncherMemory.HasValue ||
+            MaxProcessorState > 0 ||
+            (EnergyPreference != "Default" && !string.IsNullOrEmpty(EnergyPreference)) ||
+            (CpuBoostMode != "Default" && !string.IsNullOrEmpty(CpuBoostMode));
+
+        /// <summary>
+        /// Short description of the settings that affect performance and power, e.g. "15W · 1280x800 · 40 FPS · RSR",
+        /// with STAPM/slow/fast written "15/18/25W" when the envelope is shaped.
+        /// Sessions recorded under the same label are compared as one profile.
+        /// </summary>
+        [JsonIgnore]
+        public string PerformanceLabel
+        {
+            get
+            {
+                var parts = new List<string>();
+                if (TdpWatts > 0 && (SlowLimitWatts > 0 || FastLimitWatts > 0))
+                    parts.Add($"{TdpWatts}/{(SlowLimitWatts > 0 ? SlowLimitWatts : TdpWatts)}/{(FastLimitWatts > 0 ? FastLimitWatts : TdpWatts)}W");
+                else if (TdpWatts > 0) parts.Add($"{TdpWatts}W");
+                if (ApuSlowLimitWatts > 0) parts.Add($"sPPT {ApuSlowLimitWatts}W");
+                if (TctlLimitCelsius > 0) parts.Add($"Tctl {TctlLimitCelsius}°C");
+                if (ResolutionWidth > 0 && ResolutionHeight > 0) parts.Add($"{ResolutionWidth}x{ResolutionHeight}");
+                if (RefreshRateHz > 0) parts.Add($"{RefreshRateHz}Hz");
+                if (FpsLimit > 0) parts.Add($"{FpsLimit} FPS");
+                else if (FpsLimit == 0) parts.Add("Uncapped");
+                if (RsrEnabled == true) parts.Add("RSR");
+                if (AfmfEnabled == true) parts.Add("AFMF");
+                if (AntiLagEnabled == true) parts.Add("Anti-Lag");
+                if (ChillEnabled == true) parts.Add($"Chill {ChillMinFps}-{ChillMaxFps}");
+                if (RadeonBoostEnabled == true) parts.Add("Radeon Boost");
+                if (ImageSharpeningEnabled == true) parts.Add("Sharpening");
+                if (!string.IsNullOrEmpty(FanCurvePreset) && FanCurvePreset != "Default") parts.Add($"Fan {FanCurvePreset}");
+                if (MaxProcessorState > 0) parts.Add($"CPU {MaxProcessorState}%");
+                if (!string.IsNullOrEmpty(EnergyPreference) && EnergyPreference != "Default") parts.Add($"EPP {EnergyPreference}");
+                if (!string.IsNullOrEmpty(CpuBoostMode) && CpuBoostMode != "Default") parts.Add($"Boost {CpuBoostMode}");
+                return parts.Count > 0 ? string.Join(" · ", parts) : "Profile";
+            }
+        }
     }
 }
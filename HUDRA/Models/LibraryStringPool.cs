@@ -0,0 +1,43 @@
+using System;
+using System.Collections.Concurrent;
+using System.Collections.Generic;
+
+namespace HUDRA.Models
+{
+    /// <summary>
+    /// Shared storage for the strings that repeat across a game library: executable names found in many
+    /// install folders (crash handlers, anti-cheat, redistributables). Values unique to one game are deliberately not pooled; a pool entry costs more
+    /// than the string it would save. Thread-safe.
+    /// </summary>
+    public sealed class LibraryStringPool
+    {
+        public static LibraryStringPool Shared { get; } = new LibraryStringPool();
+
+        private readonly ConcurrentDictionary<string, string> _strings = new(StringComparer.Ordinal);
+
+        public int Count => _strings.Count;
+
+        public string Intern(string value)
+        {
+            if (value.Length == 0) return string.Empty;
+            return _strings.GetOrAdd(value, value);
+        }
+
+        /// <summary>
+        /// Interns each name into a right-sized array. Returns a shared empty array for no names.
+        /// </summary>
+        public string[] InternAll(IEnumerable<string>? values)
+        {
+            if (values == null) return Array.Empty<string>();
+
+            var interned = new List<string>();
+            foreach (var value in values)
+            {
+                if (!string.IsNullOrEmpty(value))
+                    interned.Add(Intern(value));
+            }
+
+            return interned.Count == 0 ? Array.Empty<string>() : interned.ToArray();
+        }
+    }
+}
@@ -0,0 +1,32 @@
+namespace HUDRA.Models
+{
+    /// <summary>
+    /// The SMU limits behind a TDP setting. STAPM is the sustained limit the TDP picker sets; slow and fast
+    /// are the PPT limits the APU may boost to over seconds and milliseconds; sPPT is the APU-only slow limit;
+    /// Tctl is the temperature the SMU throttles at. Watts and degrees C; 0 = not set.
+    /// </summary>
+    public sealed record PowerEnvelope
+    {
+        public int StapmWatts { get; init; }
+        public int SlowWatts { get; init; }
+        public int FastWatts { get; init; }
+        public int ApuSlowWatts { get; init; }
+        public int TctlCelsius { get; init; }
+
+        /// <summary>
+        /// Whether anything beyond a flat TDP is set, i.e. whether this differs from what SetTdp writes on its own.
+        /// </summary>
+        public bool IsShaped => (SlowWatts > 0 && SlowWatts != StapmWatts) ||
+            (FastWatts > 0 && FastWatts != StapmWatts) ||
+            ApuSlowWatts > 0 ||
+            TctlCelsius > 0;
+
+        public override string ToString()
+        {
+            var text = $"STAPM {StapmWatts}W, slow {SlowWatts}W, fast {FastWatts}W";
+            if (ApuSlowWatts > 0) text += $", sPPT {ApuSlowWatts}W";
+            if (TctlCelsius > 0) text += $", Tctl {TctlCelsius}°C";
+            return text;
+        }
+    }
+}
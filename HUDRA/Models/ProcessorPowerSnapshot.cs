@@ -0,0 +1,29 @@
+using System;
+using System.Collections.Generic;
+
+namespace HUDRA.Models
+{
+    /// <summary>
+    /// Processor settings of a Windows power plan that game profiles can change.
+    /// </summary>
+    public enum ProcessorPowerSetting
+    {
+        MaxProcessorState,            // PROCTHROTTLEMAX, percent
+        EnergyPerformancePreference,  // PERFEPP, 0 = performance .. 100 = efficiency
+        BoostMode                     // PERFBOOSTMODE
+    }
+
+    /// <summary>
+    /// Plugged-in and on-battery index of one power setting.
+    /// </summary>
+    public readonly record struct PowerSettingIndex(uint Ac, uint Dc);
+
+    /// <summary>
+    /// Processor power settings as read from one power plan, so they can be written back to that plan.
+    /// </summary>
+    public class ProcessorPowerSnapshot
+    {
+        public Guid SchemeId { get; set; }
+        public Dictionary<ProcessorPowerSetting, PowerSettingIndex> Values { get; set; } = new();
+    }
+}
@@ -0,0 +1,28 @@
+using System.Text.Json.Serialization;
+
+namespace HUDRA.Models
+{
+    /// <summary>
+    /// Radeon Chill: the frame rate drops toward MinFps while there's no input and rises to MaxFps with it.
+    /// </summary>
+    public readonly record struct RadeonChillState(bool Enabled, int MinFps, int MaxFps);
+
+    /// <summary>
+    /// Radeon Image Sharpening, Sharpness in percent.
+    /// </summary>
+    public readonly record struct RadeonSharpeningState(bool Enabled, int Sharpness);
+
+    /// <summary>
+    /// Global Radeon 3D settings as read from the driver. A null feature couldn't be read (unsupported
+    /// GPU or driver) and is never written back.
+    /// </summary>
+    public class Radeon3DSettingsSnapshot
+    {
+        public RadeonChillState? Chill { get; set; }
+        public bool? BoostEnabled { get; set; }
+        public RadeonSharpeningState? ImageSharpening { get; set; }
+
+        [JsonIgnore]
+        public bool IsEmpty => Chill == null && BoostEnabled == null && ImageSharpening == null;
+    }
+}
@@ -18,9 +18,11 @@ namespace HUDRA.Models
         public int RsrSharpness { get; set; }
         public bool AfmfEnabled { get; set; }
         public bool AntiLagEnabled { get; set; }
+        public Radeon3DSettingsSnapshot? Radeon3DSettings { get; set; }
         public bool HdrEnabled { get; set; }
         public string FanCurvePreset { get; set; } = "Cruise";
         public bool FanCurveEnabled { get; set; }
+        public ProcessorPowerSnapshot? ProcessorPower { get; set; }
 
         public DateTime CapturedAt { get; set; } = DateTime.Now;
     }
@@ -1,3 +1,4 @@
+using HUDRA.Controls;
 using HUDRA.Services;
 using Microsoft.UI.Xaml;
 using Microsoft.UI.Xaml.Controls;
@@ -55,21 +56,24 @@ namespace HUDRA.Pages
 
         private void SetupFanCurveEventHandling()
         {
-            // Handle fan curve control events
-            FanCurveControl.FanCurveChanged += (s, e) =>
+            // Handle fan curve control events (unsubscribe first - the page instance is cached across visits)
+            FanCurveControl.FanCurveChanged -= OnFanCurveChanged;
+            FanCurveControl.FanCurveChanged += OnFanCurveChanged;
+        }
+
+        private void OnFanCurveChanged(object? sender, FanCurveChangedEventArgs e)
+        {
+            if (e.Curve.IsEnabled)
             {
-                if (e.Curve.IsEnabled)
-                {
-                    System.Diagnostics.Debug.WriteLine("Fan curve control active - custom curve applied");
-                }
-                else
-                {
-                    System.Diagnostics.Debug.WriteLine("Fan curve control disabled - hardware mode active");
-                }
-                
-                // Could add additional logging or status updates here
-                // e.g., update main window status, log to file, etc.
-            };
+                System.Diagnostics.Debug.WriteLine("Fan curve control active - custom curve applied");
+            }
+            else
+            {
+                System.Diagnostics.Debug.WriteLine("Fan curve control disabled - hardware mode active");
+            }
+
+            // Could add additional logging or status updates here
+            // e.g., update main window status, log to file, etc.
         }
 
     }
@@ -2,6 +2,8 @@ using HUDRA.Extensions;
 using HUDRA.Interfaces;
 using HUDRA.Models;
 using HUDRA.Services;
+using HUDRA.Services.ArtworkPlaceholders;
+using HUDRA.Services.SessionHistory;
 using HUDRA.AttachedProperties;
 using Microsoft.UI;
 using Microsoft.UI.Xaml;
@@ -9,11 +11,13 @@ using Microsoft.UI.Xaml.Controls;
 using Microsoft.UI.Xaml.Media;
 using System;
 using System.Collections.Generic;
+using System.Collections.ObjectModel;
 using System.ComponentModel;
 using System.IO;
 using System.Linq;
 using System.Runtime.CompilerServices;
 using System.Text.Json;
+using System.Threading;
 using System.Threading.Tasks;
 using Windows.Storage.Pickers;
 
@@ -30,8 +34,12 @@ namespace HUDRA.Pages
         private string? _pendingArtworkPath;
         private bool _artworkChanged = false;
         private List<string> _tempSgdbPaths = new();
+        private readonly ObservableCollection<SteamGridDbResult> _sgdbResults = new();
+        private CancellationTokenSource? _sgdbCts;
         private string _artworkDirectory = string.Empty;
         private string? _selectedSgdbPath = null;  // Track selected SGDB tile for visual feedback
+        private readonly ObservableCollection<ProfileEfficiencyRow> _efficiencyRows = new();
+        private int _efficiencyLoadVersion;
 
         // Gamepad navigation state
         private bool _isFocused = false;
@@ -49,6 +57,13 @@ namespace HUDRA.Pages
             this.InitializeComponent();
             InitializeGamepadNavigation();
 
+            // Leaving the page mid-search stops the remaining preview downloads
+            this.Unloaded += (s, e) =>
+            {
+                CancelSgdbSearch();
+                CleanupTempSgdbFiles();
+            };
+
             // Get artwork directory path
             var appDataPath = Path.Combine(
                 Environment.GetFolderPath(Environment.SpecialFolder.LocalApplicationData),
@@ -124,6 +139,7 @@ namespace HUDRA.Pages
 
             // Load game profile if it exists
             LoadGameProfile();
+            LoadEfficiencyComparison(_currentGame.ProcessName);
 
             // Subscribe to auto-save events (unsubscribe first to prevent duplicates if page is cached)
             GameProfileControl.ProfileChanged -= GameProfileControl_ProfileChanged;
@@ -132,6 +148,36 @@ namespace HUDRA.Pages
             DisplayNameTextBox.TextChanged += DisplayNameTextBox_TextChanged;
         }
 
+        /// <summary>
+        /// Shows energy per frame for each profile this game has been played with, from its session history.
+        /// </summary>
+        private async void LoadEfficiencyComparison(string processName)
+        {
+            int version = ++_efficiencyLoadVersion;
+            _efficiencyRows.Clear();
+            EfficiencySection.Visibility = Visibility.Collapsed;
+
+            try
+            {
+                var mainWindow = (Application.Current as App)?.MainWindow;
+                var store = mainWindow?.SessionHistory ?? new SessionHistoryStore();
+                var gameKey = SessionHistoryStore.GetGameKey(processName);
+
+                var profiles = await Task.Run(() => EfficiencyComparison.ByProfile(store.GetSummaries(gameKey)));
+                if (version != _efficiencyLoadVersion || profiles.Count == 0) return;
+
+                foreach (var profile in profiles)
+                    _efficiencyRows.Add(ProfileEfficiencyRow.From(profile));
+
+                EfficiencyItemsControl.ItemsSource = _efficiencyRows;
+                EfficiencySection.Visibility = Visibility.Visible;
+            }
+            catch (Exception ex)
+            {
+                System.Diagnostics.Debug.WriteLine($"GameSettingsPage: Error loading efficiency comparison: {ex.Message}");
+            }
+        }
+
         private void LoadGameProfile()
         {
             if (_currentGame == null) return;
@@ -488,14 +534,8 @@ namespace HUDRA.Pages
         // Button click handlers
         private void BackButton_Click(object sender, RoutedEventArgs e)
         {
-            // Cleanup temp SGDB files (except the one selected as artwork)
-            foreach (var tempPath in _tempSgdbPaths)
-            {
-                if (File.Exists(tempPath) && tempPath != _pendingArtworkPath)
-                {
-                    try { File.Delete(tempPath); } catch { }
-                }
-            }
+            CancelSgdbSearch();
+            CleanupTempSgdbFiles();
             NavigateToLibrary();
         }
 
@@ -576,7 +616,7 @@ namespace HUDRA.Pages
             }
         }
 
-        private void BrowseButton_Click(object sender, RoutedEventArgs e)
+        private async void BrowseButton_Click(object sender, RoutedEventArgs e)
         {
             try
             {
@@ -616,7 +656,7 @@ namespace HUDRA.Pages
                 HideArtworkError();
 
                 // Save artwork immediately
-                SaveArtwork(_pendingArtworkPath);
+                await SaveArtworkAsync(_pendingArtworkPath);
             }
             catch (Exception ex)
             {
@@ -629,39 +669,56 @@ namespace HUDRA.Pages
         {
             if (_artworkService == null || _currentGame == null) return;
 
+            CancelSgdbSearch();
+            CleanupTempSgdbFiles();
+            var cts = new CancellationTokenSource();
+            _sgdbCts = cts;
+
             try
             {
                 // Show section and loading indicator
                 SgdbResultsSection.Visibility = Visibility.Visible;
                 SgdbLoadingIndicator.Visibility = Visibility.Visible;
                 SgdbErrorText.Visibility = Visibility.Collapsed;
-                SgdbImageGrid.ItemsSource = null;
-
-                // Fetch artwork options using the current Display Name field value (allows user to correct search term)
-                var results = await _artworkService.GetArtworkOptionsAsync(DisplayNameTextBox.Text, 10);
+                _sgdbResults.Clear();
+                SgdbImageGrid.ItemsSource = _sgdbResults;
 
-                SgdbLoadingIndicator.Visibility = Visibility.Collapsed;
+                // Reset selection
+                _selectedSgdbPath = null;
 
-                if (results == null || results.Count == 0)
+                // Fetch artwork options using the current Display Name field value (allows user to correct search term).
+                // Previews arrive as they finish downloading; keep them in resolution order.
+                await foreach (var result in _artworkService.StreamArtworkOptionsAsync(DisplayNameTextBox.Text, 10, cts.Token))
                 {
-                    ShowSgdbError("No artwork found on SteamGridDB for this game.");
-                    return;
-                }
+                    _tempSgdbPaths.Add(result.TempFilePath);
+                    cts.Token.ThrowIfCancellationRequested(); // Landed after a newer search started
 
-                // Store temp paths for cleanup
-                _tempSgdbPaths = results.Select(r => r.TempFilePath).ToList();
+                    int insertAt = 0;
+                    while (insertAt < _sgdbResults.Count && _sgdbResults[insertAt].Index < result.Index)
+                    {
+                        insertAt++;
+                    }
+                    _sgdbResults.Insert(insertAt, result);
 
-                // Display results
-                SgdbImageGrid.ItemsSource = results;
+                    SgdbLoadingIndicator.Visibility = Visibility.Collapsed;
 
-                // Reset selection
-                _selectedSgdbPath = null;
+                    // Delay to allow ItemsControl to render, then update borders
+                    DispatcherQueue.TryEnqueue(Microsoft.UI.Dispatching.DispatcherQueuePriority.Low, () =>
+                    {
+                        UpdateSgdbTileSelection();
+                    });
+                }
 
-                // Delay to allow ItemsControl to render, then update borders
-                DispatcherQueue.TryEnqueue(Microsoft.UI.Dispatching.DispatcherQueuePriority.Low, () =>
+                SgdbLoadingIndicator.Visibility = Visibility.Collapsed;
+
+                if (_sgdbResults.Count == 0)
                 {
-                    UpdateSgdbTileSelection();
-                });
+                    ShowSgdbError("No artwork found on SteamGridDB for this game.");
+                }
+            }
+            catch (OperationCanceledException)
+            {
+                // Superseded by a new search or the page was closed
             }
             catch (Exception ex)
             {
@@ -669,29 +726,90 @@ namespace HUDRA.Pages
                 SgdbLoadingIndicator.Visibility = Visibility.Collapsed;
                 ShowSgdbError("Failed to fetch artwork from SteamGridDB.");
             }
+            finally
+            {
+                if (_sgdbCts == cts) _sgdbCts = null;
+                cts.Dispose();
+            }
         }
 
-        private void SgdbImage_Click(object sender, RoutedEventArgs e)
+        private async void SgdbImage_Click(object sender, RoutedEventArgs e)
         {
             if (sender is not Button button || button.Tag is not SteamGridDbResult result)
                 return;
 
-            // Set as pending artwork
-            _pendingArtworkPath = result.TempFilePath;
-            _artworkChanged = true;
             _selectedSgdbPath = result.TempFilePath;
 
-            // Update preview
-            ArtworkPreview.Source = new Microsoft.UI.Xaml.Media.Imaging.BitmapImage(
-                new Uri(result.TempFilePath));
-
             // Update selection borders
             UpdateSgdbTileSelection();
 
-            HideArtworkError();
+            await SelectSgdbResultAsync(result);
+        }
+
+        /// <summary>
+        /// Downloads the full-size grid for a picked SGDB tile (the tile itself is only a thumbnail), previews it
+        /// and saves it as the game's artwork. Shared by pointer and gamepad selection.
+        /// </summary>
+        private async Task SelectSgdbResultAsync(SteamGridDbResult result)
+        {
+            if (_artworkService == null) return;
+
+            try
+            {
+                var fullImagePath = await _artworkService.DownloadFullImageAsync(result);
+                if (string.IsNullOrEmpty(fullImagePath))
+                {
+                    ShowArtworkError("Failed to download the selected artwork");
+                    return;
+                }
+
+                if (fullImagePath != result.TempFilePath)
+                {
+                    _tempSgdbPaths.Add(fullImagePath);
+                }
+
+                // Another tile was picked while this one downloaded
+                if (_selectedSgdbPath != result.TempFilePath) return;
+
+                // Set as pending artwork
+                _pendingArtworkPath = fullImagePath;
+                _artworkChanged = true;
+
+                // Update preview
+                ArtworkPreview.Source = new Microsoft.UI.Xaml.Media.Imaging.BitmapImage(
+                    new Uri(fullImagePath));
+
+                HideArtworkError();
+
+                // Save artwork immediately
+                await SaveArtworkAsync(_pendingArtworkPath);
+            }
+            catch (Exception ex)
+            {
+                System.Diagnostics.Debug.WriteLine($"GameSettingsPage: Error selecting SteamGridDB artwork: {ex.Message}");
+                ShowArtworkError("Failed to download the selected artwork");
+            }
+        }
+
+        private void CancelSgdbSearch()
+        {
+            _sgdbCts?.Cancel();
+            _sgdbCts = null;
+        }
 
-            // Save artwork immediately
-            SaveArtwork(_pendingArtworkPath);
+        /// <summary>
+        /// Delete downloaded SGDB previews (except the one selected as artwork)
+        /// </summary>
+        private void CleanupTempSgdbFiles()
+        {
+            foreach (var tempPath in _tempSgdbPaths)
+            {
+                if (File.Exists(tempPath) && tempPath != _pendingArtworkPath)
+                {
+                    try { File.Delete(tempPath); } catch { }
+                }
+            }
+            _tempSgdbPaths.Clear();
         }
 
         private void NavigateToLibrary()
@@ -710,7 +828,7 @@ namespace HUDRA.Pages
             return sanitized;
         }
 
-        private void SaveArtwork(string? sourcePath)
+        private async Task SaveArtworkAsync(string? sourcePath)
         {
             if (_currentGame == null || _gameDatabase == null || string.IsNullOrEmpty(sourcePath)) return;
 
@@ -742,6 +860,7 @@ namespace HUDRA.Pages
 
                 _currentGame.ArtworkPath = newPath;
                 _originalArtworkPath = newPath; // Update so subsequent saves don't re-delete
+                await ArtworkPlaceholderService.UpdateAsync(_currentGame);
                 _gameDatabase.SaveGame(_currentGame);
 
                 // Refresh library artwork
@@ -931,25 +1050,19 @@ namespace HUDRA.Pages
             UpdateSgdbTileSelection();
         }
 
-        private void ActivateSgdbGridTile()
+        private async void ActivateSgdbGridTile()
         {
             var items = SgdbImageGrid.Items;
             if (items == null || _sgdbGridFocusIndex >= items.Count) return;
 
             if (items[_sgdbGridFocusIndex] is SteamGridDbResult result)
             {
-                // Reuse existing selection logic
-                _pendingArtworkPath = result.TempFilePath;
-                _artworkChanged = true;
                 _selectedSgdbPath = result.TempFilePath;
 
-                // Update preview
-                ArtworkPreview.Source = new Microsoft.UI.Xaml.Media.Imaging.BitmapImage(
-                    new Uri(result.TempFilePath));
-
                 // Update visual feedback
                 UpdateSgdbGridFocusVisual();
-                HideArtworkError();
+
+                await SelectSgdbResultAsync(result);
             }
         }
 
@@ -1010,4 +1123,42 @@ namespace HUDRA.Pages
             return null;
         }
     }
+
+    /// <summary>
+    /// Display strings for one row of the per-profile efficiency comparison.
+    /// </summary>
+    public class ProfileEfficiencyRow
+    {
+        public string Label { get; init; } = string.Empty;
+        public string Efficiency { get; init; } = string.Empty;
+        public string Detail { get; init; } = string.Empty;
+
+        public static ProfileEfficiencyRow From(ProfileEfficiency profile)
+        {
+            var stats = profile.JoulesPerFrame;
+            double margin = stats.ConfidenceHalfWidth95;
+            string efficiency = double.IsNaN(margin)
+                ? $"{stats.Mean:F3} J/frame"
+                : $"{stats.Mean:F3} ± {margin:F3} J/frame";
+            if (!profile.UsesPackagePower)
+                efficiency += " (battery)";
+
+            var details = new List<string>();
+            if (!double.IsNaN(profile.AverageFps))
+                details.Add($"{profile.AverageFps:F0} FPS");
+            details.Add(profile.SessionCount == 1 ? "1 session" : $"{profile.SessionCount} sessions");
+            details.Add(profile.PlayTime.TotalHours >= 1
+                ? $"{(int)profile.PlayTime.TotalHours}h {profile.PlayTime.Minutes}m"
+                : $"{profile.PlayTime.Minutes}m");
+            if (profile.PowerSaverEnergyWh >= 0.01)
+                details.Add($"{profile.PowerSaverEnergyWh:F2} Wh saved by power saver");
+
+            return new ProfileEfficiencyRow
+            {
+                Label = profile.ProfileLabel,
+                Efficiency = efficiency,
+                Detail = string.Join(" · ", details)
+            };
+        }
+    }
 }
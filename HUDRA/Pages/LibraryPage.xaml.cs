@@ -1,5 +1,6 @@
 using HUDRA.Models;
 using HUDRA.Services;
+using HUDRA.Services.ArtworkPlaceholders;
 using Microsoft.UI.Xaml;
 using Microsoft.UI.Xaml.Controls;
 using Microsoft.UI.Xaml.Data;
@@ -27,7 +28,7 @@ namespace HUDRA.Pages
         private readonly SecureStorageService _secureStorage = new();
 
         // State preservation - STATIC fields persist across page recreation
-        // Despite NavigationCacheMode.Enabled, page is still being recreated (framework issue)
+        // NavigationService caches this page, but the cache can be trimmed under memory pressure
         private static double _savedScrollOffset = 0;
         private static string? _savedFocusedGameProcessName = null;
         private static bool _lastUsedGamepadInput = false; // Track input method for smart focus restoration
@@ -364,6 +365,15 @@ namespace HUDRA.Pages
             RefreshLibrary();
         }
 
+        private void ArtworkImage_ImageOpened(object sender, RoutedEventArgs e)
+        {
+            // Crossfade from the placeholder (OpacityTransition animates the change)
+            if (sender is Image image)
+            {
+                image.Opacity = 1;
+            }
+        }
+
         /// <summary>
         /// Forces a full library reload on next navigation.
         /// Called after adding manual games or updating artwork.
@@ -1436,17 +1446,10 @@ namespace HUDRA.Pages
                     }
 
                     // Save the game with artwork path (or empty if not found)
+                    await ArtworkPlaceholderService.UpdateAsync(manualGame);
+                    // The detection service reads the database's store directly, so this is the only update needed
                     database.SaveGame(manualGame);
 
-                    // Update the cached games dictionary
-                    var cachedGamesField = typeof(EnhancedGameDetectionService).GetField("_cachedGames",
-                        System.Reflection.BindingFlags.NonPublic | System.Reflection.BindingFlags.Instance);
-
-                    if (cachedGamesField?.GetValue(_gameDetectionService) is Dictionary<string, DetectedGame> cachedGames)
-                    {
-                        cachedGames[manualGame.ProcessName] = manualGame;
-                    }
-
                     System.Diagnostics.Debug.WriteLine($"Manual game added: {gameName} ({exePath})");
 
                     // Immediately reload the library to show the new game with artwork
@@ -1630,4 +1633,34 @@ namespace HUDRA.Pages
             throw new NotImplementedException();
         }
     }
+
+    public class ArtworkPlaceholderConverter : IValueConverter
+    {
+        public object? Convert(object value, Type targetType, object parameter, string language)
+        {
+            return ArtworkPlaceholderService.GetPlaceholderImage(value as string);
+        }
+
+        public object ConvertBack(object value, Type targetType, object parameter, string language)
+        {
+            throw new NotImplementedException();
+        }
+    }
+
+    public class HexColorToBrushConverter : IValueConverter
+    {
+        public object? Convert(object value, Type targetType, object parameter, string language)
+        {
+            if (ArtworkPlaceholderCodec.TryParseColor(value as string, out var r, out var g, out var b))
+            {
+                return new Microsoft.UI.Xaml.Media.SolidColorBrush(Windows.UI.Color.FromArgb(255, r, g, b));
+            }
+            return null;
+        }
+
+        public object ConvertBack(object value, Type targetType, object parameter, string language)
+        {
+            throw new NotImplementedException();
+        }
+    }
 }
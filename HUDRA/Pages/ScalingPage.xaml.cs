@@ -1,3 +1,4 @@
+using HUDRA.Controls;
 using HUDRA.Models;
 using HUDRA.Services;
 using Microsoft.UI.Xaml;
@@ -76,6 +77,9 @@ namespace HUDRA.Pages
             {
                 LosslessScalingExpander.IsExpanded = _losslessScalingExpanderExpanded;
             }
+
+            // Collapsed sections build their bodies (and query ADLX) only when opened
+            System.Diagnostics.Debug.WriteLine($"ScalingPage: Loaded - expander bodies: {NavigableExpander.DescribeBodies()}");
         }
 
         private void ScalingPage_Unloaded(object sender, RoutedEventArgs e)
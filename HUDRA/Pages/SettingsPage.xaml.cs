@@ -26,21 +26,26 @@ namespace HUDRA.Pages
         private static bool _gameDetectionExpanderExpanded = false;
         private static bool _defaultProfileExpanderExpanded = false;
         private static bool _powerProfileExpanderExpanded = false;
+        private static bool _powerSaverExpanderExpanded = false;
         private static bool _startupSettingsExpanderExpanded = false;
 
         // Reference to GameProfileService for capturing defaults
         private GameProfileService? _gameProfileService;
 
+        // Section bodies are built from their templates on first open, so these are null until then
+        private DefaultProfileControl? DefaultProfileControl => DefaultProfileExpander?.Body as DefaultProfileControl;
+        public PowerProfileControl? PowerProfileControl => PowerProfileExpander?.Body as PowerProfileControl;
+        private GameDetectionControl? GameDetectionControl => GameDetectionExpander?.Body as GameDetectionControl;
+        private StartupOptionsControl? StartupOptionsControl => StartupSettingsExpander?.Body as StartupOptionsControl;
+
         public SettingsPage()
         {
             this.InitializeComponent();
             this.Loaded += SettingsPage_Loaded;
             this.Unloaded += SettingsPage_Unloaded;
-            LoadSettings();
-            LoadStartupSettings();
-            LoadRtssSettings();
-            LoadEnhancedScanningSettings();
-            LoadDatabaseStatus();
+            DefaultProfileExpander.BodyRealized += DefaultProfileExpander_BodyRealized;
+            GameDetectionExpander.BodyRealized += GameDetectionExpander_BodyRealized;
+            StartupSettingsExpander.BodyRealized += StartupSettingsExpander_BodyRealized;
             LoadVersionInfo();
         }
 
@@ -60,21 +65,28 @@ namespace HUDRA.Pages
         // Expose root for gamepad page navigation
         public FrameworkElement? RootPanel => SettingsRootPanel;
 
-        private void LoadSettings()
+        // Wire up each section's control the first time its body is built. Bodies are kept alive after
+        // that, so the handlers run once per page instance.
+        private void DefaultProfileExpander_BodyRealized(object? sender, EventArgs e)
+        {
+            DefaultProfileExpander.BodyRealized -= DefaultProfileExpander_BodyRealized;
+
+            // DefaultProfileControl handles its own loading; it only needs the GameProfileService
+            DefaultProfileControl?.Initialize(_gameProfileService);
+        }
+
+        private void GameDetectionExpander_BodyRealized(object? sender, EventArgs e)
         {
-            // Settings are now loaded within the custom controls themselves
-            // Wire up event handlers to the custom controls
-            LoadDefaultProfileSettings();
+            GameDetectionExpander.BodyRealized -= GameDetectionExpander_BodyRealized;
             LoadGameDetectionSettings();
-            LoadStartupSettings();
-            LoadHotkeySettings();
-            DiagnoseStartupTask();
+            LoadDatabaseStatus();
         }
 
-        private void LoadDefaultProfileSettings()
+        private void StartupSettingsExpander_BodyRealized(object? sender, EventArgs e)
         {
-            // DefaultProfileControl handles its own loading
-            // Initialize will be called with the GameProfileService later
+            StartupSettingsExpander.BodyRealized -= StartupSettingsExpander_BodyRealized;
+            LoadStartupSettings();
+            LoadHotkeySettings();
         }
 
         private void LoadGameDetectionSettings()
@@ -217,11 +229,6 @@ namespace HUDRA.Pages
             }
         }
 
-        private void LoadRtssSettings()
-        {
-            // RTSS settings are now loaded in LoadStartupSettings()
-        }
-
         private void UpdateMinimizeOnStartupState()
         {
             // Enable/disable based on admin status only - independent of startup toggle
@@ -240,7 +247,7 @@ namespace HUDRA.Pages
             _dpiService = dpiService;
             _gameProfileService = gameProfileService;
 
-            // Initialize the DefaultProfileControl with the GameProfileService
+            // Initialize the DefaultProfileControl with the GameProfileService (if its section was already opened)
             if (DefaultProfileControl != null)
             {
                 DefaultProfileControl.Initialize(gameProfileService);
@@ -269,6 +276,12 @@ namespace HUDRA.Pages
                 PowerProfileExpander.IsExpanded = _powerProfileExpanderExpanded;
             }
 
+            // Load Power Saver Expander state
+            if (PowerSaverExpander != null)
+            {
+                PowerSaverExpander.IsExpanded = _powerSaverExpanderExpanded;
+            }
+
             // Load Startup Settings Expander state
             if (StartupSettingsExpander != null)
             {
@@ -276,6 +289,9 @@ namespace HUDRA.Pages
             }
 
             // DefaultProfileControl handles its own summary display
+
+            // Collapsed sections build their bodies (and read settings, power plans, secure storage) only when opened
+            System.Diagnostics.Debug.WriteLine($"SettingsPage: Loaded - expander bodies: {NavigableExpander.DescribeBodies()}");
         }
 
         private void SettingsPage_Unloaded(object sender, RoutedEventArgs e)
@@ -298,6 +314,12 @@ namespace HUDRA.Pages
                 _powerProfileExpanderExpanded = PowerProfileExpander.IsExpanded;
             }
 
+            // Save Power Saver expander state
+            if (PowerSaverExpander != null)
+            {
+                _powerSaverExpanderExpanded = PowerSaverExpander.IsExpanded;
+            }
+
             // Save Startup Settings expander state
             if (StartupSettingsExpander != null)
             {
@@ -332,6 +354,12 @@ namespace HUDRA.Pages
                 _powerProfileExpanderExpanded = PowerProfileExpander.IsExpanded;
             }
 
+            // Save Power Saver expander state
+            if (PowerSaverExpander != null)
+            {
+                _powerSaverExpanderExpanded = PowerSaverExpander.IsExpanded;
+            }
+
             // Save Startup Settings expander state
             if (StartupSettingsExpander != null)
             {
@@ -341,32 +369,6 @@ namespace HUDRA.Pages
             _isInitialized = false;
         }
 
-        // Add this temporary method to your SettingsPage.xaml.cs for debugging
-        // Make sure you have: using System.IO; at the top of your file
-
-        private void DiagnoseStartupTask()
-        {
-
-            // Check if task exists
-            bool taskExists = StartupService.IsStartupEnabled();
-
-            // Get executable path
-            string exePath = StartupService.GetExecutablePath();
-
-            // Check if executable exists
-            bool exeExists = File.Exists(exePath);
-
-            // Get task details (without running it!)
-            if (taskExists)
-            {
-                string taskDetails = StartupService.GetTaskRunInfo(); // This just gets info, doesn't run
-            }
-
-            // Check admin status
-            bool isAdmin = StartupService.IsRunningAsAdmin();
-
-        }
-
         private void LoadHotkeySettings()
         {
             try
@@ -439,11 +441,6 @@ namespace HUDRA.Pages
             }
         }
 
-        private void LoadEnhancedScanningSettings()
-        {
-            // Enhanced library scanning settings are now loaded in LoadGameDetectionSettings()
-        }
-
         private async void EnhancedLibraryScanningToggle_Toggled(object sender, RoutedEventArgs e)
         {
             var toggle = sender as ToggleSwitch;
@@ -0,0 +1,388 @@
+using HUDRA.Models;
+using System;
+using System.Runtime.InteropServices;
+
+namespace HUDRA.Services.AMD
+{
+    /// <summary>
+    /// <see cref="IAdlx3DSettingsApi"/> over the ADLX runtime the AMD driver installs (amdadlx64.dll).
+    /// The bundled ADLX_3DSettings.dll only exports RSR, AFMF and Anti-Lag, so Chill, Boost and Image
+    /// Sharpening are reached through the ADLX interfaces themselves. Settings are global and go to the
+    /// first GPU, the iGPU on a handheld.
+    ///
+    /// The vtable slots below are transcribed from the SDK headers and have never been run against a real
+    /// AMD driver. Until they are checked on hardware the setters refuse to call into the driver (see
+    /// <see cref="WritesVerified"/>); a wrong slot there would call an arbitrary method with our arguments.
+    /// </summary>
+    public sealed unsafe class AdlxNative3DSettingsApi : IAdlx3DSettingsApi
+    {
+        private const string ADLX_DLL = "amdadlx64.dll";
+
+        // ADLX_RESULT values ADLX_SUCCEEDED accepts: OK, ALREADY_ENABLED, ALREADY_INITIALIZED
+        private const int ADLX_OK = 0;
+        private const int ADLX_ALREADY_INITIALIZED = 2;
+
+        // Vtable slots, in the order of the ADLX SDK C headers
+        private const int IADLXInterface_Release = 1;
+        private const int IADLXSystem_GetGPUs = 1;
+        private const int IADLXSystem_Get3DSettingsServices = 7;
+        private const int IADLXList_Size = 3;
+        private const int IADLXList_Begin = 5;
+        private const int IADLXGPUList_At = 11;
+        private const int IADLX3DSettingsServices_GetChill = 4;
+        private const int IADLX3DSettingsServices_GetBoost = 5;
+        private const int IADLX3DSettingsServices_GetImageSharpening = 6;
+
+        // IADLX3DChill (I3DSettings.h)
+        private const int Chill_IsSupported = 3;
+        private const int Chill_IsEnabled = 4;
+        private const int Chill_GetFpsRange = 5;
+        private const int Chill_GetMinFps = 6;
+        private const int Chill_GetMaxFps = 7;
+        private const int Chill_SetEnabled = 8;
+        private const int Chill_SetMinFps = 9;
+        private const int Chill_SetMaxFps = 10;
+
+        // IADLX3DBoost (I3DSettings.h); slots 5 and 6 are GetResolution and GetResolutionRange
+        private const int Boost_IsSupported = 3;
+        private const int Boost_IsEnabled = 4;
+        private const int Boost_SetEnabled = 7;
+
+        // IADLX3DImageSharpening (I3DSettings.h)
+        private const int Sharpening_IsSupported = 3;
+        private const int Sharpening_IsEnabled = 4;
+        private const int Sharpening_GetSharpness = 5;
+        private const int Sharpening_GetSharpnessRange = 6;
+        private const int Sharpening_SetEnabled = 7;
+        private const int Sharpening_SetSharpness = 8;
+
+        /// <summary>
+        /// False until the slots above have been checked on an AMD GPU. While false, every TrySet* returns
+        /// false without touching the driver, so per-game profiles capture these settings but don't apply them.
+        /// </summary>
+        private static bool WritesVerified => false;
+
+        [StructLayout(LayoutKind.Sequential)]
+        private struct AdlxIntRange
+        {
+            public int MinValue;
+            public int MaxValue;
+            public int Step;
+        }
+
+        private readonly object _lock = new();
+        private bool _initialized;
+
+        // Held for the life of the process, like ADLX's own helper does; never released
+        private IntPtr _services;
+        private IntPtr _gpu;
+
+        public bool TryGetChill(out RadeonChillState state)
+        {
+            state = default;
+            lock (_lock)
+            {
+                var chill = AcquireFeature(IADLX3DSettingsServices_GetChill, Chill_IsSupported);
+                if (chill == IntPtr.Zero)
+                    return false;
+
+                try
+                {
+                    if (!GetBool(chill, Chill_IsEnabled, out bool enabled) ||
+                        !GetInt(chill, Chill_GetMinFps, out int minFps) ||
+                        !GetInt(chill, Chill_GetMaxFps, out int maxFps))
+                        return false;
+
+                    state = new RadeonChillState(enabled, minFps, maxFps);
+                    return true;
+                }
+                finally
+                {
+                    Release(chill);
+                }
+            }
+        }
+
+        public bool TrySetChill(RadeonChillState state)
+        {
+            if (!WritesVerified)
+                return RefuseWrite("Chill");
+
+            lock (_lock)
+            {
+                var chill = AcquireFeature(IADLX3DSettingsServices_GetChill, Chill_IsSupported);
+                if (chill == IntPtr.Zero)
+                    return false;
+
+                try
+                {
+                    var range = GetRange(chill, Chill_GetFpsRange);
+                    int maxFps = ClampToRange(state.MaxFps, range);
+                    int minFps = Math.Min(ClampToRange(state.MinFps, range), maxFps);
+
+                    // Keep min ≤ max after each write; the driver rejects a crossed pair
+                    bool fpsSet = GetInt(chill, Chill_GetMaxFps, out int currentMax) && minFps > currentMax
+                        ? SetInt(chill, Chill_SetMaxFps, maxFps) && SetInt(chill, Chill_SetMinFps, minFps)
+                        : SetInt(chill, Chill_SetMinFps, minFps) && SetInt(chill, Chill_SetMaxFps, maxFps);
+
+                    if (!fpsSet)
+                        System.Diagnostics.Debug.WriteLine($"ADLX: Could not set Chill range {minFps}-{maxFps}");
+
+                    return SetBool(chill, Chill_SetEnabled, state.Enabled) && fpsSet;
+                }
+                finally
+                {
+                    Release(chill);
+                }
+            }
+        }
+
+        public bool TryGetBoost(out bool enabled)
+        {
+            enabled = false;
+            lock (_lock)
+            {
+                var boost = AcquireFeature(IADLX3DSettingsServices_GetBoost, Boost_IsSupported);
+                if (boost == IntPtr.Zero)
+                    return false;
+
+                try
+                {
+                    return GetBool(boost, Boost_IsEnabled, out enabled);
+                }
+                finally
+                {
+                    Release(boost);
+                }
+            }
+        }
+
+        public bool TrySetBoost(bool enabled)
+        {
+            if (!WritesVerified)
+                return RefuseWrite("Boost");
+
+            lock (_lock)
+            {
+                var boost = AcquireFeature(IADLX3DSettingsServices_GetBoost, Boost_IsSupported);
+                if (boost == IntPtr.Zero)
+                    return false;
+
+                try
+                {
+                    return SetBool(boost, Boost_SetEnabled, enabled);
+                }
+                finally
+                {
+                    Release(boost);
+                }
+            }
+        }
+
+        public bool TryGetImageSharpening(out RadeonSharpeningState state)
+        {
+            state = default;
+            lock (_lock)
+            {
+                var sharpening = AcquireFeature(IADLX3DSettingsServices_GetImageSharpening, Sharpening_IsSupported);
+                if (sharpening == IntPtr.Zero)
+                    return false;
+
+                try
+                {
+                    if (!GetBool(sharpening, Sharpening_IsEnabled, out bool enabled) ||
+                        !GetInt(sharpening, Sharpening_GetSharpness, out int sharpness))
+                        return false;
+
+                    state = new RadeonSharpeningState(enabled, sharpness);
+                    return true;
+                }
+                finally
+                {
+                    Release(sharpening);
+                }
+            }
+        }
+
+        public bool TrySetImageSharpening(RadeonSharpeningState state)
+        {
+            if (!WritesVerified)
+                return RefuseWrite("Image Sharpening");
+
+            lock (_lock)
+            {
+                var sharpening = AcquireFeature(IADLX3DSettingsServices_GetImageSharpening, Sharpening_IsSupported);
+                if (sharpening == IntPtr.Zero)
+                    return false;
+
+                try
+                {
+                    // Sharpness before enabling, same as RSR, so it takes effect immediately
+                    int sharpness = ClampToRange(state.Sharpness, GetRange(sharpening, Sharpening_GetSharpnessRange));
+                    bool sharpnessSet = SetInt(sharpening, Sharpening_SetSharpness, sharpness);
+                    if (!sharpnessSet)
+                        System.Diagnostics.Debug.WriteLine($"ADLX: Could not set sharpness {sharpness}");
+
+                    return SetBool(sharpening, Sharpening_SetEnabled, state.Enabled) && sharpnessSet;
+                }
+                finally
+                {
+                    Release(sharpening);
+                }
+            }
+        }
+
+        /// <summary>
+        /// The feature interface for the GPU if the driver supports it there, otherwise zero. Release it when done.
+        /// </summary>
+        private IntPtr AcquireFeature(int servicesSlot, int isSupportedSlot)
+        {
+            if (!EnsureInitialized())
+                return IntPtr.Zero;
+
+            IntPtr feature;
+            var getFeature = (delegate* unmanaged<IntPtr, IntPtr, IntPtr*, int>)Slot(_services, servicesSlot);
+            if (!Succeeded(getFeature(_services, _gpu, &feature)) || feature == IntPtr.Zero)
+                return IntPtr.Zero;
+
+            if (!GetBool(feature, isSupportedSlot, out bool supported) || !supported)
+            {
+                Release(feature);
+                return IntPtr.Zero;
+            }
+
+            return feature;
+        }
+
+        private bool EnsureInitialized()
+        {
+            if (_initialized)
+                return _services != IntPtr.Zero && _gpu != IntPtr.Zero;
+            _initialized = true;
+
+            try
+            {
+                if (!NativeLibrary.TryLoad(ADLX_DLL, out var library))
+                {
+                    System.Diagnostics.Debug.WriteLine("ADLX: Runtime not found, AMD driver not installed");
+                    return false;
+                }
+
+                if (!NativeLibrary.TryGetExport(library, "ADLXQueryFullVersion", out var queryVersionPtr) ||
+                    !NativeLibrary.TryGetExport(library, "ADLXInitialize", out var initializePtr))
+                {
+                    System.Diagnostics.Debug.WriteLine("ADLX: Runtime is missing its entry points");
+                    return false;
+                }
+
+                // Ask for the driver's own version so an older SDK header can't make it refuse
+                ulong version;
+                if (!Succeeded(((delegate* unmanaged<ulong*, int>)queryVersionPtr)(&version)))
+                    return false;
+
+                IntPtr system;
+                if (!Succeeded(((delegate* unmanaged<ulong, IntPtr*, int>)initializePtr)(version, &system)) || system == IntPtr.Zero)
+                {
+                    System.Diagnostics.Debug.WriteLine("ADLX: ADLXInitialize failed");
+                    return false;
+                }
+
+                IntPtr services;
+                var get3DSettingsServices = (delegate* unmanaged<IntPtr, IntPtr*, int>)Slot(system, IADLXSystem_Get3DSettingsServices);
+                if (!Succeeded(get3DSettingsServices(system, &services)) || services == IntPtr.Zero)
+                    return false;
+
+                IntPtr gpuList;
+                var getGpus = (delegate* unmanaged<IntPtr, IntPtr*, int>)Slot(system, IADLXSystem_GetGPUs);
+                if (!Succeeded(getGpus(system, &gpuList)) || gpuList == IntPtr.Zero)
+                {
+                    Release(services);
+                    return false;
+                }
+
+                try
+                {
+                    var size = (delegate* unmanaged<IntPtr, uint>)Slot(gpuList, IADLXList_Size);
+                    var begin = (delegate* unmanaged<IntPtr, uint>)Slot(gpuList, IADLXList_Begin);
+                    var at = (delegate* unmanaged<IntPtr, uint, IntPtr*, int>)Slot(gpuList, IADLXGPUList_At);
+
+                    IntPtr gpu;
+                    if (size(gpuList) == 0 || !Succeeded(at(gpuList, begin(gpuList), &gpu)) || gpu == IntPtr.Zero)
+                    {
+                        System.Diagnostics.Debug.WriteLine("ADLX: No GPU reported");
+                        Release(services);
+                        return false;
+                    }
+
+                    _services = services;
+                    _gpu = gpu;
+                }
+                finally
+                {
+                    Release(gpuList);
+                }
+
+                System.Diagnostics.Debug.WriteLine($"ADLX: 3D settings initialized (runtime {version >> 48}.{(version >> 32) & 0xFFFF})");
+                return true;
+            }
+            catch (Exception ex)
+            {
+                System.Diagnostics.Debug.WriteLine($"ADLX: Error initializing 3D settings: {ex.Message}");
+                return false;
+            }
+        }
+
+        private static bool RefuseWrite(string feature)
+        {
+            System.Diagnostics.Debug.WriteLine($"ADLX: Not applying {feature}, the vtable binding hasn't been verified on AMD hardware");
+            return false;
+        }
+
+        private static void* Slot(IntPtr instance, int index) => (*(void***)instance)[index];
+
+        private static bool Succeeded(int result) => result >= ADLX_OK && result <= ADLX_ALREADY_INITIALIZED;
+
+        private static void Release(IntPtr instance)
+        {
+            ((delegate* unmanaged<IntPtr, int>)Slot(instance, IADLXInterface_Release))(instance);
+        }
+
+        private static bool GetBool(IntPtr instance, int slot, out bool value)
+        {
+            byte result;
+            bool ok = Succeeded(((delegate* unmanaged<IntPtr, byte*, int>)Slot(instance, slot))(instance, &result));
+            value = ok && result != 0;
+            return ok;
+        }
+
+        private static bool SetBool(IntPtr instance, int slot, bool value)
+        {
+            return Succeeded(((delegate* unmanaged<IntPtr, byte, int>)Slot(instance, slot))(instance, value ? (byte)1 : (byte)0));
+        }
+
+        private static bool GetInt(IntPtr instance, int slot, out int value)
+        {
+            int result;
+            bool ok = Succeeded(((delegate* unmanaged<IntPtr, int*, int>)Slot(instance, slot))(instance, &result));
+            value = ok ? result : 0;
+            return ok;
+        }
+
+        private static bool SetInt(IntPtr instance, int slot, int value)
+        {
+            return Succeeded(((delegate* unmanaged<IntPtr, int, int>)Slot(instance, slot))(instance, value));
+        }
+
+        private static AdlxIntRange? GetRange(IntPtr feature, int slot)
+        {
+            AdlxIntRange range;
+            var getRange = (delegate* unmanaged<IntPtr, AdlxIntRange*, int>)Slot(feature, slot);
+            return Succeeded(getRange(feature, &range)) && range.MaxValue >= range.MinValue ? range : null;
+        }
+
+        private static int ClampToRange(int value, AdlxIntRange? range)
+        {
+            return range is { } r ? Math.Clamp(value, r.MinValue, r.MaxValue) : value;
+        }
+    }
+}
@@ -0,0 +1,20 @@
+using HUDRA.Models;
+
+namespace HUDRA.Services.AMD
+{
+    /// <summary>
+    /// ADLX 3D settings that game profiles change. Kept behind an interface so apply and revert can run
+    /// against a fake driver. TryGet returns false when the GPU or driver doesn't support the feature.
+    /// </summary>
+    public interface IAdlx3DSettingsApi
+    {
+        bool TryGetChill(out RadeonChillState state);
+        bool TrySetChill(RadeonChillState state);
+
+        bool TryGetBoost(out bool enabled);
+        bool TrySetBoost(bool enabled);
+
+        bool TryGetImageSharpening(out RadeonSharpeningState state);
+        bool TrySetImageSharpening(RadeonSharpeningState state);
+    }
+}
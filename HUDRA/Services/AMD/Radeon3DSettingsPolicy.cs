@@ -0,0 +1,65 @@
+using HUDRA.Models;
+using System;
+
+namespace HUDRA.Services.AMD
+{
+    /// <summary>
+    /// Pure resolution of a game profile's Radeon Chill, Boost and Image Sharpening settings against what
+    /// the driver currently has, and of what to write back on revert. No driver calls.
+    /// </summary>
+    public static class Radeon3DSettingsPolicy
+    {
+        /// <summary>
+        /// The features the profile changes, with the values to write. Features left at default, unsupported
+        /// (absent from current) or already as requested are null. Turning a feature off keeps its current
+        /// FPS range or sharpness so it comes back the same when turned on in the driver.
+        /// </summary>
+        public static Radeon3DSettingsSnapshot Resolve(GameProfile profile, Radeon3DSettingsSnapshot current)
+        {
+            var targets = new Radeon3DSettingsSnapshot();
+
+            if (profile.ChillEnabled.HasValue && current.Chill is { } chill)
+            {
+                var target = profile.ChillEnabled.Value
+                    ? new RadeonChillState(true,
+                        Math.Min(profile.ChillMinFps, profile.ChillMaxFps),
+                        Math.Max(profile.ChillMinFps, profile.ChillMaxFps))
+                    : chill with { Enabled = false };
+                if (target != chill)
+                    targets.Chill = target;
+            }
+
+            if (profile.RadeonBoostEnabled.HasValue && current.BoostEnabled is { } boost &&
+                boost != profile.RadeonBoostEnabled.Value)
+            {
+                targets.BoostEnabled = profile.RadeonBoostEnabled.Value;
+            }
+
+            if (profile.ImageSharpeningEnabled.HasValue && current.ImageSharpening is { } sharpening)
+            {
+                var target = profile.ImageSharpeningEnabled.Value
+                    ? new RadeonSharpeningState(true, Math.Clamp(profile.ImageSharpness, 0, 100))
+                    : sharpening with { Enabled = false };
+                if (target != sharpening)
+                    targets.ImageSharpening = target;
+            }
+
+            return targets;
+        }
+
+        /// <summary>
+        /// What to write back after a game: for each feature the profile changed, the revert target's value
+        /// (a saved Default Profile, or the capture taken before the profile) if it has one, otherwise the
+        /// value from before the write.
+        /// </summary>
+        public static Radeon3DSettingsSnapshot ResolveRevert(Radeon3DSettingsSnapshot changed, Radeon3DSettingsSnapshot? revertTarget)
+        {
+            return new Radeon3DSettingsSnapshot
+            {
+                Chill = changed.Chill.HasValue ? revertTarget?.Chill ?? changed.Chill : null,
+                BoostEnabled = changed.BoostEnabled.HasValue ? revertTarget?.BoostEnabled ?? changed.BoostEnabled : null,
+                ImageSharpening = changed.ImageSharpening.HasValue ? revertTarget?.ImageSharpening ?? changed.ImageSharpening : null
+            };
+        }
+    }
+}
@@ -0,0 +1,122 @@
+using HUDRA.Models;
+using System.Collections.Generic;
+
+namespace HUDRA.Services.AMD
+{
+    /// <summary>
+    /// Applies per-game Radeon Chill, Boost and Image Sharpening through ADLX, and writes the previous
+    /// values back. Each feature is read before it's written, so a revert touches only what was changed.
+    /// </summary>
+    public sealed class Radeon3DSettingsService
+    {
+        private readonly IAdlx3DSettingsApi _api;
+
+        public Radeon3DSettingsService() : this(new AdlxNative3DSettingsApi())
+        {
+        }
+
+        public Radeon3DSettingsService(IAdlx3DSettingsApi api)
+        {
+            _api = api;
+        }
+
+        /// <summary>
+        /// Every feature the driver reports; unsupported ones are left null.
+        /// </summary>
+        public Radeon3DSettingsSnapshot Capture()
+        {
+            var snapshot = new Radeon3DSettingsSnapshot();
+            if (_api.TryGetChill(out var chill))
+                snapshot.Chill = chill;
+            if (_api.TryGetBoost(out bool boost))
+                snapshot.BoostEnabled = boost;
+            if (_api.TryGetImageSharpening(out var sharpening))
+                snapshot.ImageSharpening = sharpening;
+            return snapshot;
+        }
+
+        /// <summary>
+        /// Writes the profile's settings. Restore holds the previous value of everything that may have
+        /// changed, null if nothing did.
+        /// </summary>
+        public (bool Success, Radeon3DSettingsSnapshot? Restore, string Message) Apply(GameProfile profile)
+        {
+            var current = Capture();
+            var failed = new List<string>();
+
+            if (profile.ChillEnabled.HasValue && current.Chill == null)
+                failed.Add("Chill unsupported");
+            if (profile.RadeonBoostEnabled.HasValue && current.BoostEnabled == null)
+                failed.Add("Boost unsupported");
+            if (profile.ImageSharpeningEnabled.HasValue && current.ImageSharpening == null)
+                failed.Add("Sharpening unsupported");
+
+            var targets = Radeon3DSettingsPolicy.Resolve(profile, current);
+            var restore = new Radeon3DSettingsSnapshot();
+            var applied = new List<string>();
+
+            // Previous value recorded before each write, so a partial write is still put back
+            if (targets.Chill is { } chill)
+            {
+                restore.Chill = current.Chill;
+                if (_api.TrySetChill(chill))
+                    applied.Add(chill.Enabled ? $"Chill {chill.MinFps}-{chill.MaxFps} FPS" : "Chill off");
+                else
+                    failed.Add("Chill");
+            }
+
+            if (targets.BoostEnabled is { } boost)
+            {
+                restore.BoostEnabled = current.BoostEnabled;
+                if (_api.TrySetBoost(boost))
+                    applied.Add(boost ? "Boost on" : "Boost off");
+                else
+                    failed.Add("Boost");
+            }
+
+            if (targets.ImageSharpening is { } sharpening)
+            {
+                restore.ImageSharpening = current.ImageSharpening;
+                if (_api.TrySetImageSharpening(sharpening))
+                    applied.Add(sharpening.Enabled ? $"Sharpening {sharpening.Sharpness}%" : "Sharpening off");
+                else
+                    failed.Add("Sharpening");
+            }
+
+            string message = failed.Count > 0
+                ? $"Failed: {string.Join(", ", failed)}"
+                : applied.Count > 0 ? string.Join(", ", applied) : "Already set";
+            System.Diagnostics.Debug.WriteLine($"Radeon3D: {message}");
+
+            return (failed.Count == 0, restore.IsEmpty ? null : restore, message);
+        }
+
+        /// <summary>
+        /// Writes back every feature present in the snapshot.
+        /// </summary>
+        public bool Restore(Radeon3DSettingsSnapshot snapshot)
+        {
+            bool success = true;
+
+            if (snapshot.Chill is { } chill && !_api.TrySetChill(chill))
+            {
+                System.Diagnostics.Debug.WriteLine("Radeon3D: Could not restore Chill");
+                success = false;
+            }
+
+            if (snapshot.BoostEnabled is { } boost && !_api.TrySetBoost(boost))
+            {
+                System.Diagnostics.Debug.WriteLine("Radeon3D: Could not restore Boost");
+                success = false;
+            }
+
+            if (snapshot.ImageSharpening is { } sharpening && !_api.TrySetImageSharpening(sharpening))
+            {
+                System.Diagnostics.Debug.WriteLine("Radeon3D: Could not restore Image Sharpening");
+                success = false;
+            }
+
+            return success;
+        }
+    }
+}
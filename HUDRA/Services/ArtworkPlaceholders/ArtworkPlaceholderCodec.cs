@@ -0,0 +1,373 @@
+using System;
+using System.Diagnostics.CodeAnalysis;
+
+namespace HUDRA.Services.ArtworkPlaceholders
+{
+    /// <summary>
+    /// Encodes an image as a tiny blurred placeholder string and decodes it back to pixels (the BlurHash scheme:
+    /// a few DCT components in linear light, base-83 encoded). 4x3 components give a 28-character string that
+    /// keeps the artwork's layout of light and color. Also picks a dominant color for the tile background.
+    /// Pixels are 32-bit BGRA, matching what Windows imaging decoders produce. Pure and thread-safe.
+    /// </summary>
+    public static class ArtworkPlaceholderCodec
+    {
+        public const int DefaultComponentsX = 4;
+        public const int DefaultComponentsY = 3;
+
+        private const string Base83Chars = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz#$%*+,-.:;=?@[]^_{|}~";
+
+        private static readonly float[] SrgbToLinearTable = BuildSrgbToLinearTable();
+        private const int LinearTableSize = 4096; // Decode-side lookup; within 1/255 of the exact curve
+        private static readonly byte[] LinearToSrgbTable = BuildLinearToSrgbTable();
+        private static readonly sbyte[] Base83Values = BuildBase83Values();
+
+        private const int HistogramBins = 4096; // 4 bits per channel
+        private const int MaxDominantColorPixels = int.MaxValue / 255; // Keeps a bin's channel sum within int
+
+        [ThreadStatic] private static int[]? _histogramCounts;
+        [ThreadStatic] private static int[]? _histogramSums;
+
+        /// <summary>
+        /// Encoded length for the given component counts (1 size + 1 max AC + 4 DC + 2 per AC component).
+        /// </summary>
+        public static int GetEncodedLength(int componentsX, int componentsY) => 4 + 2 * componentsX * componentsY;
+
+        public static string Encode(ReadOnlySpan<byte> bgra, int width, int height, int stride,
+            int componentsX = DefaultComponentsX, int componentsY = DefaultComponentsY)
+        {
+            if (componentsX < 1 || componentsX > 9) throw new ArgumentOutOfRangeException(nameof(componentsX));
+            if (componentsY < 1 || componentsY > 9) throw new ArgumentOutOfRangeException(nameof(componentsY));
+            if (width < 1 || height < 1) throw new ArgumentOutOfRangeException(nameof(width));
+            if (stride < width * 4 || bgra.Length < stride * (height - 1) + width * 4)
+                throw new ArgumentException("Pixel buffer is smaller than width/height/stride", nameof(bgra));
+
+            // Basis functions are separable: cos(pi*i*x/w) * cos(pi*j*y/h)
+            var cosX = BuildCosineTable(componentsX, width);
+            var cosY = BuildCosineTable(componentsY, height);
+
+            int count = componentsX * componentsY;
+            Span<float> factors = stackalloc float[count * 3];
+            factors.Clear();
+
+            // Row sums first: for each row and horizontal component, sum the linear colors along the row
+            Span<float> rowSums = stackalloc float[componentsX * 3];
+            for (int y = 0; y < height; y++)
+            {
+                rowSums.Clear();
+                var row = bgra.Slice(y * stride, width * 4);
+                for (int x = 0; x < width; x++)
+                {
+                    float b = SrgbToLinearTable[row[x * 4]];
+                    float g = SrgbToLinearTable[row[x * 4 + 1]];
+                    float r = SrgbToLinearTable[row[x * 4 + 2]];
+                    for (int i = 0; i < componentsX; i++)
+                    {
+                        float basis = cosX[i * width + x];
+                        rowSums[i * 3] += basis * r;
+                        rowSums[i * 3 + 1] += basis * g;
+                        rowSums[i * 3 + 2] += basis * b;
+                    }
+                }
+
+                for (int j = 0; j < componentsY; j++)
+                {
+                    float basis = cosY[j * height + y];
+                    for (int i = 0; i < componentsX; i++)
+                    {
+                        int f = (j * componentsX + i) * 3;
+                        factors[f] += basis * rowSums[i * 3];
+                        factors[f + 1] += basis * rowSums[i * 3 + 1];
+                        factors[f + 2] += basis * rowSums[i * 3 + 2];
+                    }
+                }
+            }
+
+            float dcScale = 1f / (width * height);
+            float acScale = 2f / (width * height);
+            for (int c = 0; c < count; c++)
+            {
+                float scale = c == 0 ? dcScale : acScale;
+                factors[c * 3] *= scale;
+                factors[c * 3 + 1] *= scale;
+                factors[c * 3 + 2] *= scale;
+            }
+
+            Span<char> hash = stackalloc char[GetEncodedLength(componentsX, componentsY)];
+            int position = 0;
+
+            WriteBase83((componentsX - 1) + (componentsY - 1) * 9, 1, hash, ref position);
+
+            float maximumValue = 1f;
+            if (count > 1)
+            {
+                float actualMaximum = 0f;
+                for (int k = 3; k < count * 3; k++)
+                    actualMaximum = Math.Max(actualMaximum, Math.Abs(factors[k]));
+
+                int quantisedMaximum = Math.Clamp((int)MathF.Floor(actualMaximum * 166f - 0.5f), 0, 82);
+                maximumValue = (quantisedMaximum + 1) / 166f;
+                WriteBase83(quantisedMaximum, 1, hash, ref position);
+            }
+            else
+            {
+                WriteBase83(0, 1, hash, ref position);
+            }
+
+            int dc = (LinearToSrgb(factors[0]) << 16) | (LinearToSrgb(factors[1]) << 8) | LinearToSrgb(factors[2]);
+            WriteBase83(dc, 4, hash, ref position);
+
+            for (int c = 1; c < count; c++)
+            {
+                int quantR = QuantiseAc(factors[c * 3] / maximumValue);
+                int quantG = QuantiseAc(factors[c * 3 + 1] / maximumValue);
+                int quantB = QuantiseAc(factors[c * 3 + 2] / maximumValue);
+                WriteBase83(quantR * 19 * 19 + quantG * 19 + quantB, 2, hash, ref position);
+            }
+
+            return new string(hash);
+        }
+
+        public static bool IsValid([NotNullWhen(true)] string? hash)
+        {
+            if (string.IsNullOrEmpty(hash) || hash.Length < 6) return false;
+            if (!TryReadBase83(hash.AsSpan(0, 1), out int sizeFlag)) return false;
+
+            int componentsX = sizeFlag % 9 + 1;
+            int componentsY = sizeFlag / 9 + 1;
+            if (hash.Length != GetEncodedLength(componentsX, componentsY)) return false;
+
+            foreach (char c in hash)
+            {
+                if (c >= Base83Values.Length || Base83Values[c] < 0) return false;
+            }
+            return true;
+        }
+
+        /// <summary>
+        /// Renders <paramref name="hash"/> into a BGRA buffer of width*height*4 bytes (opaque).
+        /// Returns false for an invalid hash.
+        /// </summary>
+        public static bool TryDecode(string? hash, int width, int height, Span<byte> bgra)
+        {
+            if (width < 1 || height < 1 || bgra.Length < width * height * 4 || !IsValid(hash))
+                return false;
+
+            TryReadBase83(hash.AsSpan(0, 1), out int sizeFlag);
+            int componentsX = sizeFlag % 9 + 1;
+            int componentsY = sizeFlag / 9 + 1;
+            int count = componentsX * componentsY;
+
+            TryReadBase83(hash.AsSpan(1, 1), out int quantisedMaximum);
+            float maximumValue = (quantisedMaximum + 1) / 166f;
+
+            Span<float> colors = stackalloc float[count * 3];
+            TryReadBase83(hash.AsSpan(2, 4), out int dc);
+            colors[0] = SrgbToLinearTable[(dc >> 16) & 0xFF];
+            colors[1] = SrgbToLinearTable[(dc >> 8) & 0xFF];
+            colors[2] = SrgbToLinearTable[dc & 0xFF];
+
+            for (int c = 1; c < count; c++)
+            {
+                TryReadBase83(hash.AsSpan(4 + c * 2, 2), out int ac);
+                colors[c * 3] = SignedSquare((ac / (19 * 19) - 9) / 9f) * maximumValue;
+                colors[c * 3 + 1] = SignedSquare((ac / 19 % 19 - 9) / 9f) * maximumValue;
+                colors[c * 3 + 2] = SignedSquare((ac % 19 - 9) / 9f) * maximumValue;
+            }
+
+            var cosX = BuildCosineTable(componentsX, width);
+            var cosY = BuildCosineTable(componentsY, height);
+
+            // Separable like the encoder: collapse the vertical components per row, then sum horizontally
+            Span<float> rowColors = stackalloc float[componentsX * 3];
+            for (int y = 0; y < height; y++)
+            {
+                rowColors.Clear();
+                for (int j = 0; j < componentsY; j++)
+                {
+                    float basisY = cosY[j * height + y];
+                    for (int i = 0; i < componentsX; i++)
+                    {
+                        int c = (j * componentsX + i) * 3;
+                        rowColors[i * 3] += colors[c] * basisY;
+                        rowColors[i * 3 + 1] += colors[c + 1] * basisY;
+                        rowColors[i * 3 + 2] += colors[c + 2] * basisY;
+                    }
+                }
+
+                for (int x = 0; x < width; x++)
+                {
+                    float r = 0, g = 0, b = 0;
+                    for (int i = 0; i < componentsX; i++)
+                    {
+                        float basis = cosX[i * width + x];
+                        r += rowColors[i * 3] * basis;
+                        g += rowColors[i * 3 + 1] * basis;
+                        b += rowColors[i * 3 + 2] * basis;
+                    }
+
+                    int p = (y * width + x) * 4;
+                    bgra[p] = LinearToSrgbFast(b);
+                    bgra[p + 1] = LinearToSrgbFast(g);
+                    bgra[p + 2] = LinearToSrgbFast(r);
+                    bgra[p + 3] = 255;
+                }
+            }
+
+            return true;
+        }
+
+        /// <summary>
+        /// Most common color (0xRRGGBB): pixels are binned at 4 bits per channel and the fullest bin's average
+        /// is returned, so a large flat background wins over a busy foreground. Mostly transparent pixels are ignored.
+        /// </summary>
+        public static int GetDominantColor(ReadOnlySpan<byte> bgra, int width, int height, int stride)
+        {
+            if ((long)width * height > MaxDominantColorPixels)
+                throw new ArgumentOutOfRangeException(nameof(width), "Sample the image down before picking a dominant color");
+            if (width < 1 || height < 1 || stride < width * 4 || bgra.Length < stride * (height - 1) + width * 4)
+                throw new ArgumentException("Pixel buffer is smaller than width/height/stride", nameof(bgra));
+
+            // Reused per thread rather than allocated per tile (a 96 KB long[] of sums landed on the LOH every call)
+            var counts = _histogramCounts ??= new int[HistogramBins];
+            var sums = _histogramSums ??= new int[HistogramBins * 3];
+            Array.Clear(counts);
+            Array.Clear(sums);
+
+            for (int y = 0; y < height; y++)
+            {
+                var row = bgra.Slice(y * stride, width * 4);
+                for (int x = 0; x < width; x++)
+                {
+                    int p = x * 4;
+                    if (row[p + 3] < 128) continue;
+
+                    int b = row[p], g = row[p + 1], r = row[p + 2];
+                    int bin = ((r >> 4) << 8) | ((g >> 4) << 4) | (b >> 4);
+                    counts[bin]++;
+                    sums[bin * 3] += r;
+                    sums[bin * 3 + 1] += g;
+                    sums[bin * 3 + 2] += b;
+                }
+            }
+
+            int best = -1;
+            for (int bin = 0; bin < counts.Length; bin++)
+            {
+                if (counts[bin] > 0 && (best < 0 || counts[bin] > counts[best]))
+                    best = bin;
+            }
+
+            if (best < 0) return 0;
+
+            int n = counts[best];
+            int red = sums[best * 3] / n;
+            int green = sums[best * 3 + 1] / n;
+            int blue = sums[best * 3 + 2] / n;
+            return (red << 16) | (green << 8) | blue;
+        }
+
+        public static string FormatColor(int rgb) => $"#{rgb & 0xFFFFFF:X6}";
+
+        public static bool TryParseColor(string? text, out byte r, out byte g, out byte b)
+        {
+            r = g = b = 0;
+            if (string.IsNullOrEmpty(text) || text.Length != 7 || text[0] != '#' ||
+                !int.TryParse(text.AsSpan(1), System.Globalization.NumberStyles.HexNumber, null, out int rgb))
+            {
+                return false;
+            }
+
+            r = (byte)(rgb >> 16);
+            g = (byte)(rgb >> 8);
+            b = (byte)rgb;
+            return true;
+        }
+
+        private static float[] BuildCosineTable(int components, int size)
+        {
+            var table = new float[components * size];
+            for (int i = 0; i < components; i++)
+            {
+                for (int x = 0; x < size; x++)
+                {
+                    table[i * size + x] = MathF.Cos(MathF.PI * i * x / size);
+                }
+            }
+            return table;
+        }
+
+        private static int QuantiseAc(float value)
+        {
+            return Math.Clamp((int)MathF.Floor(SignedSqrt(value) * 9f + 9.5f), 0, 18);
+        }
+
+        private static float SignedSqrt(float value) => MathF.CopySign(MathF.Sqrt(Math.Abs(value)), value);
+
+        private static float SignedSquare(float value) => MathF.CopySign(value * value, value);
+
+        private static int LinearToSrgb(float value)
+        {
+            float v = Math.Clamp(value, 0f, 1f);
+            float srgb = v <= 0.0031308f ? v * 12.92f : 1.055f * MathF.Pow(v, 1f / 2.4f) - 0.055f;
+            return (int)(srgb * 255f + 0.5f);
+        }
+
+        private static byte LinearToSrgbFast(float value)
+        {
+            return LinearToSrgbTable[(int)(Math.Clamp(value, 0f, 1f) * LinearTableSize + 0.5f)];
+        }
+
+        private static byte[] BuildLinearToSrgbTable()
+        {
+            var table = new byte[LinearTableSize + 1];
+            for (int i = 0; i < table.Length; i++)
+            {
+                table[i] = (byte)LinearToSrgb((float)i / LinearTableSize);
+            }
+            return table;
+        }
+
+        private static float[] BuildSrgbToLinearTable()
+        {
+            var table = new float[256];
+            for (int i = 0; i < table.Length; i++)
+            {
+                float v = i / 255f;
+                table[i] = v <= 0.04045f ? v / 12.92f : MathF.Pow((v + 0.055f) / 1.055f, 2.4f);
+            }
+            return table;
+        }
+
+        private static sbyte[] BuildBase83Values()
+        {
+            var values = new sbyte[128];
+            Array.Fill(values, (sbyte)-1);
+            for (int i = 0; i < Base83Chars.Length; i++)
+            {
+                values[Base83Chars[i]] = (sbyte)i;
+            }
+            return values;
+        }
+
+        private static void WriteBase83(int value, int length, Span<char> destination, ref int position)
+        {
+            for (int i = length - 1; i >= 0; i--)
+            {
+                destination[position + i] = Base83Chars[value % 83];
+                value /= 83;
+            }
+            position += length;
+        }
+
+        private static bool TryReadBase83(ReadOnlySpan<char> text, out int value)
+        {
+            value = 0;
+            foreach (char c in text)
+            {
+                if (c >= Base83Values.Length || Base83Values[c] < 0) return false;
+                value = value * 83 + Base83Values[c];
+            }
+            return true;
+        }
+    }
+}
@@ -0,0 +1,144 @@
+using HUDRA.Models;
+using Microsoft.UI.Xaml.Media;
+using Microsoft.UI.Xaml.Media.Imaging;
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using System.Runtime.InteropServices.WindowsRuntime;
+using System.Threading.Tasks;
+using Windows.Graphics.Imaging;
+
+namespace HUDRA.Services.ArtworkPlaceholders
+{
+    /// <summary>
+    /// Computes a game's artwork placeholder and dominant color when its artwork is saved, and turns the stored
+    /// placeholder back into a small bitmap for library tiles to show while the real artwork decodes.
+    /// </summary>
+    public static class ArtworkPlaceholderService
+    {
+        // Analysis size: plenty for 4x3 components and a color histogram, and cheap for the decoder to scale to
+        private const uint SampleWidth = 32;
+
+        // Tiles are 125x82; the blur is upscaled by the Image control
+        public const int PlaceholderWidth = 32;
+        public const int PlaceholderHeight = 21;
+
+        // A few screens of tiles; scrolling further back decodes again, which takes microseconds
+        private const int MaxCachedBitmaps = 64;
+
+        private static readonly LruCache<string, WriteableBitmap> _bitmapCache = new(MaxCachedBitmaps, StringComparer.Ordinal);
+
+        /// <summary>
+        /// Decodes the game's artwork at low resolution and stores its placeholder and dominant color on the game.
+        /// Clears both if the artwork is missing or can't be decoded. Doesn't save the game.
+        /// </summary>
+        public static async Task<bool> UpdateAsync(DetectedGame game)
+        {
+            var artworkPath = StripQuery(game.ArtworkPath);
+            if (string.IsNullOrEmpty(artworkPath) || !File.Exists(artworkPath))
+            {
+                game.ArtworkPlaceholder = null;
+                game.ArtworkColor = null;
+                return false;
+            }
+
+            try
+            {
+                using var file = new FileStream(artworkPath, FileMode.Open, FileAccess.Read, FileShare.Read);
+                var decoder = await BitmapDecoder.CreateAsync(file.AsRandomAccessStream());
+
+                uint width = Math.Min(SampleWidth, decoder.OrientedPixelWidth);
+                uint height = Math.Max(1, (uint)Math.Round((double)decoder.OrientedPixelHeight * width / decoder.OrientedPixelWidth));
+
+                var transform = new BitmapTransform
+                {
+                    ScaledWidth = width,
+                    ScaledHeight = height,
+                    InterpolationMode = BitmapInterpolationMode.Fant
+                };
+
+                var pixelData = await decoder.GetPixelDataAsync(
+                    BitmapPixelFormat.Bgra8,
+                    BitmapAlphaMode.Straight,
+                    transform,
+                    ExifOrientationMode.RespectExifOrientation,
+                    ColorManagementMode.ColorManageToSRgb);
+
+                var pixels = pixelData.DetachPixelData();
+                int stride = (int)width * 4;
+
+                game.ArtworkPlaceholder = ArtworkPlaceholderCodec.Encode(pixels, (int)width, (int)height, stride);
+                game.ArtworkColor = ArtworkPlaceholderCodec.FormatColor(
+                    ArtworkPlaceholderCodec.GetDominantColor(pixels, (int)width, (int)height, stride));
+                return true;
+            }
+            catch (Exception ex)
+            {
+                System.Diagnostics.Debug.WriteLine($"ArtworkPlaceholder: Failed to analyze artwork for {game.DisplayName}: {ex.Message}");
+                game.ArtworkPlaceholder = null;
+                game.ArtworkColor = null;
+                return false;
+            }
+        }
+
+        /// <summary>
+        /// Fills in placeholders for games that have artwork but no placeholder yet (existing libraries, fallback art).
+        /// </summary>
+        public static async Task UpdateMissingAsync(IEnumerable<DetectedGame> games, EnhancedGameDatabase database)
+        {
+            var pending = games
+                .Where(g => !string.IsNullOrEmpty(g.ArtworkPath) && !ArtworkPlaceholderCodec.IsValid(g.ArtworkPlaceholder))
+                .ToList();
+            if (pending.Count == 0) return;
+
+            var stopwatch = System.Diagnostics.Stopwatch.StartNew();
+            int updated = 0;
+            foreach (var game in pending)
+            {
+                if (await UpdateAsync(game))
+                {
+                    database.SaveGame(game);
+                    updated++;
+                }
+            }
+
+            System.Diagnostics.Debug.WriteLine($"ArtworkPlaceholder: Computed {updated}/{pending.Count} placeholders in {stopwatch.ElapsedMilliseconds}ms");
+        }
+
+        /// <summary>
+        /// Bitmap for a stored placeholder, or null if there is none. Must be called on the UI thread;
+        /// bitmaps are shared between tiles with the same placeholder, and the most recently used are kept.
+        /// </summary>
+        public static ImageSource? GetPlaceholderImage(string? placeholder)
+        {
+            if (!ArtworkPlaceholderCodec.IsValid(placeholder))
+                return null;
+
+            if (_bitmapCache.TryGetValue(placeholder, out var cached))
+                return cached;
+
+            var pixels = new byte[PlaceholderWidth * PlaceholderHeight * 4];
+            if (!ArtworkPlaceholderCodec.TryDecode(placeholder, PlaceholderWidth, PlaceholderHeight, pixels))
+                return null;
+
+            var bitmap = new WriteableBitmap(PlaceholderWidth, PlaceholderHeight);
+            using (var stream = bitmap.PixelBuffer.AsStream())
+            {
+                stream.Write(pixels, 0, pixels.Length);
+            }
+            bitmap.Invalidate();
+
+            _bitmapCache.Set(placeholder, bitmap);
+            return bitmap;
+        }
+
+        private static string? StripQuery(string? path)
+        {
+            // Library tiles append "?t=..." to bust the Image cache
+            if (string.IsNullOrEmpty(path)) return path;
+            int query = path.IndexOf('?');
+            return query >= 0 ? path.Substring(0, query) : path;
+        }
+    }
+}
@@ -0,0 +1,69 @@
+using System;
+using System.Collections.Generic;
+
+namespace HUDRA.Services.ArtworkPlaceholders
+{
+    /// <summary>
+    /// Fixed-capacity map that evicts the least recently used entry when full. Not thread-safe.
+    /// </summary>
+    public sealed class LruCache<TKey, TValue> where TKey : notnull
+    {
+        private readonly Dictionary<TKey, LinkedListNode<KeyValuePair<TKey, TValue>>> _entries;
+        private readonly LinkedList<KeyValuePair<TKey, TValue>> _order = new(); // Most recent first
+
+        public int Capacity { get; }
+
+        public int Count => _entries.Count;
+
+        public LruCache(int capacity, IEqualityComparer<TKey>? comparer = null)
+        {
+            if (capacity < 1) throw new ArgumentOutOfRangeException(nameof(capacity));
+            Capacity = capacity;
+            _entries = new Dictionary<TKey, LinkedListNode<KeyValuePair<TKey, TValue>>>(capacity, comparer);
+        }
+
+        /// <summary>
+        /// Looks up <paramref name="key"/> and marks it most recently used.
+        /// </summary>
+        public bool TryGetValue(TKey key, out TValue value)
+        {
+            if (_entries.TryGetValue(key, out var node))
+            {
+                _order.Remove(node);
+                _order.AddFirst(node);
+                value = node.Value.Value;
+                return true;
+            }
+
+            value = default!;
+            return false;
+        }
+
+        /// <summary>
+        /// Adds or replaces <paramref name="key"/> as the most recently used entry, evicting the least
+        /// recently used one if the cache is full.
+        /// </summary>
+        public void Set(TKey key, TValue value)
+        {
+            if (_entries.TryGetValue(key, out var existing))
+            {
+                _order.Remove(existing);
+                _entries.Remove(key);
+            }
+            else if (_entries.Count >= Capacity)
+            {
+                var last = _order.Last!;
+                _order.RemoveLast();
+                _entries.Remove(last.Value.Key);
+            }
+
+            _entries[key] = _order.AddFirst(new KeyValuePair<TKey, TValue>(key, value));
+        }
+
+        public void Clear()
+        {
+            _entries.Clear();
+            _order.Clear();
+        }
+    }
+}
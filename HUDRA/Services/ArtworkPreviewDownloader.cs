@@ -0,0 +1,134 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using System.Linq;
+using System.Net.Http;
+using System.Runtime.CompilerServices;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace HUDRA.Services
+{
+    /// <summary>
+    /// One image to fetch: where it comes from, where it goes, and its position in the caller's list.
+    /// </summary>
+    public readonly record struct ArtworkDownload(int Index, Uri Url, string FilePath);
+
+    /// <summary>
+    /// Downloads a set of images with bounded concurrency and yields each one as soon as it is on disk,
+    /// in completion order. Failed downloads are skipped. If the consumer stops early or cancels, in-flight
+    /// downloads are cancelled and any file that was not handed out is deleted.
+    /// </summary>
+    public sealed class ArtworkPreviewDownloader
+    {
+        private readonly HttpClient _httpClient;
+        private readonly int _maxConcurrency;
+
+        /// <summary>
+        /// Time from start until the first image was ready, for the most recent run.
+        /// </summary>
+        public TimeSpan? LastTimeToFirstResult { get; private set; }
+        public TimeSpan? LastTotalTime { get; private set; }
+
+        public ArtworkPreviewDownloader(HttpClient httpClient, int maxConcurrency = 4)
+        {
+            if (maxConcurrency < 1) throw new ArgumentOutOfRangeException(nameof(maxConcurrency));
+            _httpClient = httpClient ?? throw new ArgumentNullException(nameof(httpClient));
+            _maxConcurrency = maxConcurrency;
+        }
+
+        public async IAsyncEnumerable<ArtworkDownload> DownloadAsync(
+            IReadOnlyList<ArtworkDownload> downloads,
+            [EnumeratorCancellation] CancellationToken cancellationToken = default)
+        {
+            LastTimeToFirstResult = null;
+            LastTotalTime = null;
+            if (downloads.Count == 0) yield break;
+
+            var stopwatch = Stopwatch.StartNew();
+            using var linked = CancellationTokenSource.CreateLinkedTokenSource(cancellationToken);
+            using var throttle = new SemaphoreSlim(_maxConcurrency);
+            var pending = downloads.Select(d => DownloadOneAsync(d, throttle, linked.Token)).ToList();
+
+            try
+            {
+                while (pending.Count > 0)
+                {
+                    var completed = await Task.WhenAny(pending).ConfigureAwait(false);
+                    pending.Remove(completed);
+
+                    var result = await completed.ConfigureAwait(false);
+                    if (result == null) continue;
+
+                    LastTimeToFirstResult ??= stopwatch.Elapsed;
+                    yield return result.Value;
+                }
+
+                LastTotalTime = stopwatch.Elapsed;
+            }
+            finally
+            {
+                // Consumer stopped early, cancelled, or a download threw: nobody will claim the rest
+                linked.Cancel();
+                foreach (var task in pending)
+                {
+                    try
+                    {
+                        var orphan = await task.ConfigureAwait(false);
+                        if (orphan != null) TryDelete(orphan.Value.FilePath);
+                    }
+                    catch (OperationCanceledException)
+                    {
+                    }
+                }
+            }
+        }
+
+        private async Task<ArtworkDownload?> DownloadOneAsync(
+            ArtworkDownload download, SemaphoreSlim throttle, CancellationToken cancellationToken)
+        {
+            await throttle.WaitAsync(cancellationToken).ConfigureAwait(false);
+            try
+            {
+                using var response = await _httpClient.GetAsync(
+                    download.Url, HttpCompletionOption.ResponseHeadersRead, cancellationToken).ConfigureAwait(false);
+                response.EnsureSuccessStatusCode();
+
+                await using (var file = new FileStream(download.FilePath, FileMode.Create, FileAccess.Write,
+                    FileShare.None, bufferSize: 81920, useAsync: true))
+                {
+                    await response.Content.CopyToAsync(file, cancellationToken).ConfigureAwait(false);
+                }
+
+                return download;
+            }
+            catch (OperationCanceledException)
+            {
+                TryDelete(download.FilePath);
+                throw;
+            }
+            catch (Exception ex)
+            {
+                Debug.WriteLine($"ArtworkPreviewDownloader: Failed to download {download.Url}: {ex.Message}");
+                TryDelete(download.FilePath);
+                return null;
+            }
+            finally
+            {
+                throttle.Release();
+            }
+        }
+
+        private static void TryDelete(string path)
+        {
+            try
+            {
+                if (File.Exists(path)) File.Delete(path);
+            }
+            catch
+            {
+            }
+        }
+    }
+}
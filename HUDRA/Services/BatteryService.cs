@@ -1,7 +1,13 @@
 using HUDRA.Configuration;
+using HUDRA.Extensions;
+using HUDRA.Services.Power;
+using HUDRA.Services.SessionHistory;
 using Microsoft.UI.Dispatching;
 using Microsoft.UI.Xaml;
 using System;
+using System.Collections.Generic;
+using System.Threading;
+using System.Threading.Tasks;
 using Windows.System.Power;
 
 namespace HUDRA.Services
@@ -12,14 +18,26 @@ namespace HUDRA.Services
         public bool IsCharging { get; set; }
         public bool OnAc { get; set; }
         public TimeSpan RemainingDischargeTime { get; set; }
+
+        // From the drain estimator; NaN/null until it has seen a discharging reading
+        public double RemainingCapacityWh { get; set; } = double.NaN;
+        public double DischargeWatts { get; set; } = double.NaN;
+        public TimeSpan? EstimatedRemaining { get; set; }
     }
 
     public class BatteryService : IDisposable
     {
         private readonly DispatcherQueue _dispatcher;
         private readonly DispatcherTimer _timer;
+        private readonly BatteryDrainEstimator _estimator = new();
+        private readonly object _estimatorLock = new object();
+        private volatile TdpDrainModel _drainModel = TdpDrainModel.Empty;
+        private int _drainModelVersion;
         private bool _disposed;
 
+        // How far back a game's history is used to fit its drain model
+        private static readonly TimeSpan DrainModelHistory = TimeSpan.FromDays(90);
+
         public BatteryInfo CurrentInfo { get; private set; } = new BatteryInfo();
 
         public event EventHandler<BatteryInfo>? BatteryInfoUpdated;
@@ -56,15 +74,113 @@ namespace HUDRA.Services
             bool isCharging = batteryStatus == BatteryStatus.Charging;
             bool onAc = supplyStatus == PowerSupplyStatus.Adequate || isCharging;
 
+            var reading = ReadBatteryReport();
+            double smoothedWatts;
+            TimeSpan? estimate;
+            lock (_estimatorLock)
+            {
+                // A charging or idle-on-AC reading resets the estimate itself
+                _estimator.Add(reading);
+                smoothedWatts = _estimator.SmoothedWatts;
+                estimate = _estimator.EstimateRemaining(reading.RemainingWh);
+            }
+
             CurrentInfo = new BatteryInfo
             {
                 Percent = percent,
                 IsCharging = isCharging,
                 OnAc = onAc,
-                RemainingDischargeTime = remaining
+                RemainingDischargeTime = remaining,
+                RemainingCapacityWh = reading.RemainingWh,
+                DischargeWatts = smoothedWatts,
+                EstimatedRemaining = onAc ? null : estimate
+            };
+
+            _dispatcher.TryEnqueueLatest("BatteryInfo", () => BatteryInfoUpdated?.Invoke(this, CurrentInfo));
+        }
+
+        internal static BatteryReading ReadBatteryReport()
+        {
+            var reading = BatteryReading.Empty(DateTimeOffset.UtcNow.ToUnixTimeMilliseconds());
+            try
+            {
+                var report = Windows.Devices.Power.Battery.AggregateBattery.GetReport();
+                return reading with
+                {
+                    RemainingWh = report.RemainingCapacityInMilliwattHours is int mwh ? mwh / 1000.0 : double.NaN,
+                    // Windows reports a negative charge rate while discharging
+                    DischargeWatts = report.ChargeRateInMilliwatts is int rate ? -rate / 1000.0 : double.NaN
+                };
+            }
+            catch (Exception ex)
+            {
+                System.Diagnostics.Debug.WriteLine($"Battery report failed: {ex.Message}");
+                return reading;
+            }
+        }
+
+        /// <summary>
+        /// Feeds a telemetry sample (package power alongside battery discharge) into the drain estimate.
+        /// Thread-safe; called from the session recorder's timer.
+        /// </summary>
+        public void AddTelemetry(in SessionSample sample)
+        {
+            if (_disposed || float.IsNaN(sample.BatteryDischargeWatts)) return;
+
+            var reading = BatteryReading.Empty(sample.TimestampMs) with
+            {
+                DischargeWatts = sample.BatteryDischargeWatts,
+                PackagePowerWatts = sample.PackagePowerWatts
             };
 
-            _dispatcher.TryEnqueue(() => BatteryInfoUpdated?.Invoke(this, CurrentInfo));
+            lock (_estimatorLock)
+            {
+                _estimator.Add(reading);
+            }
+        }
+
+        /// <summary>
+        /// Fits the drain-by-TDP model from a game's recorded history on a background thread, then
+        /// republishes battery info so predictions appear.
+        /// </summary>
+        public void LoadDrainModel(SessionHistoryStore store, string gameKey)
+        {
+            int version = Interlocked.Increment(ref _drainModelVersion);
+            _ = Task.Run(() =>
+            {
+                try
+                {
+                    var now = DateTime.UtcNow;
+                    var model = TdpDrainModel.Fit(store.GetSamples(gameKey, now - DrainModelHistory, now));
+                    if (version != Volatile.Read(ref _drainModelVersion)) return;
+
+                    _drainModel = model;
+                    System.Diagnostics.Debug.WriteLine($"Battery drain model for {gameKey}: {model.MeasuredSteps.Count} measured TDP steps");
+                    _dispatcher.TryEnqueueLatest("BatteryInfo", () => BatteryInfoUpdated?.Invoke(this, CurrentInfo));
+                }
+                catch (Exception ex)
+                {
+                    System.Diagnostics.Debug.WriteLine($"Failed to load battery drain model: {ex.Message}");
+                }
+            });
+        }
+
+        public void ClearDrainModel()
+        {
+            Interlocked.Increment(ref _drainModelVersion);
+            _drainModel = TdpDrainModel.Empty;
+        }
+
+        /// <summary>
+        /// Predicted playtime on the remaining charge at each TDP step, from the current game's history.
+        /// Empty when no game history is loaded.
+        /// </summary>
+        public List<TdpPlaytime> PredictPlaytime(IEnumerable<int> tdpSteps)
+        {
+            var model = _drainModel;
+            return model.HasData
+                ? model.Predict(tdpSteps, CurrentInfo.RemainingCapacityWh)
+                : new List<TdpPlaytime>();
         }
 
         public void Dispose()
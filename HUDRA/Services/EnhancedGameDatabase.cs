@@ -1,7 +1,9 @@
 using HUDRA.Models;
 using System;
+using System.Collections;
 using System.Collections.Concurrent;
 using System.Collections.Generic;
+using System.Diagnostics.CodeAnalysis;
 using System.IO;
 using System.Linq;
 using System.Text.Json;
@@ -20,6 +22,9 @@ namespace HUDRA.Services
         private readonly string _databasePath;
         private readonly SemaphoreSlim _fileLock = new(1, 1);
         private ConcurrentDictionary<string, DetectedGame> _games = new(StringComparer.OrdinalIgnoreCase);
+        private GameView? _view;
+
+        internal ConcurrentDictionary<string, DetectedGame> Store => _games;
         private bool _disposed = false;
         private bool _isDirty = false;
         private readonly Timer _autoSaveTimer;
@@ -75,9 +80,15 @@ namespace HUDRA.Services
 
                 if (games != null)
                 {
-                    _games = new ConcurrentDictionary<string, DetectedGame>(
-                        games.Where(g => g != null && !string.IsNullOrEmpty(g.ProcessName))
-                             .ToDictionary(g => g.ProcessName, g => g, StringComparer.OrdinalIgnoreCase));
+                    // Sized up front so a large library loads without rehashing or an intermediate dictionary
+                    var loaded = new ConcurrentDictionary<string, DetectedGame>(
+                        Environment.ProcessorCount, games.Count, StringComparer.OrdinalIgnoreCase);
+                    foreach (var game in games)
+                    {
+                        if (game != null && !string.IsNullOrEmpty(game.ProcessName))
+                            loaded[game.ProcessName] = game;
+                    }
+                    _games = loaded;
                 }
 
                 System.Diagnostics.Debug.WriteLine($"Loaded {_games.Count} games from {_databasePath}");
@@ -240,6 +251,12 @@ namespace HUDRA.Services
             }
         }
 
+        /// <summary>
+        /// Live read-only view of the library, keyed by process name. This store is the only copy of the
+        /// games; callers read through the view instead of building their own dictionaries.
+        /// </summary>
+        public IReadOnlyDictionary<string, DetectedGame> Games => _view ??= new GameView(this);
+
         public DetectedGame? GetGame(string processName)
         {
             if (_disposed) return null;
@@ -443,6 +460,49 @@ namespace HUDRA.Services
         #endregion
     }
 
+    /// <summary>
+    /// Read-only view over the database's dictionary. Enumerating Values walks the live dictionary instead of
+    /// taking the snapshot copy ConcurrentDictionary.Values makes, so per-process lookups stay allocation-free.
+    /// </summary>
+    internal sealed class GameView : IReadOnlyDictionary<string, DetectedGame>
+    {
+        private readonly EnhancedGameDatabase _database;
+
+        public GameView(EnhancedGameDatabase database)
+        {
+            _database = database;
+        }
+
+        private ConcurrentDictionary<string, DetectedGame> Store => _database.Store;
+
+        public DetectedGame this[string key] => Store[key];
+        public int Count => Store.Count;
+
+        public IEnumerable<string> Keys
+        {
+            get
+            {
+                foreach (var entry in Store) yield return entry.Key;
+            }
+        }
+
+        public IEnumerable<DetectedGame> Values
+        {
+            get
+            {
+                foreach (var entry in Store) yield return entry.Value;
+            }
+        }
+
+        public bool ContainsKey(string key) => Store.ContainsKey(key);
+
+        public bool TryGetValue(string key, [MaybeNullWhen(false)] out DetectedGame value) => Store.TryGetValue(key, out value);
+
+        public IEnumerator<KeyValuePair<string, DetectedGame>> GetEnumerator() => Store.GetEnumerator();
+
+        IEnumerator IEnumerable.GetEnumerator() => GetEnumerator();
+    }
+
     /// <summary>
     /// Database statistics - unchanged from LiteDB implementation.
     /// </summary>
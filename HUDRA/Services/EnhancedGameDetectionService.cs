@@ -1,5 +1,11 @@
+using HUDRA.Extensions;
 using HUDRA.Models;
+using HUDRA.Services.ArtworkPlaceholders;
 using HUDRA.Services.GameLibraryProviders;
+using HUDRA.Services.LibraryWatch;
+using HUDRA.Services.Power;
+using HUDRA.Services.Scheduling;
+using HUDRA.Services.TitleMatching;
 using Microsoft.UI.Dispatching;
 using System;
 using System.Collections.Generic;
@@ -12,21 +18,40 @@ using System.Threading.Tasks;
 
 namespace HUDRA.Services
 {
-    public class EnhancedGameDetectionService : IDisposable
+    public class EnhancedGameDetectionService : IDisposable, IGameFocusSource
     {
         private readonly DispatcherQueue _dispatcher;
+
+        // Scan status goes through the coalescing UI queue: artwork downloads report per game, and only the
+        // newest text is worth a UI pass. Separate keys keep state/ready transitions from replacing progress.
+        private const string ScanProgressKey = "GameScan.Progress";
+        private const string ScanningStateKey = "GameScan.State";
+        private const string DatabaseReadyKey = "GameScan.DatabaseReady";
+
+        private readonly TitleMatcher _titleMatcher = new TitleMatcher();
+
+        // While manifest watchers cover installs and uninstalls, the periodic full scan is only a safety net
+        private const int WatchedRefreshIntervalMultiplier = 4;
+
+        private readonly GameLauncherConfigService _launcherConfigService = new GameLauncherConfigService();
+        private LibraryManifestWatcher? _manifestWatcher;
+        private readonly SemaphoreSlim _manifestUpdateLock = new SemaphoreSlim(1, 1);
+
         private readonly List<IGameLibraryProvider> _providers;
         private Timer? _refreshTimer;
         private readonly Timer _detectionTimer;
         private readonly EnhancedGameDatabase _gameDatabase;
         private SteamGridDbArtworkService? _artworkService;
 
-        private Dictionary<string, DetectedGame> _cachedGames = new(StringComparer.OrdinalIgnoreCase);
+        // Read-only view of the database's store while the library is active; empty when enhanced scanning is off
+        private static readonly IReadOnlyDictionary<string, DetectedGame> EmptyLibrary = new Dictionary<string, DetectedGame>();
+        private IReadOnlyDictionary<string, DetectedGame> _library = EmptyLibrary;
         private GameInfo? _currentGame;
         private bool _disposed = false;
         private bool _isDatabaseReady = false;
         private bool _isScanning = false;
         private bool _isMonitoringActiveGame = false; // Flag to pause expensive process scanning when game is running
+        private IReadOnlyList<ProcessSnapshot> _lastProcessSnapshot = Array.Empty<ProcessSnapshot>();
         
 
         // Enhanced scanning properties and events
@@ -41,12 +66,18 @@ namespace HUDRA.Services
         public GameInfo? CurrentGame => _currentGame;
         public bool IsGameDatabaseReady => _isDatabaseReady;
         public bool IsScanning => _isScanning;
-        public int GameDatabaseCount => _cachedGames.Count;
+        public int GameDatabaseCount => _library.Count;
         public DatabaseStats DatabaseStats => _gameDatabase?.GetDatabaseStats() ?? new DatabaseStats();
         public bool IsEnhancedScanningActive => IsEnhancedScanningEnabled();
         public EnhancedGameDatabase Database => _gameDatabase;
         public bool HasArtworkService => _artworkService != null;
 
+        /// <summary>
+        /// Process table captured by the last full detection scan (the scan that found the current game).
+        /// Lets game-start actions pick candidates without enumerating processes again.
+        /// </summary>
+        public IReadOnlyList<ProcessSnapshot> LastProcessSnapshot => _lastProcessSnapshot;
+
         /// <summary>
         /// Initializes the artwork service with the user's API key.
         /// Call this after the user configures their SGDB API key.
@@ -114,7 +145,7 @@ namespace HUDRA.Services
 
         private void OnProviderProgressChanged(object? sender, string progress)
         {
-            _dispatcher.TryEnqueue(() => ScanProgressChanged?.Invoke(this, progress));
+            _dispatcher.TryEnqueueLatest(ScanProgressKey, () => ScanProgressChanged?.Invoke(this, progress));
         }
 
         private async Task BuildGameDatabaseAsync()
@@ -124,16 +155,16 @@ namespace HUDRA.Services
             try
             {
                 _isScanning = true;
-                _dispatcher.TryEnqueue(() => ScanningStateChanged?.Invoke(this, true));
+                _dispatcher.TryEnqueueLatest(ScanningStateKey, () => ScanningStateChanged?.Invoke(this, true));
                 
-                _dispatcher.TryEnqueue(() => ScanProgressChanged?.Invoke(this, "Loading existing game database..."));
+                _dispatcher.TryEnqueueLatest(ScanProgressKey, () => ScanProgressChanged?.Invoke(this, "Loading existing game database..."));
 
                 // Load existing games from persistent database (async to avoid blocking UI)
                 var allExistingGames = await _gameDatabase.GetAllGamesAsync();
                 var existingGames = allExistingGames.ToDictionary(g => g.ProcessName, StringComparer.OrdinalIgnoreCase);
                 var newGames = new Dictionary<string, DetectedGame>(StringComparer.OrdinalIgnoreCase);
 
-                _dispatcher.TryEnqueue(() => ScanProgressChanged?.Invoke(this, $"Found {existingGames.Count} existing games, scanning for new games..."));
+                _dispatcher.TryEnqueueLatest(ScanProgressKey, () => ScanProgressChanged?.Invoke(this, $"Found {existingGames.Count} existing games, scanning for new games..."));
 
                 // Scan providers for new games - each provider runs independently
                 var availableProviders = _providers.Where(p => p.IsAvailable).ToList();
@@ -156,6 +187,7 @@ namespace HUDRA.Services
 
                 // Collect all currently found games from providers
                 var currentlyFoundGames = new Dictionary<string, DetectedGame>(StringComparer.OrdinalIgnoreCase);
+                var gamesByInstallLocation = CrossProviderDuplicates.BuildInstallLocationIndex(existingGames.Values);
 
                 foreach (var result in providerResults)
                 {
@@ -177,7 +209,15 @@ namespace HUDRA.Services
 
                             if (!existingGames.ContainsKey(kvp.Key) && !newGames.ContainsKey(kvp.Key))
                             {
+                                var duplicate = CrossProviderDuplicates.Find(_titleMatcher, kvp.Value, gamesByInstallLocation);
+                                if (duplicate != null)
+                                {
+                                    System.Diagnostics.Debug.WriteLine($"Enhanced: Skipping {kvp.Value.Source} entry '{kvp.Value.DisplayName}' ({kvp.Key}) - same game as {duplicate.Source} entry '{duplicate.DisplayName}' ({duplicate.ProcessName})");
+                                    continue;
+                                }
+
                                 newGames[kvp.Key] = kvp.Value;
+                                CrossProviderDuplicates.AddToInstallLocationIndex(gamesByInstallLocation, kvp.Value);
                             }
                         }
                     }
@@ -197,7 +237,7 @@ namespace HUDRA.Services
 
                 if (manualGamesToRemove.Any())
                 {
-                    _dispatcher.TryEnqueue(() => ScanProgressChanged?.Invoke(this, $"Removing {manualGamesToRemove.Count} manual games with missing executables..."));
+                    _dispatcher.TryEnqueueLatest(ScanProgressKey, () => ScanProgressChanged?.Invoke(this, $"Removing {manualGamesToRemove.Count} manual games with missing executables..."));
 
                     foreach (var game in manualGamesToRemove)
                     {
@@ -218,7 +258,7 @@ namespace HUDRA.Services
 
                 if (gamesToRemove.Any())
                 {
-                    _dispatcher.TryEnqueue(() => ScanProgressChanged?.Invoke(this, $"Removing {gamesToRemove.Count} uninstalled games from database..."));
+                    _dispatcher.TryEnqueueLatest(ScanProgressKey, () => ScanProgressChanged?.Invoke(this, $"Removing {gamesToRemove.Count} uninstalled games from database..."));
 
                     foreach (var game in gamesToRemove)
                     {
@@ -230,7 +270,7 @@ namespace HUDRA.Services
                 // Save new games to database and add to learning inclusion list
                 if (newGames.Any())
                 {
-                    _dispatcher.TryEnqueue(() => ScanProgressChanged?.Invoke(this, $"Saving {newGames.Count} new games to database..."));
+                    _dispatcher.TryEnqueueLatest(ScanProgressKey, () => ScanProgressChanged?.Invoke(this, $"Saving {newGames.Count} new games to database..."));
 
                     foreach (var game in newGames.Values)
                     {
@@ -246,7 +286,7 @@ namespace HUDRA.Services
 
                 if (existingGamesToUpdate.Any())
                 {
-                    _dispatcher.TryEnqueue(() => ScanProgressChanged?.Invoke(this, $"Updating {existingGamesToUpdate.Count} existing games..."));
+                    _dispatcher.TryEnqueueLatest(ScanProgressKey, () => ScanProgressChanged?.Invoke(this, $"Updating {existingGamesToUpdate.Count} existing games..."));
 
                     foreach (var game in existingGamesToUpdate)
                     {
@@ -255,33 +295,28 @@ namespace HUDRA.Services
                     }
                 }
 
-                // Build in-memory cache from all games (existing + new)
-                var allGames = await _gameDatabase.GetAllGamesAsync();
-                _cachedGames = allGames.ToDictionary(g => g.ProcessName, StringComparer.OrdinalIgnoreCase);
+                // The database's store is the library; no separate in-memory copy to rebuild
+                _library = _gameDatabase.Games;
 
                 _isDatabaseReady = true;
 
                 // Download artwork for games that don't have it yet (or only have fallback)
-                System.Diagnostics.Debug.WriteLine($"EnhancedGameDetection: Checking artwork service - HasService: {_artworkService != null}, GameCount: {_cachedGames.Count}");
-                if (_artworkService != null && _cachedGames.Any())
+                System.Diagnostics.Debug.WriteLine($"EnhancedGameDetection: Checking artwork service - HasService: {_artworkService != null}, GameCount: {_library.Count}");
+                if (_artworkService != null && _library.Any())
                 {
-                    var gamesNeedingArtwork = _cachedGames.Values.Where(g =>
+                    var gamesNeedingArtwork = _library.Values.Where(g =>
                         string.IsNullOrEmpty(g.ArtworkPath) ||
                         g.ArtworkPath.EndsWith("no-artwork-grid.png", StringComparison.OrdinalIgnoreCase)).ToList();
                     System.Diagnostics.Debug.WriteLine($"EnhancedGameDetection: Games needing artwork: {gamesNeedingArtwork.Count}");
                     if (gamesNeedingArtwork.Any())
                     {
-                        _dispatcher.TryEnqueue(() => ScanProgressChanged?.Invoke(this, $"Downloading artwork for {gamesNeedingArtwork.Count} games..."));
+                        _dispatcher.TryEnqueueLatest(ScanProgressKey, () => ScanProgressChanged?.Invoke(this, $"Downloading artwork for {gamesNeedingArtwork.Count} games..."));
                         await _artworkService.DownloadArtworkForGamesAsync(
                             gamesNeedingArtwork,
                             _gameDatabase,
-                            progress => _dispatcher.TryEnqueue(() => ScanProgressChanged?.Invoke(this, progress)),
+                            progress => _dispatcher.TryEnqueueLatest(ScanProgressKey, () => ScanProgressChanged?.Invoke(this, progress)),
                             forceDownload: true  // Force re-download for games with fallback artwork
                         );
-
-                        // Reload cache after artwork update
-                        allGames = await _gameDatabase.GetAllGamesAsync();
-                        _cachedGames = allGames.ToDictionary(g => g.ProcessName, StringComparer.OrdinalIgnoreCase);
                     }
                 }
                 else
@@ -292,26 +327,30 @@ namespace HUDRA.Services
                 // Ensure fallback artwork exists and assign to games without artwork
                 await EnsureFallbackArtworkAsync();
 
-                _dispatcher.TryEnqueue(() =>
+                // Tile placeholders for artwork saved before placeholders existed, or assigned above
+                await ArtworkPlaceholderService.UpdateMissingAsync(_library.Values, _gameDatabase);
+
+                // Same queue as the progress text so a stale progress update can't land after the summary
+                _dispatcher.TryEnqueueLatest(ScanProgressKey, () =>
                 {
-                    var statusParts = new List<string> { $"{_cachedGames.Count} games in database" };
+                    var statusParts = new List<string> { $"{_library.Count} games in database" };
                     if (newGames.Any()) statusParts.Add($"{newGames.Count} new");
                     if (totalGamesToRemove.Any()) statusParts.Add($"{totalGamesToRemove.Count} removed");
 
                     ScanProgressChanged?.Invoke(this, $"Scan complete - {string.Join(", ", statusParts)}");
-                    DatabaseReady?.Invoke(this, EventArgs.Empty);
                 });
+                _dispatcher.TryEnqueueLatest(DatabaseReadyKey, () => DatabaseReady?.Invoke(this, EventArgs.Empty));
 
             }
             catch (Exception ex)
             {
                 System.Diagnostics.Debug.WriteLine($"Error building game database: {ex.Message}");
-                _dispatcher.TryEnqueue(() => ScanProgressChanged?.Invoke(this, "Database build failed"));
+                _dispatcher.TryEnqueueLatest(ScanProgressKey, () => ScanProgressChanged?.Invoke(this, "Database build failed"));
             }
             finally
             {
                 _isScanning = false;
-                _dispatcher.TryEnqueue(() => ScanningStateChanged?.Invoke(this, false));
+                _dispatcher.TryEnqueueLatest(ScanningStateKey, () => ScanningStateChanged?.Invoke(this, false));
             }
         }
 
@@ -355,11 +394,11 @@ namespace HUDRA.Services
                 }
 
                 // Find games without artwork and assign fallback
-                var gamesWithoutArtwork = _cachedGames.Values.Where(g => string.IsNullOrEmpty(g.ArtworkPath)).ToList();
+                var gamesWithoutArtwork = _library.Values.Where(g => string.IsNullOrEmpty(g.ArtworkPath)).ToList();
 
                 if (gamesWithoutArtwork.Any())
                 {
-                    _dispatcher.TryEnqueue(() => ScanProgressChanged?.Invoke(this, $"Assigning fallback artwork to {gamesWithoutArtwork.Count} games..."));
+                    _dispatcher.TryEnqueueLatest(ScanProgressKey, () => ScanProgressChanged?.Invoke(this, $"Assigning fallback artwork to {gamesWithoutArtwork.Count} games..."));
 
                     foreach (var game in gamesWithoutArtwork)
                     {
@@ -367,10 +406,6 @@ namespace HUDRA.Services
                         _gameDatabase.SaveGame(game);
                         System.Diagnostics.Debug.WriteLine($"EnhancedGameDetection: Assigned fallback artwork to: {game.DisplayName}");
                     }
-
-                    // Reload cache after updating artwork paths
-                    var allGames = await _gameDatabase.GetAllGamesAsync();
-                    _cachedGames = allGames.ToDictionary(g => g.ProcessName, StringComparer.OrdinalIgnoreCase);
                 }
             }
             catch (Exception ex)
@@ -397,6 +432,13 @@ namespace HUDRA.Services
 
             // Clear all provider caches to force fresh detection
             // This is essential for detecting newly installed games
+            ClearProviderCaches();
+
+            await BuildGameDatabaseAsync();
+        }
+
+        private void ClearProviderCaches()
+        {
             foreach (var provider in _providers)
             {
                 try
@@ -408,10 +450,285 @@ namespace HUDRA.Services
                     System.Diagnostics.Debug.WriteLine($"EnhancedGameDetection: Error clearing cache for {provider.ProviderName}: {ex.Message}");
                 }
             }
+        }
 
-            await BuildGameDatabaseAsync();
+        #region Manifest watching
+
+        private void StartManifestWatcher()
+        {
+            StopManifestWatcher();
+
+            try
+            {
+                var watcher = new LibraryManifestWatcher();
+                watcher.ManifestsChanged += OnManifestsChanged;
+                watcher.WatchLost += OnManifestWatchLost;
+                watcher.Start(_launcherConfigService.GetAllGameLibraryPaths());
+                _manifestWatcher = watcher;
+            }
+            catch (Exception ex)
+            {
+                System.Diagnostics.Debug.WriteLine($"EnhancedGameDetection: Manifest watching unavailable, relying on periodic refresh: {ex.Message}");
+            }
+        }
+
+        private void StopManifestWatcher()
+        {
+            var watcher = _manifestWatcher;
+            _manifestWatcher = null;
+            if (watcher == null) return;
+
+            watcher.ManifestsChanged -= OnManifestsChanged;
+            watcher.WatchLost -= OnManifestWatchLost;
+            watcher.Dispose();
+        }
+
+        private void OnManifestWatchLost(object? sender, EventArgs e)
+        {
+            // Events may have been dropped; only a full scan can tell what changed
+            _ = Task.Run(RescanLibraryAsync);
+        }
+
+        private void OnManifestsChanged(object? sender, IReadOnlyList<ManifestChange> changes)
+        {
+            _ = Task.Run(() => ApplyManifestChangesAsync(changes));
+        }
+
+        /// <summary>
+        /// Re-reads only the manifests that changed and adds, updates or removes their games. Changes that
+        /// can't be resolved from the manifest alone (new Steam library, generic folder) fall back to a full rescan.
+        /// </summary>
+        private async Task ApplyManifestChangesAsync(IReadOnlyList<ManifestChange> changes)
+        {
+            if (_disposed || !IsEnhancedScanningEnabled()) return;
+
+            await _manifestUpdateLock.WaitAsync();
+            try
+            {
+                // A full scan in progress reads the same manifests; apply on top of its result
+                while (_isScanning && !_disposed)
+                {
+                    await Task.Delay(TimeSpan.FromSeconds(1));
+                }
+                if (_disposed) return;
+
+                var stopwatch = Stopwatch.StartNew();
+                var addedGames = new List<DetectedGame>();
+                int removedCount = 0;
+                bool needsFullRescan = false;
+
+                var existingGames = (await _gameDatabase.GetAllGamesAsync()).ToList();
+
+                foreach (var change in changes)
+                {
+                    System.Diagnostics.Debug.WriteLine($"EnhancedGameDetection: Manifest changed ({change.Kind}): {change.Path}");
+
+                    switch (change.Kind)
+                    {
+                        case ManifestKind.SteamApp:
+                            needsFullRescan |= !ApplySteamManifest(change.Path, existingGames, addedGames, ref removedCount);
+                            break;
+                        case ManifestKind.EpicItem:
+                            needsFullRescan |= !ApplyEpicManifest(change.Path, existingGames, addedGames, ref removedCount);
+                            break;
+                        default:
+                            needsFullRescan = true;
+                            break;
+                    }
+                }
+
+                System.Diagnostics.Debug.WriteLine($"EnhancedGameDetection: Applied {changes.Count} manifest change(s) in {stopwatch.ElapsedMilliseconds}ms - {addedGames.Count} added/updated, {removedCount} removed, full rescan: {needsFullRescan}");
+
+                if (needsFullRescan)
+                {
+                    await RescanLibraryAsync();
+                    return;
+                }
+
+                if (addedGames.Count == 0 && removedCount == 0)
+                    return;
+
+                // Provider caches now predate the library; the next periodic scan must not undo this update
+                ClearProviderCaches();
+
+                _library = _gameDatabase.Games;
+
+                var gamesNeedingArtwork = addedGames.Where(g => string.IsNullOrEmpty(g.ArtworkPath)).ToList();
+                if (_artworkService != null && gamesNeedingArtwork.Any())
+                {
+                    await _artworkService.DownloadArtworkForGamesAsync(gamesNeedingArtwork, _gameDatabase);
+                }
+
+                await EnsureFallbackArtworkAsync();
+                await ArtworkPlaceholderService.UpdateMissingAsync(_library.Values, _gameDatabase);
+
+                _dispatcher.TryEnqueueLatest(ScanProgressKey, () =>
+                {
+                    var statusParts = new List<string> { $"{_library.Count} games in database" };
+                    if (addedGames.Any()) statusParts.Add($"{addedGames.Count} updated");
+                    if (removedCount > 0) statusParts.Add($"{removedCount} removed");
+
+                    ScanProgressChanged?.Invoke(this, $"Library updated - {string.Join(", ", statusParts)}");
+                });
+                _dispatcher.TryEnqueueLatest(DatabaseReadyKey, () => DatabaseReady?.Invoke(this, EventArgs.Empty));
+            }
+            catch (Exception ex)
+            {
+                System.Diagnostics.Debug.WriteLine($"EnhancedGameDetection: Error applying manifest changes: {ex.Message}");
+            }
+            finally
+            {
+                _manifestUpdateLock.Release();
+            }
+        }
+
+        /// <summary>
+        /// Returns false when the manifest can't be turned into a game on its own and a full scan is needed.
+        /// </summary>
+        private bool ApplySteamManifest(string path, List<DetectedGame> existingGames, List<DetectedGame> addedGames, ref int removedCount)
+        {
+            var appId = LauncherManifests.GetSteamAppId(path);
+            if (appId == null) return true;
+
+            if (!File.Exists(path))
+            {
+                // Uninstalled: Steam deletes the manifest along with the game folder
+                removedCount += RemoveGames(existingGames, g => g.Source == GameSource.Steam && g.PackageInfo == appId);
+                return true;
+            }
+
+            var manifest = LauncherManifests.ReadSteamAppManifest(path);
+            if (manifest == null || !manifest.IsFullyInstalled)
+                return true; // Download/update in progress; the final write raises another change
+
+            var resolver = GameLibNetProvider.SteamLaunchResolver;
+            resolver.Prepare(null, new[] { (manifest.AppId, manifest.InstallDir) });
+            if (!resolver.TryGetExecutable(manifest.AppId, out var relativeExecutable))
+                return false;
+
+            var executablePath = Path.Combine(manifest.InstallDir, relativeExecutable);
+            if (!File.Exists(executablePath))
+                return false;
+
+            var game = new DetectedGame
+            {
+                ProcessName = Path.GetFileNameWithoutExtension(executablePath),
+                DisplayName = !string.IsNullOrWhiteSpace(manifest.Name) ? manifest.Name : Path.GetFileNameWithoutExtension(executablePath),
+                ExecutablePath = executablePath,
+                InstallLocation = manifest.InstallDir,
+                Source = GameSource.Steam,
+                LauncherInfo = $"steam://rungameid/{manifest.AppId}",
+                PackageInfo = manifest.AppId,
+                LastDetected = DateTime.Now
+            };
+
+            UpsertGame(game, existingGames, addedGames,
+                g => g.Source == GameSource.Steam && g.PackageInfo == manifest.AppId);
+            return true;
+        }
+
+        private bool ApplyEpicManifest(string path, List<DetectedGame> existingGames, List<DetectedGame> addedGames, ref int removedCount)
+        {
+            if (!File.Exists(path))
+            {
+                // The deleted manifest can't say which game it was; drop Epic games whose executable is gone
+                removedCount += RemoveGames(existingGames, g => g.Source == GameSource.Epic &&
+                    !string.IsNullOrEmpty(g.ExecutablePath) && !File.Exists(g.ExecutablePath));
+                return true;
+            }
+
+            var manifest = LauncherManifests.ReadEpicManifest(path);
+            if (manifest == null || manifest.IsIncompleteInstall || manifest.IsAddOn)
+                return true;
+
+            if (string.IsNullOrWhiteSpace(manifest.InstallLocation) || string.IsNullOrWhiteSpace(manifest.LaunchExecutable))
+                return false;
+
+            var executablePath = Path.Combine(manifest.InstallLocation, manifest.LaunchExecutable);
+            if (!File.Exists(executablePath))
+                return false;
+
+            var game = new DetectedGame
+            {
+                ProcessName = Path.GetFileNameWithoutExtension(executablePath),
+                DisplayName = !string.IsNullOrWhiteSpace(manifest.DisplayName) ? manifest.DisplayName : Path.GetFileNameWithoutExtension(executablePath),
+                ExecutablePath = executablePath,
+                InstallLocation = manifest.InstallLocation,
+                Source = GameSource.Epic,
+                LauncherInfo = $"com.epicgames.launcher://apps/{manifest.AppName}?action=launch&silent=true",
+                PackageInfo = manifest.AppName,
+                LastDetected = DateTime.Now
+            };
+
+            var installLocation = CrossProviderDuplicates.NormalizeInstallLocation(manifest.InstallLocation);
+            UpsertGame(game, existingGames, addedGames,
+                g => g.Source == GameSource.Epic &&
+                     string.Equals(CrossProviderDuplicates.NormalizeInstallLocation(g.InstallLocation), installLocation, StringComparison.OrdinalIgnoreCase));
+            return true;
         }
 
+        /// <summary>
+        /// Saves a game parsed from a manifest. An existing entry for the same app keeps its artwork, profile,
+        /// launch info and first-detected date, even if an update changed the executable name.
+        /// </summary>
+        private void UpsertGame(DetectedGame game, List<DetectedGame> existingGames, List<DetectedGame> addedGames, Func<DetectedGame, bool> isSameApp)
+        {
+            if (IsExcludedUtility(game.DisplayName))
+                return;
+
+            var previous = existingGames.FirstOrDefault(isSameApp)
+                           ?? existingGames.FirstOrDefault(g => g.ProcessName.Equals(game.ProcessName, StringComparison.OrdinalIgnoreCase));
+
+            if (previous != null && previous.Source != game.Source)
+                return; // Already in the library from another source (or added manually)
+
+            if (previous == null)
+            {
+                var duplicate = CrossProviderDuplicates.Find(_titleMatcher, game, CrossProviderDuplicates.BuildInstallLocationIndex(existingGames));
+                if (duplicate != null)
+                {
+                    System.Diagnostics.Debug.WriteLine($"Enhanced: Skipping {game.Source} entry '{game.DisplayName}' ({game.ProcessName}) - same game as {duplicate.Source} entry '{duplicate.DisplayName}' ({duplicate.ProcessName})");
+                    return;
+                }
+            }
+            else
+            {
+                game.FirstDetected = previous.FirstDetected;
+                game.ArtworkPath = previous.ArtworkPath;
+                game.ArtworkPlaceholder = previous.ArtworkPlaceholder;
+                game.ArtworkColor = previous.ArtworkColor;
+                game.ProfileJson = previous.ProfileJson;
+                game.AlternativeExecutables = previous.AlternativeExecutables;
+                if (!string.IsNullOrEmpty(previous.LauncherInfo)) game.LauncherInfo = previous.LauncherInfo;
+                if (!string.IsNullOrEmpty(previous.PackageInfo)) game.PackageInfo = previous.PackageInfo;
+
+                if (!previous.ProcessName.Equals(game.ProcessName, StringComparison.OrdinalIgnoreCase))
+                {
+                    System.Diagnostics.Debug.WriteLine($"Enhanced: Executable for '{game.DisplayName}' changed {previous.ProcessName} -> {game.ProcessName}");
+                    _gameDatabase.DeleteGame(previous.ProcessName);
+                }
+                existingGames.Remove(previous);
+            }
+
+            _gameDatabase.SaveGame(game);
+            existingGames.Add(game);
+            addedGames.Add(game);
+        }
+
+        private int RemoveGames(List<DetectedGame> existingGames, Func<DetectedGame, bool> predicate)
+        {
+            var removed = existingGames.Where(predicate).ToList();
+            foreach (var game in removed)
+            {
+                System.Diagnostics.Debug.WriteLine($"Enhanced: Removing uninstalled game from DB - Name: {game.DisplayName}, ProcessName: {game.ProcessName}");
+                _gameDatabase.DeleteGame(game.ProcessName);
+                existingGames.Remove(game);
+            }
+            return removed.Count;
+        }
+
+        #endregion
+
         private async Task ResetDatabaseAsync()
         {
             if (!IsEnhancedScanningEnabled())
@@ -420,8 +737,8 @@ namespace HUDRA.Services
             // Clear the database
             _gameDatabase.ClearDatabase();
 
-            // Clear in-memory cache
-            _cachedGames.Clear();
+            // Detach the library view until the rebuild finishes
+            _library = EmptyLibrary;
             _isDatabaseReady = false;
 
             // Rebuild from scratch
@@ -456,8 +773,15 @@ namespace HUDRA.Services
             // Build database
             Task.Run(async () => await BuildGameDatabaseAsync());
 
+            // Watch launcher manifests so installs/uninstalls are applied one manifest at a time
+            StartManifestWatcher();
+
             // Setup periodic refresh
             int refreshIntervalMinutes = SettingsService.GetGameDatabaseRefreshInterval();
+            if (_manifestWatcher?.WatchedFolderCount > 0)
+            {
+                refreshIntervalMinutes *= WatchedRefreshIntervalMultiplier;
+            }
             _refreshTimer = new Timer(async _ => await RefreshGameDatabaseAsync(), null,
                 TimeSpan.FromMinutes(refreshIntervalMinutes), TimeSpan.FromMinutes(refreshIntervalMinutes));
         }
@@ -509,10 +833,11 @@ namespace HUDRA.Services
         {
             _refreshTimer?.Dispose();
             _refreshTimer = null;
+            StopManifestWatcher();
             
             // Reset database state when disabling enhanced scanning
             _isDatabaseReady = false;
-            _cachedGames.Clear();
+            _library = EmptyLibrary;
         }
 
         private void DetectGamesCallback(object? state)
@@ -721,6 +1046,7 @@ namespace HUDRA.Services
 
                 // Get all processes and filter out system processes more aggressively
                 var allProcesses = Process.GetProcesses();
+                _lastProcessSnapshot = CaptureProcessSnapshot(allProcesses);
                 var candidateProcesses = allProcesses.Where(p =>
                     ShouldScanProcess(p)).ToList();
 
@@ -749,7 +1075,7 @@ namespace HUDRA.Services
                             continue;
 
                         // Check if this executable path matches any game in our database (exact path match)
-                        var matchingGame = _cachedGames.Values.FirstOrDefault(dbGame =>
+                        var matchingGame = _library.Values.FirstOrDefault(dbGame =>
                             string.Equals(dbGame.ExecutablePath, processExePath, StringComparison.OrdinalIgnoreCase));
 
                         // If no exact path match, try Xbox fallback matching by executable name
@@ -837,6 +1163,23 @@ namespace HUDRA.Services
             }
         }
 
+        private static IReadOnlyList<ProcessSnapshot> CaptureProcessSnapshot(Process[] processes)
+        {
+            var snapshot = new List<ProcessSnapshot>(processes.Length);
+            foreach (var process in processes)
+            {
+                try
+                {
+                    snapshot.Add(new ProcessSnapshot { ProcessId = process.Id, ProcessName = process.ProcessName });
+                }
+                catch
+                {
+                    // Process exited during enumeration
+                }
+            }
+            return snapshot;
+        }
+
         /// <summary>
         /// Try to match a running process against Xbox games in the database by executable name.
         /// This fallback is used when exact path matching fails (common with Game Pass due to junctions).
@@ -856,7 +1199,7 @@ namespace HUDRA.Services
                     return null;
 
                 // Only check Xbox games in the database
-                var xboxGames = _cachedGames.Values.Where(g => g.Source == GameSource.Xbox).ToList();
+                var xboxGames = _library.Values.Where(g => g.Source == GameSource.Xbox).ToList();
 
                 if (!xboxGames.Any())
                     return null;
@@ -992,7 +1335,7 @@ namespace HUDRA.Services
                 }
                     
                 // Skip system processes by name
-                if (IsSystemProcess(process.ProcessName))
+                if (KnownProcesses.IsSystemProcess(process.ProcessName))
                     return false;
                     
                 // Skip current process
@@ -1017,62 +1360,15 @@ namespace HUDRA.Services
             }
         }
         
-        /// <summary>
-        /// Check if a process is a system process that we should skip
-        /// </summary>
-        private bool IsSystemProcess(string processName)
-        {
-            var systemProcesses = new HashSet<string>(StringComparer.OrdinalIgnoreCase)
-            {
-                // Core Windows processes
-                "Idle", "System", "Registry", "smss", "csrss", "wininit", "services", 
-                "lsass", "winlogon", "fontdrvhost", "dwm", "svchost", "dllhost",
-                "WmiPrvSE", "spoolsv", "SearchIndexer", "taskhost", "explorer",
-                "RuntimeBroker", "ApplicationFrameHost", "ShellExperienceHost",
-                "StartMenuExperienceHost", "SearchHost", "SecurityHealthSystray",
-                "ctfmon", "taskhostw", "winstore.app", "PhoneExperienceHost",
-                "sihost", "backgroundTaskHost", "PickerHost", "LockApp",
-                "UserOOBEBroker", "SettingSyncHost", "PresentationFontCache",
-                "MsMpEng", "NisSrv", "SearchFilterHost", "SearchProtocolHost",
-                "audiodg", "conhost", "LogonUI", "userinit", "Secure System",
-                "Memory Compression", "nvcontainer", "NVDisplay.Container",
-                
-                // Additional Windows services and system processes
-                "csrss", "lsm", "lsass", "wininit", "winlogon", "services", "spoolsv",
-                "msdtc", "Ati2evxx", "Ati2evxx", "CCC", "stacsv", "mdm", "alg",
-                "wscntfy", "wuauclt", "cidaemon", "cidaemon", "cftmon", "imapi",
-                "dfsr", "msiexec", "notepad", "calc", "mspaint", "write", "wordpad",
-                "taskmgr", "perfmon", "dxdiag", "msconfig", "regedit", "cmd",
-                "powershell", "PowerShell_ISE", "wt", "WindowsTerminal",
-                
-                // Security and antivirus
-                "MsMpEng", "NisSrv", "SecurityHealthService", "SecurityHealthSystray",
-                "WindowsSecurityService", "MpCmdRun", "MpSigStub",
-                
-                // Windows Update and maintenance
-                "TiWorker", "TrustedInstaller", "wuauclt", "UsoClient", "UpdateOrchestrator",
-                "SIHClient", "CompatTelRunner", "DismHost",
-                
-                // Hardware and drivers
-                "nvcontainer", "nvdisplay.container", "nvidia web helper", "nvbackend",
-                "RtkAudioService", "RtkAudUService64", "igfxpers", "igfxtray",
-                "TeamViewer_Service", "TeamViewer", "tv_w32", "tv_x64",
-                
-                // Common utilities that aren't games
-                "notepad++", "chrome", "firefox", "edge", "iexplore", "opera",
-                "winrar", "7z", "7zfm", "AcroRd32", "Acrobat", "OUTLOOK", "WINWORD",
-                "EXCEL", "POWERPNT", "devenv", "Code", "atom", "sublime_text"
-            };
-            
-            return systemProcesses.Contains(processName);
-        }
-        
         // Win32 API declarations for window handling
         [DllImport("user32.dll")]
         private static extern bool IsWindow(IntPtr hWnd);
         
         [DllImport("user32.dll")]
         private static extern bool IsWindowVisible(IntPtr hWnd);
+
+        [DllImport("user32.dll")]
+        private static extern bool IsIconic(IntPtr hWnd);
         
         [DllImport("user32.dll")]
         private static extern bool EnumWindows(EnumWindowsProc enumProc, IntPtr lParam);
@@ -1111,7 +1407,7 @@ namespace HUDRA.Services
                 }
 
                 // Scan all running processes for known games
-                foreach (var cachedGame in _cachedGames.Values)
+                foreach (var cachedGame in _library.Values)
                 {
                     try
                     {
@@ -1176,7 +1472,7 @@ namespace HUDRA.Services
                 }
 
                 // Fast cached database lookup by ProcessName (fallback method)
-                if (_cachedGames.TryGetValue(processName, out var detectedGame))
+                if (_library.TryGetValue(processName, out var detectedGame))
                 {
                     // Convert DetectedGame to GameInfo for compatibility
                     var process = Process.GetProcessesByName(processName).FirstOrDefault();
@@ -1233,7 +1529,7 @@ namespace HUDRA.Services
                 }
 
                 // Fast cached database lookup
-                if (_cachedGames.TryGetValue(processName, out var detectedGame))
+                if (_library.TryGetValue(processName, out var detectedGame))
                 {
                     // Convert DetectedGame to GameInfo for compatibility
                     var process = Process.GetProcessesByName(processName).FirstOrDefault();
@@ -1273,6 +1569,34 @@ namespace HUDRA.Services
             }
         }
 
+        /// <summary>
+        /// Whether the detected game's window is in the foreground, behind another window or minimized.
+        /// Unknown if <paramref name="processId"/> isn't the current game.
+        /// </summary>
+        public GameFocus GetGameFocus(int processId)
+        {
+            var game = _currentGame;
+            if (game == null || game.ProcessId != processId)
+                return GameFocus.Unknown;
+
+            try
+            {
+                if (game.WindowHandle != IntPtr.Zero && IsWindow(game.WindowHandle) && IsIconic(game.WindowHandle))
+                    return GameFocus.Minimized;
+
+                var foregroundWindow = GetForegroundWindow();
+                if (foregroundWindow == IntPtr.Zero)
+                    return GameFocus.Unknown;
+
+                GetWindowThreadProcessId(foregroundWindow, out uint foregroundProcessId);
+                return foregroundProcessId == (uint)processId ? GameFocus.Foreground : GameFocus.Background;
+            }
+            catch
+            {
+                return GameFocus.Unknown;
+            }
+        }
+
         private Process? GetForegroundProcess()
         {
             try
@@ -1433,13 +1757,6 @@ namespace HUDRA.Services
                 // Clear existing Xbox games from database
                 var deletedCount = _gameDatabase.ClearXboxGames();
                 
-                // Clear Xbox games from in-memory cache
-                var xboxGamesToRemove = _cachedGames.Where(kvp => kvp.Value.Source == GameSource.Xbox).Select(kvp => kvp.Key).ToList();
-                foreach (var gameKey in xboxGamesToRemove)
-                {
-                    _cachedGames.Remove(gameKey);
-                }
-                
                 // Re-scan Xbox games only
                 var xboxProvider = _providers.OfType<XboxGameProvider>().FirstOrDefault();
                 if (xboxProvider != null && xboxProvider.IsAvailable)
@@ -1458,7 +1775,6 @@ namespace HUDRA.Services
                         }
 
                         _gameDatabase.SaveGame(game);
-                        _cachedGames[game.ProcessName] = game;
                         savedCount++;
                     }
 
@@ -1483,6 +1799,7 @@ namespace HUDRA.Services
                 try
                 {
                     _refreshTimer?.Dispose();
+                    StopManifestWatcher();
                     _detectionTimer?.Dispose();
                     _gameDatabase?.Dispose();
                     _artworkService?.Dispose();
@@ -5,6 +5,23 @@ using HUDRA.Services.FanControl.Devices;
 
 namespace HUDRA.Services.FanControl
 {
+    /// <summary>
+    /// Where <see cref="DeviceDetectionService.DetectDevice(out bool)"/> spent its time: the hardware lookup
+    /// (saved result when the fingerprint matches, WMI otherwise) and device initialization, which skips
+    /// probing when an earlier start recorded the device type.
+    /// </summary>
+    public readonly record struct DeviceDetectionTiming(
+        TimeSpan Total,
+        TimeSpan HardwareLookup,
+        FingerprintMatch? Fingerprint,
+        bool UsedKnownType,
+        int ProbedTypes)
+    {
+        public override string ToString() =>
+            $"{Total.TotalMilliseconds:F0}ms (hardware {HardwareLookup.TotalMilliseconds:F0}ms, fingerprint {Fingerprint?.ToString() ?? "none saved"}, " +
+            (UsedKnownType ? "known device type)" : $"probed {ProbedTypes} types)");
+    }
+
     public class DeviceDetectionService
     {
         private static readonly List<Type> SupportedDeviceTypes = new()
@@ -16,28 +33,115 @@ namespace HUDRA.Services.FanControl
             typeof(LenovoLegionGoDevice) // Lenovo Legion Go / Legion Go 2
         };
 
-        public static IFanControlDevice? DetectDevice()
+        public static IFanControlDevice? DetectDevice() => DetectDevice(out _);
+
+        /// <summary>
+        /// Timing of the most recent <see cref="DetectDevice(out bool)"/>, for the startup log.
+        /// </summary>
+        public static DeviceDetectionTiming? LastDetection { get; private set; }
+
+        /// <summary>
+        /// Detects and initializes the fan control device. If an earlier start recorded which implementation
+        /// works here (and the hardware fingerprint still matches), that one is initialized directly without
+        /// probing the others; <paramref name="needsVerification"/> is then true and the caller should run
+        /// <see cref="VerifyDevice"/> off the startup path.
+        /// </summary>
+        public static IFanControlDevice? DetectDevice(out bool needsVerification)
         {
+            needsVerification = false;
+            var stopwatch = Stopwatch.StartNew();
+
+            var knownType = FindKnownType(HardwareDetectionService.GetDetectedDevice().FanControlDeviceType);
+            var hardwareLookup = stopwatch.Elapsed;
+
+            if (knownType != null)
+            {
+                var known = TryInitialize(knownType, verifyDevice: false);
+                if (known != null)
+                {
+                    needsVerification = true;
+                    RecordDetection(stopwatch, hardwareLookup, usedKnownType: true, probedTypes: 0);
+                    Debug.WriteLine($"Initialized known device {known.ManufacturerName} {known.DeviceName} in {stopwatch.ElapsedMilliseconds}ms");
+                    return known;
+                }
+
+                Debug.WriteLine($"Known device {knownType.Name} failed to initialize, probing all devices");
+            }
+
+            int probed = 0;
             foreach (var deviceType in SupportedDeviceTypes)
             {
-                try
+                probed++;
+                var device = TryInitialize(deviceType, verifyDevice: true);
+                if (device != null)
                 {
-                    if (Activator.CreateInstance(deviceType) is IFanControlDevice device)
-                    {
-                        if (device.IsDeviceSupported() && device.Initialize())
-                        {
-                            Debug.WriteLine($"Successfully detected: {device.ManufacturerName} {device.DeviceName}");
-                            return device;
-                        }
-
-                        device.Dispose();
-                    }
+                    RecordDetection(stopwatch, hardwareLookup, usedKnownType: false, probed);
+                    Debug.WriteLine($"Successfully detected: {device.ManufacturerName} {device.DeviceName} in {stopwatch.ElapsedMilliseconds}ms");
+                    HardwareDetectionService.SetFanControlDeviceType(deviceType.Name);
+                    return device;
                 }
-                catch (Exception ex)
+            }
+
+            RecordDetection(stopwatch, hardwareLookup, usedKnownType: false, probed);
+            HardwareDetectionService.SetFanControlDeviceType(null);
+            return null;
+        }
+
+        private static void RecordDetection(Stopwatch stopwatch, TimeSpan hardwareLookup, bool usedKnownType, int probedTypes)
+        {
+            LastDetection = new DeviceDetectionTiming(stopwatch.Elapsed, hardwareLookup,
+                HardwareDetectionService.LastFingerprintMatch, usedKnownType, probedTypes);
+        }
+
+        /// <summary>
+        /// Runs the full identity probe on a device initialized from the cache. On failure the cached type is
+        /// forgotten so the next start probes every device again.
+        /// </summary>
+        public static bool VerifyDevice(IFanControlDevice device)
+        {
+            var stopwatch = Stopwatch.StartNew();
+            bool supported;
+            try
+            {
+                supported = device.IsDeviceSupported();
+            }
+            catch (Exception ex)
+            {
+                Debug.WriteLine($"Failed to verify {device.GetType().Name}: {ex.Message}");
+                supported = false;
+            }
+
+            Debug.WriteLine($"Verified {device.GetType().Name}: {supported} ({stopwatch.ElapsedMilliseconds}ms)");
+            if (!supported)
+                HardwareDetectionService.SetFanControlDeviceType(null);
+
+            return supported;
+        }
+
+        private static Type? FindKnownType(string? typeName)
+        {
+            if (string.IsNullOrEmpty(typeName))
+                return null;
+
+            return SupportedDeviceTypes.Find(t => t.Name == typeName);
+        }
+
+        private static IFanControlDevice? TryInitialize(Type deviceType, bool verifyDevice)
+        {
+            try
+            {
+                if (Activator.CreateInstance(deviceType) is IFanControlDevice device)
                 {
-                    Debug.WriteLine($"Failed to initialize {deviceType.Name}: {ex.Message}");
+                    if ((!verifyDevice || device.IsDeviceSupported()) && device.Initialize(verifyDevice))
+                        return device;
+
+                    device.Dispose();
                 }
             }
+            catch (Exception ex)
+            {
+                Debug.WriteLine($"Failed to initialize {deviceType.Name}: {ex.Message}");
+            }
 
             return null;
         }
@@ -72,13 +72,15 @@ namespace HUDRA.Services.FanControl.Devices
         private static readonly LenovoFanTable DefaultFanTable =
             new LenovoFanTable(new ushort[] { 44, 48, 55, 60, 71, 79, 87, 87, 100, 100 });
 
-        public bool Initialize()
+        public bool Initialize() => Initialize(verifyDevice: true);
+
+        public bool Initialize(bool verifyDevice)
         {
             try
             {
                 Debug.WriteLine("Initializing Lenovo Legion Go fan control...");
 
-                if (!IsDeviceSupported())
+                if (verifyDevice && !IsDeviceSupported())
                 {
                     Debug.WriteLine("Device not supported or not a Lenovo Legion Go");
                     return false;
@@ -1,125 +1,121 @@
-﻿using OpenLibSys;
-using System;
+﻿using System;
 using System.Diagnostics;
 
 namespace HUDRA.Services.FanControl
 {
     public abstract class ECCommunicationBase : IDisposable
     {
-        protected Ols? _ols;
+        private readonly ECPortBroker _broker;
+        private bool _ecInitialized = false;
         protected bool _disposed = false;
-        private readonly object _lockObject = new object();
 
-        public bool IsOpen => _ols != null && _ols.GetStatus() == (uint)Ols.Status.NO_ERROR;
+        protected ECCommunicationBase() : this(ECPortBroker.Shared)
+        {
+        }
 
-        protected virtual bool InitializeEC()
+        protected ECCommunicationBase(ECPortBroker broker)
         {
-            try
-            {
-                _ols = new Ols();
-                var status = _ols.GetStatus();
+            _broker = broker;
+        }
 
-                if (status != (uint)Ols.Status.NO_ERROR)
-                {
-                    Debug.WriteLine($"OpenLibSys initialization failed with status: {status}");
-                    return false;
-                }
+        // Per device: IsDeviceSupported falls back to an EC read only once this device has initialized EC,
+        // even if another device or the turbo button already opened the shared handle
+        public bool IsOpen => !_disposed && _ecInitialized && _broker.IsOpen;
 
-                Debug.WriteLine("EC communication initialized successfully");
-                return true;
-            }
-            catch (Exception ex)
-            {
-                Debug.WriteLine($"Failed to initialize EC communication: {ex.Message}");
-                return false;
-            }
+        protected virtual bool InitializeEC()
+        {
+            // The handle is process-wide; the first device to initialize opens it
+            _ecInitialized = _broker.Open();
+            return _ecInitialized;
         }
 
-        protected virtual bool WriteECRegister(ushort address, ECRegisterMap registerMap, byte data)
+        protected virtual bool WriteECRegister(ushort address, ECRegisterMap registerMap, byte data,
+            ECPriority priority = ECPriority.Normal)
         {
             if (!IsOpen) return false;
 
-            lock (_lockObject)
+            try
             {
-                try
+                _broker.Execute(priority, port =>
                 {
                     var protocol = registerMap.Protocol;
                     var addressUpper = (byte)((address >> 8) & 0xFF);
                     var addressLower = (byte)(address & 0xFF);
 
                     // Use device-specific protocol
-                    WritePortPair(registerMap.StatusCommandPort, registerMap.DataPort,
+                    WritePortPair(port, registerMap.StatusCommandPort, registerMap.DataPort,
                                  protocol.AddressSelectHigh, protocol.AddressSetHigh);
-                    WritePortPair(registerMap.StatusCommandPort, registerMap.DataPort,
+                    WritePortPair(port, registerMap.StatusCommandPort, registerMap.DataPort,
                                  protocol.AddressPort, addressUpper);
 
-                    WritePortPair(registerMap.StatusCommandPort, registerMap.DataPort,
+                    WritePortPair(port, registerMap.StatusCommandPort, registerMap.DataPort,
                                  protocol.AddressSelectLow, protocol.AddressSetLow);
-                    WritePortPair(registerMap.StatusCommandPort, registerMap.DataPort,
+                    WritePortPair(port, registerMap.StatusCommandPort, registerMap.DataPort,
                                  protocol.AddressPort, addressLower);
 
-                    WritePortPair(registerMap.StatusCommandPort, registerMap.DataPort,
+                    WritePortPair(port, registerMap.StatusCommandPort, registerMap.DataPort,
                                  protocol.DataSelect, protocol.DataCommand);
-                    WritePortPair(registerMap.StatusCommandPort, registerMap.DataPort,
+                    WritePortPair(port, registerMap.StatusCommandPort, registerMap.DataPort,
                                  protocol.AddressPort, data);
+                });
 
-                    return true;
-                }
-                catch (Exception ex)
-                {
-                    Debug.WriteLine($"EC register write failed: {ex.Message}");
-                    return false;
-                }
+                return true;
+            }
+            catch (Exception ex)
+            {
+                Debug.WriteLine($"EC register write failed: {ex.Message}");
+                return false;
             }
         }
-        protected virtual bool ReadECRegister(ushort address, ECRegisterMap registerMap, out byte data)
+        protected virtual bool ReadECRegister(ushort address, ECRegisterMap registerMap, out byte data,
+            ECPriority priority = ECPriority.Normal)
         {
             data = 0;
 
             if (!IsOpen)
                 return false;
 
-            lock (_lockObject)
+            try
             {
-                try
+                data = _broker.Execute(priority, port =>
                 {
                     var protocol = registerMap.Protocol;
                     var addressUpper = (byte)((address >> 8) & 0xFF);
                     var addressLower = (byte)(address & 0xFF);
 
                     // Use device-specific protocol for address setup
-                    WritePortPair(registerMap.StatusCommandPort, registerMap.DataPort,
+                    WritePortPair(port, registerMap.StatusCommandPort, registerMap.DataPort,
                                  protocol.AddressSelectHigh, protocol.AddressSetHigh);
-                    WritePortPair(registerMap.StatusCommandPort, registerMap.DataPort,
+                    WritePortPair(port, registerMap.StatusCommandPort, registerMap.DataPort,
                                  protocol.AddressPort, addressUpper);
 
-                    WritePortPair(registerMap.StatusCommandPort, registerMap.DataPort,
+                    WritePortPair(port, registerMap.StatusCommandPort, registerMap.DataPort,
                                  protocol.AddressSelectLow, protocol.AddressSetLow);
-                    WritePortPair(registerMap.StatusCommandPort, registerMap.DataPort,
+                    WritePortPair(port, registerMap.StatusCommandPort, registerMap.DataPort,
                                  protocol.AddressPort, addressLower);
 
                     // Set up for read operation
-                    WritePortPair(registerMap.StatusCommandPort, registerMap.DataPort,
+                    WritePortPair(port, registerMap.StatusCommandPort, registerMap.DataPort,
                                  protocol.DataSelect, protocol.DataCommand);
 
                     // Use protocol-specific read sequence
-                    _ols!.WriteIoPortByte(registerMap.StatusCommandPort, protocol.ReadDataSelect);
-                    data = _ols.ReadIoPortByte(registerMap.DataPort);
+                    port.WriteIoPortByte(registerMap.StatusCommandPort, protocol.ReadDataSelect);
+                    return port.ReadIoPortByte(registerMap.DataPort);
+                });
 
-                    return true;
-                }
-                catch (Exception ex)
-                {
-                    Debug.WriteLine($"EC register read failed: {ex.Message}");
-                    return false;
-                }
+                return true;
+            }
+            catch (Exception ex)
+            {
+                Debug.WriteLine($"EC register read failed: {ex.Message}");
+                return false;
             }
         }
 
-        private void WritePortPair(ushort commandPort, ushort dataPort, byte command, byte data)
+        private static void WritePortPair(IPortIO port, ushort commandPort, ushort dataPort, byte command, byte data)
         {
-            _ols!.WriteIoPortByte(commandPort, command);
-            _ols.WriteIoPortByte(dataPort, data);
+            port.WriteIoPortByte(commandPort, command);
+            port.WriteIoPortByte(dataPort, data);
         }
 
         protected static byte PercentageToDuty(double percentage, byte minValue, byte maxValue)
@@ -141,12 +137,8 @@ namespace HUDRA.Services.FanControl
 
         public virtual void Dispose()
         {
-            if (!_disposed)
-            {
-                _ols?.Dispose();
-                _ols = null;
-                _disposed = true;
-            }
+            // The shared handle stays open for other EC users; it's closed on app exit
+            _disposed = true;
         }
     }
 }
\ No newline at end of file
@@ -0,0 +1,246 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Threading;
+
+namespace HUDRA.Services.FanControl
+{
+    public enum ECPriority
+    {
+        High,   // One-off user-visible setup (turbo button mapping, reopening after resume)
+        Normal, // Fan control writes
+        Low     // Status polling
+    }
+
+    /// <summary>
+    /// Byte-wide port I/O. Implemented over WinRing0 in the app; a simulated EC can stand in for it.
+    /// </summary>
+    public interface IPortIO : IDisposable
+    {
+        byte ReadIoPortByte(ushort port);
+        void WriteIoPortByte(ushort port, byte value);
+    }
+
+    public readonly struct ECBrokerMetrics
+    {
+        public long TransactionCount { get; init; }
+        public int QueueDepth { get; init; }
+        public int MaxQueueDepth { get; init; }
+        public double AverageWaitMicroseconds { get; init; }
+        public double MaxWaitMicroseconds { get; init; }
+        public double AverageHoldMicroseconds { get; init; }
+        public double MaxHoldMicroseconds { get; init; }
+
+        public override string ToString() =>
+            $"{TransactionCount} transactions, queue {QueueDepth} (max {MaxQueueDepth}), " +
+            $"wait avg {AverageWaitMicroseconds:F1}µs max {MaxWaitMicroseconds:F1}µs, " +
+            $"hold avg {AverageHoldMicroseconds:F1}µs max {MaxHoldMicroseconds:F1}µs";
+    }
+
+    /// <summary>
+    /// Owns the process's single WinRing0 handle and runs every EC transaction (a complete index/data port
+    /// sequence) one at a time. The EC's index registers are shared state: two sequences that interleave
+    /// select each other's addresses, so fan devices and the turbo button setup must all go through here.
+    /// Waiting transactions are served highest priority first, then in arrival order. The caller's thread
+    /// runs its own transaction, so uncontended access costs one lock round trip.
+    /// </summary>
+    public sealed partial class ECPortBroker : IDisposable
+    {
+        private static readonly Lazy<ECPortBroker> _shared = new(() => new ECPortBroker(OpenDriverPort));
+
+        public static ECPortBroker Shared => _shared.Value;
+
+        // Implemented over WinRing0 in OlsPortIO.cs, which only the app compiles; elsewhere Shared has no port
+        static partial void TryOpenDriverPort(ref IPortIO? port);
+
+        private static IPortIO? OpenDriverPort()
+        {
+            IPortIO? port = null;
+            TryOpenDriverPort(ref port);
+            return port;
+        }
+
+        private readonly Func<IPortIO?> _openPort;
+        private readonly object _queueLock = new object();
+        private readonly PriorityQueue<Waiter, (ECPriority Priority, long Sequence)> _waiting = new();
+        private IPortIO? _port;
+        private bool _busy;
+        private long _sequence;
+        private bool _disposed;
+
+        // Metrics, guarded by _queueLock
+        private long _transactionCount;
+        private int _maxQueueDepth;
+        private long _totalWaitTicks;
+        private long _maxWaitTicks;
+        private long _totalHoldTicks;
+        private long _maxHoldTicks;
+
+        private sealed class Waiter
+        {
+            public readonly ManualResetEventSlim Turn = new(false);
+        }
+
+        public ECPortBroker(Func<IPortIO?> openPort)
+        {
+            _openPort = openPort;
+        }
+
+        public bool IsOpen => Volatile.Read(ref _port) != null;
+
+        /// <summary>
+        /// Opens the port I/O handle if it isn't open yet. Safe to call from every device's initialization.
+        /// </summary>
+        public bool Open()
+        {
+            if (IsOpen) return true;
+
+            Acquire(ECPriority.High);
+            try
+            {
+                if (_disposed) return false;
+                _port ??= _openPort();
+                return _port != null;
+            }
+            finally
+            {
+                ReleaseWithoutTransaction();
+            }
+        }
+
+        /// <summary>
+        /// Replaces the handle, e.g. after hibernation. Queued transactions run against the new handle.
+        /// </summary>
+        public bool Reopen()
+        {
+            Acquire(ECPriority.High);
+            try
+            {
+                if (_disposed) return false;
+                _port?.Dispose();
+                _port = _openPort();
+                return _port != null;
+            }
+            finally
+            {
+                ReleaseWithoutTransaction();
+            }
+        }
+
+        /// <summary>
+        /// Runs <paramref name="transaction"/> with exclusive use of the ports. Transactions must not call
+        /// back into the broker. Throws <see cref="InvalidOperationException"/> if the handle isn't open.
+        /// </summary>
+        public T Execute<T>(ECPriority priority, Func<IPortIO, T> transaction)
+        {
+            long requested = Stopwatch.GetTimestamp();
+            Acquire(priority);
+            long acquired = Stopwatch.GetTimestamp();
+            try
+            {
+                var port = _port ?? throw new InvalidOperationException("EC port I/O is not open");
+                return transaction(port);
+            }
+            finally
+            {
+                Release(acquired - requested, Stopwatch.GetTimestamp() - acquired);
+            }
+        }
+
+        public void Execute(ECPriority priority, Action<IPortIO> transaction)
+        {
+            Execute(priority, port =>
+            {
+                transaction(port);
+                return true;
+            });
+        }
+
+        public ECBrokerMetrics GetMetrics()
+        {
+            lock (_queueLock)
+            {
+                double toMicroseconds = 1_000_000.0 / Stopwatch.Frequency;
+                return new ECBrokerMetrics
+                {
+                    TransactionCount = _transactionCount,
+                    QueueDepth = _waiting.Count,
+                    MaxQueueDepth = _maxQueueDepth,
+                    AverageWaitMicroseconds = _transactionCount > 0 ? _totalWaitTicks * toMicroseconds / _transactionCount : 0,
+                    MaxWaitMicroseconds = _maxWaitTicks * toMicroseconds,
+                    AverageHoldMicroseconds = _transactionCount > 0 ? _totalHoldTicks * toMicroseconds / _transactionCount : 0,
+                    MaxHoldMicroseconds = _maxHoldTicks * toMicroseconds
+                };
+            }
+        }
+
+        private void Acquire(ECPriority priority)
+        {
+            Waiter waiter;
+            lock (_queueLock)
+            {
+                if (!_busy)
+                {
+                    _busy = true;
+                    return;
+                }
+
+                waiter = new Waiter();
+                _waiting.Enqueue(waiter, (priority, _sequence++));
+                _maxQueueDepth = Math.Max(_maxQueueDepth, _waiting.Count);
+            }
+
+            // Release hands ownership over directly, so nothing can slip in between. The event is
+            // Monitor-based (no kernel handle) and may still be inside Set, so it's left to the GC.
+            waiter.Turn.Wait();
+        }
+
+        private void Release(long waitTicks, long holdTicks)
+        {
+            lock (_queueLock)
+            {
+                _transactionCount++;
+                _totalWaitTicks += waitTicks;
+                _totalHoldTicks += holdTicks;
+                _maxWaitTicks = Math.Max(_maxWaitTicks, waitTicks);
+                _maxHoldTicks = Math.Max(_maxHoldTicks, holdTicks);
+
+                HandOver();
+            }
+        }
+
+        // Open/Reopen/Dispose hold the ports too but aren't counted as transactions
+        private void ReleaseWithoutTransaction()
+        {
+            lock (_queueLock)
+            {
+                HandOver();
+            }
+        }
+
+        private void HandOver()
+        {
+            if (_waiting.TryDequeue(out var next, out _))
+                next.Turn.Set();
+            else
+                _busy = false;
+        }
+
+        public void Dispose()
+        {
+            Acquire(ECPriority.High);
+            try
+            {
+                if (_disposed) return;
+                _disposed = true;
+                _port?.Dispose();
+                _port = null;
+                Debug.WriteLine($"ECPortBroker: Closed - {GetMetrics()}");
+            }
+            finally
+            {
+                ReleaseWithoutTransaction();
+            }
+        }
+    }
+}
@@ -18,7 +18,9 @@ namespace HUDRA.Services.FanControl
 
         private FanControlMode _currentMode = FanControlMode.Hardware;
 
-        public virtual bool Initialize()
+        public bool Initialize() => Initialize(verifyDevice: true);
+
+        public virtual bool Initialize(bool verifyDevice)
         {
             try
             {
@@ -30,7 +32,7 @@ namespace HUDRA.Services.FanControl
                     return false;
                 }
 
-                if (!IsDeviceSupported())
+                if (verifyDevice && !IsDeviceSupported())
                 {
                     Debug.WriteLine($"Device not supported or not a {ManufacturerName} {DeviceName}");
                     return false;
@@ -123,12 +125,12 @@ namespace HUDRA.Services.FanControl
 
             try
             {
-                if (ReadECRegister(RegisterMap.FanControlAddress, RegisterMap, out byte controlValue))
+                if (ReadECRegister(RegisterMap.FanControlAddress, RegisterMap, out byte controlValue, ECPriority.Low))
                 {
                     status.IsControlEnabled = controlValue != 0;
                 }
 
-                if (ReadECRegister(RegisterMap.FanDutyAddress, RegisterMap, out byte dutyValue))
+                if (ReadECRegister(RegisterMap.FanDutyAddress, RegisterMap, out byte dutyValue, ECPriority.Low))
                 {
                     status.CurrentDutyPercent = DutyToPercentage(dutyValue, RegisterMap.FanValueMin, RegisterMap.FanValueMax);
                 }
@@ -150,6 +150,12 @@ namespace HUDRA.Services.FanControl
         uint? TurboButtonECAddress { get; }
 
         bool Initialize();
+
+        /// <summary>
+        /// Initializes without the identity probe when the caller already knows this is the right device
+        /// (see <see cref="DeviceDetectionService"/>); <see cref="IsDeviceSupported"/> can verify it later.
+        /// </summary>
+        bool Initialize(bool verifyDevice);
         bool SetFanControl(FanControlMode mode);
         bool SetFanDuty(double percent);
         FanStatus GetFanStatus();
@@ -0,0 +1,53 @@
+using OpenLibSys;
+using System;
+using System.Diagnostics;
+
+namespace HUDRA.Services.FanControl
+{
+    public sealed partial class ECPortBroker
+    {
+        static partial void TryOpenDriverPort(ref IPortIO? port) => port = OlsPortIO.TryOpen();
+    }
+
+    /// <summary>
+    /// <see cref="IPortIO"/> over the WinRing0 driver.
+    /// </summary>
+    internal sealed class OlsPortIO : IPortIO
+    {
+        private readonly Ols _ols;
+
+        private OlsPortIO(Ols ols)
+        {
+            _ols = ols;
+        }
+
+        public static IPortIO? TryOpen()
+        {
+            try
+            {
+                var ols = new Ols();
+                var status = ols.GetStatus();
+                if (status != (uint)Ols.Status.NO_ERROR)
+                {
+                    Debug.WriteLine($"OpenLibSys initialization failed with status: {status}");
+                    ols.Dispose();
+                    return null;
+                }
+
+                Debug.WriteLine("EC communication initialized successfully");
+                return new OlsPortIO(ols);
+            }
+            catch (Exception ex)
+            {
+                Debug.WriteLine($"Failed to initialize EC communication: {ex.Message}");
+                return null;
+            }
+        }
+
+        public byte ReadIoPortByte(ushort port) => _ols.ReadIoPortByte(port);
+
+        public void WriteIoPortByte(ushort port, byte value) => _ols.WriteIoPortByte(port, value);
+
+        public void Dispose() => _ols.Dispose();
+    }
+}
@@ -1,4 +1,5 @@
 ﻿using HUDRA.Controls;
+using HUDRA.Extensions;
 using HUDRA.Models;
 using HUDRA.Services.FanControl;
 using Microsoft.UI.Dispatching;
@@ -29,6 +30,13 @@ namespace HUDRA.Services
         public IFanControlDevice? DetectedDevice => _device;
         public FanControlMode CurrentMode { get; private set; } = FanControlMode.Hardware;
         public double CurrentFanSpeed { get; private set; } = 0.0;
+        public bool IsTemperatureControlEnabled => _temperatureControlEnabled;
+
+        /// <summary>
+        /// Status from the most recent background poll; avoids an EC read for callers that can take it a
+        /// couple of seconds old.
+        /// </summary>
+        public FanStatus? LastStatus { get; private set; }
 
         public FanControlService(DispatcherQueue dispatcher)
         {
@@ -55,7 +63,8 @@ namespace HUDRA.Services
                 DeviceStatusChanged?.Invoke(this, "Detecting fan control device...");
 
                 // Try to detect and initialize a supported device
-                _device = DeviceDetectionService.DetectDevice();
+                _device = DeviceDetectionService.DetectDevice(out bool needsVerification);
+                DebugLogger.Log($"Fan control device detection: {DeviceDetectionService.LastDetection}", "STARTUP");
 
                 if (_device == null)
                 {
@@ -68,6 +77,14 @@ namespace HUDRA.Services
                 StartStatusMonitoring();
 
                 _isInitialized = true;
+
+                // Initialized from the cached device type; confirm the identity without holding up startup
+                if (needsVerification)
+                {
+                    var device = _device;
+                    _ = Task.Run(() => VerifyCachedDevice(device));
+                }
+
                 var successMessage = $"Fan control initialized: {DeviceInfo}";
                 DeviceStatusChanged?.Invoke(this, successMessage);
 
@@ -183,8 +200,9 @@ namespace HUDRA.Services
             try
             {
                 var status = _device!.GetFanStatus();
+                LastStatus = status;
 
-                _dispatcher.TryEnqueue(() =>
+                _dispatcher.TryEnqueueLatest("FanStatus", () =>
                 {
                     FanStatusChanged?.Invoke(this, new FanStatusChangedEventArgs(status));
                 });
@@ -195,6 +213,46 @@ namespace HUDRA.Services
             }
         }
 
+        private void VerifyCachedDevice(IFanControlDevice device)
+        {
+            if (DeviceDetectionService.VerifyDevice(device) || _disposed || !ReferenceEquals(_device, device))
+                return;
+
+            Debug.WriteLine($"FanControlService: Cached device {DeviceInfo} failed verification, probing all devices");
+
+            _statusTimer?.Dispose();
+            _statusTimer = null;
+
+            _device = null;
+            LastStatus = null;
+            CurrentMode = FanControlMode.Hardware;
+            CurrentFanSpeed = 0.0;
+            device.Dispose();
+
+            // VerifyDevice forgot the cached type, so this is the same full probe a first start runs
+            var replacement = DeviceDetectionService.DetectDevice();
+            if (replacement != null && !_disposed)
+            {
+                _device = replacement;
+                StartStatusMonitoring();
+
+                // Temperature control stays on; its next reading switches the new device to software mode
+                var message = $"Fan control initialized: {DeviceInfo}";
+                Debug.WriteLine($"FanControlService: {message}");
+                _dispatcher.TryEnqueue(() => DeviceStatusChanged?.Invoke(this, message));
+                return;
+            }
+
+            replacement?.Dispose();
+            DisableTemperatureControl();
+            _isInitialized = false;
+
+            _dispatcher.TryEnqueue(() =>
+            {
+                DeviceStatusChanged?.Invoke(this, "No supported fan control device detected. Fan control will be unavailable.");
+            });
+        }
+
         public async Task<(bool Success, string Message)> ReinitializeAfterResumeAsync()
         {
             try
@@ -208,6 +266,7 @@ namespace HUDRA.Services
                 // Dispose the existing device
                 _device?.Dispose();
                 _device = null;
+                LastStatus = null;
 
                 // Reset state
                 _isInitialized = false;
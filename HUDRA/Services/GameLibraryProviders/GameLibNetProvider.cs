@@ -1,4 +1,5 @@
 using HUDRA.Models;
+using HUDRA.Services.Steam;
 using System;
 using System.Collections.Generic;
 using System.Diagnostics;
@@ -19,6 +20,14 @@ namespace HUDRA.Services.GameLibraryProviders
         private static LauncherManager? _cachedLauncherManager;
         private static readonly object _launcherLock = new object();
 
+        // Steam executables come from appinfo launch configs, cached per app and build
+        private static readonly SteamLaunchResolver _steamLaunchResolver = new SteamLaunchResolver();
+
+        /// <summary>
+        /// Shared with targeted manifest updates so both paths use one launch-config cache.
+        /// </summary>
+        internal static SteamLaunchResolver SteamLaunchResolver => _steamLaunchResolver;
+
         public event EventHandler<string>? ScanProgressChanged;
 
         /// <summary>
@@ -93,6 +102,11 @@ namespace HUDRA.Services.GameLibraryProviders
                         var gameSource = GetGameSourceFromLauncher(launcherName);
                         var gameCount = launcher.Games?.Count() ?? 0;
                         System.Diagnostics.Debug.WriteLine($"GameLib.NET: {launcherName} has {gameCount} games");
+
+                        if (launcherName.ToLowerInvariant().Contains("steam"))
+                        {
+                            PrepareSteamLaunchConfigs(launcher);
+                        }
                         
                         foreach (var game in launcher.Games)
                         {
@@ -239,6 +253,21 @@ namespace HUDRA.Services.GameLibraryProviders
                 if (string.IsNullOrWhiteSpace(installDir))
                     return null;
 
+                // Method 0: Launch configuration from Steam's appinfo (what "Play" actually runs)
+                if (properties.ContainsKey("Id"))
+                {
+                    var appId = properties["Id"].GetValue(game)?.ToString();
+                    if (!string.IsNullOrWhiteSpace(appId) && _steamLaunchResolver.TryGetExecutable(appId, out var launchExecutable))
+                    {
+                        var launchPath = Path.Combine(installDir, launchExecutable);
+                        if (File.Exists(launchPath))
+                        {
+                            System.Diagnostics.Debug.WriteLine($"GameLib.NET: Steam launch config executable: '{launchPath}'");
+                            return launchPath;
+                        }
+                    }
+                }
+
                 // Try to get executable name from various sources
                 string? executableName = null;
 
@@ -324,6 +353,39 @@ namespace HUDRA.Services.GameLibraryProviders
             }
         }
 
+        /// <summary>
+        /// Resolve launch configs for all of the launcher's games in one appinfo.vdf pass (cache misses only)
+        /// </summary>
+        private void PrepareSteamLaunchConfigs(object launcher)
+        {
+            try
+            {
+                var steamRoot = launcher.GetType().GetProperty("InstallDir")?.GetValue(launcher)?.ToString();
+                var apps = new List<(string AppId, string InstallDir)>();
+
+                var games = launcher.GetType().GetProperty("Games")?.GetValue(launcher) as System.Collections.IEnumerable;
+                if (games == null) return;
+
+                foreach (var game in games)
+                {
+                    var gameType = game.GetType();
+                    var appId = gameType.GetProperty("Id")?.GetValue(game)?.ToString();
+                    var installDir = gameType.GetProperty("InstallDir")?.GetValue(game)?.ToString();
+
+                    if (!string.IsNullOrWhiteSpace(appId) && !string.IsNullOrWhiteSpace(installDir))
+                    {
+                        apps.Add((appId, installDir));
+                    }
+                }
+
+                _steamLaunchResolver.Prepare(steamRoot, apps);
+            }
+            catch (Exception ex)
+            {
+                System.Diagnostics.Debug.WriteLine($"GameLib.NET: Error preparing Steam launch configs: {ex.Message}");
+            }
+        }
+
         private string? GetUbisoftExecutablePath(object game, Dictionary<string, System.Reflection.PropertyInfo> properties)
         {
             try
@@ -1,5 +1,7 @@
 using HUDRA.Models;
+using HUDRA.Services.AMD;
 using HUDRA.Services.FanControl;
+using HUDRA.Services.Power;
 using System;
 using System.Linq;
 using System.Text.Json;
@@ -21,6 +23,11 @@ namespace HUDRA.Services
         private readonly EnhancedGameDatabase _gameDatabase;
 
         private SystemDefaults? _systemDefaults;
+        private EnvelopeRestore? _envelopeRestore;
+        private ProcessorPowerSnapshot? _processorPowerRestore;
+        private readonly ProcessorPowerService _processorPowerService = new();
+        private Radeon3DSettingsSnapshot? _radeon3DRestore;
+        private readonly Radeon3DSettingsService _radeon3DSettingsService = new();
         private bool _isProfileActive = false;
         private string? _activeProfileProcessName;
         private bool _disposed = false;
@@ -37,6 +44,10 @@ namespace HUDRA.Services
         public event EventHandler<ProfileApplicationResult>? ProfileApplied;
         public event EventHandler? ProfileReverted;
 
+        // sPPT and Tctl to put back; SetTdp restores STAPM, slow and fast but never touches these.
+        // RestoreApuSlow with 0 watts = couldn't be read, so it follows the reverted TDP.
+        private readonly record struct EnvelopeRestore(bool RestoreApuSlow, int ApuSlowWatts, int TctlCelsius);
+
         public GameProfileService(
             ResolutionService resolutionService,
             RtssFpsLimiterService fpsLimiterService,
@@ -140,6 +151,17 @@ namespace HUDRA.Services
                     {
                         System.Diagnostics.Debug.WriteLine("  Failed to capture Anti-Lag state");
                     }
+
+                    var radeon3D = await Task.Run(() => _radeon3DSettingsService.Capture());
+                    if (!radeon3D.IsEmpty)
+                    {
+                        defaults.Radeon3DSettings = radeon3D;
+                        System.Diagnostics.Debug.WriteLine($"  Captured Chill: {radeon3D.Chill?.ToString() ?? "n/a"}, Boost: {radeon3D.BoostEnabled?.ToString() ?? "n/a"}, Sharpening: {radeon3D.ImageSharpening?.ToString() ?? "n/a"}");
+                    }
+                    else
+                    {
+                        System.Diagnostics.Debug.WriteLine("  Failed to capture Chill/Boost/Sharpening state");
+                    }
                 }
                 else
                 {
@@ -162,6 +184,17 @@ namespace HUDRA.Services
                 defaults.FanCurveEnabled = fanCurve.IsEnabled;
                 defaults.FanCurvePreset = fanCurve.ActivePreset ?? "Cruise";
 
+                // Capture processor power settings of the active plan
+                try
+                {
+                    defaults.ProcessorPower = _processorPowerService.Capture();
+                    System.Diagnostics.Debug.WriteLine($"  Captured processor power: {defaults.ProcessorPower?.Values.Count ?? 0} setting(s)");
+                }
+                catch (Exception ex)
+                {
+                    System.Diagnostics.Debug.WriteLine($"  Failed to capture processor power: {ex.Message}");
+                }
+
                 defaults.CapturedAt = DateTime.Now;
             }
             catch (Exception ex)
@@ -203,7 +236,19 @@ namespace HUDRA.Services
                 System.Diagnostics.Debug.WriteLine($"Applying profile for {processName}");
 
                 // Apply TDP (if > 0, meaning it's set)
-                if (profile.TdpWatts > 0)
+                TDPService.ActiveEnvelope = null;
+                if (profile.HasPowerEnvelope)
+                {
+                    try
+                    {
+                        ApplyPowerEnvelope(profile, result);
+                    }
+                    catch (Exception ex)
+                    {
+                        result.AddResult("TDP", false, ex.Message);
+                    }
+                }
+                else if (profile.TdpWatts > 0)
                 {
                     try
                     {
@@ -218,6 +263,23 @@ namespace HUDRA.Services
                     }
                 }
 
+                // Apply processor power settings (max state, EPP, boost mode)
+                var processorTargets = ProcessorPowerPolicy.Resolve(profile);
+                if (processorTargets.Count > 0)
+                {
+                    try
+                    {
+                        var processorResult = _processorPowerService.Apply(processorTargets);
+                        _processorPowerRestore = processorResult.Restore;
+                        result.AddResult("CPU Power", processorResult.Success, processorResult.Message);
+                        System.Diagnostics.Debug.WriteLine($"  CPU Power: {processorResult.Message} - {(processorResult.Success ? "OK" : "FAILED")}");
+                    }
+                    catch (Exception ex)
+                    {
+                        result.AddResult("CPU Power", false, ex.Message);
+                    }
+                }
+
                 // Apply Resolution (if width/height > 0, meaning it's set)
                 if (profile.ResolutionWidth > 0 && profile.ResolutionHeight > 0)
                 {
@@ -328,6 +390,23 @@ namespace HUDRA.Services
                     }
                 }
 
+                // Apply AMD Chill, Boost and Image Sharpening (only those explicitly set, not "Default")
+                if (_amdService.IsAmdGpuAvailable() &&
+                    (profile.ChillEnabled.HasValue || profile.RadeonBoostEnabled.HasValue || profile.ImageSharpeningEnabled.HasValue))
+                {
+                    try
+                    {
+                        var radeon3DResult = await Task.Run(() => _radeon3DSettingsService.Apply(profile));
+                        _radeon3DRestore = radeon3DResult.Restore;
+                        result.AddResult("Radeon3D", radeon3DResult.Success, radeon3DResult.Message);
+                        System.Diagnostics.Debug.WriteLine($"  Chill/Boost/Sharpening: {radeon3DResult.Message} - {(radeon3DResult.Success ? "OK" : "FAILED")}");
+                    }
+                    catch (Exception ex)
+                    {
+                        result.AddResult("Radeon3D", false, ex.Message);
+                    }
+                }
+
                 // Apply HDR (only if explicitly set, not null/"Default")
                 if (profile.HdrEnabled.HasValue)
                 {
@@ -385,6 +464,40 @@ namespace HUDRA.Services
             return result;
         }
 
+        /// <summary>
+        /// Applies the profile's TDP with its envelope. A shaped envelope stays active for the game so
+        /// TDP re-applies (sticky TDP, power saver, quick pause) keep its boost instead of flattening it.
+        /// </summary>
+        private void ApplyPowerEnvelope(GameProfile profile, ProfileApplicationResult result)
+        {
+            var limits = PowerEnvelopeLimits.ForDevice(HardwareDetectionService.GetDetectedDevice());
+            var validation = PowerEnvelopeValidator.Validate(profile.PowerEnvelope, limits);
+            foreach (var adjustment in validation.Adjustments)
+                System.Diagnostics.Debug.WriteLine($"  Power envelope adjusted: {adjustment}");
+            var envelope = validation.Envelope;
+            if (envelope.StapmWatts == 0 && envelope.ApuSlowWatts == 0 && envelope.TctlCelsius == 0)
+                return;
+
+            using var tdpService = new TDPService();
+
+            if (envelope.ApuSlowWatts > 0 || envelope.TctlCelsius > 0)
+            {
+                var (readOk, current) = tdpService.GetPowerEnvelope();
+                _envelopeRestore = new EnvelopeRestore(
+                    envelope.ApuSlowWatts > 0,
+                    envelope.ApuSlowWatts > 0 && readOk ? current.ApuSlowWatts : 0,
+                    envelope.TctlCelsius == 0 ? 0
+                        : readOk && current.TctlCelsius > 0 ? current.TctlCelsius : limits.DefaultTctlCelsius);
+            }
+
+            var envelopeResult = tdpService.SetPowerEnvelope(envelope);
+            result.AddResult("TDP", envelopeResult.Success, envelopeResult.Message);
+            System.Diagnostics.Debug.WriteLine($"  Power envelope: {envelope} - {(envelopeResult.Success ? "OK" : "FAILED")}");
+
+            if (envelopeResult.Success && envelope.StapmWatts > 0 && envelope.IsShaped)
+                TDPService.ActiveEnvelope = envelope;
+        }
+
         /// <summary>
         /// Reverts all settings to the saved Default Profile, or falls back to captured state if no defaults saved.
         /// </summary>
@@ -411,12 +524,21 @@ namespace HUDRA.Services
 
             try
             {
-                // Revert TDP
+                // Revert TDP (flat, so the profile's envelope goes with it)
+                TDPService.ActiveEnvelope = null;
                 try
                 {
                     using var tdpService = new TDPService();
                     tdpService.SetTdp(revertTarget.TdpWatts * 1000);
                     System.Diagnostics.Debug.WriteLine($"  TDP: {revertTarget.TdpWatts}W - OK");
+
+                    if (_envelopeRestore is EnvelopeRestore restore)
+                    {
+                        int apuSlow = !restore.RestoreApuSlow ? 0
+                            : restore.ApuSlowWatts > 0 ? restore.ApuSlowWatts : revertTarget.TdpWatts;
+                        var envelopeResult = tdpService.SetPowerEnvelope(new PowerEnvelope { ApuSlowWatts = apuSlow, TctlCelsius = restore.TctlCelsius });
+                        System.Diagnostics.Debug.WriteLine($"  sPPT/Tctl: {apuSlow}W/{restore.TctlCelsius}°C - {(envelopeResult.Success ? "OK" : "FAILED")}");
+                    }
                 }
                 catch (Exception ex)
                 {
@@ -434,6 +556,21 @@ namespace HUDRA.Services
                     System.Diagnostics.Debug.WriteLine($"  Sticky TDP revert failed: {ex.Message}");
                 }
 
+                // Revert processor power settings the profile changed
+                if (_processorPowerRestore != null)
+                {
+                    try
+                    {
+                        var processorTarget = ProcessorPowerPolicy.ResolveRevert(_processorPowerRestore, revertTarget.ProcessorPower);
+                        bool restored = _processorPowerService.Restore(processorTarget);
+                        System.Diagnostics.Debug.WriteLine($"  CPU Power: {processorTarget.Values.Count} setting(s) - {(restored ? "OK" : "FAILED")}");
+                    }
+                    catch (Exception ex)
+                    {
+                        System.Diagnostics.Debug.WriteLine($"  CPU Power revert failed: {ex.Message}");
+                    }
+                }
+
                 // Revert Resolution and Refresh Rate
                 try
                 {
@@ -505,6 +642,21 @@ namespace HUDRA.Services
                     {
                         System.Diagnostics.Debug.WriteLine($"  Anti-Lag revert failed: {ex.Message}");
                     }
+
+                    // Only the features the profile changed
+                    if (_radeon3DRestore != null)
+                    {
+                        try
+                        {
+                            var radeon3DTarget = Radeon3DSettingsPolicy.ResolveRevert(_radeon3DRestore, revertTarget.Radeon3DSettings);
+                            bool restored = await Task.Run(() => _radeon3DSettingsService.Restore(radeon3DTarget));
+                            System.Diagnostics.Debug.WriteLine($"  Chill/Boost/Sharpening: {(restored ? "OK" : "FAILED")}");
+                        }
+                        catch (Exception ex)
+                        {
+                            System.Diagnostics.Debug.WriteLine($"  Chill/Boost/Sharpening revert failed: {ex.Message}");
+                        }
+                    }
                 }
                 else
                 {
@@ -549,6 +701,9 @@ namespace HUDRA.Services
                 _isProfileActive = false;
                 _activeProfileProcessName = null;
                 _systemDefaults = null;
+                _envelopeRestore = null;
+                _processorPowerRestore = null;
+                _radeon3DRestore = null;
 
                 ProfileReverted?.Invoke(this, EventArgs.Empty);
 
@@ -571,6 +726,9 @@ namespace HUDRA.Services
             _isProfileActive = false;
             _activeProfileProcessName = null;
             _systemDefaults = null;
+            _envelopeRestore = null;
+            _processorPowerRestore = null;
+            _radeon3DRestore = null;
         }
 
         /// <summary>
@@ -8,34 +8,85 @@ namespace HUDRA.Services
 {
     /// <summary>
     /// Centralized hardware detection service that identifies the device manufacturer and model.
-    /// Detection runs once and is stored permanently in settings (hardware can't change on handhelds).
+    /// Detection runs once and is stored in settings together with a hardware fingerprint; it only runs
+    /// again if the fingerprint changes (settings moved to another device, BIOS update).
     /// </summary>
     public static class HardwareDetectionService
     {
         private static DetectedDevice? _cachedDevice;
 
+        private static readonly object _lock = new object();
+
+        /// <summary>
+        /// How the saved device compared to the current fingerprint on the first lookup; null when nothing was
+        /// saved. Anything but <see cref="FingerprintMatch.Changed"/> means WMI detection was skipped.
+        /// </summary>
+        public static FingerprintMatch? LastFingerprintMatch { get; private set; }
+
         /// <summary>
-        /// Gets the detected device, loading from settings or detecting once if needed.
-        /// Hardware can't change on handhelds, so detection only runs once ever.
+        /// Gets the detected device, loading from settings or detecting if needed.
+        /// Saved results are reused as long as the hardware fingerprint matches.
         /// </summary>
         public static DetectedDevice GetDetectedDevice()
         {
-            if (_cachedDevice != null)
-                return _cachedDevice;
-
-            // Try loading from settings first
-            _cachedDevice = SettingsService.GetDetectedDevice();
-            if (_cachedDevice != null)
+            lock (_lock)
             {
-                Debug.WriteLine($"HardwareDetection: Loaded from settings - {_cachedDevice.Manufacturer} {_cachedDevice.DeviceName}");
+                if (_cachedDevice != null)
+                    return _cachedDevice;
+
+                var stopwatch = Stopwatch.StartNew();
+                var fingerprint = HardwareFingerprint.Read();
+
+                // Try loading from settings first
+                var saved = SettingsService.GetDetectedDevice();
+                if (saved != null)
+                {
+                    var match = fingerprint.Compare(saved.Fingerprint);
+                    LastFingerprintMatch = match;
+                    if (match != FingerprintMatch.Changed)
+                    {
+                        _cachedDevice = saved;
+                        if (match == FingerprintMatch.NotRecorded)
+                        {
+                            saved.Fingerprint = fingerprint.Value;
+                            SettingsService.SetDetectedDevice(saved);
+                        }
+
+                        Debug.WriteLine($"HardwareDetection: Loaded from settings ({match}) in {stopwatch.ElapsedMilliseconds}ms - {_cachedDevice.Manufacturer} {_cachedDevice.DeviceName}");
+                        return _cachedDevice;
+                    }
+
+                    Debug.WriteLine($"HardwareDetection: Fingerprint changed from '{saved.Fingerprint}' to '{fingerprint}', re-detecting...");
+                }
+                else
+                {
+                    Debug.WriteLine("HardwareDetection: No saved device info, running detection...");
+                }
+
+                _cachedDevice = DetectDevice();
+                _cachedDevice.Fingerprint = fingerprint.Value;
+                SettingsService.SetDetectedDevice(_cachedDevice);
+                Debug.WriteLine($"HardwareDetection: Detection took {stopwatch.ElapsedMilliseconds}ms");
                 return _cachedDevice;
             }
+        }
 
-            // Not in settings - run detection once and store permanently
-            Debug.WriteLine("HardwareDetection: No saved device info, running detection...");
-            _cachedDevice = DetectDevice();
-            SettingsService.SetDetectedDevice(_cachedDevice);
-            return _cachedDevice;
+        /// <summary>
+        /// Remembers which fan control implementation initialized on this device so the next start can skip
+        /// probing the others. Pass null to forget it after a failed verification.
+        /// </summary>
+        public static void SetFanControlDeviceType(string? typeName)
+        {
+            lock (_lock)
+            {
+                var device = GetDetectedDevice();
+                typeName ??= "";
+                if (device.FanControlDeviceType == typeName)
+                    return;
+
+                device.FanControlDeviceType = typeName;
+                SettingsService.SetDetectedDevice(device);
+            }
         }
 
         private static DetectedDevice DetectDevice()
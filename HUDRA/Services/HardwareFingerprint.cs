@@ -0,0 +1,106 @@
+using Microsoft.Win32;
+using System;
+using System.Linq;
+using System.Runtime.Versioning;
+
+namespace HUDRA.Services
+{
+    public enum FingerprintMatch
+    {
+        Match,        // Same board and firmware as when detection ran
+        NotRecorded,  // Saved by a version without fingerprints; adopt the current one
+        Changed,      // Different board or BIOS update; detection must run again
+        Unavailable   // Current fingerprint couldn't be read; trust the saved result
+    }
+
+    /// <summary>
+    /// Identifies the machine from the SMBIOS strings Windows copies into the registry at boot, so saved
+    /// detection results can be checked without a WMI round trip. A BIOS update changes the fingerprint
+    /// on purpose: firmware updates are when WMI and EC interfaces appear or move.
+    /// </summary>
+    public sealed class HardwareFingerprint
+    {
+        private const string BiosKeyPath = @"HARDWARE\DESCRIPTION\System\BIOS";
+
+        // Win32_ComputerSystem Manufacturer/Model are SystemManufacturer/SystemProductName
+        internal static readonly string[] Fields =
+        {
+            "SystemManufacturer",
+            "SystemProductName",
+            "SystemFamily",
+            "BaseBoardManufacturer",
+            "BaseBoardProduct",
+            "BIOSVersion"
+        };
+
+        private const char Separator = '|';
+
+        public static readonly HardwareFingerprint Empty = new HardwareFingerprint(string.Empty);
+
+        public string Value { get; }
+
+        public bool IsEmpty => Value.Length == 0;
+
+        private HardwareFingerprint(string value)
+        {
+            Value = value;
+        }
+
+        /// <summary>
+        /// Reads the current machine's fingerprint. Returns <see cref="Empty"/> if the BIOS key is missing.
+        /// </summary>
+        public static HardwareFingerprint Read()
+        {
+            if (!OperatingSystem.IsWindows())
+                return Empty;
+
+            try
+            {
+                using var biosKey = Registry.LocalMachine.OpenSubKey(BiosKeyPath);
+                if (biosKey == null)
+                    return Empty;
+
+                return FromKey(biosKey);
+            }
+            catch (Exception ex)
+            {
+                System.Diagnostics.Debug.WriteLine($"HardwareFingerprint: Could not read BIOS key: {ex.Message}");
+                return Empty;
+            }
+        }
+
+        [SupportedOSPlatform("windows")]
+        private static HardwareFingerprint FromKey(RegistryKey biosKey) =>
+            FromValues(name => biosKey.GetValue(name)?.ToString());
+
+        /// <summary>
+        /// Builds a fingerprint from a value source keyed by <see cref="Fields"/>. Empty if every value is missing.
+        /// </summary>
+        public static HardwareFingerprint FromValues(Func<string, string?> readValue)
+        {
+            var values = Fields
+                .Select(field => (readValue(field) ?? string.Empty).Trim().Replace(Separator, ' '))
+                .ToArray();
+
+            if (values.All(v => v.Length == 0))
+                return Empty;
+
+            return new HardwareFingerprint(string.Join(Separator, values));
+        }
+
+        public FingerprintMatch Compare(string? saved)
+        {
+            if (IsEmpty)
+                return FingerprintMatch.Unavailable;
+            if (string.IsNullOrEmpty(saved))
+                return FingerprintMatch.NotRecorded;
+
+            // Values are trimmed when read; case isn't significant in SMBIOS strings
+            return string.Equals(saved, Value, StringComparison.OrdinalIgnoreCase)
+                ? FingerprintMatch.Match
+                : FingerprintMatch.Changed;
+        }
+
+        public override string ToString() => IsEmpty ? "(none)" : Value;
+    }
+}
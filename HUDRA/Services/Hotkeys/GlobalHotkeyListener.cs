@@ -0,0 +1,309 @@
+using System;
+using System.Diagnostics;
+using System.Runtime.InteropServices;
+using System.Threading;
+
+namespace HUDRA.Services.Hotkeys
+{
+    public enum HotkeyListenerMode
+    {
+        Stopped,
+        RegisteredHotkey,  // RegisterHotKey - no per-keystroke callback into HUDRA
+        LowLevelHook       // WH_KEYBOARD_LL on a dedicated high-priority thread
+    }
+
+    /// <summary>
+    /// Snapshot of low-level hook callback timings (only populated in LowLevelHook mode).
+    /// </summary>
+    public readonly struct HotkeyHookLatency
+    {
+        public long CallbackCount { get; init; }
+        public double AverageMicroseconds { get; init; }
+        public double MaxMicroseconds { get; init; }
+
+        public override string ToString() =>
+            $"{CallbackCount} callbacks, avg {AverageMicroseconds:F1}µs, max {MaxMicroseconds:F1}µs";
+    }
+
+    /// <summary>
+    /// Listens for the hide/show hotkey on its own message-loop thread so keystrokes never
+    /// queue behind UI work. Combos with a main key are registered with RegisterHotKey, which
+    /// means Windows only calls us when the combo fires. Modifier-only combos (turbo buttons)
+    /// fall back to a low-level keyboard hook whose callback does nothing but update an
+    /// allocation-free <see cref="HotkeyComboMatcher"/>.
+    /// </summary>
+    public sealed class GlobalHotkeyListener : IDisposable
+    {
+        private const int WH_KEYBOARD_LL = 13;
+        private const int WM_KEYDOWN = 0x0100;
+        private const int WM_KEYUP = 0x0101;
+        private const int WM_SYSKEYDOWN = 0x0104;
+        private const int WM_SYSKEYUP = 0x0105;
+        private const int WM_HOTKEY = 0x0312;
+        private const int WM_QUIT = 0x0012;
+        private const int WM_APP_COMBO_FIRED = 0x8000 + 1;
+        private const int WM_APP_RESET = 0x8000 + 2;
+        private const uint MOD_NOREPEAT = 0x4000;
+        private const int HOTKEY_ID = 0x4855; // "HU"
+
+        private readonly HotkeyComboMatcher _matcher;
+        private readonly LowLevelKeyboardProc _hookProc;
+        private Thread? _thread;
+        private volatile uint _threadId;
+        private IntPtr _hookHandle = IntPtr.Zero;
+        private volatile HotkeyListenerMode _mode = HotkeyListenerMode.Stopped;
+        private bool _disposed;
+
+        // Hook latency counters - written only by the listener thread
+        private long _callbackCount;
+        private long _callbackTotalTicks;
+        private long _callbackMaxTicks;
+
+        public event EventHandler? HotkeyPressed;
+
+        public HotkeyListenerMode Mode => _mode;
+        public HotkeyCombo Combo => _matcher.Combo;
+
+        public GlobalHotkeyListener(HotkeyCombo combo)
+        {
+            _matcher = new HotkeyComboMatcher(combo);
+            _hookProc = HookCallback; // Keep delegate alive for the lifetime of the hook
+        }
+
+        public void Start()
+        {
+            if (_thread != null) return;
+
+            var started = new ManualResetEventSlim(false);
+            _thread = new Thread(() => Run(started))
+            {
+                IsBackground = true,
+                Priority = ThreadPriority.Highest,
+                Name = "HUDRA Hotkey Listener"
+            };
+            _thread.Start();
+            started.Wait(TimeSpan.FromSeconds(2));
+        }
+
+        public void Stop()
+        {
+            if (_thread == null) return;
+
+            if (_threadId != 0)
+            {
+                PostThreadMessage(_threadId, WM_QUIT, IntPtr.Zero, IntPtr.Zero);
+            }
+
+            _thread.Join(TimeSpan.FromSeconds(2));
+            _thread = null;
+            _threadId = 0;
+            _mode = HotkeyListenerMode.Stopped;
+        }
+
+        /// <summary>
+        /// Switches to a new combo. Restarts the listener thread since the registration mode may change.
+        /// </summary>
+        public void SetCombo(HotkeyCombo combo)
+        {
+            bool wasRunning = _thread != null;
+            Stop();
+            _matcher.SetCombo(combo);
+            if (wasRunning)
+            {
+                Start();
+            }
+        }
+
+        /// <summary>
+        /// Drops tracked key state (e.g. after hibernation, where key-up events can be lost).
+        /// </summary>
+        public void ResetKeyState()
+        {
+            if (_threadId != 0)
+            {
+                PostThreadMessage(_threadId, WM_APP_RESET, IntPtr.Zero, IntPtr.Zero);
+            }
+        }
+
+        public HotkeyHookLatency GetHookLatency()
+        {
+            long count = Interlocked.Read(ref _callbackCount);
+            long total = Interlocked.Read(ref _callbackTotalTicks);
+            long max = Interlocked.Read(ref _callbackMaxTicks);
+            double ticksToMicroseconds = 1_000_000.0 / Stopwatch.Frequency;
+
+            return new HotkeyHookLatency
+            {
+                CallbackCount = count,
+                AverageMicroseconds = count > 0 ? total * ticksToMicroseconds / count : 0,
+                MaxMicroseconds = max * ticksToMicroseconds
+            };
+        }
+
+        private void Run(ManualResetEventSlim started)
+        {
+            _threadId = GetCurrentThreadId();
+
+            // Force creation of this thread's message queue before anyone posts to it
+            PeekMessage(out _, IntPtr.Zero, 0, 0, 0);
+
+            var combo = _matcher.Combo;
+            if (combo.HasMainKey &&
+                RegisterHotKey(IntPtr.Zero, HOTKEY_ID, (uint)combo.Modifiers | MOD_NOREPEAT, (uint)combo.MainKey))
+            {
+                _mode = HotkeyListenerMode.RegisteredHotkey;
+                System.Diagnostics.Debug.WriteLine($"🔑 Hotkey {combo} registered as system hotkey");
+            }
+            else
+            {
+                if (combo.HasMainKey)
+                {
+                    System.Diagnostics.Debug.WriteLine($"🔑 RegisterHotKey failed for {combo} (error {Marshal.GetLastWin32Error()}) - using keyboard hook");
+                }
+
+                _hookHandle = SetWindowsHookEx(WH_KEYBOARD_LL, _hookProc, GetModuleHandle(null), 0);
+                if (_hookHandle == IntPtr.Zero)
+                {
+                    System.Diagnostics.Debug.WriteLine($"⚠️ Failed to install keyboard hook (error {Marshal.GetLastWin32Error()})");
+                    started.Set();
+                    return;
+                }
+
+                _mode = HotkeyListenerMode.LowLevelHook;
+                System.Diagnostics.Debug.WriteLine($"🔑 Hotkey {combo} monitored via low-level keyboard hook");
+            }
+
+            started.Set();
+
+            try
+            {
+                while (GetMessage(out var msg, IntPtr.Zero, 0, 0) > 0)
+                {
+                    switch (msg.message)
+                    {
+                        case WM_HOTKEY when msg.wParam == (IntPtr)HOTKEY_ID:
+                        case WM_APP_COMBO_FIRED:
+                            RaiseHotkeyPressed();
+                            break;
+                        case WM_APP_RESET:
+                            _matcher.Reset();
+                            break;
+                    }
+                }
+            }
+            finally
+            {
+                if (_mode == HotkeyListenerMode.RegisteredHotkey)
+                {
+                    UnregisterHotKey(IntPtr.Zero, HOTKEY_ID);
+                }
+
+                if (_hookHandle != IntPtr.Zero)
+                {
+                    UnhookWindowsHookEx(_hookHandle);
+                    _hookHandle = IntPtr.Zero;
+                    System.Diagnostics.Debug.WriteLine($"🔑 Keyboard hook removed - latency: {GetHookLatency()}");
+                }
+            }
+        }
+
+        private void RaiseHotkeyPressed()
+        {
+            try
+            {
+                HotkeyPressed?.Invoke(this, EventArgs.Empty);
+            }
+            catch (Exception ex)
+            {
+                System.Diagnostics.Debug.WriteLine($"Error in hotkey handler: {ex.Message}");
+            }
+        }
+
+        private IntPtr HookCallback(int nCode, IntPtr wParam, IntPtr lParam)
+        {
+            long start = Stopwatch.GetTimestamp();
+
+            if (nCode >= 0)
+            {
+                int message = (int)wParam;
+                int vk = Marshal.ReadInt32(lParam); // KBDLLHOOKSTRUCT.vkCode
+
+                if (message == WM_KEYDOWN || message == WM_SYSKEYDOWN)
+                {
+                    if (_matcher.KeyDown(vk))
+                    {
+                        // Dispatch after the hook returns so handlers never delay the keystroke
+                        PostThreadMessage(_threadId, WM_APP_COMBO_FIRED, IntPtr.Zero, IntPtr.Zero);
+                    }
+                }
+                else if (message == WM_KEYUP || message == WM_SYSKEYUP)
+                {
+                    _matcher.KeyUp(vk);
+                }
+            }
+
+            long elapsed = Stopwatch.GetTimestamp() - start;
+            Interlocked.Increment(ref _callbackCount);
+            Interlocked.Add(ref _callbackTotalTicks, elapsed);
+            if (elapsed > _callbackMaxTicks)
+            {
+                Interlocked.Exchange(ref _callbackMaxTicks, elapsed);
+            }
+
+            return CallNextHookEx(_hookHandle, nCode, wParam, lParam);
+        }
+
+        public void Dispose()
+        {
+            if (_disposed) return;
+            _disposed = true;
+
+            Stop();
+            HotkeyPressed = null;
+        }
+
+        private delegate IntPtr LowLevelKeyboardProc(int nCode, IntPtr wParam, IntPtr lParam);
+
+        [StructLayout(LayoutKind.Sequential)]
+        private struct MSG
+        {
+            public IntPtr hwnd;
+            public uint message;
+            public IntPtr wParam;
+            public IntPtr lParam;
+            public uint time;
+            public int ptX;
+            public int ptY;
+        }
+
+        [DllImport("user32.dll", SetLastError = true)]
+        private static extern IntPtr SetWindowsHookEx(int idHook, LowLevelKeyboardProc lpfn, IntPtr hMod, uint dwThreadId);
+
+        [DllImport("user32.dll", SetLastError = true)]
+        private static extern bool UnhookWindowsHookEx(IntPtr hhk);
+
+        [DllImport("user32.dll")]
+        private static extern IntPtr CallNextHookEx(IntPtr hhk, int nCode, IntPtr wParam, IntPtr lParam);
+
+        [DllImport("user32.dll", SetLastError = true)]
+        private static extern bool RegisterHotKey(IntPtr hWnd, int id, uint fsModifiers, uint vk);
+
+        [DllImport("user32.dll", SetLastError = true)]
+        private static extern bool UnregisterHotKey(IntPtr hWnd, int id);
+
+        [DllImport("user32.dll")]
+        private static extern int GetMessage(out MSG lpMsg, IntPtr hWnd, uint wMsgFilterMin, uint wMsgFilterMax);
+
+        [DllImport("user32.dll")]
+        private static extern bool PeekMessage(out MSG lpMsg, IntPtr hWnd, uint wMsgFilterMin, uint wMsgFilterMax, uint wRemoveMsg);
+
+        [DllImport("user32.dll", SetLastError = true)]
+        private static extern bool PostThreadMessage(uint idThread, int msg, IntPtr wParam, IntPtr lParam);
+
+        [DllImport("kernel32.dll")]
+        private static extern uint GetCurrentThreadId();
+
+        [DllImport("kernel32.dll", CharSet = CharSet.Unicode)]
+        private static extern IntPtr GetModuleHandle(string? lpModuleName);
+    }
+}
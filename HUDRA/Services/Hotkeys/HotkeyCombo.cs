@@ -0,0 +1,248 @@
+using System;
+
+namespace HUDRA.Services.Hotkeys
+{
+    [Flags]
+    public enum HotkeyModifiers
+    {
+        None = 0,
+        Alt = 1,      // Same bit values as RegisterHotKey MOD_* flags
+        Control = 2,
+        Shift = 4,
+        Win = 8
+    }
+
+    /// <summary>
+    /// A parsed hide/show hotkey: a set of modifiers plus an optional main key (virtual-key code).
+    /// Modifier-only combos (e.g. the Win+Alt+Ctrl chord emitted by handheld turbo buttons)
+    /// have MainKey == 0 and cannot be registered as system hotkeys.
+    /// </summary>
+    public readonly struct HotkeyCombo : IEquatable<HotkeyCombo>
+    {
+        // Virtual-key codes used by the parser and matcher
+        internal const int VK_SHIFT = 0x10;
+        internal const int VK_CONTROL = 0x11;
+        internal const int VK_MENU = 0x12;
+        internal const int VK_LWIN = 0x5B;
+        internal const int VK_RWIN = 0x5C;
+        internal const int VK_LSHIFT = 0xA0;
+        internal const int VK_RSHIFT = 0xA1;
+        internal const int VK_LCONTROL = 0xA2;
+        internal const int VK_RCONTROL = 0xA3;
+        internal const int VK_LMENU = 0xA4;
+        internal const int VK_RMENU = 0xA5;
+
+        public static readonly HotkeyCombo Default =
+            new(HotkeyModifiers.Win | HotkeyModifiers.Alt | HotkeyModifiers.Control, 0);
+
+        public HotkeyModifiers Modifiers { get; }
+        public int MainKey { get; }
+
+        public bool HasMainKey => MainKey != 0;
+        public bool IsEmpty => Modifiers == HotkeyModifiers.None && MainKey == 0;
+
+        public HotkeyCombo(HotkeyModifiers modifiers, int mainKey)
+        {
+            Modifiers = modifiers;
+            MainKey = mainKey;
+        }
+
+        /// <summary>
+        /// Parses the settings representation ("Win+Alt+Ctrl", "F10") into a combo.
+        /// Falls back to <see cref="Default"/> when nothing valid is configured.
+        /// </summary>
+        public static HotkeyCombo Parse(string? modifiers, string? key)
+        {
+            var parsedModifiers = HotkeyModifiers.None;
+
+            if (!string.IsNullOrEmpty(modifiers))
+            {
+                foreach (var part in modifiers.Split('+', StringSplitOptions.RemoveEmptyEntries | StringSplitOptions.TrimEntries))
+                {
+                    parsedModifiers |= part.ToLowerInvariant() switch
+                    {
+                        "win" => HotkeyModifiers.Win,
+                        "ctrl" => HotkeyModifiers.Control,
+                        "alt" => HotkeyModifiers.Alt,
+                        "shift" => HotkeyModifiers.Shift,
+                        _ => HotkeyModifiers.None
+                    };
+                }
+            }
+
+            var combo = new HotkeyCombo(parsedModifiers, ParseKey(key));
+            return combo.IsEmpty ? Default : combo;
+        }
+
+        /// <summary>
+        /// Converts a key name as stored by HotkeySelector into a virtual-key code, or 0 if unknown.
+        /// </summary>
+        public static int ParseKey(string? keyString)
+        {
+            if (string.IsNullOrEmpty(keyString))
+                return 0;
+
+            var upper = keyString.ToUpperInvariant();
+            switch (upper)
+            {
+                case "SPACE": return 0x20;
+                case "TAB": return 0x09;
+                case "ENTER": return 0x0D;
+                case "ESC": return 0x1B;
+                case "INSERT": return 0x2D;
+                case "DELETE": return 0x2E;
+                case "HOME": return 0x24;
+                case "END": return 0x23;
+                case "PGUP": return 0x21;
+                case "PGDN": return 0x22;
+            }
+
+            if (upper.Length == 1 && upper[0] >= 'A' && upper[0] <= 'Z')
+                return upper[0]; // VK_A..VK_Z match ASCII
+
+            if (upper.Length == 1 && upper[0] >= '0' && upper[0] <= '9')
+                return upper[0]; // VK_0..VK_9 match ASCII
+
+            if (upper.Length > 1 && upper[0] == 'F' && int.TryParse(upper.AsSpan(1), out int fNum) && fNum >= 1 && fNum <= 24)
+                return 0x70 + fNum - 1; // VK_F1..VK_F24
+
+            return 0;
+        }
+
+        public bool Equals(HotkeyCombo other) => Modifiers == other.Modifiers && MainKey == other.MainKey;
+        public override bool Equals(object? obj) => obj is HotkeyCombo other && Equals(other);
+        public override int GetHashCode() => HashCode.Combine(Modifiers, MainKey);
+
+        public override string ToString()
+        {
+            var text = Modifiers.ToString().Replace(", ", "+");
+            return HasMainKey ? $"{text}+0x{MainKey:X2}" : text;
+        }
+    }
+
+    /// <summary>
+    /// Allocation-free combo state machine fed by raw key down/up events.
+    /// Fires once when the combo becomes fully pressed and re-arms only after one of its keys
+    /// is released, so auto-repeat while holding the chord does not toggle repeatedly.
+    /// </summary>
+    public sealed class HotkeyComboMatcher
+    {
+        private HotkeyCombo _combo;
+
+        // One bit per physical key side so releasing LCtrl doesn't clear a held RCtrl
+        private int _sideBits;
+        private bool _mainKeyDown;
+        private bool _armed = true;
+
+        public HotkeyComboMatcher(HotkeyCombo combo)
+        {
+            _combo = combo;
+        }
+
+        public HotkeyCombo Combo => _combo;
+
+        public void SetCombo(HotkeyCombo combo)
+        {
+            _combo = combo;
+            Reset();
+        }
+
+        /// <summary>
+        /// Clears all tracked key state. Call after sleep/resume or secure desktop switches
+        /// where key-up events may have been lost.
+        /// </summary>
+        public void Reset()
+        {
+            _sideBits = 0;
+            _mainKeyDown = false;
+            _armed = true;
+        }
+
+        /// <summary>
+        /// Records a key press. Returns true exactly when this press completes the combo.
+        /// </summary>
+        public bool KeyDown(int vk)
+        {
+            int bit = SideBit(vk);
+            if (bit != 0)
+            {
+                _sideBits |= bit;
+            }
+            else if (vk == _combo.MainKey && _combo.HasMainKey)
+            {
+                _mainKeyDown = true;
+            }
+            else
+            {
+                return false;
+            }
+
+            if (_armed && IsSatisfied())
+            {
+                _armed = false;
+                return true;
+            }
+
+            return false;
+        }
+
+        public void KeyUp(int vk)
+        {
+            int bit = SideBit(vk);
+            if (bit != 0)
+            {
+                _sideBits &= ~bit;
+            }
+            else if (vk == _combo.MainKey && _combo.HasMainKey)
+            {
+                _mainKeyDown = false;
+            }
+            else
+            {
+                return;
+            }
+
+            if (!IsSatisfied())
+            {
+                _armed = true;
+            }
+        }
+
+        private bool IsSatisfied()
+        {
+            if (_combo.HasMainKey && !_mainKeyDown)
+                return false;
+
+            return (PressedModifiers() & _combo.Modifiers) == _combo.Modifiers;
+        }
+
+        private HotkeyModifiers PressedModifiers()
+        {
+            var pressed = HotkeyModifiers.None;
+            if ((_sideBits & 0x03) != 0) pressed |= HotkeyModifiers.Win;
+            if ((_sideBits & 0x0C) != 0) pressed |= HotkeyModifiers.Control;
+            if ((_sideBits & 0x30) != 0) pressed |= HotkeyModifiers.Alt;
+            if ((_sideBits & 0xC0) != 0) pressed |= HotkeyModifiers.Shift;
+            return pressed;
+        }
+
+        private static int SideBit(int vk)
+        {
+            switch (vk)
+            {
+                case HotkeyCombo.VK_LWIN: return 0x01;
+                case HotkeyCombo.VK_RWIN: return 0x02;
+                case HotkeyCombo.VK_CONTROL:
+                case HotkeyCombo.VK_LCONTROL: return 0x04;
+                case HotkeyCombo.VK_RCONTROL: return 0x08;
+                case HotkeyCombo.VK_MENU:
+                case HotkeyCombo.VK_LMENU: return 0x10;
+                case HotkeyCombo.VK_RMENU: return 0x20;
+                case HotkeyCombo.VK_SHIFT:
+                case HotkeyCombo.VK_LSHIFT: return 0x40;
+                case HotkeyCombo.VK_RSHIFT: return 0x80;
+                default: return 0;
+            }
+        }
+    }
+}
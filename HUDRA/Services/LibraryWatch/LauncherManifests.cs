@@ -0,0 +1,172 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using System.Text.Json;
+using System.Text.RegularExpressions;
+
+namespace HUDRA.Services.LibraryWatch
+{
+    public enum ManifestKind
+    {
+        Unknown,
+        SteamApp,            // steamapps\appmanifest_{id}.acf, one per installed app
+        SteamLibraryFolders, // steamapps\libraryfolders.vdf, the list of library roots
+        EpicItem,            // EpicGamesLauncher\Data\Manifests\*.item, one per installed app
+        LibraryFolder        // A generic game library directory (no manifest format)
+    }
+
+    public class SteamAppManifest
+    {
+        public string AppId { get; set; } = string.Empty;
+        public string Name { get; set; } = string.Empty;
+        public string InstallDir { get; set; } = string.Empty; // Full path under steamapps\common
+        public string BuildId { get; set; } = string.Empty;
+        public bool IsFullyInstalled { get; set; }
+    }
+
+    public class EpicItemManifest
+    {
+        public string AppName { get; set; } = string.Empty;
+        public string DisplayName { get; set; } = string.Empty;
+        public string InstallLocation { get; set; } = string.Empty;
+        public string LaunchExecutable { get; set; } = string.Empty; // Relative to InstallLocation
+        public bool IsIncompleteInstall { get; set; }
+        public bool IsAddOn { get; set; } // DLC manifests point at their base game's AppName
+    }
+
+    /// <summary>
+    /// Parses the per-app manifests that launchers write on install, update and uninstall, so a single
+    /// changed file can be turned back into a library entry without rescanning the launcher.
+    /// </summary>
+    public static class LauncherManifests
+    {
+        private const int SteamStateFullyInstalled = 4;
+
+        private static readonly Regex SteamAppManifestName = new Regex(@"^appmanifest_(\d+)\.acf$", RegexOptions.IgnoreCase | RegexOptions.Compiled);
+        private static readonly Regex VdfPathRegex = new Regex("\"path\"\\s+\"([^\"]+)\"", RegexOptions.IgnoreCase | RegexOptions.Compiled);
+
+        public static ManifestKind Classify(string path)
+        {
+            var fileName = Path.GetFileName(path);
+            if (SteamAppManifestName.IsMatch(fileName))
+                return ManifestKind.SteamApp;
+            if (fileName.Equals("libraryfolders.vdf", StringComparison.OrdinalIgnoreCase))
+                return ManifestKind.SteamLibraryFolders;
+            if (fileName.EndsWith(".item", StringComparison.OrdinalIgnoreCase))
+                return ManifestKind.EpicItem;
+            return ManifestKind.Unknown;
+        }
+
+        /// <summary>
+        /// App ID from an appmanifest file name; works after the file has been deleted.
+        /// </summary>
+        public static string? GetSteamAppId(string path)
+        {
+            var match = SteamAppManifestName.Match(Path.GetFileName(path));
+            return match.Success ? match.Groups[1].Value : null;
+        }
+
+        public static SteamAppManifest? ReadSteamAppManifest(string path)
+        {
+            var text = ReadShared(path);
+            if (text == null) return null;
+
+            var appId = GetVdfValue(text, "appid") ?? GetSteamAppId(path);
+            var installDir = GetVdfValue(text, "installdir");
+            if (string.IsNullOrEmpty(appId) || string.IsNullOrEmpty(installDir))
+                return null;
+
+            int.TryParse(GetVdfValue(text, "StateFlags"), out int stateFlags);
+            var steamAppsDir = Path.GetDirectoryName(path) ?? string.Empty;
+
+            return new SteamAppManifest
+            {
+                AppId = appId,
+                Name = GetVdfValue(text, "name") ?? string.Empty,
+                InstallDir = Path.Combine(steamAppsDir, "common", installDir),
+                BuildId = GetVdfValue(text, "buildid") ?? string.Empty,
+                IsFullyInstalled = (stateFlags & SteamStateFullyInstalled) != 0
+            };
+        }
+
+        /// <summary>
+        /// Library roots listed in libraryfolders.vdf (the folder that contains steamapps).
+        /// </summary>
+        public static List<string> ReadSteamLibraryFolders(string path)
+        {
+            var text = ReadShared(path);
+            if (text == null) return new List<string>();
+
+            return VdfPathRegex.Matches(text)
+                .Select(m => m.Groups[1].Value.Replace(@"\\", @"\"))
+                .Distinct(StringComparer.OrdinalIgnoreCase)
+                .ToList();
+        }
+
+        public static EpicItemManifest? ReadEpicManifest(string path)
+        {
+            var text = ReadShared(path);
+            if (text == null) return null;
+
+            try
+            {
+                using var document = JsonDocument.Parse(text);
+                var root = document.RootElement;
+
+                var appName = GetJsonString(root, "AppName");
+                var mainGameAppName = GetJsonString(root, "MainGameAppName");
+
+                return new EpicItemManifest
+                {
+                    AppName = appName,
+                    DisplayName = GetJsonString(root, "DisplayName"),
+                    InstallLocation = GetJsonString(root, "InstallLocation"),
+                    LaunchExecutable = GetJsonString(root, "LaunchExecutable"),
+                    IsIncompleteInstall = root.TryGetProperty("bIsIncompleteInstall", out var incomplete) &&
+                                          incomplete.ValueKind == JsonValueKind.True,
+                    IsAddOn = !string.IsNullOrEmpty(mainGameAppName) &&
+                              !mainGameAppName.Equals(appName, StringComparison.OrdinalIgnoreCase)
+                };
+            }
+            catch (JsonException ex)
+            {
+                // Usually a half-written file; the launcher's next write will raise another change
+                System.Diagnostics.Debug.WriteLine($"LauncherManifests: Invalid Epic manifest {path}: {ex.Message}");
+                return null;
+            }
+        }
+
+        // Top-level keys only appear once before the nested sections, so the first match is the app's own value
+        private static string? GetVdfValue(string text, string key)
+        {
+            var match = Regex.Match(text, $"\"{Regex.Escape(key)}\"\\s+\"([^\"]*)\"", RegexOptions.IgnoreCase);
+            return match.Success ? match.Groups[1].Value : null;
+        }
+
+        private static string GetJsonString(JsonElement element, string name)
+        {
+            return element.TryGetProperty(name, out var value) && value.ValueKind == JsonValueKind.String
+                ? value.GetString() ?? string.Empty
+                : string.Empty;
+        }
+
+        /// <summary>
+        /// Launchers keep manifests open while writing them; read without blocking the writer.
+        /// </summary>
+        private static string? ReadShared(string path)
+        {
+            try
+            {
+                using var stream = new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.ReadWrite | FileShare.Delete);
+                using var reader = new StreamReader(stream);
+                return reader.ReadToEnd();
+            }
+            catch (Exception ex) when (ex is IOException || ex is UnauthorizedAccessException)
+            {
+                System.Diagnostics.Debug.WriteLine($"LauncherManifests: Could not read {path}: {ex.Message}");
+                return null;
+            }
+        }
+    }
+}
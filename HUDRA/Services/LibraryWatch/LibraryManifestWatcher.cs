@@ -0,0 +1,270 @@
+using Microsoft.Win32;
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+
+namespace HUDRA.Services.LibraryWatch
+{
+    public readonly record struct ManifestChange(string Path, ManifestKind Kind);
+
+    /// <summary>
+    /// Watches launcher manifest folders (Steam steamapps, Epic Manifests) and generic library folders, and
+    /// reports each changed manifest once its writes have settled. Lets the library pick up installs and
+    /// uninstalls by re-reading one file instead of running a full provider scan.
+    /// </summary>
+    public sealed class LibraryManifestWatcher : IDisposable
+    {
+        public static readonly TimeSpan DefaultQuietPeriod = TimeSpan.FromSeconds(2);
+
+        private readonly Dictionary<string, FileSystemWatcher> _watchers = new(StringComparer.OrdinalIgnoreCase);
+        private readonly Dictionary<string, ManifestKind> _pendingKinds = new(StringComparer.OrdinalIgnoreCase);
+        private readonly object _lock = new object();
+        private readonly ManifestChangeDebouncer _debouncer;
+        private string? _steamRoot;
+        private bool _disposed;
+
+        /// <summary>
+        /// Raised on a thread-pool thread with every manifest that settled in the same quiet period.
+        /// </summary>
+        public event EventHandler<IReadOnlyList<ManifestChange>>? ManifestsChanged;
+
+        /// <summary>
+        /// A watcher overflowed or its folder went away; events may have been missed and a full scan is needed.
+        /// </summary>
+        public event EventHandler? WatchLost;
+
+        public LibraryManifestWatcher() : this(DefaultQuietPeriod)
+        {
+        }
+
+        /// <summary>
+        /// Quiet periods are measured against <paramref name="clock"/>, UtcNow by default.
+        /// </summary>
+        public LibraryManifestWatcher(TimeSpan quietPeriod, Func<DateTime>? clock = null)
+        {
+            _debouncer = new ManifestChangeDebouncer(quietPeriod, OnSettled, clock);
+        }
+
+        public int WatchedFolderCount
+        {
+            get
+            {
+                lock (_lock)
+                {
+                    return _watchers.Count;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Watches the Steam libraries, the Epic manifest folder and <paramref name="libraryPaths"/>.
+        /// Folders that don't exist are skipped.
+        /// </summary>
+        public void Start(IEnumerable<string> libraryPaths)
+        {
+            _steamRoot = FindSteamRoot();
+            SyncSteamLibraries();
+
+            var epicManifests = FindEpicManifestDirectory();
+            if (epicManifests != null)
+                WatchManifests(epicManifests, "*.item");
+
+            foreach (var path in libraryPaths)
+                WatchLibraryFolder(path);
+
+            System.Diagnostics.Debug.WriteLine($"LibraryManifestWatcher: Watching {WatchedFolderCount} folder(s)");
+        }
+
+        /// <summary>
+        /// Watches one manifest folder, e.g. a steamapps folder with "appmanifest_*.acf".
+        /// </summary>
+        public bool WatchManifests(string directory, string filter)
+        {
+            return AddWatcher(directory, filter, NotifyFilters.FileName | NotifyFilters.LastWrite | NotifyFilters.Size,
+                includeSubdirectories: false, ManifestKind.Unknown);
+        }
+
+        /// <summary>
+        /// Watches a library folder without a manifest format for game folders being added or removed.
+        /// </summary>
+        public bool WatchLibraryFolder(string directory)
+        {
+            return AddWatcher(directory, "*", NotifyFilters.DirectoryName,
+                includeSubdirectories: false, ManifestKind.LibraryFolder);
+        }
+
+        private bool AddWatcher(string directory, string filter, NotifyFilters notifyFilter, bool includeSubdirectories, ManifestKind folderKind)
+        {
+            var key = Path.Combine(directory, filter);
+            lock (_lock)
+            {
+                if (_disposed || _watchers.ContainsKey(key) || !Directory.Exists(directory))
+                    return false;
+
+                try
+                {
+                    var watcher = new FileSystemWatcher(directory, filter)
+                    {
+                        NotifyFilter = notifyFilter,
+                        IncludeSubdirectories = includeSubdirectories,
+                        InternalBufferSize = 16 * 1024
+                    };
+
+                    FileSystemEventHandler onChange = (_, e) => OnRawEvent(e.FullPath, directory, folderKind);
+                    watcher.Created += onChange;
+                    watcher.Changed += onChange;
+                    watcher.Deleted += onChange;
+                    watcher.Renamed += (_, e) =>
+                    {
+                        // Writers that save via temp file + rename: the new name is the manifest
+                        OnRawEvent(e.OldFullPath, directory, folderKind);
+                        OnRawEvent(e.FullPath, directory, folderKind);
+                    };
+                    watcher.Error += (_, e) =>
+                    {
+                        System.Diagnostics.Debug.WriteLine($"LibraryManifestWatcher: Watch error on {directory}: {e.GetException().Message}");
+                        WatchLost?.Invoke(this, EventArgs.Empty);
+                    };
+
+                    watcher.EnableRaisingEvents = true;
+                    _watchers[key] = watcher;
+                    return true;
+                }
+                catch (Exception ex)
+                {
+                    System.Diagnostics.Debug.WriteLine($"LibraryManifestWatcher: Cannot watch {directory}: {ex.Message}");
+                    return false;
+                }
+            }
+        }
+
+        private void OnRawEvent(string fullPath, string watchedDirectory, ManifestKind folderKind)
+        {
+            ManifestKind kind;
+            string key;
+
+            if (folderKind == ManifestKind.LibraryFolder)
+            {
+                // Copying a game in raises an event per folder; report the library once
+                kind = ManifestKind.LibraryFolder;
+                key = watchedDirectory;
+            }
+            else
+            {
+                kind = LauncherManifests.Classify(fullPath);
+                if (kind == ManifestKind.Unknown) return; // Steam's temp/download files share the folder
+                key = fullPath;
+            }
+
+            lock (_lock)
+            {
+                if (_disposed) return;
+                _pendingKinds[key] = kind;
+            }
+
+            _debouncer.Notify(key);
+        }
+
+        private void OnSettled(IReadOnlyList<string> paths)
+        {
+            var changes = new List<ManifestChange>(paths.Count);
+            lock (_lock)
+            {
+                if (_disposed) return;
+
+                foreach (var path in paths)
+                {
+                    if (_pendingKinds.Remove(path, out var kind))
+                        changes.Add(new ManifestChange(path, kind));
+                }
+            }
+
+            // A library added in Steam's settings needs its own watcher before its manifests are useful
+            if (changes.Any(c => c.Kind == ManifestKind.SteamLibraryFolders))
+                SyncSteamLibraries();
+
+            if (changes.Count > 0)
+                ManifestsChanged?.Invoke(this, changes);
+        }
+
+        private void SyncSteamLibraries()
+        {
+            if (_steamRoot == null) return;
+
+            var rootSteamApps = Path.Combine(_steamRoot, "steamapps");
+            var libraryRoots = new List<string> { _steamRoot };
+            libraryRoots.AddRange(LauncherManifests.ReadSteamLibraryFolders(Path.Combine(rootSteamApps, "libraryfolders.vdf")));
+
+            foreach (var root in libraryRoots.Distinct(StringComparer.OrdinalIgnoreCase))
+            {
+                WatchManifests(Path.Combine(root, "steamapps"), "appmanifest_*.acf");
+            }
+
+            WatchManifests(rootSteamApps, "libraryfolders.vdf");
+        }
+
+        private static string? FindSteamRoot()
+        {
+            if (OperatingSystem.IsWindows())
+            {
+                try
+                {
+                    using var steamKey = Registry.CurrentUser.OpenSubKey(@"Software\Valve\Steam");
+                    if (steamKey?.GetValue("SteamPath") is string registryPath && Directory.Exists(registryPath))
+                        return registryPath.Replace('/', Path.DirectorySeparatorChar);
+                }
+                catch
+                {
+                }
+            }
+
+            var defaultPath = Path.Combine(Environment.GetFolderPath(Environment.SpecialFolder.ProgramFilesX86), "Steam");
+            return Directory.Exists(defaultPath) ? defaultPath : null;
+        }
+
+        private static string? FindEpicManifestDirectory()
+        {
+            if (OperatingSystem.IsWindows())
+            {
+                try
+                {
+                    using var epicKey = Registry.LocalMachine.OpenSubKey(@"SOFTWARE\WOW6432Node\Epic Games\EpicGamesLauncher");
+                    if (epicKey?.GetValue("AppDataPath") is string appDataPath)
+                    {
+                        var manifests = Path.Combine(appDataPath, "Manifests");
+                        if (Directory.Exists(manifests)) return manifests;
+                    }
+                }
+                catch
+                {
+                }
+            }
+
+            var defaultPath = Path.Combine(Environment.GetFolderPath(Environment.SpecialFolder.CommonApplicationData),
+                "Epic", "EpicGamesLauncher", "Data", "Manifests");
+            return Directory.Exists(defaultPath) ? defaultPath : null;
+        }
+
+        public void Dispose()
+        {
+            List<FileSystemWatcher> watchers;
+            lock (_lock)
+            {
+                if (_disposed) return;
+                _disposed = true;
+                watchers = _watchers.Values.ToList();
+                _watchers.Clear();
+                _pendingKinds.Clear();
+            }
+
+            foreach (var watcher in watchers)
+            {
+                watcher.EnableRaisingEvents = false;
+                watcher.Dispose();
+            }
+
+            _debouncer.Dispose();
+        }
+    }
+}
@@ -0,0 +1,122 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Threading;
+
+namespace HUDRA.Services.LibraryWatch
+{
+    /// <summary>
+    /// Collapses bursts of file-system events per path. A launcher writing a manifest typically produces
+    /// several Created/Changed/Renamed events within a few milliseconds (temp file, rename, attribute touch);
+    /// each path is reported once, after it has been quiet for <see cref="QuietPeriod"/>. Paths that settle
+    /// together are delivered in one batch, in first-notified order.
+    /// </summary>
+    public sealed class ManifestChangeDebouncer : IDisposable
+    {
+        private readonly Action<IReadOnlyList<string>> _onSettled;
+        private readonly Func<DateTime> _clock;
+        private readonly Dictionary<string, DateTime> _lastEvent = new(StringComparer.OrdinalIgnoreCase);
+        private readonly List<string> _order = new();
+        private readonly object _lock = new object();
+        private readonly Timer _timer;
+        private bool _disposed;
+
+        public TimeSpan QuietPeriod { get; }
+
+        /// <summary>
+        /// Events that were absorbed into an already pending path since construction.
+        /// </summary>
+        public long CoalescedEvents { get; private set; }
+
+        public ManifestChangeDebouncer(TimeSpan quietPeriod, Action<IReadOnlyList<string>> onSettled, Func<DateTime>? clock = null)
+        {
+            if (quietPeriod <= TimeSpan.Zero) throw new ArgumentOutOfRangeException(nameof(quietPeriod));
+            QuietPeriod = quietPeriod;
+            _onSettled = onSettled ?? throw new ArgumentNullException(nameof(onSettled));
+            _clock = clock ?? (() => DateTime.UtcNow);
+            _timer = new Timer(_ => Flush(), null, Timeout.Infinite, Timeout.Infinite);
+        }
+
+        public int PendingCount
+        {
+            get
+            {
+                lock (_lock)
+                {
+                    return _order.Count;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Records an event for <paramref name="path"/> and restarts its quiet period. Safe to call from
+        /// FileSystemWatcher threads.
+        /// </summary>
+        public void Notify(string path)
+        {
+            lock (_lock)
+            {
+                if (_disposed) return;
+
+                if (_lastEvent.ContainsKey(path))
+                    CoalescedEvents++;
+                else
+                    _order.Add(path);
+
+                _lastEvent[path] = _clock();
+                _timer.Change(QuietPeriod, Timeout.InfiniteTimeSpan);
+            }
+        }
+
+        /// <summary>
+        /// Delivers every path whose quiet period has elapsed and re-arms the timer for the rest.
+        /// Called by the internal timer; public so callers with their own clock can drive it.
+        /// </summary>
+        public void Flush()
+        {
+            List<string> settled;
+            lock (_lock)
+            {
+                if (_disposed || _order.Count == 0) return;
+
+                var now = _clock();
+                settled = _order.Where(p => now - _lastEvent[p] >= QuietPeriod).ToList();
+                foreach (var path in settled)
+                {
+                    _order.Remove(path);
+                    _lastEvent.Remove(path);
+                }
+
+                if (_order.Count > 0)
+                {
+                    var nextDue = _order.Min(p => _lastEvent[p]) + QuietPeriod - now;
+                    _timer.Change(nextDue > TimeSpan.Zero ? nextDue : TimeSpan.Zero, Timeout.InfiniteTimeSpan);
+                }
+            }
+
+            if (settled.Count == 0) return;
+
+            try
+            {
+                _onSettled(settled);
+            }
+            catch (Exception ex)
+            {
+                System.Diagnostics.Debug.WriteLine($"ManifestChangeDebouncer: Handler failed: {ex.Message}");
+            }
+        }
+
+        public void Dispose()
+        {
+            lock (_lock)
+            {
+                if (_disposed) return;
+                _disposed = true;
+                _order.Clear();
+                _lastEvent.Clear();
+            }
+
+            _timer.Dispose();
+        }
+    }
+}
@@ -1,25 +1,92 @@
 using HUDRA.Pages;
+using Microsoft.UI.Dispatching;
 using Microsoft.UI.Xaml;
 using Microsoft.UI.Xaml.Controls;
 using System;
 using System.Collections.Generic;
+using System.Diagnostics;
+using System.Text;
 
 namespace HUDRA.Services
 {
+    /// <summary>
+    /// How long a page instance is kept after the user navigates away from it.
+    /// </summary>
+    public enum PageRetention
+    {
+        /// <summary>New instance on every visit.</summary>
+        None,
+        /// <summary>Kept for reuse, evicted under memory pressure.</summary>
+        Cached,
+        /// <summary>Kept for the lifetime of the window.</summary>
+        Pinned
+    }
+
     public class NavigationService : IDisposable
     {
+        // Tab order shared with L1/R1 page navigation; neighbours of the current page are prewarmed
+        public static readonly IReadOnlyList<Type> PageOrder = new[]
+        {
+            typeof(MainPage),
+            typeof(LibraryPage),
+            typeof(FanCurvePage),
+            typeof(ScalingPage),
+            typeof(SettingsPage)
+        };
+
+        private static readonly TimeSpan MemoryCheckInterval = TimeSpan.FromSeconds(30);
+
         private readonly Frame _frame;
         private readonly Stack<Type> _navigationStack = new();
+        private readonly Dictionary<Type, PageRetention> _retention = new()
+        {
+            [typeof(MainPage)] = PageRetention.Pinned,
+            [typeof(LibraryPage)] = PageRetention.Cached,
+            [typeof(FanCurvePage)] = PageRetention.Cached,
+            [typeof(ScalingPage)] = PageRetention.Cached,
+            [typeof(SettingsPage)] = PageRetention.Cached,
+            // Per-game editor holds artwork search state; always start fresh
+            [typeof(GameSettingsPage)] = PageRetention.None
+        };
+        private readonly Dictionary<Type, FrameworkElement> _pageCache = new();
+        private readonly Dictionary<Type, NavigationLatency> _latency = new();
+        private readonly DispatcherTimer _memoryCheckTimer;
         private Type? _currentPageType;
         private bool _isNavigating = false;
+        private bool _prewarmScheduled = false;
 
         public event EventHandler<Type>? PageChanged;
         public bool IsNavigating => _isNavigating;
         public Type? CurrentPageType => _currentPageType;
+        public bool PrewarmEnabled { get; set; } = true;
+
+        /// <summary>
+        /// Tab-switch latency (navigate call to page Loaded) split by fresh vs cached instance.
+        /// </summary>
+        public class NavigationLatency
+        {
+            public int CreatedCount { get; set; }
+            public double CreatedTotalMs { get; set; }
+            public int CachedCount { get; set; }
+            public double CachedTotalMs { get; set; }
+
+            public double CreatedAverageMs => CreatedCount > 0 ? CreatedTotalMs / CreatedCount : 0;
+            public double CachedAverageMs => CachedCount > 0 ? CachedTotalMs / CachedCount : 0;
+        }
 
         public NavigationService(Frame frame)
         {
             _frame = frame ?? throw new ArgumentNullException(nameof(frame));
+
+            _memoryCheckTimer = new DispatcherTimer { Interval = MemoryCheckInterval };
+            _memoryCheckTimer.Tick += (s, e) =>
+            {
+                if (IsUnderMemoryPressure())
+                {
+                    TrimCache();
+                }
+            };
+            _memoryCheckTimer.Start();
         }
 
         public void NavigateToMain()
@@ -52,6 +119,39 @@ namespace HUDRA.Services
             Navigate(typeof(GameSettingsPage));
         }
 
+        public void SetRetention(Type pageType, PageRetention retention)
+        {
+            _retention[pageType] = retention;
+            if (retention == PageRetention.None && pageType != _currentPageType)
+            {
+                _pageCache.Remove(pageType);
+            }
+        }
+
+        public PageRetention GetRetention(Type pageType)
+        {
+            return _retention.TryGetValue(pageType, out var retention) ? retention : PageRetention.None;
+        }
+
+        public IReadOnlyDictionary<Type, NavigationLatency> LatencyStats => _latency;
+
+        /// <summary>
+        /// One line per visited page type. Created visits cost what every visit did before page caching,
+        /// so the two columns are the before/after comparison for the session.
+        /// </summary>
+        public string FormatLatencySummary()
+        {
+            var summary = new StringBuilder("Navigation latency (navigate to Loaded):");
+            foreach (var pair in _latency)
+            {
+                var stats = pair.Value;
+                summary.AppendLine();
+                summary.Append($"  {pair.Key.Name,-18} created {stats.CreatedAverageMs,7:F1}ms x{stats.CreatedCount,-4} " +
+                    $"cached {stats.CachedAverageMs,7:F1}ms x{stats.CachedCount}");
+            }
+            return summary.ToString();
+        }
+
         public void Navigate(Type pageType)
         {
             if (pageType == null) throw new ArgumentNullException(nameof(pageType));
@@ -60,31 +160,49 @@ namespace HUDRA.Services
             try
             {
                 _isNavigating = true;
-                
+                var stopwatch = Stopwatch.StartNew();
+
                 // Save current page type to stack if different
                 if (_currentPageType != null && _currentPageType != pageType)
                 {
                     _navigationStack.Push(_currentPageType);
                 }
 
-                // Create new page instance
-                var newPage = Activator.CreateInstance(pageType) as FrameworkElement;
+                // Drop the outgoing page unless its retention keeps it around
+                if (_currentPageType != null && _currentPageType != pageType &&
+                    GetRetention(_currentPageType) == PageRetention.None)
+                {
+                    _pageCache.Remove(_currentPageType);
+                }
+
+                bool fromCache = _pageCache.TryGetValue(pageType, out var newPage);
+                if (!fromCache)
+                {
+                    newPage = Activator.CreateInstance(pageType) as FrameworkElement;
+                }
+
                 if (newPage != null)
                 {
-                                        _frame.Content = newPage;
+                    if (GetRetention(pageType) != PageRetention.None)
+                    {
+                        _pageCache[pageType] = newPage;
+                    }
+
+                    TrackLatency(pageType, newPage, stopwatch, fromCache);
+
+                    _frame.Content = newPage;
                     _currentPageType = pageType;
 
-                                        
                     // Notify after content is set
                     PageChanged?.Invoke(this, pageType);
+
+                    SchedulePrewarm();
                 }
-                else
-                {
-                                    }
             }
             catch (Exception ex)
             {
-                                            }
+                Debug.WriteLine($"Navigation to {pageType.Name} failed: {ex.Message}");
+            }
             finally
             {
                 // Clear navigation flag after a small delay to ensure page transition completes
@@ -93,7 +211,7 @@ namespace HUDRA.Services
                 {
                     timer.Stop();
                     _isNavigating = false;
-                                    };
+                };
                 timer.Start();
             }
         }
@@ -107,10 +225,168 @@ namespace HUDRA.Services
             }
         }
 
+        /// <summary>
+        /// Releases cached (non-pinned) pages other than the one on screen.
+        /// </summary>
+        public void TrimCache()
+        {
+            var evict = new List<Type>();
+            foreach (var pageType in _pageCache.Keys)
+            {
+                if (pageType != _currentPageType && GetRetention(pageType) != PageRetention.Pinned)
+                {
+                    evict.Add(pageType);
+                }
+            }
+
+            foreach (var pageType in evict)
+            {
+                _pageCache.Remove(pageType);
+            }
+
+            if (evict.Count > 0)
+            {
+                Debug.WriteLine($"Navigation: evicted {evict.Count} cached page(s)");
+            }
+        }
+
+        private void TrackLatency(Type pageType, FrameworkElement page, Stopwatch stopwatch, bool fromCache)
+        {
+            void OnLoaded(object sender, RoutedEventArgs e)
+            {
+                page.Loaded -= OnLoaded;
+                stopwatch.Stop();
+
+                if (!_latency.TryGetValue(pageType, out var stats))
+                {
+                    stats = new NavigationLatency();
+                    _latency[pageType] = stats;
+                }
+
+                double elapsedMs = stopwatch.Elapsed.TotalMilliseconds;
+                if (fromCache)
+                {
+                    stats.CachedCount++;
+                    stats.CachedTotalMs += elapsedMs;
+                }
+                else
+                {
+                    stats.CreatedCount++;
+                    stats.CreatedTotalMs += elapsedMs;
+                }
+
+                Debug.WriteLine($"Navigation: {pageType.Name} {(fromCache ? "cached" : "created")} in {elapsedMs:F1}ms " +
+                    $"(avg created {stats.CreatedAverageMs:F1}ms, avg cached {stats.CachedAverageMs:F1}ms)");
+            }
+
+            page.Loaded += OnLoaded;
+        }
+
+        /// <summary>
+        /// Builds the tab-order neighbours of the current page at idle priority, one page per dispatcher pass
+        /// so a prewarm never stacks up behind user input.
+        /// </summary>
+        private void SchedulePrewarm()
+        {
+            if (!PrewarmEnabled || _prewarmScheduled || _currentPageType == null) return;
+
+            _prewarmScheduled = _frame.DispatcherQueue.TryEnqueue(DispatcherQueuePriority.Low, PrewarmNext);
+        }
+
+        private void PrewarmNext()
+        {
+            _prewarmScheduled = false;
+            if (_isNavigating)
+            {
+                // Let the navigation settle first
+                var retry = new DispatcherTimer { Interval = TimeSpan.FromMilliseconds(150) };
+                retry.Tick += (s, e) =>
+                {
+                    retry.Stop();
+                    SchedulePrewarm();
+                };
+                retry.Start();
+                return;
+            }
+
+            if (IsUnderMemoryPressure())
+            {
+                TrimCache();
+                return;
+            }
+
+            var next = GetNextPrewarmCandidate();
+            if (next == null) return;
+
+            try
+            {
+                var stopwatch = Stopwatch.StartNew();
+                if (Activator.CreateInstance(next) is FrameworkElement page)
+                {
+                    _pageCache[next] = page;
+                    Debug.WriteLine($"Navigation: prewarmed {next.Name} in {stopwatch.Elapsed.TotalMilliseconds:F1}ms");
+                }
+            }
+            catch (Exception ex)
+            {
+                Debug.WriteLine($"Navigation: prewarm of {next.Name} failed: {ex.Message}");
+                _retention[next] = PageRetention.None; // Don't retry a page that can't be built ahead of time
+            }
+
+            SchedulePrewarm();
+        }
+
+        private Type? GetNextPrewarmCandidate()
+        {
+            int index = _currentPageType != null ? IndexOfPage(_currentPageType) : -1;
+
+            if (index >= 0)
+            {
+                foreach (int offset in new[] { 1, -1 })
+                {
+                    var candidate = PageOrder[(index + offset + PageOrder.Count) % PageOrder.Count];
+                    if (NeedsPrewarm(candidate)) return candidate;
+                }
+            }
+
+            // Home is the most common return target from any page
+            return NeedsPrewarm(typeof(MainPage)) ? typeof(MainPage) : null;
+        }
+
+        private bool NeedsPrewarm(Type pageType)
+        {
+            return pageType != _currentPageType &&
+                   GetRetention(pageType) != PageRetention.None &&
+                   !_pageCache.ContainsKey(pageType);
+        }
+
+        private static int IndexOfPage(Type pageType)
+        {
+            for (int i = 0; i < PageOrder.Count; i++)
+            {
+                if (PageOrder[i] == pageType) return i;
+            }
+            return -1;
+        }
+
+        private static bool IsUnderMemoryPressure()
+        {
+            var info = GC.GetGCMemoryInfo();
+            return info.HighMemoryLoadThresholdBytes > 0 &&
+                   info.MemoryLoadBytes >= info.HighMemoryLoadThresholdBytes;
+        }
+
         public void Dispose()
         {
+            if (_latency.Count > 0)
+            {
+                Debug.WriteLine(FormatLatencySummary());
+            }
+
+            _memoryCheckTimer.Stop();
             PageChanged = null;
             _navigationStack.Clear();
+            _pageCache.Clear();
         }
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,318 @@
+using HUDRA.Services.SessionHistory;
+using System;
+using System.Collections.Generic;
+
+namespace HUDRA.Services.Power
+{
+    /// <summary>
+    /// One battery observation. Any field may be NaN when its source has nothing at that moment.
+    /// </summary>
+    public readonly struct BatteryReading
+    {
+        public long TimestampMs { get; init; }          // Unix time, milliseconds
+        public double RemainingWh { get; init; }        // Remaining capacity
+        public double DischargeWatts { get; init; }     // Reported rate; negative while charging
+        public double PackagePowerWatts { get; init; }  // APU package power at the same moment
+
+        public static BatteryReading Empty(long timestampMs) => new BatteryReading
+        {
+            TimestampMs = timestampMs,
+            RemainingWh = double.NaN,
+            DischargeWatts = double.NaN,
+            PackagePowerWatts = double.NaN
+        };
+    }
+
+    /// <summary>
+    /// Smooths the battery discharge rate from periodic readings. The battery's own rate lags and is
+    /// noisy, so when package power is known the estimate is package power plus a slowly learned
+    /// overhead (screen, RAM, fan, conversion losses); a TDP change then shows up on the next reading
+    /// instead of minutes later. Without package power it falls back to the reported rate, or to the
+    /// capacity drop between readings. Pure arithmetic, no device access.
+    /// </summary>
+    public sealed class BatteryDrainEstimator
+    {
+        public static readonly TimeSpan DefaultSmoothingTime = TimeSpan.FromMinutes(2);
+        public static readonly TimeSpan DefaultOverheadTime = TimeSpan.FromMinutes(10);
+
+        // Package power is already averaged by the SMU, so it needs far less smoothing than the battery rate
+        private const double PackageSmoothingMs = 20_000;
+
+        // Battery-only readings reuse package power this recent
+        private const long PackagePowerFreshMs = 15_000;
+
+        // Capacity is reported in coarse steps; shorter spans give wild rates
+        private const long MinCapacitySpanMs = 60_000;
+
+        // A longer gap (sleep, hibernate) restarts smoothing instead of averaging across it
+        private const long MaxGapMs = 10 * 60_000;
+
+        private readonly double _smoothingMs;
+        private readonly double _overheadMs;
+
+        private long _lastTimestampMs;
+        private long _lastOverheadMs;
+        private long _packageTimestampMs;
+        private double _packageWatts = double.NaN;
+        private long _capacityTimestampMs;
+        private double _capacityWh = double.NaN;
+
+        public BatteryDrainEstimator() : this(DefaultSmoothingTime, DefaultOverheadTime)
+        {
+        }
+
+        public BatteryDrainEstimator(TimeSpan smoothingTime, TimeSpan overheadTime)
+        {
+            _smoothingMs = smoothingTime.TotalMilliseconds;
+            _overheadMs = overheadTime.TotalMilliseconds;
+        }
+
+        /// <summary>
+        /// Smoothed discharge in watts, or NaN until a discharging reading arrives.
+        /// </summary>
+        public double SmoothedWatts { get; private set; } = double.NaN;
+
+        /// <summary>
+        /// Learned draw beyond package power in watts, or NaN until both have been seen together.
+        /// </summary>
+        public double OverheadWatts { get; private set; } = double.NaN;
+
+        public bool HasEstimate => !double.IsNaN(SmoothedWatts);
+
+        public void Add(in BatteryReading reading)
+        {
+            // Charging: nothing to predict, and the next discharge starts fresh. Overhead is kept.
+            if (reading.DischargeWatts <= 0)
+            {
+                Reset(keepOverhead: true);
+                return;
+            }
+
+            double measured = MeasureDischarge(reading);
+            double package = double.NaN;
+            if (reading.PackagePowerWatts > 0)
+            {
+                package = _packageWatts = reading.PackagePowerWatts;
+                _packageTimestampMs = reading.TimestampMs;
+            }
+            else if (reading.TimestampMs - _packageTimestampMs <= PackagePowerFreshMs)
+            {
+                package = _packageWatts;
+            }
+
+            // Only learn overhead from readings that carry their own package power, so both sides are simultaneous
+            if (!double.IsNaN(measured) && reading.PackagePowerWatts > 0)
+            {
+                double overhead = Math.Max(0, measured - package);
+                if (double.IsNaN(OverheadWatts))
+                {
+                    OverheadWatts = overhead;
+                }
+                else
+                {
+                    long elapsed = reading.TimestampMs - _lastOverheadMs;
+                    if (elapsed > 0)
+                        OverheadWatts += Alpha(elapsed, _overheadMs) * (overhead - OverheadWatts);
+                }
+                _lastOverheadMs = reading.TimestampMs;
+            }
+
+            bool fromPackage = !double.IsNaN(package) && !double.IsNaN(OverheadWatts);
+            double instant = fromPackage ? package + OverheadWatts : measured;
+            if (double.IsNaN(instant))
+                return;
+
+            long sinceLast = reading.TimestampMs - _lastTimestampMs;
+            double smoothingMs = fromPackage ? Math.Min(PackageSmoothingMs, _smoothingMs) : _smoothingMs;
+            if (double.IsNaN(SmoothedWatts) || sinceLast > MaxGapMs)
+                SmoothedWatts = instant;
+            else if (sinceLast > 0)
+                SmoothedWatts += Alpha(sinceLast, smoothingMs) * (instant - SmoothedWatts);
+
+            _lastTimestampMs = reading.TimestampMs;
+        }
+
+        /// <summary>
+        /// Time until <paramref name="remainingWh"/> runs out at the smoothed rate, or null without an estimate.
+        /// </summary>
+        public TimeSpan? EstimateRemaining(double remainingWh) =>
+            Playtime(remainingWh, SmoothedWatts);
+
+        public void Reset() => Reset(keepOverhead: false);
+
+        private void Reset(bool keepOverhead)
+        {
+            SmoothedWatts = double.NaN;
+            _lastTimestampMs = 0;
+            _capacityWh = double.NaN;
+            _capacityTimestampMs = 0;
+            _packageWatts = double.NaN;
+            _packageTimestampMs = 0;
+            if (!keepOverhead)
+            {
+                OverheadWatts = double.NaN;
+                _lastOverheadMs = 0;
+            }
+        }
+
+        private double MeasureDischarge(in BatteryReading reading)
+        {
+            if (reading.DischargeWatts > 0)
+                return reading.DischargeWatts;
+
+            if (double.IsNaN(reading.RemainingWh))
+                return double.NaN;
+
+            if (double.IsNaN(_capacityWh) || reading.TimestampMs - _capacityTimestampMs > MaxGapMs)
+            {
+                _capacityWh = reading.RemainingWh;
+                _capacityTimestampMs = reading.TimestampMs;
+                return double.NaN;
+            }
+
+            long span = reading.TimestampMs - _capacityTimestampMs;
+            double used = _capacityWh - reading.RemainingWh;
+            if (span < MinCapacitySpanMs || used <= 0)
+                return double.NaN;
+
+            _capacityWh = reading.RemainingWh;
+            _capacityTimestampMs = reading.TimestampMs;
+            return used * 3_600_000.0 / span;
+        }
+
+        // Exponential smoothing weight for an irregular sampling interval
+        private static double Alpha(long elapsedMs, double timeConstantMs) =>
+            1 - Math.Exp(-elapsedMs / timeConstantMs);
+
+        internal static TimeSpan? Playtime(double remainingWh, double watts)
+        {
+            if (double.IsNaN(remainingWh) || remainingWh <= 0 || double.IsNaN(watts) || watts <= 0)
+                return null;
+            return TimeSpan.FromHours(remainingWh / watts);
+        }
+    }
+
+    public readonly struct TdpPlaytime
+    {
+        public int TdpWatts { get; init; }
+        public double DischargeWatts { get; init; }
+        public TimeSpan? Playtime { get; init; }
+
+        // Samples recorded at this TDP; 0 means the value comes from the fitted line
+        public int SampleCount { get; init; }
+
+        public bool IsMeasured => SampleCount > 0;
+    }
+
+    /// <summary>
+    /// Battery drain by TDP for one game, fitted from its recorded session history. TDP steps with
+    /// enough samples use their measured average; other steps come from a weighted line through the
+    /// measured ones. Games that are frame-capped below their TDP fit a slope under one watt per watt,
+    /// which is the point of using history rather than assuming drain follows TDP.
+    /// </summary>
+    public sealed class TdpDrainModel
+    {
+        // 1 minute at the recorder's 5 s rate; fewer is mostly TDP-switch transients
+        public const int MinSamplesPerStep = 12;
+
+        // With a single measured step the line can't be fitted; assume each TDP watt is a battery watt
+        private const double FallbackSlope = 1.0;
+        private const double MinSlope = 0.1;
+        private const double MaxSlope = 2.0;
+        private const double MinWatts = 1.0;
+
+        private readonly Dictionary<int, (double Watts, int Count)> _measured;
+        private readonly double _intercept;
+        private readonly double _slope;
+
+        private TdpDrainModel(Dictionary<int, (double, int)> measured, double intercept, double slope)
+        {
+            _measured = measured;
+            _intercept = intercept;
+            _slope = slope;
+        }
+
+        public static TdpDrainModel Empty { get; } = new TdpDrainModel(new Dictionary<int, (double, int)>(), double.NaN, double.NaN);
+
+        public bool HasData => _measured.Count > 0;
+
+        public IReadOnlyCollection<int> MeasuredSteps => _measured.Keys;
+
+        public static TdpDrainModel Fit(IEnumerable<SessionSample> history)
+        {
+            var sums = new Dictionary<int, (double Sum, int Count)>();
+            foreach (var sample in history)
+            {
+                if (float.IsNaN(sample.TdpWatts) || sample.TdpWatts <= 0 ||
+                    float.IsNaN(sample.BatteryDischargeWatts) || sample.BatteryDischargeWatts <= 0)
+                    continue;
+
+                int tdp = (int)Math.Round(sample.TdpWatts);
+                sums.TryGetValue(tdp, out var acc);
+                sums[tdp] = (acc.Sum + sample.BatteryDischargeWatts, acc.Count + 1);
+            }
+
+            var measured = new Dictionary<int, (double, int)>();
+            foreach (var (tdp, acc) in sums)
+            {
+                if (acc.Count >= MinSamplesPerStep)
+                    measured[tdp] = (acc.Sum / acc.Count, acc.Count);
+            }
+
+            if (measured.Count == 0)
+                return Empty;
+
+            // Weighted least squares over the step means
+            double sw = 0, sx = 0, sy = 0, sxx = 0, sxy = 0;
+            foreach (var (tdp, (watts, count)) in measured)
+            {
+                sw += count;
+                sx += count * tdp;
+                sy += count * watts;
+                sxx += count * (double)tdp * tdp;
+                sxy += count * tdp * watts;
+            }
+
+            double meanX = sx / sw, meanY = sy / sw;
+            double varX = sxx / sw - meanX * meanX;
+            double slope = measured.Count >= 2 && varX > 1e-9
+                ? (sxy / sw - meanX * meanY) / varX
+                : FallbackSlope;
+            slope = Math.Clamp(slope, MinSlope, MaxSlope);
+
+            return new TdpDrainModel(measured, meanY - slope * meanX, slope);
+        }
+
+        /// <summary>
+        /// Expected battery drain at <paramref name="tdpWatts"/>, or NaN without history.
+        /// </summary>
+        public double PredictWatts(int tdpWatts)
+        {
+            if (_measured.TryGetValue(tdpWatts, out var step))
+                return step.Watts;
+            if (double.IsNaN(_slope))
+                return double.NaN;
+            return Math.Max(MinWatts, _intercept + _slope * tdpWatts);
+        }
+
+        public TdpPlaytime Predict(int tdpWatts, double remainingWh)
+        {
+            double watts = PredictWatts(tdpWatts);
+            return new TdpPlaytime
+            {
+                TdpWatts = tdpWatts,
+                DischargeWatts = watts,
+                Playtime = BatteryDrainEstimator.Playtime(remainingWh, watts),
+                SampleCount = _measured.TryGetValue(tdpWatts, out var step) ? step.Count : 0
+            };
+        }
+
+        public List<TdpPlaytime> Predict(IEnumerable<int> tdpSteps, double remainingWh)
+        {
+            var result = new List<TdpPlaytime>();
+            foreach (var tdp in tdpSteps)
+                result.Add(Predict(tdp, remainingWh));
+            return result;
+        }
+    }
+}
@@ -0,0 +1,76 @@
+using System;
+
+namespace HUDRA.Services.Power
+{
+    public enum GameFocus
+    {
+        Unknown,     // No window to judge by; treated as foreground
+        Foreground,
+        Background,  // Another window (including HUDRA) has focus
+        Minimized
+    }
+
+    public interface IGameFocusSource
+    {
+        /// <summary>
+        /// Where the game with <paramref name="processId"/> stands relative to the foreground window.
+        /// </summary>
+        GameFocus GetGameFocus(int processId);
+    }
+
+    /// <summary>
+    /// Decides when a game has been out of the foreground long enough to throttle. Alt-tabbing to check
+    /// something or opening HUDRA for a moment shouldn't cost frame rate, so throttling waits out a grace
+    /// period (shorter when minimized, which is deliberate); coming back restores on the same update.
+    /// Time comes from the caller, so the state machine is deterministic.
+    /// </summary>
+    public sealed class GameFocusPolicy
+    {
+        public static readonly TimeSpan DefaultGracePeriod = TimeSpan.FromSeconds(10);
+        public static readonly TimeSpan DefaultMinimizedGracePeriod = TimeSpan.FromSeconds(3);
+
+        private readonly long _graceMs;
+        private readonly long _minimizedGraceMs;
+        private long _unfocusedSinceMs = -1;
+
+        public GameFocusPolicy() : this(DefaultGracePeriod, DefaultMinimizedGracePeriod)
+        {
+        }
+
+        public GameFocusPolicy(TimeSpan gracePeriod, TimeSpan minimizedGracePeriod)
+        {
+            _graceMs = (long)gracePeriod.TotalMilliseconds;
+            _minimizedGraceMs = (long)minimizedGracePeriod.TotalMilliseconds;
+        }
+
+        public bool IsThrottled { get; private set; }
+
+        /// <summary>
+        /// Feeds the latest focus reading and returns whether the game should be throttled.
+        /// </summary>
+        public bool Update(long timestampMs, GameFocus focus)
+        {
+            if (focus == GameFocus.Foreground || focus == GameFocus.Unknown)
+            {
+                _unfocusedSinceMs = -1;
+                IsThrottled = false;
+                return false;
+            }
+
+            if (_unfocusedSinceMs < 0)
+                _unfocusedSinceMs = timestampMs;
+
+            long grace = focus == GameFocus.Minimized ? _minimizedGraceMs : _graceMs;
+            if (timestampMs - _unfocusedSinceMs >= grace)
+                IsThrottled = true;
+
+            return IsThrottled;
+        }
+
+        public void Reset()
+        {
+            _unfocusedSinceMs = -1;
+            IsThrottled = false;
+        }
+    }
+}
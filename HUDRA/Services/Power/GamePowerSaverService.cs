@@ -0,0 +1,382 @@
+using HUDRA.Models;
+using System;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace HUDRA.Services.Power
+{
+    public readonly struct PowerSaverReport
+    {
+        public double EnergySavedWh { get; init; }
+        public TimeSpan SavingTime { get; init; }
+    }
+
+    /// <summary>
+    /// The saver's settings. A TDP or cap of 0 leaves that setting alone.
+    /// </summary>
+    public readonly struct PowerSaverSettings
+    {
+        public bool MenuEnabled { get; init; }
+        public int MenuTdp { get; init; }
+        public int MenuFpsLimit { get; init; }
+        public bool BackgroundEnabled { get; init; }
+        public int BackgroundTdp { get; init; }
+        public int BackgroundFpsLimit { get; init; }
+    }
+
+    /// <summary>
+    /// Lowers TDP and caps the frame rate while the running game isn't being played, and puts the profile's
+    /// values back as soon as it is again. Two independent triggers, each opt-in:
+    ///   - Menus, loading screens and pauses (<see cref="GameStateClassifier"/>). Loading screens only get
+    ///     the cap: they're mostly CPU and disk bound, so a lower TDP would lengthen them.
+    ///   - The game sitting out of the foreground past a grace period (<see cref="GameFocusPolicy"/>).
+    ///     Background throttling is the deeper of the two and wins when both apply.
+    ///
+    /// A TDP or cap the user picks while throttled is left alone until the game is back in play.
+    /// Menu detection needs RTSS hooked into the game, and a GPU load sensor for menus specifically.
+    /// Everything runs on a timer thread; TDP, the cap and the game's frame rate go through
+    /// <see cref="IPowerSaverControl"/>.
+    /// </summary>
+    public sealed class GamePowerSaverService : IDisposable
+    {
+        private static readonly TimeSpan DefaultPollInterval = TimeSpan.FromSeconds(1);
+
+        private readonly IPowerSaverControl _control;
+        private readonly Func<IGameFocusSource?> _getFocusSource;
+        private readonly Func<PowerSaverSettings> _getSettings;
+        private readonly TimeSpan _pollInterval;
+        private readonly object _lock = new object();
+        private readonly GameStateClassifier _classifier = new GameStateClassifier();
+        private readonly GameFocusPolicy _focusPolicy = new GameFocusPolicy();
+        private PowerSaverLedger _ledger = new PowerSaverLedger();
+        private Timer? _timer;
+        private int _processId;
+        private int _polling;
+        private double _packageWatts = double.NaN;
+        private long _packageTimestampMs;
+        private bool _menuSaverEnabled;
+        private bool _backgroundSaverEnabled;
+        private SaverTarget _target;
+        private bool _held;
+        private bool _disposed;
+
+        // What was in force before throttling, restored on the way out; 0 = not changed by us
+        private int _savedTdp;
+        private int _appliedTdp;
+        private bool _tdpOverridden;
+        private int _savedFpsLimit;
+        private int _appliedFpsLimit;
+        private bool _fpsOverridden;
+
+        // 0 in either field leaves that setting alone
+        private readonly record struct SaverTarget(int Tdp, int FpsLimit);
+
+        /// <param name="getSettings">Read when a game starts and on every poll, so target changes apply live.</param>
+        public GamePowerSaverService(IPowerSaverControl control,
+            Func<IGameFocusSource?> getFocusSource,
+            Func<PowerSaverSettings> getSettings)
+            : this(control, getFocusSource, getSettings, DefaultPollInterval)
+        {
+        }
+
+        /// <param name="pollInterval">Infinite to drive <see cref="Poll"/> by hand.</param>
+        internal GamePowerSaverService(IPowerSaverControl control,
+            Func<IGameFocusSource?> getFocusSource,
+            Func<PowerSaverSettings> getSettings,
+            TimeSpan pollInterval)
+        {
+            _control = control;
+            _getFocusSource = getFocusSource;
+            _getSettings = getSettings;
+            _pollInterval = pollInterval;
+        }
+
+        public GameActivityState State
+        {
+            get { lock (_lock) return _classifier.State; }
+        }
+
+        public bool IsBackgroundThrottled
+        {
+            get { lock (_lock) return _focusPolicy.IsThrottled; }
+        }
+
+        /// <summary>
+        /// Starts watching the game if either saver is enabled in settings.
+        /// </summary>
+        public void Start(GameInfo game)
+        {
+            var settings = _getSettings();
+            bool menuEnabled = settings.MenuEnabled;
+            bool backgroundEnabled = settings.BackgroundEnabled;
+            if (!menuEnabled && !backgroundEnabled)
+                return;
+
+            lock (_lock)
+            {
+                if (_disposed || _processId == game.ProcessId)
+                    return;
+
+                _timer?.Dispose();
+                _classifier.Reset();
+                _focusPolicy.Reset();
+                _ledger = new PowerSaverLedger();
+                _packageWatts = double.NaN;
+                _menuSaverEnabled = menuEnabled;
+                _backgroundSaverEnabled = backgroundEnabled;
+                _held = false;
+                _processId = game.ProcessId;
+                _timer = new Timer(OnPollTimer, null, _pollInterval, _pollInterval);
+            }
+
+            System.Diagnostics.Debug.WriteLine($"PowerSaver: Watching {game.ProcessName} (PID {game.ProcessId}) - " +
+                $"menus {(menuEnabled ? "on" : "off")}, background {(backgroundEnabled ? "on" : "off")}");
+        }
+
+        /// <summary>
+        /// Stops watching, restores anything the saver changed and returns what the session saved,
+        /// or null if nothing was being watched.
+        /// </summary>
+        public Task<PowerSaverReport?> StopAsync() => Task.Run(StopCore);
+
+        /// <summary>
+        /// Puts back anything the saver changed and stops polling until <see cref="Release"/>, keeping the
+        /// session's ledger. For something else that needs TDP and the cap to itself for a while.
+        /// </summary>
+        public void Hold()
+        {
+            lock (_lock)
+            {
+                if (_processId == 0 || _held)
+                    return;
+
+                _held = true;
+                _timer?.Change(Timeout.Infinite, Timeout.Infinite);
+                ApplyTarget(default);
+            }
+        }
+
+        public void Release()
+        {
+            lock (_lock)
+            {
+                if (!_held)
+                    return;
+
+                _held = false;
+                if (_processId == 0)
+                    return;
+
+                // Focus time from before the hold shouldn't count towards the grace period
+                _focusPolicy.Reset();
+                _timer?.Change(_pollInterval, _pollInterval);
+            }
+        }
+
+        /// <summary>
+        /// Package power from the session recorder's samples; the ledger credits savings against it.
+        /// </summary>
+        public void ReportPackagePower(long timestampMs, double watts)
+        {
+            lock (_lock)
+            {
+                _packageWatts = watts;
+                _packageTimestampMs = timestampMs;
+            }
+        }
+
+        private PowerSaverReport? StopCore()
+        {
+            lock (_lock)
+            {
+                if (_processId == 0)
+                    return null;
+
+                _timer?.Dispose();
+                _timer = null;
+                _processId = 0;
+                _held = false;
+                ApplyTarget(default);
+
+                var report = new PowerSaverReport { EnergySavedWh = _ledger.EnergySavedWh, SavingTime = _ledger.SavingTime };
+                System.Diagnostics.Debug.WriteLine(
+                    $"PowerSaver: Session saved {report.EnergySavedWh:F2} Wh over {report.SavingTime.TotalMinutes:F1} min " +
+                    $"(menu {_ledger.TimeIn(GameActivityState.Menu).TotalMinutes:F1}, loading {_ledger.TimeIn(GameActivityState.Loading).TotalMinutes:F1}, " +
+                    $"paused {_ledger.TimeIn(GameActivityState.Paused).TotalMinutes:F1}, background {_ledger.BackgroundTime.TotalMinutes:F1})");
+                return report;
+            }
+        }
+
+        private void OnPollTimer(object? state)
+        {
+            // Applying a cap can take longer than a tick while RTSS starts up; skip rather than pile up
+            if (Interlocked.Exchange(ref _polling, 1) == 1)
+                return;
+
+            try
+            {
+                Poll(DateTimeOffset.UtcNow.ToUnixTimeMilliseconds());
+            }
+            catch (Exception ex)
+            {
+                System.Diagnostics.Debug.WriteLine($"PowerSaver: Poll failed: {ex.Message}");
+            }
+            finally
+            {
+                Volatile.Write(ref _polling, 0);
+            }
+        }
+
+        /// <summary>
+        /// One tick: reads focus and activity at <paramref name="now"/> and moves TDP and the cap to match.
+        /// </summary>
+        internal void Poll(long now)
+        {
+            lock (_lock)
+            {
+                if (_timer == null || _held || _disposed)
+                    return;
+
+                bool background = _backgroundSaverEnabled &&
+                    _focusPolicy.Update(now, _getFocusSource()?.GetGameFocus(_processId) ?? GameFocus.Unknown);
+
+                // A throttled background game's frames say nothing about menus; classification resumes on refocus
+                var activity = _menuSaverEnabled && !background
+                    ? _classifier.Add(_control.Observe(_processId, now))
+                    : _classifier.State;
+
+                // Sample-and-hold package power between the recorder's samples, but not across a stall
+                double watts = now - _packageTimestampMs <= 15_000 ? _packageWatts : double.NaN;
+                _ledger.Add(now, activity, watts, background);
+
+                var target = GetTarget(activity, background);
+                if (target != _target)
+                {
+                    System.Diagnostics.Debug.WriteLine($"PowerSaver: {(background ? "Background" : activity.ToString())} - " +
+                        $"TDP {(target.Tdp > 0 ? target.Tdp + "W" : "profile")}, cap {(target.FpsLimit > 0 ? target.FpsLimit + " FPS" : "profile")}");
+                }
+
+                ApplyTarget(target);
+            }
+        }
+
+        private SaverTarget GetTarget(GameActivityState activity, bool background)
+        {
+            if (!background && activity == GameActivityState.Gameplay)
+                return default;
+
+            var settings = _getSettings();
+            if (background)
+                return new SaverTarget(settings.BackgroundTdp, settings.BackgroundFpsLimit);
+
+            return activity switch
+            {
+                GameActivityState.Menu or GameActivityState.Paused => new SaverTarget(settings.MenuTdp, settings.MenuFpsLimit),
+                GameActivityState.Loading => new SaverTarget(0, settings.MenuFpsLimit),
+                _ => default
+            };
+        }
+
+        private void ApplyTarget(SaverTarget target)
+        {
+            _target = target;
+            int currentTdp = _control.CurrentTdp;
+
+            // Anything changed behind our back while throttled was the user; theirs stands until the game is back in play
+            if (_appliedTdp != 0 && currentTdp != 0 && currentTdp != _appliedTdp)
+            {
+                System.Diagnostics.Debug.WriteLine($"PowerSaver: TDP changed to {currentTdp}W while throttled - keeping it");
+                _appliedTdp = 0;
+                _savedTdp = 0;
+                _tdpOverridden = true;
+            }
+            int currentFpsLimit = _control.CurrentFpsLimit;
+            if (_appliedFpsLimit != 0 && currentFpsLimit != _appliedFpsLimit)
+            {
+                System.Diagnostics.Debug.WriteLine($"PowerSaver: FPS cap changed to {currentFpsLimit} while throttled - keeping it");
+                _appliedFpsLimit = 0;
+                _savedFpsLimit = 0;
+                _fpsOverridden = true;
+            }
+
+            ApplyTdp(target.Tdp, currentTdp);
+            ApplyFpsLimit(target.FpsLimit);
+        }
+
+        private void ApplyTdp(int tdp, int currentTdp)
+        {
+            if (tdp == 0)
+            {
+                _tdpOverridden = false;
+                if (_appliedTdp == 0)
+                    return;
+
+                _control.TrySetTdp(_savedTdp);
+                _appliedTdp = 0;
+                _savedTdp = 0;
+                return;
+            }
+
+            if (_tdpOverridden || tdp == _appliedTdp)
+                return;
+
+            int profileTdp = _appliedTdp != 0 ? _savedTdp : currentTdp;
+            int next = tdp < profileTdp ? tdp : profileTdp;
+            if (next <= 0 || (next == profileTdp && _appliedTdp == 0))
+                return;
+
+            if (_control.TrySetTdp(next))
+            {
+                _savedTdp = profileTdp;
+                _appliedTdp = next == profileTdp ? 0 : next;
+            }
+        }
+
+        private void ApplyFpsLimit(int fpsLimit)
+        {
+            if (fpsLimit == 0)
+            {
+                _fpsOverridden = false;
+                if (_appliedFpsLimit == 0)
+                    return;
+
+                _control.TrySetFpsLimit(_savedFpsLimit);
+                _appliedFpsLimit = 0;
+                _savedFpsLimit = 0;
+                return;
+            }
+
+            if (_fpsOverridden || fpsLimit == _appliedFpsLimit)
+                return;
+
+            int profileLimit = _appliedFpsLimit != 0 ? _savedFpsLimit : _control.CurrentFpsLimit;
+            if (profileLimit > 0 && fpsLimit >= profileLimit)
+            {
+                // The profile's own cap is already at least as low; drop back to it if we were lower
+                if (_appliedFpsLimit != 0)
+                    ApplyFpsLimit(0);
+                return;
+            }
+
+            if (_control.TrySetFpsLimit(fpsLimit))
+            {
+                _savedFpsLimit = profileLimit;
+                _appliedFpsLimit = fpsLimit;
+            }
+        }
+
+        public void Dispose()
+        {
+            lock (_lock)
+            {
+                if (_disposed) return;
+
+                _timer?.Dispose();
+                _timer = null;
+                _processId = 0;
+                ApplyTarget(default);
+                _disposed = true;
+            }
+        }
+    }
+}
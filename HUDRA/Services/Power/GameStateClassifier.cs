@@ -0,0 +1,359 @@
+using System;
+
+namespace HUDRA.Services.Power
+{
+    public enum GameActivityState
+    {
+        Gameplay,
+        Menu,     // Cheap frames: menus, map screens, pause menus that keep rendering
+        Loading,  // Low, erratic frame rate with the GPU mostly idle
+        Paused    // (Almost) nothing presented: paused or minimized
+    }
+
+    /// <summary>
+    /// One reading of the running game. NaN where a signal isn't available.
+    /// </summary>
+    public readonly struct ActivityObservation
+    {
+        public long TimestampMs { get; init; }
+        public double Fps { get; init; }
+        public double FrameTimeMs { get; init; }      // Last frame time RTSS saw
+        public double GpuLoadPercent { get; init; }
+        public int FpsCap { get; init; }              // Cap in force right now, 0 for none
+    }
+
+    /// <summary>
+    /// Classifies what the game is doing from frame rate, frame-time spread and GPU load. The key signal
+    /// for menus is GPU load per frame: menus render cheap frames (often uncapped, so fast at full load),
+    /// gameplay renders expensive ones, and the ratio holds even after a cap slows the menu down. Baselines
+    /// for gameplay frame rate and cost are learned while the game is in gameplay.
+    ///
+    /// Entering a saving state takes a sustained window of agreement; leaving it takes one gameplay-looking
+    /// observation, so the player never waits on the classifier. Deterministic: same observations, same states.
+    /// </summary>
+    public sealed class GameStateClassifier
+    {
+        public const int WindowSize = 8;            // Observations (8 s at 1 Hz)
+        public const int EnterObservations = 5;     // Consecutive agreeing windows before leaving gameplay
+        public const int BaselineObservations = 30; // Gameplay observations before menus can be recognized
+
+        // Loading screens stutter between fast and stalled frames, so one fast frame isn't enough to leave them.
+        // Loading only carries a frame cap (no TDP cut), so the extra second costs the player little.
+        public const int LoadingExitObservations = 2;
+
+        private const double PausedFps = 3;
+        private const double PausedGpuLoad = 15;
+        private const double LoadingMaxFps = 20;           // Absolute, before a baseline exists
+        private const double LoadingFpsRatio = 0.6;        // Of effective gameplay frame rate
+        private const double LoadingMinFrameTimeCv = 0.5;
+        private const double LoadingMaxGpuLoad = 50;
+        private const double LoadingGpuRatio = 0.5;        // Of gameplay GPU load
+        private const double CappedGameplayRatio = 0.9;    // Of the cap, when gameplay runs faster than it
+        private const double MenuEnterCostRatio = 0.4;     // Of gameplay GPU cost per frame
+        private const double MenuExitCostRatio = 0.7;      // Hysteresis: slower clocks at lower TDP raise load
+        private const double MenuMaxFrameTimeCv = 0.25;
+        private const double SteadyFrameTimeRatio = 0.3;   // Last frame time within 30% of the average
+
+        // Baselines follow the light end of gameplay: frame rate rises quickly and falls slowly, cost per
+        // frame the other way round. A heavy scene must not make lighter gameplay look like a menu later.
+        private const double FastAlpha = 0.2;
+        private const double SlowAlpha = 0.02;
+        private const double CostRiseAlpha = 0.005;      // ~3 minutes at 1 Hz: exit thresholds hang off this
+
+        // A window whose per-frame cost spans more than this is mid-transition and isn't learned from;
+        // otherwise the fast-falling baseline would follow gameplay fading into a menu
+        private const double MaxLearnCostSpread = 2.0;
+
+        private readonly ActivityObservation[] _window = new ActivityObservation[WindowSize];
+        private readonly double[] _scratch = new double[WindowSize];
+        private int _head;
+        private int _count;
+        private GameActivityState _candidate = GameActivityState.Gameplay;
+        private int _candidateStreak;
+        private int _exitStreak;
+        private int _baselineCount;
+        private double _gameplayGpuLoad = double.NaN;
+
+        public GameActivityState State { get; private set; } = GameActivityState.Gameplay;
+
+        /// <summary>
+        /// Learned gameplay frame rate, NaN until observed.
+        /// </summary>
+        public double GameplayFps { get; private set; } = double.NaN;
+
+        /// <summary>
+        /// Learned gameplay GPU load per frame (percent per fps), NaN without GPU load.
+        /// </summary>
+        public double GameplayCost { get; private set; } = double.NaN;
+
+        public bool HasBaseline => _baselineCount >= BaselineObservations;
+
+        public GameActivityState Add(in ActivityObservation observation)
+        {
+            _window[_head] = observation;
+            _head = (_head + 1) % WindowSize;
+            if (_count < WindowSize) _count++;
+
+            if (State != GameActivityState.Gameplay)
+            {
+                _exitStreak = LooksLikeGameplay(observation) ? _exitStreak + 1 : 0;
+                int needed = State == GameActivityState.Loading ? LoadingExitObservations : 1;
+                if (_exitStreak >= needed)
+                {
+                    State = GameActivityState.Gameplay;
+                    _candidate = GameActivityState.Gameplay;
+                    _candidateStreak = 0;
+                    _exitStreak = 0;
+                    return State;
+                }
+            }
+
+            if (_count < WindowSize)
+                return State;
+
+            var candidate = ClassifyWindow();
+            if (candidate == _candidate)
+            {
+                _candidateStreak++;
+            }
+            else
+            {
+                _candidate = candidate;
+                _candidateStreak = 1;
+            }
+
+            if (candidate != State && candidate != GameActivityState.Gameplay && _candidateStreak >= EnterObservations)
+            {
+                State = candidate;
+                _exitStreak = 0;
+            }
+
+            if (State == GameActivityState.Gameplay && candidate == GameActivityState.Gameplay)
+                LearnBaseline();
+
+            return State;
+        }
+
+        public void Reset()
+        {
+            Array.Clear(_window);
+            _head = 0;
+            _count = 0;
+            _candidate = GameActivityState.Gameplay;
+            _candidateStreak = 0;
+            _exitStreak = 0;
+            _baselineCount = 0;
+            State = GameActivityState.Gameplay;
+            GameplayFps = double.NaN;
+            GameplayCost = double.NaN;
+            _gameplayGpuLoad = double.NaN;
+        }
+
+        private GameActivityState ClassifyWindow()
+        {
+            double fps = Median(o => o.Fps);
+            double gpu = Median(o => o.GpuLoadPercent);
+            double frameTimeCv = FrameTimeCv();
+            int cap = _window[(_head + WindowSize - 1) % WindowSize].FpsCap;
+
+            if (double.IsNaN(fps))
+                return GameActivityState.Gameplay;
+
+            if (fps < PausedFps && (double.IsNaN(gpu) || gpu < PausedGpuLoad))
+                return GameActivityState.Paused;
+
+            double loadingFps = HasBaseline
+                ? LoadingFpsRatio * EffectiveGameplayFps(cap)
+                : LoadingMaxFps;
+            bool erratic = frameTimeCv > LoadingMinFrameTimeCv || fps < LoadingMaxFps;
+            // Slow frames, or (after low-frame-rate gameplay, where slow proves little) a mostly idle GPU
+            bool stalled = fps < loadingFps || (HasBaseline && gpu < LoadingGpuRatio * _gameplayGpuLoad);
+            if (erratic && stalled && (double.IsNaN(gpu) || gpu < LoadingMaxGpuLoad))
+                return GameActivityState.Loading;
+
+            if (HasBaseline && !double.IsNaN(GameplayCost) && !double.IsNaN(gpu) && fps > 0)
+            {
+                double ratio = State == GameActivityState.Menu ? MenuExitCostRatio : MenuEnterCostRatio;
+                bool steady = double.IsNaN(frameTimeCv) || frameTimeCv < MenuMaxFrameTimeCv;
+                if (steady && gpu / fps < ratio * GameplayCost)
+                    return GameActivityState.Menu;
+            }
+
+            return GameActivityState.Gameplay;
+        }
+
+        // Exit test on the latest observation, so restoring never waits for a full window
+        private bool LooksLikeGameplay(in ActivityObservation o)
+        {
+            if (double.IsNaN(o.Fps))
+                return false;
+
+            switch (State)
+            {
+                case GameActivityState.Paused:
+                    return o.Fps >= PausedFps || o.GpuLoadPercent >= PausedGpuLoad;
+
+                case GameActivityState.Loading:
+                    // Gameplay that outruns the cap sits right at it, which a stuttering loading screen rarely does
+                    double loadingFps = !HasBaseline ? LoadingMaxFps
+                        : o.FpsCap > 0 && GameplayFps > o.FpsCap ? CappedGameplayRatio * o.FpsCap
+                        : LoadingFpsRatio * GameplayFps;
+                    bool steady = o.FrameTimeMs > 0 && Math.Abs(o.FrameTimeMs * o.Fps / 1000 - 1) < SteadyFrameTimeRatio;
+                    // Under a cap the frame rate threshold is low, so frames must also cost what gameplay's do
+                    bool expensive = double.IsNaN(o.GpuLoadPercent) || double.IsNaN(GameplayCost) ||
+                        o.GpuLoadPercent / o.Fps >= MenuExitCostRatio * GameplayCost;
+                    return steady && ((o.Fps >= loadingFps && expensive) || o.GpuLoadPercent >= LoadingMaxGpuLoad);
+
+                case GameActivityState.Menu:
+                    if (double.IsNaN(o.GpuLoadPercent) || o.Fps <= 0) return true;
+                    return o.GpuLoadPercent / o.Fps >= MenuExitCostRatio * GameplayCost;
+
+                default:
+                    return true;
+            }
+        }
+
+        private void LearnBaseline()
+        {
+            double fps = Median(o => o.Fps);
+            if (double.IsNaN(fps) || fps <= 0 || CostSpread() > MaxLearnCostSpread) return;
+
+            // A capped stretch says nothing about what gameplay runs at uncapped
+            var latest = _window[(_head + WindowSize - 1) % WindowSize];
+            if (latest.FpsCap > 0 && fps >= latest.FpsCap * 0.9 && HasBaseline)
+                return;
+
+            double fpsAlpha = fps > GameplayFps ? FastAlpha : SlowAlpha;
+            GameplayFps = double.IsNaN(GameplayFps) ? fps : GameplayFps + fpsAlpha * (fps - GameplayFps);
+
+            double gpu = Median(o => o.GpuLoadPercent);
+            if (!double.IsNaN(gpu))
+                _gameplayGpuLoad = double.IsNaN(_gameplayGpuLoad) ? gpu : _gameplayGpuLoad + SlowAlpha * (gpu - _gameplayGpuLoad);
+
+            double cost = Median(o => o.Fps > 0 ? o.GpuLoadPercent / o.Fps : double.NaN);
+            if (!double.IsNaN(cost))
+            {
+                double costAlpha = cost < GameplayCost ? FastAlpha : CostRiseAlpha;
+                GameplayCost = double.IsNaN(GameplayCost) ? cost : GameplayCost + costAlpha * (cost - GameplayCost);
+            }
+
+            _baselineCount++;
+        }
+
+        private double EffectiveGameplayFps(int cap) =>
+            cap > 0 ? Math.Min(GameplayFps, cap) : GameplayFps;
+
+        // Median over the window ignoring NaN; NaN if nothing is valid. Uses a fixed scratch buffer.
+        private double Median(Func<ActivityObservation, double> selector)
+        {
+            int n = 0;
+            for (int i = 0; i < _count; i++)
+            {
+                double value = selector(_window[i]);
+                if (!double.IsNaN(value))
+                    _scratch[n++] = value;
+            }
+
+            if (n == 0) return double.NaN;
+            Array.Sort(_scratch, 0, n);
+            return n % 2 == 1 ? _scratch[n / 2] : (_scratch[n / 2 - 1] + _scratch[n / 2]) / 2;
+        }
+
+        // Highest over lowest GPU cost per frame in the window; 1 without GPU load
+        private double CostSpread()
+        {
+            double min = double.MaxValue, max = 0;
+            for (int i = 0; i < _count; i++)
+            {
+                var o = _window[i];
+                if (double.IsNaN(o.GpuLoadPercent) || !(o.Fps > 0)) continue;
+                double cost = o.GpuLoadPercent / o.Fps;
+                min = Math.Min(min, cost);
+                max = Math.Max(max, cost);
+            }
+
+            if (max == 0) return 1;
+            return min > 0 ? max / min : double.PositiveInfinity;
+        }
+
+        // Coefficient of variation of frame time across the window
+        private double FrameTimeCv()
+        {
+            int n = 0;
+            double sum = 0, sumSquares = 0;
+            for (int i = 0; i < _count; i++)
+            {
+                double value = _window[i].FrameTimeMs;
+                if (double.IsNaN(value) || value <= 0) continue;
+                n++;
+                sum += value;
+                sumSquares += value * value;
+            }
+
+            if (n < 2) return double.NaN;
+            double mean = sum / n;
+            double variance = Math.Max(0, (sumSquares - n * mean * mean) / (n - 1));
+            return Math.Sqrt(variance) / mean;
+        }
+    }
+
+    /// <summary>
+    /// Energy the power saver saved in one session. Gameplay package power is tracked as the baseline;
+    /// while saving (a non-gameplay state, or the game throttled in the background), each interval
+    /// credits baseline minus measured package power.
+    /// </summary>
+    public sealed class PowerSaverLedger
+    {
+        private const double BaselineAlpha = 0.1;
+        private const long MaxIntervalMs = 10_000;
+
+        private readonly double[] _secondsInState = new double[4];
+        private double _backgroundSeconds;
+        private long _lastTimestampMs;
+        private GameActivityState _lastState = GameActivityState.Gameplay;
+        private bool _lastBackground;
+        private double _lastWatts = double.NaN;
+
+        public double GameplayWatts { get; private set; } = double.NaN;
+        public double EnergySavedWh { get; private set; }
+
+        public TimeSpan TimeIn(GameActivityState state) => TimeSpan.FromSeconds(_secondsInState[(int)state]);
+
+        // Time throttled out of the foreground; not counted under any activity state
+        public TimeSpan BackgroundTime => TimeSpan.FromSeconds(_backgroundSeconds);
+
+        public TimeSpan SavingTime =>
+            TimeIn(GameActivityState.Menu) + TimeIn(GameActivityState.Loading) + TimeIn(GameActivityState.Paused) + BackgroundTime;
+
+        /// <param name="packageWatts">Latest package power, NaN if unknown.</param>
+        /// <param name="background">The game is being throttled for sitting out of the foreground.</param>
+        public void Add(long timestampMs, GameActivityState state, double packageWatts, bool background = false)
+        {
+            long elapsedMs = timestampMs - _lastTimestampMs;
+            if (_lastTimestampMs != 0 && elapsedMs > 0 && elapsedMs <= MaxIntervalMs)
+            {
+                double seconds = elapsedMs / 1000.0;
+                if (_lastBackground)
+                    _backgroundSeconds += seconds;
+                else
+                    _secondsInState[(int)_lastState] += seconds;
+
+                bool saving = _lastBackground || _lastState != GameActivityState.Gameplay;
+                if (saving && !double.IsNaN(GameplayWatts) && !double.IsNaN(_lastWatts))
+                    EnergySavedWh += Math.Max(0, GameplayWatts - _lastWatts) * seconds / 3600.0;
+            }
+
+            if (!background && state == GameActivityState.Gameplay && !double.IsNaN(packageWatts) && packageWatts > 0)
+            {
+                GameplayWatts = double.IsNaN(GameplayWatts)
+                    ? packageWatts
+                    : GameplayWatts + BaselineAlpha * (packageWatts - GameplayWatts);
+            }
+
+            _lastTimestampMs = timestampMs;
+            _lastState = state;
+            _lastBackground = background;
+            _lastWatts = packageWatts > 0 ? packageWatts : double.NaN;
+        }
+    }
+}
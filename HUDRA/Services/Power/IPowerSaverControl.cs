@@ -0,0 +1,33 @@
+namespace HUDRA.Services.Power
+{
+    /// <summary>
+    /// What <see cref="GamePowerSaverService"/> reads and changes on the device.
+    /// </summary>
+    public interface IPowerSaverControl
+    {
+        /// <summary>
+        /// Target TDP in watts, 0 if unknown.
+        /// </summary>
+        int CurrentTdp { get; }
+
+        /// <summary>
+        /// Sets TDP and makes it the sticky target, so TDP correction doesn't put the old value back.
+        /// </summary>
+        bool TrySetTdp(int watts);
+
+        /// <summary>
+        /// Global frame-rate cap, 0 for none.
+        /// </summary>
+        int CurrentFpsLimit { get; }
+
+        /// <summary>
+        /// Sets the global frame-rate cap; 0 removes it.
+        /// </summary>
+        bool TrySetFpsLimit(int fps);
+
+        /// <summary>
+        /// Frame rate, frame time and GPU load for the game right now, NaN where unavailable.
+        /// </summary>
+        ActivityObservation Observe(int processId, long timestampMs);
+    }
+}
@@ -0,0 +1,22 @@
+using HUDRA.Models;
+using System;
+
+namespace HUDRA.Services.Power
+{
+    /// <summary>
+    /// Power plan reads and writes needed for per-game processor settings. Kept behind an interface so
+    /// apply and revert can run against a fake plan store.
+    /// </summary>
+    public interface IProcessorPowerApi
+    {
+        Guid? GetActiveScheme();
+
+        bool TryRead(Guid schemeId, ProcessorPowerSetting setting, out PowerSettingIndex value);
+        bool TryWrite(Guid schemeId, ProcessorPowerSetting setting, PowerSettingIndex value);
+
+        /// <summary>
+        /// Makes a plan active; written indexes of the active plan only take effect once it is re-activated.
+        /// </summary>
+        bool TryActivate(Guid schemeId);
+    }
+}
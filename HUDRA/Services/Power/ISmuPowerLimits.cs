@@ -0,0 +1,35 @@
+namespace HUDRA.Services.Power
+{
+    public enum SmuLimit
+    {
+        Stapm,
+        Slow,
+        Fast,
+        ApuSlow,
+        Tctl
+    }
+
+    /// <summary>
+    /// The SMU's power and temperature limits, as libryzenadj exposes them.
+    /// </summary>
+    public interface ISmuPowerLimits
+    {
+        bool CanWrite(SmuLimit limit);
+
+        /// <summary>
+        /// Sends a limit to the SMU, in milliwatts (degrees C for Tctl). Returns libryzenadj's status, 0 = accepted.
+        /// Accepted doesn't mean applied; some firmware acknowledges and ignores.
+        /// </summary>
+        int Write(SmuLimit limit, uint value);
+
+        /// <summary>
+        /// Re-reads the PM table; <see cref="Read"/> returns what was in it at the last refresh.
+        /// </summary>
+        bool Refresh();
+
+        /// <summary>
+        /// The limit in force, in watts (degrees C for Tctl), or NaN if this table doesn't report it.
+        /// </summary>
+        double Read(SmuLimit limit);
+    }
+}
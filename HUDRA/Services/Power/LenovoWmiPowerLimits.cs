@@ -0,0 +1,35 @@
+using HUDRA.Models;
+using System.Collections.Generic;
+
+namespace HUDRA.Services.Power
+{
+    /// <summary>
+    /// Maps a power envelope onto the LENOVO_OTHER_METHOD.SetFeatureValue capabilities. Lenovo exposes no
+    /// Tctl capability, so Tctl is left to libryzenadj.
+    /// </summary>
+    public static class LenovoWmiPowerLimits
+    {
+        // Lenovo WMI Capability IDs for CPU power limits (from HandheldCompanion)
+        public const int CpuShortTermPowerLimit = 0x0101FF00;  // SPL / STAPM
+        public const int CpuLongTermPowerLimit = 0x0102FF00;   // Slow limit
+        public const int CpuPeakPowerLimit = 0x0103FF00;       // Fast limit
+        public const int ApuSpptPowerLimit = 0x0105FF00;       // APU sPPT
+
+        public static (int CapabilityId, int Watts)[] For(PowerEnvelope envelope)
+        {
+            var limits = new List<(int, int)>();
+            if (envelope.StapmWatts > 0)
+            {
+                limits.Add((CpuShortTermPowerLimit, envelope.StapmWatts));
+                limits.Add((CpuLongTermPowerLimit, envelope.SlowWatts));
+                limits.Add((CpuPeakPowerLimit, envelope.FastWatts));
+            }
+
+            // SetTdpWmi has always written sPPT along with the rest; keep that unless the envelope names one
+            int apuSlow = envelope.ApuSlowWatts > 0 ? envelope.ApuSlowWatts : envelope.SlowWatts;
+            if (apuSlow > 0)
+                limits.Add((ApuSpptPowerLimit, apuSlow));
+            return limits.ToArray();
+        }
+    }
+}
@@ -0,0 +1,137 @@
+using HUDRA.Models;
+using System;
+using System.Collections.Generic;
+using System.Linq;
+
+namespace HUDRA.Services.Power
+{
+    public enum SmuLimitOutcome
+    {
+        Applied,     // Accepted and read back
+        Unverified,  // Accepted; this table doesn't report it
+        Ignored,     // Accepted, but the SMU kept another value
+        Rejected,    // Non-zero status
+        Unsupported  // No setter in this libryzenadj
+    }
+
+    public readonly record struct SmuLimitResult(SmuLimit Limit, int Target, SmuLimitOutcome Outcome, double Actual);
+
+    public sealed class PowerEnvelopeApplyResult
+    {
+        public IReadOnlyList<SmuLimitResult> Limits { get; init; } = Array.Empty<SmuLimitResult>();
+
+        public SmuLimitOutcome? OutcomeOf(SmuLimit limit)
+        {
+            foreach (var result in Limits)
+                if (result.Limit == limit) return result.Outcome;
+            return null;
+        }
+
+        /// <summary>
+        /// Something took, and STAPM did if it was asked for: the TDP the user sees is in force.
+        /// </summary>
+        public bool Success =>
+            Limits.Any(IsInForce) &&
+            Limits.Where(l => l.Limit == SmuLimit.Stapm).All(IsInForce);
+
+        public bool IsComplete => Limits.All(IsInForce);
+
+        /// <summary>
+        /// STAPM was accepted but the SMU kept another value, which driver updates can cause; the Lenovo WMI
+        /// path may still get it through. A rejected STAPM isn't retried there.
+        /// </summary>
+        public bool NeedsWmiFallback => OutcomeOf(SmuLimit.Stapm) == SmuLimitOutcome.Ignored;
+
+        public string Summary => string.Join(" ", Limits.Select(l => $"{Name(l.Limit)}:{l.Outcome}"));
+
+        private static bool IsInForce(SmuLimitResult result) =>
+            result.Outcome is SmuLimitOutcome.Applied or SmuLimitOutcome.Unverified;
+
+        public static string Name(SmuLimit limit) => limit switch
+        {
+            SmuLimit.Stapm => "STAPM",
+            SmuLimit.ApuSlow => "sPPT",
+            _ => limit.ToString()
+        };
+    }
+
+    /// <summary>
+    /// Writes a validated <see cref="PowerEnvelope"/> to the SMU and reads it back. Limits being raised go
+    /// widest first (fast, slow, STAPM) and limits being lowered narrowest first, so STAPM ≤ slow ≤ fast
+    /// holds after every single write; firmware that checks the order never sees a violation, and a
+    /// failure part way leaves a consistent set behind.
+    /// </summary>
+    public static class PowerEnvelopeApplier
+    {
+        // Same tolerance SetTdp has always verified STAPM with; the SMU rounds to its own steps
+        private const double WattTolerance = 2.0;
+        private const double TctlTolerance = 1.0;
+
+        private static readonly SmuLimit[] WidestFirst = { SmuLimit.Fast, SmuLimit.Slow, SmuLimit.Stapm, SmuLimit.ApuSlow, SmuLimit.Tctl };
+
+        /// <param name="waitForSmu">Called between the writes and the read-back; the PM table lags a write.</param>
+        public static PowerEnvelopeApplyResult Apply(ISmuPowerLimits smu, PowerEnvelope envelope, Action? waitForSmu = null)
+        {
+            var targets = new Dictionary<SmuLimit, int>();
+            if (envelope.StapmWatts > 0) targets[SmuLimit.Stapm] = envelope.StapmWatts;
+            if (envelope.SlowWatts > 0) targets[SmuLimit.Slow] = envelope.SlowWatts;
+            if (envelope.FastWatts > 0) targets[SmuLimit.Fast] = envelope.FastWatts;
+            if (envelope.ApuSlowWatts > 0) targets[SmuLimit.ApuSlow] = envelope.ApuSlowWatts;
+            if (envelope.TctlCelsius > 0) targets[SmuLimit.Tctl] = envelope.TctlCelsius;
+
+            // Unknown current values are treated as raises, which is the order that's safe from a flat TDP
+            bool haveCurrent = smu.Refresh();
+            var raising = new List<SmuLimit>();
+            var lowering = new List<SmuLimit>();
+            foreach (var limit in WidestFirst)
+            {
+                if (!targets.TryGetValue(limit, out int target)) continue;
+                double current = haveCurrent ? smu.Read(limit) : double.NaN;
+                if (current > target) lowering.Add(limit);
+                else raising.Add(limit);
+            }
+            lowering.Reverse();
+
+            var outcomes = new Dictionary<SmuLimit, SmuLimitOutcome>();
+            foreach (var limit in raising.Concat(lowering))
+            {
+                if (!smu.CanWrite(limit))
+                {
+                    outcomes[limit] = SmuLimitOutcome.Unsupported;
+                    continue;
+                }
+
+                uint value = limit == SmuLimit.Tctl ? (uint)targets[limit] : (uint)targets[limit] * 1000;
+                int status = smu.Write(limit, value);
+                outcomes[limit] = status == 0 ? SmuLimitOutcome.Unverified : SmuLimitOutcome.Rejected;
+                if (status != 0)
+                    System.Diagnostics.Debug.WriteLine($"[TDP] {PowerEnvelopeApplyResult.Name(limit)} {targets[limit]} rejected ({status})");
+            }
+
+            var results = new List<SmuLimitResult>();
+            bool canVerify = outcomes.ContainsValue(SmuLimitOutcome.Unverified);
+            if (canVerify)
+            {
+                waitForSmu?.Invoke();
+                canVerify = smu.Refresh();
+            }
+
+            foreach (var limit in WidestFirst)
+            {
+                if (!outcomes.TryGetValue(limit, out var outcome)) continue;
+
+                double actual = double.NaN;
+                if (outcome == SmuLimitOutcome.Unverified && canVerify)
+                {
+                    actual = smu.Read(limit);
+                    double tolerance = limit == SmuLimit.Tctl ? TctlTolerance : WattTolerance;
+                    if (!double.IsNaN(actual))
+                        outcome = Math.Abs(actual - targets[limit]) <= tolerance ? SmuLimitOutcome.Applied : SmuLimitOutcome.Ignored;
+                }
+                results.Add(new SmuLimitResult(limit, targets[limit], outcome, actual));
+            }
+
+            return new PowerEnvelopeApplyResult { Limits = results };
+        }
+    }
+}
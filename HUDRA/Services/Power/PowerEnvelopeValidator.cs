@@ -0,0 +1,129 @@
+using HUDRA.Configuration;
+using HUDRA.Models;
+using System;
+using System.Collections.Generic;
+
+namespace HUDRA.Services.Power
+{
+    /// <summary>
+    /// What a device's cooling and power delivery can take. Known handhelds get their vendor's ceilings;
+    /// anything else is held to the TDP picker's range, since boosting past it is only safe where the
+    /// limits are known.
+    /// </summary>
+    public sealed record PowerEnvelopeLimits
+    {
+        public int MinWatts { get; init; } = HudraSettings.MIN_TDP;
+        public int MaxStapmWatts { get; init; } = HudraSettings.MAX_TDP;
+        public int MaxSlowWatts { get; init; } = HudraSettings.MAX_TDP;
+        public int MaxFastWatts { get; init; } = HudraSettings.MAX_TDP;
+        public int MaxApuSlowWatts { get; init; } = HudraSettings.MAX_TDP;
+        public int MinTctlCelsius { get; init; } = 60;
+        public int MaxTctlCelsius { get; init; } = 95;
+
+        /// <summary>
+        /// Tctl to go back to when the one in force before a profile couldn't be read.
+        /// </summary>
+        public int DefaultTctlCelsius { get; init; } = 95;
+
+        public static PowerEnvelopeLimits Generic { get; } = new();
+
+        public static PowerEnvelopeLimits ForDevice(DetectedDevice device)
+        {
+            return device.DeviceName switch
+            {
+                // Z1 Extreme; Lenovo's Custom mode ceilings
+                "Legion Go" => new PowerEnvelopeLimits
+                {
+                    MaxStapmWatts = 30, MaxSlowWatts = 35, MaxFastWatts = 41, MaxApuSlowWatts = 35,
+                    MaxTctlCelsius = 100, DefaultTctlCelsius = 100
+                },
+                // 7840U / 8840U
+                "Win Mini" or "Win 4 Series" or "X1 Series" or "F1 Series" => new PowerEnvelopeLimits
+                {
+                    MaxStapmWatts = 30, MaxSlowWatts = 32, MaxFastWatts = 35, MaxApuSlowWatts = 30,
+                    MaxTctlCelsius = 100, DefaultTctlCelsius = 100
+                },
+                _ => Generic
+            };
+        }
+    }
+
+    public sealed class PowerEnvelopeValidation
+    {
+        /// <summary>
+        /// The envelope to apply: clamped, ordered, and with slow and fast filled in from STAPM where unset.
+        /// </summary>
+        public PowerEnvelope Envelope { get; init; } = new();
+
+        /// <summary>
+        /// One line per value that had to change, for the profile result.
+        /// </summary>
+        public IReadOnlyList<string> Adjustments { get; init; } = Array.Empty<string>();
+
+        public bool WasAdjusted => Adjustments.Count > 0;
+    }
+
+    /// <summary>
+    /// Turns a requested envelope into one the SMU will take: every value inside the device's limits, and
+    /// STAPM ≤ slow ≤ fast, which is how the SMU nests its averaging windows: a limit above the one outside
+    /// it can never be reached, so the profile would promise a boost it doesn't get.
+    /// </summary>
+    public static class PowerEnvelopeValidator
+    {
+        public static PowerEnvelopeValidation Validate(PowerEnvelope requested, PowerEnvelopeLimits limits)
+        {
+            var adjustments = new List<string>();
+
+            int stapm = 0, slow = 0, fast = 0;
+            if (requested.StapmWatts > 0)
+            {
+                stapm = Clamp("TDP", requested.StapmWatts, limits.MinWatts, limits.MaxStapmWatts, "W", adjustments);
+
+                // Unset means flat, as SetTdp has always written them
+                slow = requested.SlowWatts > 0
+                    ? Clamp("Slow limit", requested.SlowWatts, stapm, Math.Max(stapm, limits.MaxSlowWatts), "W", adjustments)
+                    : stapm;
+                fast = requested.FastWatts > 0
+                    ? Clamp("Fast limit", requested.FastWatts, slow, Math.Max(slow, limits.MaxFastWatts), "W", adjustments)
+                    : slow;
+            }
+            else if (requested.SlowWatts > 0 || requested.FastWatts > 0)
+            {
+                // Without STAPM there's nothing to order them against
+                adjustments.Add("Slow and fast limits need a TDP; ignored");
+            }
+
+            int apuSlow = 0;
+            if (requested.ApuSlowWatts > 0)
+            {
+                int ceiling = slow > 0 ? Math.Min(slow, limits.MaxApuSlowWatts) : limits.MaxApuSlowWatts;
+                apuSlow = Clamp("sPPT", requested.ApuSlowWatts, limits.MinWatts, Math.Max(limits.MinWatts, ceiling), "W", adjustments);
+            }
+
+            int tctl = 0;
+            if (requested.TctlCelsius > 0)
+                tctl = Clamp("Tctl", requested.TctlCelsius, limits.MinTctlCelsius, limits.MaxTctlCelsius, "°C", adjustments);
+
+            return new PowerEnvelopeValidation
+            {
+                Envelope = new PowerEnvelope
+                {
+                    StapmWatts = stapm,
+                    SlowWatts = slow,
+                    FastWatts = fast,
+                    ApuSlowWatts = apuSlow,
+                    TctlCelsius = tctl
+                },
+                Adjustments = adjustments
+            };
+        }
+
+        private static int Clamp(string name, int value, int min, int max, string unit, List<string> adjustments)
+        {
+            int clamped = Math.Clamp(value, min, max);
+            if (clamped != value)
+                adjustments.Add($"{name} {value}{unit} -> {clamped}{unit} ({min}-{max}{unit} allowed)");
+            return clamped;
+        }
+    }
+}
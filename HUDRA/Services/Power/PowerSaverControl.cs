@@ -0,0 +1,79 @@
+using System;
+using System.Threading.Tasks;
+
+namespace HUDRA.Services.Power
+{
+    /// <summary>
+    /// TDP through ryzenadj and the TDP monitor, the cap through RTSS, frame rate from RTSS shared memory
+    /// and GPU load from the temperature monitor.
+    /// </summary>
+    public sealed class PowerSaverControl : IPowerSaverControl, IDisposable
+    {
+        private readonly RtssFpsLimiterService _fpsLimiter;
+        private readonly Func<TdpMonitorService?> _getTdpMonitor;
+        private readonly Func<TemperatureMonitorService?> _getTemperatureMonitor;
+        private TDPService? _tdpService;
+
+        public PowerSaverControl(RtssFpsLimiterService fpsLimiter,
+            Func<TdpMonitorService?> getTdpMonitor,
+            Func<TemperatureMonitorService?> getTemperatureMonitor)
+        {
+            _fpsLimiter = fpsLimiter;
+            _getTdpMonitor = getTdpMonitor;
+            _getTemperatureMonitor = getTemperatureMonitor;
+        }
+
+        public int CurrentTdp => _getTdpMonitor()?.TargetTdp ?? 0;
+
+        public bool TrySetTdp(int watts)
+        {
+            _tdpService ??= new TDPService();
+            var result = _tdpService.SetTdp(watts * 1000);
+            if (!result.Success)
+            {
+                System.Diagnostics.Debug.WriteLine($"PowerSaver: Setting {watts}W failed: {result.Message}");
+                return false;
+            }
+
+            // Sticky TDP would otherwise "correct" the saver back up within a minute
+            _getTdpMonitor()?.UpdateTargetTdp(watts);
+            return true;
+        }
+
+        public int CurrentFpsLimit => _fpsLimiter.GetCurrentFpsLimit();
+
+        public bool TrySetFpsLimit(int fps)
+        {
+            // The limiter's async methods may resume on a captured context; run them off it and wait
+            try
+            {
+                return Task.Run(() => fps > 0 ? _fpsLimiter.SetGlobalFpsLimitAsync(fps) : _fpsLimiter.DisableGlobalFpsLimitAsync())
+                    .GetAwaiter().GetResult();
+            }
+            catch (Exception ex)
+            {
+                System.Diagnostics.Debug.WriteLine($"PowerSaver: FPS limit change failed: {ex.Message}");
+                return false;
+            }
+        }
+
+        public ActivityObservation Observe(int processId, long timestampMs)
+        {
+            RtssFrameRateReader.TryRead(processId, out double fps, out double frameTimeMs);
+            return new ActivityObservation
+            {
+                TimestampMs = timestampMs,
+                Fps = fps,
+                FrameTimeMs = frameTimeMs,
+                GpuLoadPercent = _getTemperatureMonitor()?.CurrentTemperature.GpuLoadPercent ?? double.NaN,
+                FpsCap = _fpsLimiter.GetCurrentFpsLimit()
+            };
+        }
+
+        public void Dispose()
+        {
+            _tdpService?.Dispose();
+            _tdpService = null;
+        }
+    }
+}
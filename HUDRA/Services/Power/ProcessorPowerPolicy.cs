@@ -0,0 +1,90 @@
+using HUDRA.Models;
+using System;
+using System.Collections.Generic;
+
+namespace HUDRA.Services.Power
+{
+    /// <summary>
+    /// Pure resolution of a game profile's processor power settings into power plan indexes, and of what
+    /// to write back on revert. No OS calls.
+    /// </summary>
+    public static class ProcessorPowerPolicy
+    {
+        public const string EnergyDefault = "Default";
+        public const string EnergyPerformance = "Performance";
+        public const string EnergyBalanced = "Balanced";
+        public const string EnergyEfficiency = "Efficiency";
+        public const string EnergyMaxEfficiency = "MaxEfficiency";
+
+        public const string BoostDefault = "Default";
+        public const string BoostDisabled = "Disabled";
+        public const string BoostEfficient = "Efficient";
+        public const string BoostAggressive = "Aggressive";
+
+        /// <summary>
+        /// Lowest max processor state a profile can set; below it games stall on single-thread work
+        /// instead of just not boosting.
+        /// </summary>
+        public const int MinMaxProcessorState = 50;
+
+        // PERFBOOSTMODE values
+        private const uint BoostModeDisabled = 0;
+        private const uint BoostModeAggressive = 2;
+        private const uint BoostModeEfficientEnabled = 3;
+
+        /// <summary>
+        /// The index to write for each setting the profile configures; settings left at default are absent.
+        /// The same index is used plugged in and on battery.
+        /// </summary>
+        public static Dictionary<ProcessorPowerSetting, uint> Resolve(GameProfile profile)
+        {
+            var targets = new Dictionary<ProcessorPowerSetting, uint>();
+
+            if (profile.MaxProcessorState > 0)
+                targets[ProcessorPowerSetting.MaxProcessorState] = (uint)Math.Clamp(profile.MaxProcessorState, MinMaxProcessorState, 100);
+
+            uint? energy = profile.EnergyPreference switch
+            {
+                EnergyPerformance => 0,
+                EnergyBalanced => 50,
+                EnergyEfficiency => 80,
+                EnergyMaxEfficiency => 100,
+                _ => null
+            };
+            if (energy.HasValue)
+                targets[ProcessorPowerSetting.EnergyPerformancePreference] = energy.Value;
+
+            uint? boost = profile.CpuBoostMode switch
+            {
+                BoostDisabled => BoostModeDisabled,
+                BoostEfficient => BoostModeEfficientEnabled,
+                BoostAggressive => BoostModeAggressive,
+                _ => null
+            };
+            if (boost.HasValue)
+                targets[ProcessorPowerSetting.BoostMode] = boost.Value;
+
+            return targets;
+        }
+
+        /// <summary>
+        /// What to write back after a game: for each setting the profile changed, the revert target's value
+        /// if it was read from the same plan (a saved Default Profile), otherwise the value from before the
+        /// profile. Written to the plan the profile changed, even if another plan is active by then.
+        /// </summary>
+        public static ProcessorPowerSnapshot ResolveRevert(ProcessorPowerSnapshot changed, ProcessorPowerSnapshot? revertTarget)
+        {
+            bool samePlan = revertTarget != null && revertTarget.SchemeId == changed.SchemeId;
+            var result = new ProcessorPowerSnapshot { SchemeId = changed.SchemeId };
+
+            foreach (var (setting, before) in changed.Values)
+            {
+                result.Values[setting] = samePlan && revertTarget!.Values.TryGetValue(setting, out var target)
+                    ? target
+                    : before;
+            }
+
+            return result;
+        }
+    }
+}
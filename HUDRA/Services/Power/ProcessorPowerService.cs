@@ -0,0 +1,117 @@
+using HUDRA.Models;
+using System;
+using System.Collections.Generic;
+using System.Linq;
+
+namespace HUDRA.Services.Power
+{
+    /// <summary>
+    /// Applies per-game processor settings (max state, EPP, boost mode) to the active power plan in
+    /// process, and writes the previous values back. Each setting is read before it's written, so a
+    /// revert touches only what was changed and leaves the rest of the plan alone.
+    /// </summary>
+    public sealed class ProcessorPowerService
+    {
+        private static readonly ProcessorPowerSetting[] AllSettings =
+        {
+            ProcessorPowerSetting.MaxProcessorState,
+            ProcessorPowerSetting.EnergyPerformancePreference,
+            ProcessorPowerSetting.BoostMode
+        };
+
+        private readonly IProcessorPowerApi _api;
+
+        public ProcessorPowerService() : this(new Win32ProcessorPowerApi())
+        {
+        }
+
+        public ProcessorPowerService(IProcessorPowerApi api)
+        {
+            _api = api;
+        }
+
+        /// <summary>
+        /// Every processor setting of the active plan, or null if there's no active plan to read.
+        /// </summary>
+        public ProcessorPowerSnapshot? Capture()
+        {
+            var schemeId = _api.GetActiveScheme();
+            if (schemeId == null)
+                return null;
+
+            var snapshot = new ProcessorPowerSnapshot { SchemeId = schemeId.Value };
+            foreach (var setting in AllSettings)
+            {
+                if (_api.TryRead(schemeId.Value, setting, out var value))
+                    snapshot.Values[setting] = value;
+            }
+            return snapshot;
+        }
+
+        /// <summary>
+        /// Writes the targets to the active plan, plugged in and on battery. Restore holds the previous
+        /// value of everything that may have changed, null if nothing did.
+        /// </summary>
+        public (bool Success, ProcessorPowerSnapshot? Restore, string Message) Apply(IReadOnlyDictionary<ProcessorPowerSetting, uint> targets)
+        {
+            if (targets.Count == 0)
+                return (true, null, "Nothing to change");
+
+            var schemeId = _api.GetActiveScheme();
+            if (schemeId == null)
+                return (false, null, "No active power plan");
+
+            var restore = new ProcessorPowerSnapshot { SchemeId = schemeId.Value };
+            var failed = new List<string>();
+            foreach (var (setting, index) in targets)
+            {
+                // Unreadable means unrevertable; leave it alone
+                if (!_api.TryRead(schemeId.Value, setting, out var before))
+                {
+                    failed.Add(setting.ToString());
+                    continue;
+                }
+
+                if (before == new PowerSettingIndex(index, index))
+                    continue;
+
+                // Before the write, so a half-written AC/DC pair is still put back
+                restore.Values[setting] = before;
+                if (!_api.TryWrite(schemeId.Value, setting, new PowerSettingIndex(index, index)))
+                    failed.Add(setting.ToString());
+            }
+
+            if (restore.Values.Count > 0 && !_api.TryActivate(schemeId.Value))
+                failed.Add("activate");
+
+            var applied = string.Join(", ", targets.Select(t => $"{t.Key}={t.Value}"));
+            System.Diagnostics.Debug.WriteLine($"ProcessorPower: {applied}{(failed.Count > 0 ? $" (failed: {string.Join(", ", failed)})" : "")}");
+
+            return (failed.Count == 0,
+                restore.Values.Count > 0 ? restore : null,
+                failed.Count == 0 ? applied : $"Failed: {string.Join(", ", failed)}");
+        }
+
+        /// <summary>
+        /// Writes a snapshot back to its plan. The plan is only re-activated if it is still the active one;
+        /// another plan's values take effect whenever it's selected again.
+        /// </summary>
+        public bool Restore(ProcessorPowerSnapshot snapshot)
+        {
+            bool success = true;
+            foreach (var (setting, value) in snapshot.Values)
+            {
+                if (!_api.TryWrite(snapshot.SchemeId, setting, value))
+                {
+                    System.Diagnostics.Debug.WriteLine($"ProcessorPower: Could not restore {setting}");
+                    success = false;
+                }
+            }
+
+            if (snapshot.Values.Count > 0 && _api.GetActiveScheme() == snapshot.SchemeId)
+                success &= _api.TryActivate(snapshot.SchemeId);
+
+            return success;
+        }
+    }
+}
@@ -0,0 +1,92 @@
+using HUDRA.Models;
+using System;
+using System.Runtime.InteropServices;
+
+namespace HUDRA.Services.Power
+{
+    /// <summary>
+    /// PowrProf implementation of <see cref="IProcessorPowerApi"/>. Same settings powercfg edits, without
+    /// a process per read or write.
+    /// </summary>
+    public class Win32ProcessorPowerApi : IProcessorPowerApi
+    {
+        private const uint ERROR_SUCCESS = 0;
+
+        private static readonly Guid GUID_PROCESSOR_SETTINGS_SUBGROUP = new("54533251-82be-4824-96c1-47b60b740d00");
+        private static readonly Guid GUID_PROCESSOR_THROTTLE_MAXIMUM = new("bc5038f7-23e0-4960-96da-33abaf5935ec");
+        private static readonly Guid GUID_PROCESSOR_PERF_ENERGY_PREFERENCE = new("36687f9e-e3a5-4dbf-b1dc-15eb381c6863");
+        private static readonly Guid GUID_PROCESSOR_PERF_BOOST_MODE = new("be337238-0d82-4146-a960-4f3749d470c7");
+
+        public Guid? GetActiveScheme()
+        {
+            if (PowerGetActiveScheme(IntPtr.Zero, out var schemePtr) != ERROR_SUCCESS || schemePtr == IntPtr.Zero)
+                return null;
+
+            try
+            {
+                return Marshal.PtrToStructure<Guid>(schemePtr);
+            }
+            finally
+            {
+                LocalFree(schemePtr);
+            }
+        }
+
+        public bool TryRead(Guid schemeId, ProcessorPowerSetting setting, out PowerSettingIndex value)
+        {
+            value = default;
+            var subgroup = GUID_PROCESSOR_SETTINGS_SUBGROUP;
+            var settingId = GetSettingGuid(setting);
+
+            if (PowerReadACValueIndex(IntPtr.Zero, ref schemeId, ref subgroup, ref settingId, out uint ac) != ERROR_SUCCESS ||
+                PowerReadDCValueIndex(IntPtr.Zero, ref schemeId, ref subgroup, ref settingId, out uint dc) != ERROR_SUCCESS)
+                return false;
+
+            value = new PowerSettingIndex(ac, dc);
+            return true;
+        }
+
+        public bool TryWrite(Guid schemeId, ProcessorPowerSetting setting, PowerSettingIndex value)
+        {
+            var subgroup = GUID_PROCESSOR_SETTINGS_SUBGROUP;
+            var settingId = GetSettingGuid(setting);
+
+            return PowerWriteACValueIndex(IntPtr.Zero, ref schemeId, ref subgroup, ref settingId, value.Ac) == ERROR_SUCCESS &&
+                PowerWriteDCValueIndex(IntPtr.Zero, ref schemeId, ref subgroup, ref settingId, value.Dc) == ERROR_SUCCESS;
+        }
+
+        public bool TryActivate(Guid schemeId)
+        {
+            return PowerSetActiveScheme(IntPtr.Zero, ref schemeId) == ERROR_SUCCESS;
+        }
+
+        private static Guid GetSettingGuid(ProcessorPowerSetting setting) => setting switch
+        {
+            ProcessorPowerSetting.MaxProcessorState => GUID_PROCESSOR_THROTTLE_MAXIMUM,
+            ProcessorPowerSetting.EnergyPerformancePreference => GUID_PROCESSOR_PERF_ENERGY_PREFERENCE,
+            ProcessorPowerSetting.BoostMode => GUID_PROCESSOR_PERF_BOOST_MODE,
+            _ => throw new ArgumentOutOfRangeException(nameof(setting))
+        };
+
+        [DllImport("powrprof.dll")]
+        private static extern uint PowerGetActiveScheme(IntPtr userRootPowerKey, out IntPtr activePolicyGuid);
+
+        [DllImport("powrprof.dll")]
+        private static extern uint PowerSetActiveScheme(IntPtr userRootPowerKey, ref Guid schemeGuid);
+
+        [DllImport("powrprof.dll")]
+        private static extern uint PowerReadACValueIndex(IntPtr rootPowerKey, ref Guid schemeGuid, ref Guid subGroupOfPowerSettingsGuid, ref Guid powerSettingGuid, out uint acValueIndex);
+
+        [DllImport("powrprof.dll")]
+        private static extern uint PowerReadDCValueIndex(IntPtr rootPowerKey, ref Guid schemeGuid, ref Guid subGroupOfPowerSettingsGuid, ref Guid powerSettingGuid, out uint dcValueIndex);
+
+        [DllImport("powrprof.dll")]
+        private static extern uint PowerWriteACValueIndex(IntPtr rootPowerKey, ref Guid schemeGuid, ref Guid subGroupOfPowerSettingsGuid, ref Guid powerSettingGuid, uint acValueIndex);
+
+        [DllImport("powrprof.dll")]
+        private static extern uint PowerWriteDCValueIndex(IntPtr rootPowerKey, ref Guid schemeGuid, ref Guid subGroupOfPowerSettingsGuid, ref Guid powerSettingGuid, uint dcValueIndex);
+
+        [DllImport("kernel32.dll")]
+        private static extern IntPtr LocalFree(IntPtr hMem);
+    }
+}
@@ -0,0 +1,43 @@
+using System;
+using System.Collections.Generic;
+
+namespace HUDRA.Services.QuickPause
+{
+    /// <summary>
+    /// One process from a system snapshot, with enough to rebuild the parent/child tree.
+    /// </summary>
+    public class ProcessTreeEntry
+    {
+        public int ProcessId { get; set; }
+        public int ParentProcessId { get; set; }
+        public string ProcessName { get; set; } = string.Empty;
+
+        /// <summary>
+        /// Creation time, or <see cref="DateTime.MinValue"/> when it couldn't be read. Parent PIDs are not
+        /// cleared when the parent exits, so a child must be younger than its parent to count as one.
+        /// </summary>
+        public DateTime StartTimeUtc { get; set; }
+    }
+
+    /// <summary>
+    /// OS calls needed to suspend and resume a process tree. Kept behind an interface so the
+    /// pause/resume state machine can run against a fake process table.
+    /// </summary>
+    public interface IProcessSuspendApi
+    {
+        IReadOnlyList<ProcessTreeEntry> GetProcessTree();
+
+        /// <summary>
+        /// Suspends every thread of the process. Each call adds one to each thread's suspend count,
+        /// so it must be paired with exactly one <see cref="TryResume"/>.
+        /// </summary>
+        bool TrySuspend(int processId);
+
+        bool TryResume(int processId);
+
+        /// <summary>
+        /// Returns the process name for a PID, or null if it has exited. Used to guard against PID reuse on resume.
+        /// </summary>
+        string? GetProcessName(int processId);
+    }
+}
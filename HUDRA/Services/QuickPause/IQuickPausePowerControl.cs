@@ -0,0 +1,13 @@
+namespace HUDRA.Services.QuickPause
+{
+    /// <summary>
+    /// Drops the device to idle power while a game is paused and puts it back afterwards. The
+    /// implementation remembers what it changed; <see cref="Restore"/> is only called after
+    /// <see cref="EnterIdle"/>, and at most once per pause.
+    /// </summary>
+    public interface IQuickPausePowerControl
+    {
+        void EnterIdle();
+        void Restore();
+    }
+}
@@ -0,0 +1,97 @@
+using HUDRA.Services.Power;
+using System;
+
+namespace HUDRA.Services.QuickPause
+{
+    /// <summary>
+    /// Measures battery draw over a pause. Over a long enough discharge the drop in remaining capacity is
+    /// the most honest figure (it includes everything the rate misses between readings); short pauses fall
+    /// back to integrating the reported discharge rate. Readings from the first seconds are skipped because
+    /// the battery's own rate trails the load and would still carry the game.
+    /// </summary>
+    public sealed class PauseDrainMeter
+    {
+        private const long SettleMs = 30_000;
+        private const long MaxIntervalMs = 60_000;
+        private const long MinCapacitySpanMs = 5 * 60_000;
+
+        private long _startMs;
+        private double _energyWh;
+        private double _hours;
+        private long _lastRateMs;
+        private double _lastWatts = double.NaN;
+        private long _firstCapacityMs;
+        private double _firstCapacityWh = double.NaN;
+        private long _lastCapacityMs;
+        private double _lastCapacityWh = double.NaN;
+        private bool _charging;
+
+        public void Start(long timestampMs)
+        {
+            _startMs = timestampMs;
+            _energyWh = 0;
+            _hours = 0;
+            _lastWatts = double.NaN;
+            _firstCapacityWh = double.NaN;
+            _lastCapacityWh = double.NaN;
+            _charging = false;
+        }
+
+        public void Add(in BatteryReading reading)
+        {
+            if (reading.TimestampMs < _startMs + SettleMs)
+                return;
+
+            // Plugged in at some point: the capacity drop no longer measures the pause
+            if (reading.DischargeWatts <= 0)
+            {
+                _charging = true;
+                _lastWatts = double.NaN;
+                return;
+            }
+
+            if (reading.DischargeWatts > 0)
+            {
+                long elapsedMs = reading.TimestampMs - _lastRateMs;
+                if (!double.IsNaN(_lastWatts) && elapsedMs > 0 && elapsedMs <= MaxIntervalMs)
+                {
+                    double hours = elapsedMs / 3_600_000.0;
+                    _energyWh += (_lastWatts + reading.DischargeWatts) / 2 * hours;
+                    _hours += hours;
+                }
+                _lastRateMs = reading.TimestampMs;
+                _lastWatts = reading.DischargeWatts;
+            }
+
+            if (reading.RemainingWh > 0)
+            {
+                if (double.IsNaN(_firstCapacityWh))
+                {
+                    _firstCapacityMs = reading.TimestampMs;
+                    _firstCapacityWh = reading.RemainingWh;
+                }
+                _lastCapacityMs = reading.TimestampMs;
+                _lastCapacityWh = reading.RemainingWh;
+            }
+        }
+
+        /// <summary>
+        /// Average draw so far, NaN until there's a reading past the settle time on battery.
+        /// </summary>
+        public double AverageWatts
+        {
+            get
+            {
+                long capacitySpanMs = _lastCapacityMs - _firstCapacityMs;
+                double capacityDropWh = _firstCapacityWh - _lastCapacityWh;
+                if (!_charging && capacitySpanMs >= MinCapacitySpanMs && capacityDropWh > 0)
+                    return capacityDropWh / (capacitySpanMs / 3_600_000.0);
+
+                if (_hours > 0)
+                    return _energyWh / _hours;
+
+                return _lastWatts;
+            }
+        }
+    }
+}
@@ -0,0 +1,116 @@
+using HUDRA.Configuration;
+using HUDRA.Services.FanControl;
+using HUDRA.Services.Power;
+using System;
+
+namespace HUDRA.Services.QuickPause
+{
+    /// <summary>
+    /// Idles TDP and the fan for a quick pause. TDP goes to the minimum; a software-controlled fan (fixed
+    /// speed or curve) is handed back to the EC, which spins it down as the idle APU cools and still
+    /// protects it if something else heats up. The power saver is held so it doesn't read the pause as a
+    /// user change. Anything the user changes while paused is left as they set it.
+    /// </summary>
+    public sealed class QuickPausePowerControl : IQuickPausePowerControl, IDisposable
+    {
+        private readonly Func<TdpMonitorService?> _getTdpMonitor;
+        private readonly Func<FanControlService?> _getFanControl;
+        private readonly Func<TemperatureMonitorService?> _getTemperatureMonitor;
+        private readonly Func<GamePowerSaverService?> _getPowerSaver;
+        private TDPService? _tdpService;
+
+        // What was in force before the pause; 0 / false = not changed by us
+        private int _savedTdp;
+        private bool _fanReleased;
+        private bool _savedTemperatureControl;
+        private double _savedFanSpeed;
+
+        public QuickPausePowerControl(Func<TdpMonitorService?> getTdpMonitor,
+            Func<FanControlService?> getFanControl,
+            Func<TemperatureMonitorService?> getTemperatureMonitor,
+            Func<GamePowerSaverService?> getPowerSaver)
+        {
+            _getTdpMonitor = getTdpMonitor;
+            _getFanControl = getFanControl;
+            _getTemperatureMonitor = getTemperatureMonitor;
+            _getPowerSaver = getPowerSaver;
+        }
+
+        public void EnterIdle()
+        {
+            // First, so the TDP saved below is the profile's rather than a saver level
+            _getPowerSaver()?.Hold();
+
+            var tdpMonitor = _getTdpMonitor();
+            int current = tdpMonitor?.TargetTdp ?? 0;
+            if (current > HudraSettings.MIN_TDP && SetTdp(HudraSettings.MIN_TDP))
+            {
+                // Sticky TDP would otherwise put it back within a minute
+                tdpMonitor!.UpdateTargetTdp(HudraSettings.MIN_TDP);
+                _savedTdp = current;
+            }
+
+            var fan = _getFanControl();
+            if (fan != null && fan.IsDeviceAvailable && fan.CurrentMode == FanControlMode.Software)
+            {
+                _savedTemperatureControl = fan.IsTemperatureControlEnabled;
+                _savedFanSpeed = fan.CurrentFanSpeed;
+
+                // Otherwise the next temperature change would put the curve's speed back
+                if (_savedTemperatureControl)
+                    fan.DisableTemperatureControl();
+                _fanReleased = fan.SetAutoMode().Success;
+                if (!_fanReleased)
+                    RestoreTemperatureControl(fan);
+            }
+
+            System.Diagnostics.Debug.WriteLine($"QuickPause: Idle - TDP {(_savedTdp > 0 ? $"{_savedTdp}W -> {HudraSettings.MIN_TDP}W" : "unchanged")}, " +
+                $"fan {(_fanReleased ? "to hardware control" : "unchanged")}");
+        }
+
+        public void Restore()
+        {
+            var tdpMonitor = _getTdpMonitor();
+            if (_savedTdp > 0 && tdpMonitor != null && tdpMonitor.TargetTdp == HudraSettings.MIN_TDP && SetTdp(_savedTdp))
+                tdpMonitor.UpdateTargetTdp(_savedTdp);
+            _savedTdp = 0;
+
+            var fan = _getFanControl();
+            if (_fanReleased && fan != null && fan.CurrentMode == FanControlMode.Hardware)
+            {
+                if (!RestoreTemperatureControl(fan) || !SettingsService.GetFanCurve().IsEnabled)
+                    fan.SetFanSpeed(_savedFanSpeed);
+                else
+                    fan.ApplyCurrentFanCurve();
+            }
+            _fanReleased = false;
+
+            _getPowerSaver()?.Release();
+        }
+
+        private bool RestoreTemperatureControl(FanControlService fan)
+        {
+            var temperatureMonitor = _getTemperatureMonitor();
+            if (!_savedTemperatureControl || temperatureMonitor == null)
+                return false;
+
+            fan.EnableTemperatureControl(temperatureMonitor);
+            return true;
+        }
+
+        private bool SetTdp(int watts)
+        {
+            _tdpService ??= new TDPService();
+            var result = _tdpService.SetTdp(watts * 1000);
+            if (!result.Success)
+                System.Diagnostics.Debug.WriteLine($"QuickPause: Setting {watts}W failed: {result.Message}");
+            return result.Success;
+        }
+
+        public void Dispose()
+        {
+            _tdpService?.Dispose();
+            _tdpService = null;
+        }
+    }
+}
@@ -0,0 +1,272 @@
+using HUDRA.Services.Power;
+using System;
+using System.Collections.Generic;
+using System.Threading;
+
+namespace HUDRA.Services.QuickPause
+{
+    public readonly struct QuickPauseReport
+    {
+        public TimeSpan Duration { get; init; }
+        public int ProcessCount { get; init; }
+
+        /// <summary>
+        /// Battery draw while paused, NaN when it couldn't be measured (on AC, or too short a pause).
+        /// </summary>
+        public double AverageDrainWatts { get; init; }
+
+        public double EnergyWh => AverageDrainWatts * Duration.TotalHours;
+    }
+
+    /// <summary>
+    /// Freezes the running game and its child processes so the device can sit at idle power without
+    /// closing anything, then thaws exactly what it froze. The game is suspended first so it can't start
+    /// a child that would be missed; on resume, power comes back before the processes do, and the game
+    /// is resumed last so its helpers are already running when it wakes. Time comes from the caller.
+    /// </summary>
+    public sealed class QuickPauseService : IDisposable
+    {
+        private static readonly TimeSpan BatteryInterval = TimeSpan.FromSeconds(5);
+
+        private readonly IProcessSuspendApi _api;
+        private readonly IQuickPausePowerControl _power;
+        private readonly Func<BatteryReading>? _readBattery;
+        private readonly int _ownProcessId = Environment.ProcessId;
+        private readonly object _lock = new object();
+        private readonly PauseDrainMeter _drain = new PauseDrainMeter();
+
+        // Suspended in this order; resumed in reverse
+        private readonly List<SuspendedProcess> _suspended = new();
+        private Timer? _batteryTimer;
+        private long _pausedAtMs;
+        private bool _powerIdle;
+        private bool _disposed;
+
+        private readonly record struct SuspendedProcess(int ProcessId, string ProcessName);
+
+        /// <param name="readBattery">Polled while paused; pass null to feed <see cref="AddBatteryReading"/> yourself.</param>
+        public QuickPauseService(IProcessSuspendApi api, IQuickPausePowerControl power, Func<BatteryReading>? readBattery = null)
+        {
+            _api = api;
+            _power = power;
+            _readBattery = readBattery;
+        }
+
+        public bool IsPaused
+        {
+            get { lock (_lock) return _suspended.Count > 0; }
+        }
+
+        /// <summary>
+        /// The game's PID while paused, 0 otherwise.
+        /// </summary>
+        public int PausedProcessId
+        {
+            get { lock (_lock) return _suspended.Count > 0 ? _suspended[0].ProcessId : 0; }
+        }
+
+        public double CurrentDrainWatts
+        {
+            get { lock (_lock) return _suspended.Count > 0 ? _drain.AverageWatts : double.NaN; }
+        }
+
+        /// <summary>
+        /// Suspends the game and its descendants and idles the device. Returns false if the game couldn't be
+        /// suspended (nothing is changed then); true if it is paused, including already.
+        /// </summary>
+        public bool Pause(int processId, string processName, long timestampMs)
+        {
+            lock (_lock)
+            {
+                if (_disposed)
+                    return false;
+                if (_suspended.Count > 0)
+                    return _suspended[0].ProcessId == processId;
+                if (processId == _ownProcessId)
+                    return false;
+
+                // The detection service can lag an exit by a poll; don't freeze whatever got the PID next
+                var name = _api.GetProcessName(processId);
+                if (name == null || !string.Equals(name, processName, StringComparison.OrdinalIgnoreCase))
+                {
+                    System.Diagnostics.Debug.WriteLine($"QuickPause: {processName} (PID {processId}) is no longer running");
+                    return false;
+                }
+
+                if (!_api.TrySuspend(processId))
+                {
+                    System.Diagnostics.Debug.WriteLine($"QuickPause: Could not suspend {processName} (PID {processId})");
+                    return false;
+                }
+                _suspended.Add(new SuspendedProcess(processId, name));
+
+                // Snapshot after the game is frozen, so it can't start a child in between
+                foreach (var child in CollectDescendants(processId, _api.GetProcessTree(), _ownProcessId))
+                {
+                    if (_api.TrySuspend(child.ProcessId))
+                        _suspended.Add(new SuspendedProcess(child.ProcessId, child.ProcessName));
+                    else
+                        // Typically an elevated or protected helper (anti-cheat); the game itself is what matters
+                        System.Diagnostics.Debug.WriteLine($"QuickPause: Could not suspend child {child.ProcessName} (PID {child.ProcessId})");
+                }
+
+                _pausedAtMs = timestampMs;
+                _drain.Start(timestampMs);
+
+                try
+                {
+                    _power.EnterIdle();
+                    _powerIdle = true;
+                }
+                catch (Exception ex)
+                {
+                    System.Diagnostics.Debug.WriteLine($"QuickPause: Failed to idle power: {ex.Message}");
+                }
+
+                if (_readBattery != null)
+                    _batteryTimer = new Timer(OnBatteryTimer, null, BatteryInterval, BatteryInterval);
+
+                System.Diagnostics.Debug.WriteLine($"QuickPause: Paused {processName} (PID {processId}) and {_suspended.Count - 1} child process(es)");
+                return true;
+            }
+        }
+
+        /// <summary>
+        /// Restores power and resumes everything <see cref="Pause"/> suspended. Returns null if nothing was paused.
+        /// </summary>
+        public QuickPauseReport? Resume(long timestampMs)
+        {
+            lock (_lock)
+            {
+                if (_suspended.Count == 0)
+                    return null;
+
+                _batteryTimer?.Dispose();
+                _batteryTimer = null;
+
+                // Power first, so the game doesn't wake up at idle TDP
+                if (_powerIdle)
+                {
+                    try
+                    {
+                        _power.Restore();
+                    }
+                    catch (Exception ex)
+                    {
+                        System.Diagnostics.Debug.WriteLine($"QuickPause: Failed to restore power: {ex.Message}");
+                    }
+                    _powerIdle = false;
+                }
+
+                int resumed = 0;
+                for (int i = _suspended.Count - 1; i >= 0; i--)
+                {
+                    var process = _suspended[i];
+
+                    // Killed while paused; the PID may belong to something else by now
+                    var name = _api.GetProcessName(process.ProcessId);
+                    if (name == null || !string.Equals(name, process.ProcessName, StringComparison.OrdinalIgnoreCase))
+                        continue;
+
+                    if (_api.TryResume(process.ProcessId))
+                        resumed++;
+                    else
+                        System.Diagnostics.Debug.WriteLine($"QuickPause: Could not resume {process.ProcessName} (PID {process.ProcessId})");
+                }
+
+                var report = new QuickPauseReport
+                {
+                    Duration = TimeSpan.FromMilliseconds(Math.Max(0, timestampMs - _pausedAtMs)),
+                    ProcessCount = _suspended.Count,
+                    AverageDrainWatts = _drain.AverageWatts
+                };
+                _suspended.Clear();
+
+                System.Diagnostics.Debug.WriteLine($"QuickPause: Resumed {resumed}/{report.ProcessCount} process(es) after {report.Duration.TotalMinutes:F1} min" +
+                    (double.IsNaN(report.AverageDrainWatts) ? "" : $", drawing {report.AverageDrainWatts:F1}W ({report.EnergyWh:F2} Wh)"));
+                return report;
+            }
+        }
+
+        public void AddBatteryReading(in BatteryReading reading)
+        {
+            lock (_lock)
+            {
+                if (_suspended.Count > 0)
+                    _drain.Add(reading);
+            }
+        }
+
+        private void OnBatteryTimer(object? state)
+        {
+            try
+            {
+                var reading = _readBattery!();
+                AddBatteryReading(reading);
+            }
+            catch (Exception ex)
+            {
+                System.Diagnostics.Debug.WriteLine($"QuickPause: Battery read failed: {ex.Message}");
+            }
+        }
+
+        /// <summary>
+        /// Every live descendant of <paramref name="rootProcessId"/>, parents before children. A process only
+        /// counts as a child if it started after its parent: Windows keeps the parent PID of orphans, and that
+        /// PID may since have been reused.
+        /// </summary>
+        public static List<ProcessTreeEntry> CollectDescendants(int rootProcessId, IReadOnlyList<ProcessTreeEntry> processes, int excludeProcessId)
+        {
+            var byParent = new Dictionary<int, List<ProcessTreeEntry>>();
+            var startTimes = new Dictionary<int, DateTime>();
+            foreach (var process in processes)
+            {
+                startTimes[process.ProcessId] = process.StartTimeUtc;
+                if (process.ProcessId == process.ParentProcessId)
+                    continue;
+                if (!byParent.TryGetValue(process.ParentProcessId, out var children))
+                    byParent[process.ParentProcessId] = children = new List<ProcessTreeEntry>();
+                children.Add(process);
+            }
+
+            var result = new List<ProcessTreeEntry>();
+            var visited = new HashSet<int> { rootProcessId };
+            var queue = new Queue<int>();
+            queue.Enqueue(rootProcessId);
+            while (queue.Count > 0)
+            {
+                int parentId = queue.Dequeue();
+                if (!byParent.TryGetValue(parentId, out var children))
+                    continue;
+
+                // Unknown start times can't prove the relationship, so they don't get frozen
+                if (!startTimes.TryGetValue(parentId, out var parentStart) || parentStart == DateTime.MinValue)
+                    continue;
+
+                foreach (var child in children)
+                {
+                    if (child.ProcessId == excludeProcessId || child.StartTimeUtc == DateTime.MinValue ||
+                        child.StartTimeUtc < parentStart || !visited.Add(child.ProcessId))
+                        continue;
+
+                    result.Add(child);
+                    queue.Enqueue(child.ProcessId);
+                }
+            }
+
+            return result;
+        }
+
+        /// <summary>
+        /// Resumes anything still paused; a game must never be left frozen behind HUDRA.
+        /// </summary>
+        public void Dispose()
+        {
+            Resume(DateTimeOffset.UtcNow.ToUnixTimeMilliseconds());
+            lock (_lock)
+            {
+                _disposed = true;
+            }
+        }
+    }
+}
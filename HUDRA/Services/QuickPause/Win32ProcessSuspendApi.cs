@@ -0,0 +1,154 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using System.Runtime.InteropServices;
+
+namespace HUDRA.Services.QuickPause
+{
+    /// <summary>
+    /// Win32 implementation of <see cref="IProcessSuspendApi"/>. Suspends through NtSuspendProcess, which
+    /// bumps the suspend count of every thread at once (including ones created between a thread
+    /// snapshot and the suspend), and NtResumeProcess undoes exactly that.
+    /// </summary>
+    public class Win32ProcessSuspendApi : IProcessSuspendApi
+    {
+        private const uint TH32CS_SNAPPROCESS = 0x00000002;
+        private const uint PROCESS_QUERY_LIMITED_INFORMATION = 0x1000;
+        private const uint PROCESS_SUSPEND_RESUME = 0x0800;
+        private static readonly IntPtr INVALID_HANDLE_VALUE = new IntPtr(-1);
+
+        public IReadOnlyList<ProcessTreeEntry> GetProcessTree()
+        {
+            var result = new List<ProcessTreeEntry>();
+            var snapshot = CreateToolhelp32Snapshot(TH32CS_SNAPPROCESS, 0);
+            if (snapshot == INVALID_HANDLE_VALUE) return result;
+
+            try
+            {
+                var entry = new PROCESSENTRY32W { dwSize = (uint)Marshal.SizeOf<PROCESSENTRY32W>() };
+                if (!Process32FirstW(snapshot, ref entry)) return result;
+
+                do
+                {
+                    int processId = (int)entry.th32ProcessID;
+                    result.Add(new ProcessTreeEntry
+                    {
+                        ProcessId = processId,
+                        ParentProcessId = (int)entry.th32ParentProcessID,
+                        // Match Process.ProcessName, which drops the extension
+                        ProcessName = Path.GetFileNameWithoutExtension(entry.szExeFile),
+                        StartTimeUtc = GetStartTime(processId)
+                    });
+                }
+                while (Process32NextW(snapshot, ref entry));
+            }
+            finally
+            {
+                CloseHandle(snapshot);
+            }
+
+            return result;
+        }
+
+        public bool TrySuspend(int processId)
+        {
+            var handle = OpenProcess(PROCESS_SUSPEND_RESUME, false, processId);
+            if (handle == IntPtr.Zero) return false;
+
+            try
+            {
+                return NtSuspendProcess(handle) == 0;
+            }
+            finally
+            {
+                CloseHandle(handle);
+            }
+        }
+
+        public bool TryResume(int processId)
+        {
+            var handle = OpenProcess(PROCESS_SUSPEND_RESUME, false, processId);
+            if (handle == IntPtr.Zero) return false;
+
+            try
+            {
+                return NtResumeProcess(handle) == 0;
+            }
+            finally
+            {
+                CloseHandle(handle);
+            }
+        }
+
+        public string? GetProcessName(int processId)
+        {
+            try
+            {
+                using var process = Process.GetProcessById(processId);
+                return process.HasExited ? null : process.ProcessName;
+            }
+            catch
+            {
+                return null;
+            }
+        }
+
+        private static DateTime GetStartTime(int processId)
+        {
+            var handle = OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, false, processId);
+            if (handle == IntPtr.Zero) return DateTime.MinValue;
+
+            try
+            {
+                return GetProcessTimes(handle, out long creation, out _, out _, out _)
+                    ? DateTime.FromFileTimeUtc(creation)
+                    : DateTime.MinValue;
+            }
+            finally
+            {
+                CloseHandle(handle);
+            }
+        }
+
+        [StructLayout(LayoutKind.Sequential, CharSet = CharSet.Unicode)]
+        private struct PROCESSENTRY32W
+        {
+            public uint dwSize;
+            public uint cntUsage;
+            public uint th32ProcessID;
+            public UIntPtr th32DefaultHeapID;
+            public uint th32ModuleID;
+            public uint cntThreads;
+            public uint th32ParentProcessID;
+            public int pcPriClassBase;
+            public uint dwFlags;
+            [MarshalAs(UnmanagedType.ByValTStr, SizeConst = 260)]
+            public string szExeFile;
+        }
+
+        [DllImport("kernel32.dll", SetLastError = true)]
+        private static extern IntPtr CreateToolhelp32Snapshot(uint dwFlags, uint th32ProcessID);
+
+        [DllImport("kernel32.dll", SetLastError = true, CharSet = CharSet.Unicode)]
+        private static extern bool Process32FirstW(IntPtr hSnapshot, ref PROCESSENTRY32W lppe);
+
+        [DllImport("kernel32.dll", SetLastError = true, CharSet = CharSet.Unicode)]
+        private static extern bool Process32NextW(IntPtr hSnapshot, ref PROCESSENTRY32W lppe);
+
+        [DllImport("kernel32.dll", SetLastError = true)]
+        private static extern IntPtr OpenProcess(uint dwDesiredAccess, bool bInheritHandle, int dwProcessId);
+
+        [DllImport("kernel32.dll", SetLastError = true)]
+        private static extern bool CloseHandle(IntPtr hObject);
+
+        [DllImport("kernel32.dll", SetLastError = true)]
+        private static extern bool GetProcessTimes(IntPtr hProcess, out long lpCreationTime, out long lpExitTime, out long lpKernelTime, out long lpUserTime);
+
+        [DllImport("ntdll.dll")]
+        private static extern int NtSuspendProcess(IntPtr processHandle);
+
+        [DllImport("ntdll.dll")]
+        private static extern int NtResumeProcess(IntPtr processHandle);
+    }
+}
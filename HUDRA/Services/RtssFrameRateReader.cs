@@ -0,0 +1,98 @@
+using System;
+using System.IO;
+using System.IO.MemoryMappedFiles;
+
+namespace HUDRA.Services
+{
+    /// <summary>
+    /// Reads a process's current frame rate from RivaTuner Statistics Server's shared memory
+    /// (RTSSSharedMemoryV2). RTSS updates each hooked app's frame count and sampling window about
+    /// once per second; this only reads it, so it costs nothing when nobody asks.
+    /// </summary>
+    public static class RtssFrameRateReader
+    {
+        private const string SharedMemoryName = "RTSSSharedMemoryV2";
+        private const uint Signature = 0x52545353; // 'RTSS'
+
+        // RTSS_SHARED_MEMORY header
+        private const int HeaderSignature = 0;
+        private const int HeaderAppEntrySize = 8;
+        private const int HeaderAppArrOffset = 12;
+        private const int HeaderAppArrSize = 16;
+        private const int HeaderSize = 36;
+
+        // RTSS_SHARED_MEMORY_APP_ENTRY
+        private const int EntryProcessId = 0;
+        private const int EntryTime0 = 268; // After szName[MAX_PATH] and dwFlags
+        private const int EntryTime1 = 272;
+        private const int EntryFrames = 276;
+        private const int EntryFrameTime = 280; // Microseconds
+        private const int EntryMinSize = 284;
+
+        /// <summary>
+        /// Frames per second RTSS last measured for <paramref name="processId"/>, or null if RTSS isn't
+        /// running or isn't hooked into that process.
+        /// </summary>
+        public static double? GetFrameRate(int processId) =>
+            TryRead(processId, out double fps, out _) ? fps : null;
+
+        /// <summary>
+        /// Frame rate and the last frame time in milliseconds for <paramref name="processId"/>. Returns false
+        /// if RTSS isn't running, isn't hooked into that process, or hasn't measured a window yet.
+        /// </summary>
+        public static bool TryRead(int processId, out double fps, out double frameTimeMs)
+        {
+            fps = double.NaN;
+            frameTimeMs = double.NaN;
+            if (processId <= 0) return false;
+
+            try
+            {
+                using var mapping = MemoryMappedFile.OpenExisting(SharedMemoryName, MemoryMappedFileRights.Read);
+                using var view = mapping.CreateViewAccessor(0, 0, MemoryMappedFileAccess.Read);
+
+                if (view.Capacity < HeaderSize || view.ReadUInt32(HeaderSignature) != Signature)
+                    return false;
+
+                uint entrySize = view.ReadUInt32(HeaderAppEntrySize);
+                uint arrayOffset = view.ReadUInt32(HeaderAppArrOffset);
+                uint arraySize = view.ReadUInt32(HeaderAppArrSize);
+                if (entrySize < EntryMinSize)
+                    return false;
+
+                for (uint i = 0; i < arraySize; i++)
+                {
+                    long entry = arrayOffset + (long)i * entrySize;
+                    if (entry + EntryMinSize > view.Capacity)
+                        break;
+
+                    if (view.ReadUInt32(entry + EntryProcessId) != (uint)processId)
+                        continue;
+
+                    uint time0 = view.ReadUInt32(entry + EntryTime0);
+                    uint time1 = view.ReadUInt32(entry + EntryTime1);
+                    uint frames = view.ReadUInt32(entry + EntryFrames);
+                    uint frameTimeUs = view.ReadUInt32(entry + EntryFrameTime);
+                    uint elapsedMs = time1 - time0;
+                    if (elapsedMs == 0)
+                        return false;
+
+                    fps = 1000.0 * frames / elapsedMs;
+                    if (frameTimeUs > 0)
+                        frameTimeMs = frameTimeUs / 1000.0;
+                    return true;
+                }
+            }
+            catch (FileNotFoundException)
+            {
+                // RTSS isn't running
+            }
+            catch (Exception ex) when (ex is IOException || ex is UnauthorizedAccessException)
+            {
+                System.Diagnostics.Debug.WriteLine($"RtssFrameRateReader: Could not read shared memory: {ex.Message}");
+            }
+
+            return false;
+        }
+    }
+}
@@ -0,0 +1,173 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+
+namespace HUDRA.Services.Scheduling
+{
+    /// <summary>
+    /// CPU time of one throttled process at the start and end of a throttling session.
+    /// </summary>
+    public class ThrottledProcessSample
+    {
+        public string ProcessName { get; set; } = string.Empty;
+        public DateTime ProcessStartTime { get; set; }
+        public TimeSpan CpuTimeAtStart { get; set; }
+        public TimeSpan? CpuTimeAtEnd { get; set; } // null if the process exited while throttled
+    }
+
+    /// <summary>
+    /// Summary of a throttling session, reported when throttled processes are restored.
+    /// </summary>
+    public class BackgroundThrottleReport
+    {
+        public int ProcessCount { get; set; }
+        public TimeSpan Duration { get; set; }
+        public TimeSpan CpuTimeUsed { get; set; }
+        public TimeSpan ExpectedCpuTime { get; set; }
+
+        /// <summary>
+        /// Expected CPU time (each process's lifetime average rate over the session) minus what was actually used.
+        /// </summary>
+        public TimeSpan CpuTimeReclaimed => ExpectedCpuTime > CpuTimeUsed ? ExpectedCpuTime - CpuTimeUsed : TimeSpan.Zero;
+
+        public override string ToString() =>
+            $"{ProcessCount} process(es) over {Duration.TotalMinutes:F1} min - used {CpuTimeUsed.TotalSeconds:F1}s CPU, " +
+            $"expected {ExpectedCpuTime.TotalSeconds:F1}s, reclaimed ~{CpuTimeReclaimed.TotalSeconds:F1}s";
+    }
+
+    /// <summary>
+    /// Compiled set of user throttle rules. A rule is a process name (".exe" optional, case-insensitive)
+    /// or a prefix ending in '*' such as "Adobe*".
+    /// </summary>
+    public class BackgroundThrottleRuleSet
+    {
+        private readonly HashSet<string> _exact = new(StringComparer.OrdinalIgnoreCase);
+        private readonly List<string> _prefixes = new();
+
+        public BackgroundThrottleRuleSet(IEnumerable<string> rules)
+        {
+            foreach (var raw in rules)
+            {
+                var rule = raw?.Trim() ?? string.Empty;
+                if (rule.EndsWith(".exe", StringComparison.OrdinalIgnoreCase))
+                    rule = rule.Substring(0, rule.Length - 4);
+                if (rule.Length == 0 || rule == "*")
+                    continue; // A bare wildcard would throttle everything
+
+                if (rule.EndsWith('*'))
+                    _prefixes.Add(rule.TrimEnd('*'));
+                else
+                    _exact.Add(rule);
+            }
+        }
+
+        public bool IsEmpty => _exact.Count == 0 && _prefixes.Count == 0;
+
+        public bool Matches(string processName)
+        {
+            if (_exact.Contains(processName))
+                return true;
+
+            foreach (var prefix in _prefixes)
+            {
+                if (processName.StartsWith(prefix, StringComparison.OrdinalIgnoreCase))
+                    return true;
+            }
+            return false;
+        }
+    }
+
+    /// <summary>
+    /// Pure selection of background processes to throttle while a game runs.
+    /// </summary>
+    public static class BackgroundThrottlePolicy
+    {
+        public const string ModeDefault = "Default";
+        public const string ModeEfficiency = "Efficiency";
+        public const string ModeEfficiencyLowIo = "EfficiencyLowIo";
+
+        /// <summary>
+        /// Default list: launcher helpers, updaters and sync clients. Steam itself is left out because Steam
+        /// Input runs in steam.exe and throttling it adds controller latency.
+        /// </summary>
+        public static readonly IReadOnlyList<string> DefaultRules = KnownProcesses.Launchers.Concat(new[]
+        {
+            // Updaters
+            "MicrosoftEdgeUpdate", "GoogleUpdate", "AdobeARM", "AdobeUpdateService",
+            // Sync clients
+            "OneDrive", "Dropbox", "GoogleDriveFS", "iCloudDrive"
+        }).ToArray();
+
+        public static bool IsEnabled(string? mode) =>
+            string.Equals(mode, ModeEfficiency, StringComparison.OrdinalIgnoreCase) ||
+            string.Equals(mode, ModeEfficiencyLowIo, StringComparison.OrdinalIgnoreCase);
+
+        public static bool LowersIoPriority(string? mode) =>
+            string.Equals(mode, ModeEfficiencyLowIo, StringComparison.OrdinalIgnoreCase);
+
+        /// <summary>
+        /// Never throttled regardless of the rules: throttling these stalls the whole desktop, audio or HUDRA itself.
+        /// </summary>
+        public static bool IsProtected(string processName) =>
+            KnownProcesses.WindowsProcesses.Contains(processName) || KnownProcesses.HudraCompanions.Contains(processName);
+
+        public static List<ProcessSnapshot> SelectTargets(
+            BackgroundThrottleRuleSet rules,
+            IEnumerable<ProcessSnapshot> runningProcesses,
+            ProcessSnapshot game)
+        {
+            var targets = new List<ProcessSnapshot>();
+            if (rules.IsEmpty)
+                return targets;
+
+            foreach (var process in runningProcesses)
+            {
+                if (process.ProcessId == game.ProcessId ||
+                    process.ProcessId <= 4 ||
+                    string.Equals(process.ProcessName, game.ProcessName, StringComparison.OrdinalIgnoreCase) ||
+                    IsProtected(process.ProcessName) ||
+                    !rules.Matches(process.ProcessName))
+                {
+                    continue;
+                }
+
+                targets.Add(process);
+            }
+
+            return targets;
+        }
+
+        /// <summary>
+        /// Builds the session report. Expected CPU time assumes each process would have kept running at its
+        /// lifetime average rate (CPU time at start / age at start) had it not been throttled.
+        /// </summary>
+        public static BackgroundThrottleReport BuildReport(
+            IEnumerable<ThrottledProcessSample> samples, DateTime sessionStart, DateTime sessionEnd)
+        {
+            var report = new BackgroundThrottleReport { Duration = sessionEnd - sessionStart };
+            var used = TimeSpan.Zero;
+            var expected = TimeSpan.Zero;
+
+            foreach (var sample in samples)
+            {
+                report.ProcessCount++;
+
+                // Exited, or CPU times could not be read at start
+                if (!sample.CpuTimeAtEnd.HasValue || sample.ProcessStartTime == default)
+                    continue;
+
+                var age = sessionStart - sample.ProcessStartTime;
+                if (age <= TimeSpan.Zero || report.Duration <= TimeSpan.Zero)
+                    continue;
+
+                double rate = sample.CpuTimeAtStart.Ticks / (double)age.Ticks;
+                expected += TimeSpan.FromTicks((long)(rate * report.Duration.Ticks));
+                used += sample.CpuTimeAtEnd.Value - sample.CpuTimeAtStart;
+            }
+
+            report.CpuTimeUsed = used;
+            report.ExpectedCpuTime = expected;
+            return report;
+        }
+    }
+}
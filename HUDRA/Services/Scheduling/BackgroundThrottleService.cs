@@ -0,0 +1,155 @@
+using System;
+using System.Collections.Generic;
+
+namespace HUDRA.Services.Scheduling
+{
+    /// <summary>
+    /// Puts the configured background processes into efficiency mode (and optionally low I/O priority)
+    /// while a game runs, restores them afterwards and reports how much CPU time was reclaimed.
+    /// </summary>
+    public class BackgroundThrottleService
+    {
+        private readonly IProcessSchedulingApi _api;
+        private readonly object _lock = new object();
+
+        private readonly List<ThrottledProcess> _throttled = new();
+        private int _activeGameProcessId;
+        private DateTime _sessionStart;
+
+        private class ThrottledProcess
+        {
+            public int ProcessId { get; set; }
+            public ThrottledProcessSample Sample { get; set; } = new();
+            public bool EfficiencyModeSet { get; set; }
+            public IoPriority? OriginalIoPriority { get; set; }
+        }
+
+        public BackgroundThrottleReport? LastReport { get; private set; }
+
+        public bool IsActive
+        {
+            get { lock (_lock) return _activeGameProcessId != 0; }
+        }
+
+        public BackgroundThrottleService() : this(new Win32ProcessSchedulingApi())
+        {
+        }
+
+        public BackgroundThrottleService(IProcessSchedulingApi api)
+        {
+            _api = api;
+        }
+
+        /// <summary>
+        /// Throttles matching background processes for the given game. Same PID is a no-op;
+        /// a different PID restores the previous session first.
+        /// </summary>
+        public void ApplyForGame(int gameProcessId, string gameProcessName, string? mode, IEnumerable<string> rules)
+        {
+            lock (_lock)
+            {
+                if (_activeGameProcessId == gameProcessId)
+                    return;
+
+                RestoreInternal();
+
+                if (!BackgroundThrottlePolicy.IsEnabled(mode))
+                    return;
+
+                var targets = BackgroundThrottlePolicy.SelectTargets(
+                    new BackgroundThrottleRuleSet(rules),
+                    _api.GetProcesses(),
+                    new ProcessSnapshot { ProcessId = gameProcessId, ProcessName = gameProcessName });
+
+                if (targets.Count == 0)
+                    return;
+
+                _activeGameProcessId = gameProcessId;
+                _sessionStart = DateTime.UtcNow;
+                bool lowerIo = BackgroundThrottlePolicy.LowersIoPriority(mode);
+
+                foreach (var target in targets)
+                {
+                    var entry = new ThrottledProcess
+                    {
+                        ProcessId = target.ProcessId,
+                        Sample = new ThrottledProcessSample { ProcessName = target.ProcessName }
+                    };
+
+                    if (_api.TryGetCpuTime(target.ProcessId, out var cpuTime, out var startTime))
+                    {
+                        entry.Sample.CpuTimeAtStart = cpuTime;
+                        entry.Sample.ProcessStartTime = startTime;
+                    }
+
+                    entry.EfficiencyModeSet = _api.TrySetEfficiencyMode(target.ProcessId, true);
+
+                    if (lowerIo && _api.TryGetIoPriority(target.ProcessId, out var originalIo) &&
+                        originalIo > IoPriority.Low &&
+                        _api.TrySetIoPriority(target.ProcessId, IoPriority.Low))
+                    {
+                        entry.OriginalIoPriority = originalIo;
+                    }
+
+                    if (entry.EfficiencyModeSet || entry.OriginalIoPriority.HasValue)
+                    {
+                        _throttled.Add(entry);
+                    }
+                }
+
+                System.Diagnostics.Debug.WriteLine($"Throttle: {_throttled.Count} of {targets.Count} background process(es) throttled for {gameProcessName}");
+            }
+        }
+
+        /// <summary>
+        /// Restores every throttled process and returns the session report (null if nothing was throttled).
+        /// </summary>
+        public BackgroundThrottleReport? Restore()
+        {
+            lock (_lock)
+            {
+                return RestoreInternal();
+            }
+        }
+
+        private BackgroundThrottleReport? RestoreInternal()
+        {
+            if (_activeGameProcessId == 0)
+                return null;
+
+            var samples = new List<ThrottledProcessSample>(_throttled.Count);
+            foreach (var entry in _throttled)
+            {
+                // Skip exited processes and PIDs that were reused by something else
+                var currentName = _api.GetProcessName(entry.ProcessId);
+                if (string.Equals(currentName, entry.Sample.ProcessName, StringComparison.OrdinalIgnoreCase))
+                {
+                    if (_api.TryGetCpuTime(entry.ProcessId, out var cpuTime, out _))
+                    {
+                        entry.Sample.CpuTimeAtEnd = cpuTime;
+                    }
+
+                    if (entry.EfficiencyModeSet)
+                    {
+                        _api.TrySetEfficiencyMode(entry.ProcessId, false);
+                    }
+
+                    if (entry.OriginalIoPriority.HasValue)
+                    {
+                        _api.TrySetIoPriority(entry.ProcessId, entry.OriginalIoPriority.Value);
+                    }
+                }
+
+                samples.Add(entry.Sample);
+            }
+
+            var report = BackgroundThrottlePolicy.BuildReport(samples, _sessionStart, DateTime.UtcNow);
+            LastReport = report;
+            System.Diagnostics.Debug.WriteLine($"Throttle: Restored - {report}");
+
+            _throttled.Clear();
+            _activeGameProcessId = 0;
+            return report;
+        }
+    }
+}
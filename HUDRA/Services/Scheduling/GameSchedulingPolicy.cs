@@ -0,0 +1,133 @@
+using HUDRA.Models;
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Linq;
+
+namespace HUDRA.Services.Scheduling
+{
+    /// <summary>
+    /// A single scheduling change to make to one process.
+    /// </summary>
+    public class ProcessSchedulingTarget
+    {
+        public int ProcessId { get; set; }
+        public string ProcessName { get; set; } = string.Empty;
+        public ProcessPriorityClass? Priority { get; set; }
+        public IReadOnlyList<uint>? CpuSetIds { get; set; }
+    }
+
+    /// <summary>
+    /// Result of resolving a game profile's scheduling settings against the current system.
+    /// </summary>
+    public class GameSchedulingPlan
+    {
+        public ProcessSchedulingTarget? Game { get; set; }
+        public List<ProcessSchedulingTarget> Background { get; } = new();
+
+        public bool IsEmpty => Game == null && Background.Count == 0;
+    }
+
+    /// <summary>
+    /// Pure resolution of per-game scheduling settings into concrete per-process changes.
+    /// No OS calls - inputs are the profile, the CPU topology and a process table snapshot.
+    /// </summary>
+    public static class GameSchedulingPolicy
+    {
+        public const string PriorityDefault = "Default";
+        public const string PriorityAboveNormal = "AboveNormal";
+        public const string PriorityHigh = "High";
+
+        public const string CoresDefault = "Default";
+        public const string CoresReserveFirst = "ReserveFirstCore";
+
+        /// <summary>
+        /// True if the profile asks for any scheduling change at all.
+        /// </summary>
+        public static bool IsConfigured(GameProfile profile) =>
+            ParsePriority(profile.CpuPriority).HasValue ||
+            string.Equals(profile.CpuCoreAssignment, CoresReserveFirst, StringComparison.OrdinalIgnoreCase) ||
+            profile.DemoteLaunchers == true;
+
+        public static GameSchedulingPlan Resolve(
+            GameProfile profile,
+            ProcessSnapshot game,
+            IReadOnlyList<CpuSetInfo> cpuSets,
+            IEnumerable<ProcessSnapshot> runningProcesses)
+        {
+            var plan = new GameSchedulingPlan();
+
+            var gamePriority = ParsePriority(profile.CpuPriority);
+            var (gameCpuSets, reservedCpuSets) = SplitCpuSets(profile.CpuCoreAssignment, cpuSets);
+
+            if (gamePriority.HasValue || gameCpuSets != null)
+            {
+                plan.Game = new ProcessSchedulingTarget
+                {
+                    ProcessId = game.ProcessId,
+                    ProcessName = game.ProcessName,
+                    Priority = gamePriority,
+                    CpuSetIds = gameCpuSets
+                };
+            }
+
+            if (profile.DemoteLaunchers == true)
+            {
+                foreach (var process in runningProcesses)
+                {
+                    if (process.ProcessId == game.ProcessId ||
+                        string.Equals(process.ProcessName, game.ProcessName, StringComparison.OrdinalIgnoreCase) ||
+                        !KnownProcesses.IsLauncher(process.ProcessName))
+                    {
+                        continue;
+                    }
+
+                    plan.Background.Add(new ProcessSchedulingTarget
+                    {
+                        ProcessId = process.ProcessId,
+                        ProcessName = process.ProcessName,
+                        Priority = ProcessPriorityClass.BelowNormal,
+                        CpuSetIds = reservedCpuSets // Confine launchers to the core the game gave up
+                    });
+                }
+            }
+
+            return plan;
+        }
+
+        public static ProcessPriorityClass? ParsePriority(string? value)
+        {
+            if (string.Equals(value, PriorityAboveNormal, StringComparison.OrdinalIgnoreCase))
+                return ProcessPriorityClass.AboveNormal;
+            if (string.Equals(value, PriorityHigh, StringComparison.OrdinalIgnoreCase))
+                return ProcessPriorityClass.High;
+            return null; // "Default" - and never Realtime, which can starve input and audio threads
+        }
+
+        /// <summary>
+        /// For "ReserveFirstCore", gives the game every CPU set except those on the first physical core
+        /// (both SMT siblings) and returns that core's sets for background work. Needs at least 4 cores.
+        /// </summary>
+        private static (IReadOnlyList<uint>? Game, IReadOnlyList<uint>? Reserved) SplitCpuSets(
+            string? assignment, IReadOnlyList<CpuSetInfo> cpuSets)
+        {
+            if (!string.Equals(assignment, CoresReserveFirst, StringComparison.OrdinalIgnoreCase) || cpuSets.Count == 0)
+                return (null, null);
+
+            var coreCount = cpuSets.Select(c => c.CoreIndex).Distinct().Count();
+            if (coreCount < 4)
+                return (null, null);
+
+            // Prefer reserving an efficiency core if the APU has any (e.g. Z1 with Zen4c cores)
+            int lowestClass = cpuSets.Min(c => c.EfficiencyClass);
+            int reservedCore = cpuSets
+                .Where(c => c.EfficiencyClass == lowestClass)
+                .OrderBy(c => c.LogicalProcessorIndex)
+                .First().CoreIndex;
+
+            var game = cpuSets.Where(c => c.CoreIndex != reservedCore).Select(c => c.Id).ToList();
+            var reserved = cpuSets.Where(c => c.CoreIndex == reservedCore).Select(c => c.Id).ToList();
+            return (game, reserved);
+        }
+    }
+}
@@ -0,0 +1,154 @@
+using HUDRA.Models;
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+
+namespace HUDRA.Services.Scheduling
+{
+    /// <summary>
+    /// Applies a game profile's scheduling policy (priority, CPU sets, launcher demotion)
+    /// while the game runs and restores every touched process when it exits.
+    /// </summary>
+    public class GameSchedulingService
+    {
+        private readonly IProcessSchedulingApi _api;
+        private readonly object _lock = new object();
+
+        // Original state of every process we changed, for revert
+        private readonly List<AppliedChange> _appliedChanges = new();
+        private int _activeGameProcessId;
+
+        private class AppliedChange
+        {
+            public int ProcessId { get; set; }
+            public string ProcessName { get; set; } = string.Empty;
+            public ProcessPriorityClass? OriginalPriority { get; set; }
+            public bool CpuSetsChanged { get; set; }
+        }
+
+        public bool IsActive
+        {
+            get { lock (_lock) return _activeGameProcessId != 0; }
+        }
+
+        public GameSchedulingService() : this(new Win32ProcessSchedulingApi())
+        {
+        }
+
+        public GameSchedulingService(IProcessSchedulingApi api)
+        {
+            _api = api;
+        }
+
+        /// <summary>
+        /// Applies the profile's scheduling policy to the game. Calling again for the same PID is a no-op;
+        /// a different PID reverts the previous game first.
+        /// </summary>
+        public void ApplyForGame(GameInfo game, GameProfile? profile)
+        {
+            lock (_lock)
+            {
+                if (_activeGameProcessId == game.ProcessId)
+                    return;
+
+                RevertInternal();
+
+                if (profile == null || !profile.HasProfile || !GameSchedulingPolicy.IsConfigured(profile))
+                    return;
+
+                var plan = GameSchedulingPolicy.Resolve(
+                    profile,
+                    new ProcessSnapshot { ProcessId = game.ProcessId, ProcessName = game.ProcessName },
+                    _api.GetCpuSets(),
+                    profile.DemoteLaunchers == true ? _api.GetProcesses() : Array.Empty<ProcessSnapshot>());
+
+                if (plan.IsEmpty)
+                    return;
+
+                _activeGameProcessId = game.ProcessId;
+
+                if (plan.Game != null)
+                {
+                    ApplyTarget(plan.Game);
+                }
+
+                foreach (var target in plan.Background)
+                {
+                    ApplyTarget(target);
+                }
+
+                System.Diagnostics.Debug.WriteLine($"Scheduling: Applied policy for {game.ProcessName} - {_appliedChanges.Count} process(es) changed");
+            }
+        }
+
+        /// <summary>
+        /// Restores original priority and CPU sets for every process changed by <see cref="ApplyForGame"/>.
+        /// </summary>
+        public void Revert()
+        {
+            lock (_lock)
+            {
+                RevertInternal();
+            }
+        }
+
+        private void ApplyTarget(ProcessSchedulingTarget target)
+        {
+            var change = new AppliedChange { ProcessId = target.ProcessId, ProcessName = target.ProcessName };
+
+            if (target.Priority.HasValue && _api.TryGetPriority(target.ProcessId, out var original))
+            {
+                if (_api.TrySetPriority(target.ProcessId, target.Priority.Value))
+                {
+                    change.OriginalPriority = original;
+                }
+                else
+                {
+                    System.Diagnostics.Debug.WriteLine($"Scheduling: Could not set priority for {target.ProcessName} ({target.ProcessId})");
+                }
+            }
+
+            if (target.CpuSetIds != null && target.CpuSetIds.Count > 0)
+            {
+                change.CpuSetsChanged = _api.TrySetDefaultCpuSets(target.ProcessId, target.CpuSetIds);
+            }
+
+            if (change.OriginalPriority.HasValue || change.CpuSetsChanged)
+            {
+                _appliedChanges.Add(change);
+            }
+        }
+
+        private void RevertInternal()
+        {
+            if (_activeGameProcessId == 0 && _appliedChanges.Count == 0)
+                return;
+
+            int restored = 0;
+            foreach (var change in _appliedChanges)
+            {
+                // Skip exited processes and PIDs that were reused by something else
+                var currentName = _api.GetProcessName(change.ProcessId);
+                if (!string.Equals(currentName, change.ProcessName, StringComparison.OrdinalIgnoreCase))
+                    continue;
+
+                if (change.OriginalPriority.HasValue)
+                {
+                    _api.TrySetPriority(change.ProcessId, change.OriginalPriority.Value);
+                }
+
+                if (change.CpuSetsChanged)
+                {
+                    _api.TrySetDefaultCpuSets(change.ProcessId, null);
+                }
+
+                restored++;
+            }
+
+            System.Diagnostics.Debug.WriteLine($"Scheduling: Reverted {restored} of {_appliedChanges.Count} process(es)");
+
+            _appliedChanges.Clear();
+            _activeGameProcessId = 0;
+        }
+    }
+}
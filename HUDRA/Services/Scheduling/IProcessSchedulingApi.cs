@@ -0,0 +1,81 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+
+namespace HUDRA.Services.Scheduling
+{
+    /// <summary>
+    /// Lightweight view of a running process used by scheduling policies.
+    /// </summary>
+    public class ProcessSnapshot
+    {
+        public int ProcessId { get; set; }
+        public string ProcessName { get; set; } = string.Empty;
+    }
+
+    /// <summary>
+    /// One entry from GetSystemCpuSetInformation.
+    /// </summary>
+    public class CpuSetInfo
+    {
+        public uint Id { get; set; }
+        public int LogicalProcessorIndex { get; set; }
+        public int CoreIndex { get; set; }
+        public int EfficiencyClass { get; set; }
+    }
+
+    /// <summary>
+    /// Process I/O priority hint (values match IO_PRIORITY_HINT).
+    /// </summary>
+    public enum IoPriority
+    {
+        VeryLow = 0,
+        Low = 1,
+        Normal = 2
+    }
+
+    /// <summary>
+    /// OS calls needed to change process scheduling. Kept behind an interface so
+    /// policy application and revert can run against a fake process table.
+    /// </summary>
+    public interface IProcessSchedulingApi
+    {
+        IReadOnlyList<CpuSetInfo> GetCpuSets();
+        IReadOnlyList<ProcessSnapshot> GetProcesses();
+
+        bool TryGetPriority(int processId, out ProcessPriorityClass priority);
+        bool TrySetPriority(int processId, ProcessPriorityClass priority);
+
+        /// <summary>
+        /// Sets the process default CPU sets. Passing null or an empty list clears the assignment.
+        /// </summary>
+        bool TrySetDefaultCpuSets(int processId, IReadOnlyList<uint>? cpuSetIds);
+
+        /// <summary>
+        /// Returns the process name for a PID, or null if it has exited. Used to guard against PID reuse on revert.
+        /// </summary>
+        string? GetProcessName(int processId);
+
+        /// <summary>
+        /// Turns EcoQoS power throttling (Windows 11 "efficiency mode") on for a process, or hands
+        /// the decision back to the OS when disabled.
+        /// </summary>
+        bool TrySetEfficiencyMode(int processId, bool enabled);
+
+        bool TryGetIoPriority(int processId, out IoPriority priority);
+        bool TrySetIoPriority(int processId, IoPriority priority);
+
+        /// <summary>
+        /// Total kernel + user CPU time consumed by the process and when it started.
+        /// </summary>
+        bool TryGetCpuTime(int processId, out TimeSpan cpuTime, out DateTime startTime);
+
+        bool TryGetWorkingSet(int processId, out long bytes);
+
+        /// <summary>
+        /// Removes as many pages as possible from the process working set (EmptyWorkingSet).
+        /// Pages are faulted back in on demand.
+        /// </summary>
+        bool TryTrimWorkingSet(int processId);
+    }
+}
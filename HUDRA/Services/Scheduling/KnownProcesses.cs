@@ -0,0 +1,113 @@
+using System;
+using System.Collections.Generic;
+
+namespace HUDRA.Services.Scheduling
+{
+    /// <summary>
+    /// Process names (without ".exe", case-insensitive) shared by game detection, launcher demotion,
+    /// background throttling and working-set trimming, so the lists can't drift apart.
+    /// </summary>
+    public static class KnownProcesses
+    {
+        /// <summary>
+        /// The Steam client. Kept out of <see cref="Launchers"/>: Steam Input runs in it and has to keep pace
+        /// with the game, so it's never demoted or throttled. Trimming only pages memory out and may include it.
+        /// </summary>
+        public const string SteamClient = "steam";
+
+        /// <summary>
+        /// Launcher clients and their helpers, which compete with the game for CPU time and sit at hundreds
+        /// of MB while it runs.
+        /// </summary>
+        public static readonly IReadOnlyList<string> Launchers = new[]
+        {
+            // Steam
+            "steamwebhelper", "steamservice",
+            // Epic
+            "EpicGamesLauncher", "EpicWebHelper", "EpicOnlineServicesUserHelper",
+            // Xbox / Microsoft Store
+            "XboxPcApp", "XboxPcAppFT", "XboxPcTray", "XboxAppServices", "GamingServices",
+            // Battle.net
+            "Battle.net",
+            // EA
+            "EADesktop", "EABackgroundService", "Origin", "OriginWebHelperService",
+            // GOG
+            "GalaxyClient", "GalaxyClient Helper", "GalaxyCommunication",
+            // Ubisoft
+            "upc", "UplayWebCore", "UbisoftConnect",
+            // Riot / Rockstar
+            "RiotClientServices", "RiotClientUx", "RockstarService", "SocialClubHelper"
+        };
+
+        private static readonly HashSet<string> LauncherSet = new(Launchers, StringComparer.OrdinalIgnoreCase);
+
+        /// <summary>
+        /// Windows, security, update and driver processes. Never a game, and never throttled: slowing these
+        /// stalls the desktop, audio or input.
+        /// </summary>
+        public static readonly IReadOnlySet<string> WindowsProcesses = new HashSet<string>(StringComparer.OrdinalIgnoreCase)
+        {
+            // Core Windows processes
+            "Idle", "System", "Registry", "smss", "csrss", "wininit", "services",
+            "lsass", "winlogon", "fontdrvhost", "dwm", "svchost", "dllhost",
+            "WmiPrvSE", "spoolsv", "SearchIndexer", "taskhost", "explorer",
+            "RuntimeBroker", "ApplicationFrameHost", "ShellExperienceHost",
+            "StartMenuExperienceHost", "SearchHost", "SecurityHealthSystray",
+            "ctfmon", "taskhostw", "winstore.app", "PhoneExperienceHost",
+            "sihost", "backgroundTaskHost", "PickerHost", "LockApp",
+            "UserOOBEBroker", "SettingSyncHost", "PresentationFontCache",
+            "SearchFilterHost", "SearchProtocolHost",
+            "audiodg", "conhost", "LogonUI", "userinit", "Secure System",
+            "Memory Compression",
+
+            // Additional Windows services and system processes
+            "lsm", "msdtc", "Ati2evxx", "CCC", "stacsv", "mdm", "alg",
+            "wscntfy", "cidaemon", "cftmon", "imapi", "dfsr", "msiexec",
+
+            // Security and antivirus
+            "MsMpEng", "NisSrv", "SecurityHealthService",
+            "WindowsSecurityService", "MpCmdRun", "MpSigStub",
+
+            // Windows Update and maintenance
+            "TiWorker", "TrustedInstaller", "wuauclt", "UsoClient", "UpdateOrchestrator",
+            "SIHClient", "CompatTelRunner", "DismHost",
+
+            // Hardware and drivers
+            "nvcontainer", "NVDisplay.Container", "nvidia web helper", "nvbackend",
+            "RtkAudioService", "RtkAudUService64", "igfxpers", "igfxtray",
+            "TeamViewer_Service", "TeamViewer", "tv_w32", "tv_x64"
+        };
+
+        /// <summary>
+        /// Everyday applications that show windows like a game does but aren't one.
+        /// </summary>
+        public static readonly IReadOnlySet<string> NonGameApplications = new HashSet<string>(StringComparer.OrdinalIgnoreCase)
+        {
+            // Windows tools
+            "notepad", "calc", "mspaint", "write", "wordpad",
+            "taskmgr", "perfmon", "dxdiag", "msconfig", "regedit", "cmd",
+            "powershell", "PowerShell_ISE", "wt", "WindowsTerminal",
+
+            // Common utilities that aren't games
+            "notepad++", "chrome", "firefox", "edge", "iexplore", "opera",
+            "winrar", "7z", "7zfm", "AcroRd32", "Acrobat", "OUTLOOK", "WINWORD",
+            "EXCEL", "POWERPNT", "devenv", "Code", "atom", "sublime_text"
+        };
+
+        /// <summary>
+        /// HUDRA and the tools it drives while a game runs; throttling these slows the overlay or frame pacing.
+        /// </summary>
+        public static readonly IReadOnlySet<string> HudraCompanions = new HashSet<string>(StringComparer.OrdinalIgnoreCase)
+        {
+            "HUDRA", "RTSS", "RTSSHooksLoader64", "EncoderServer", "LosslessScaling"
+        };
+
+        public static bool IsLauncher(string processName) => LauncherSet.Contains(processName);
+
+        /// <summary>
+        /// Skipped by game detection: Windows itself and everyday non-game applications.
+        /// </summary>
+        public static bool IsSystemProcess(string processName) =>
+            WindowsProcesses.Contains(processName) || NonGameApplications.Contains(processName);
+    }
+}
@@ -0,0 +1,355 @@
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Runtime.InteropServices;
+
+namespace HUDRA.Services.Scheduling
+{
+    /// <summary>
+    /// Win32 implementation of <see cref="IProcessSchedulingApi"/>.
+    /// </summary>
+    public class Win32ProcessSchedulingApi : IProcessSchedulingApi
+    {
+        private const uint PROCESS_QUERY_LIMITED_INFORMATION = 0x1000;
+        private const uint PROCESS_SET_INFORMATION = 0x0200;
+        private const uint PROCESS_SET_QUOTA = 0x0100;
+        private const int CpuSetInformation = 0;
+        private const int ProcessPowerThrottling = 4;
+        private const int ProcessIoPriority = 33;
+        private const uint PROCESS_POWER_THROTTLING_CURRENT_VERSION = 1;
+        private const uint PROCESS_POWER_THROTTLING_EXECUTION_SPEED = 0x1;
+
+        private IReadOnlyList<CpuSetInfo>? _cpuSets;
+
+        public IReadOnlyList<CpuSetInfo> GetCpuSets()
+        {
+            // Topology doesn't change while we run
+            return _cpuSets ??= QueryCpuSets();
+        }
+
+        public IReadOnlyList<ProcessSnapshot> GetProcesses()
+        {
+            var result = new List<ProcessSnapshot>();
+            foreach (var process in Process.GetProcesses())
+            {
+                try
+                {
+                    result.Add(new ProcessSnapshot { ProcessId = process.Id, ProcessName = process.ProcessName });
+                }
+                catch
+                {
+                    // Process exited while enumerating
+                }
+                finally
+                {
+                    process.Dispose();
+                }
+            }
+            return result;
+        }
+
+        public bool TryGetPriority(int processId, out ProcessPriorityClass priority)
+        {
+            priority = ProcessPriorityClass.Normal;
+            var handle = OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, false, processId);
+            if (handle == IntPtr.Zero) return false;
+
+            try
+            {
+                uint value = GetPriorityClass(handle);
+                if (value == 0) return false;
+                priority = (ProcessPriorityClass)value;
+                return true;
+            }
+            finally
+            {
+                CloseHandle(handle);
+            }
+        }
+
+        public bool TrySetPriority(int processId, ProcessPriorityClass priority)
+        {
+            var handle = OpenProcess(PROCESS_SET_INFORMATION, false, processId);
+            if (handle == IntPtr.Zero) return false;
+
+            try
+            {
+                return SetPriorityClass(handle, (uint)priority);
+            }
+            finally
+            {
+                CloseHandle(handle);
+            }
+        }
+
+        public bool TrySetDefaultCpuSets(int processId, IReadOnlyList<uint>? cpuSetIds)
+        {
+            var handle = OpenProcess(PROCESS_SET_INFORMATION | PROCESS_QUERY_LIMITED_INFORMATION, false, processId);
+            if (handle == IntPtr.Zero) return false;
+
+            try
+            {
+                if (cpuSetIds == null || cpuSetIds.Count == 0)
+                {
+                    return SetProcessDefaultCpuSets(handle, null, 0);
+                }
+
+                var ids = new uint[cpuSetIds.Count];
+                for (int i = 0; i < ids.Length; i++) ids[i] = cpuSetIds[i];
+                return SetProcessDefaultCpuSets(handle, ids, (uint)ids.Length);
+            }
+            finally
+            {
+                CloseHandle(handle);
+            }
+        }
+
+        public string? GetProcessName(int processId)
+        {
+            try
+            {
+                using var process = Process.GetProcessById(processId);
+                return process.HasExited ? null : process.ProcessName;
+            }
+            catch
+            {
+                return null;
+            }
+        }
+
+        public bool TrySetEfficiencyMode(int processId, bool enabled)
+        {
+            var handle = OpenProcess(PROCESS_SET_INFORMATION, false, processId);
+            if (handle == IntPtr.Zero) return false;
+
+            try
+            {
+                // ControlMask = 0 releases the process back to OS-managed throttling
+                var state = new PROCESS_POWER_THROTTLING_STATE
+                {
+                    Version = PROCESS_POWER_THROTTLING_CURRENT_VERSION,
+                    ControlMask = enabled ? PROCESS_POWER_THROTTLING_EXECUTION_SPEED : 0,
+                    StateMask = enabled ? PROCESS_POWER_THROTTLING_EXECUTION_SPEED : 0
+                };
+                return SetProcessInformation(handle, ProcessPowerThrottling, ref state, (uint)Marshal.SizeOf<PROCESS_POWER_THROTTLING_STATE>());
+            }
+            finally
+            {
+                CloseHandle(handle);
+            }
+        }
+
+        public bool TryGetIoPriority(int processId, out IoPriority priority)
+        {
+            priority = IoPriority.Normal;
+            var handle = OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, false, processId);
+            if (handle == IntPtr.Zero) return false;
+
+            try
+            {
+                if (NtQueryInformationProcess(handle, ProcessIoPriority, out int value, sizeof(int), out _) != 0)
+                    return false;
+                priority = (IoPriority)value;
+                return true;
+            }
+            finally
+            {
+                CloseHandle(handle);
+            }
+        }
+
+        public bool TrySetIoPriority(int processId, IoPriority priority)
+        {
+            var handle = OpenProcess(PROCESS_SET_INFORMATION, false, processId);
+            if (handle == IntPtr.Zero) return false;
+
+            try
+            {
+                int value = (int)priority;
+                return NtSetInformationProcess(handle, ProcessIoPriority, ref value, sizeof(int)) == 0;
+            }
+            finally
+            {
+                CloseHandle(handle);
+            }
+        }
+
+        public bool TryGetCpuTime(int processId, out TimeSpan cpuTime, out DateTime startTime)
+        {
+            cpuTime = TimeSpan.Zero;
+            startTime = DateTime.MinValue;
+            var handle = OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, false, processId);
+            if (handle == IntPtr.Zero) return false;
+
+            try
+            {
+                if (!GetProcessTimes(handle, out long creation, out _, out long kernel, out long user))
+                    return false;
+                cpuTime = TimeSpan.FromTicks(kernel + user);
+                startTime = DateTime.FromFileTimeUtc(creation);
+                return true;
+            }
+            finally
+            {
+                CloseHandle(handle);
+            }
+        }
+
+        public bool TryGetWorkingSet(int processId, out long bytes)
+        {
+            bytes = 0;
+            var handle = OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, false, processId);
+            if (handle == IntPtr.Zero) return false;
+
+            try
+            {
+                var counters = new PROCESS_MEMORY_COUNTERS { cb = (uint)Marshal.SizeOf<PROCESS_MEMORY_COUNTERS>() };
+                if (!K32GetProcessMemoryInfo(handle, ref counters, counters.cb))
+                    return false;
+                bytes = (long)counters.WorkingSetSize;
+                return true;
+            }
+            finally
+            {
+                CloseHandle(handle);
+            }
+        }
+
+        public bool TryTrimWorkingSet(int processId)
+        {
+            var handle = OpenProcess(PROCESS_SET_QUOTA | PROCESS_QUERY_LIMITED_INFORMATION, false, processId);
+            if (handle == IntPtr.Zero) return false;
+
+            try
+            {
+                return K32EmptyWorkingSet(handle);
+            }
+            finally
+            {
+                CloseHandle(handle);
+            }
+        }
+
+        private static IReadOnlyList<CpuSetInfo> QueryCpuSets()
+        {
+            var result = new List<CpuSetInfo>();
+
+            try
+            {
+                GetSystemCpuSetInformation(IntPtr.Zero, 0, out uint length, IntPtr.Zero, 0);
+                if (length == 0) return result;
+
+                var buffer = Marshal.AllocHGlobal((int)length);
+                try
+                {
+                    if (!GetSystemCpuSetInformation(buffer, length, out length, IntPtr.Zero, 0))
+                        return result;
+
+                    int offset = 0;
+                    while (offset < length)
+                    {
+                        var entry = Marshal.PtrToStructure<SYSTEM_CPU_SET_INFORMATION>(buffer + offset);
+                        if (entry.Type == CpuSetInformation)
+                        {
+                            result.Add(new CpuSetInfo
+                            {
+                                Id = entry.Id,
+                                LogicalProcessorIndex = entry.LogicalProcessorIndex,
+                                CoreIndex = entry.CoreIndex,
+                                EfficiencyClass = entry.EfficiencyClass
+                            });
+                        }
+                        offset += (int)entry.Size;
+                        if (entry.Size == 0) break;
+                    }
+                }
+                finally
+                {
+                    Marshal.FreeHGlobal(buffer);
+                }
+            }
+            catch (Exception ex)
+            {
+                System.Diagnostics.Debug.WriteLine($"Scheduling: Failed to query CPU sets: {ex.Message}");
+            }
+
+            return result;
+        }
+
+        [StructLayout(LayoutKind.Sequential)]
+        private struct SYSTEM_CPU_SET_INFORMATION
+        {
+            public uint Size;
+            public int Type;
+            public uint Id;
+            public ushort Group;
+            public byte LogicalProcessorIndex;
+            public byte CoreIndex;
+            public byte LastLevelCacheIndex;
+            public byte NumaNodeIndex;
+            public byte EfficiencyClass;
+            public byte AllFlags;
+            public uint Reserved;
+            public ulong AllocationTag;
+        }
+
+        [StructLayout(LayoutKind.Sequential)]
+        private struct PROCESS_POWER_THROTTLING_STATE
+        {
+            public uint Version;
+            public uint ControlMask;
+            public uint StateMask;
+        }
+
+        [StructLayout(LayoutKind.Sequential)]
+        private struct PROCESS_MEMORY_COUNTERS
+        {
+            public uint cb;
+            public uint PageFaultCount;
+            public UIntPtr PeakWorkingSetSize;
+            public UIntPtr WorkingSetSize;
+            public UIntPtr QuotaPeakPagedPoolUsage;
+            public UIntPtr QuotaPagedPoolUsage;
+            public UIntPtr QuotaPeakNonPagedPoolUsage;
+            public UIntPtr QuotaNonPagedPoolUsage;
+            public UIntPtr PagefileUsage;
+            public UIntPtr PeakPagefileUsage;
+        }
+
+        [DllImport("kernel32.dll", SetLastError = true)]
+        private static extern IntPtr OpenProcess(uint dwDesiredAccess, bool bInheritHandle, int dwProcessId);
+
+        [DllImport("kernel32.dll", SetLastError = true)]
+        private static extern bool CloseHandle(IntPtr hObject);
+
+        [DllImport("kernel32.dll", SetLastError = true)]
+        private static extern uint GetPriorityClass(IntPtr hProcess);
+
+        [DllImport("kernel32.dll", SetLastError = true)]
+        private static extern bool SetPriorityClass(IntPtr hProcess, uint dwPriorityClass);
+
+        [DllImport("kernel32.dll", SetLastError = true)]
+        private static extern bool SetProcessDefaultCpuSets(IntPtr process, uint[]? cpuSetIds, uint cpuSetIdCount);
+
+        [DllImport("kernel32.dll", SetLastError = true)]
+        private static extern bool GetSystemCpuSetInformation(IntPtr information, uint bufferLength, out uint returnedLength, IntPtr process, uint flags);
+
+        [DllImport("kernel32.dll", SetLastError = true)]
+        private static extern bool SetProcessInformation(IntPtr hProcess, int processInformationClass, ref PROCESS_POWER_THROTTLING_STATE processInformation, uint processInformationSize);
+
+        [DllImport("kernel32.dll", SetLastError = true)]
+        private static extern bool GetProcessTimes(IntPtr hProcess, out long creationTime, out long exitTime, out long kernelTime, out long userTime);
+
+        [DllImport("kernel32.dll", SetLastError = true)]
+        private static extern bool K32GetProcessMemoryInfo(IntPtr hProcess, ref PROCESS_MEMORY_COUNTERS counters, uint cb);
+
+        [DllImport("kernel32.dll", SetLastError = true)]
+        private static extern bool K32EmptyWorkingSet(IntPtr hProcess);
+
+        [DllImport("ntdll.dll")]
+        private static extern int NtQueryInformationProcess(IntPtr processHandle, int processInformationClass, out int processInformation, int processInformationLength, out int returnLength);
+
+        [DllImport("ntdll.dll")]
+        private static extern int NtSetInformationProcess(IntPtr processHandle, int processInformationClass, ref int processInformation, int processInformationLength);
+    }
+}
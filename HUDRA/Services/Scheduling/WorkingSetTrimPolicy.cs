@@ -0,0 +1,72 @@
+using System.Collections.Generic;
+using System.Linq;
+
+namespace HUDRA.Services.Scheduling
+{
+    /// <summary>
+    /// Working set of one launcher process before and after trimming.
+    /// </summary>
+    public class WorkingSetTrimResult
+    {
+        public int ProcessId { get; set; }
+        public string ProcessName { get; set; } = string.Empty;
+        public long BytesBefore { get; set; }
+        public long BytesAfter { get; set; }
+
+        public long BytesFreed => BytesBefore > BytesAfter ? BytesBefore - BytesAfter : 0;
+    }
+
+    /// <summary>
+    /// Summary of one trim pass at game start.
+    /// </summary>
+    public class WorkingSetTrimReport
+    {
+        public string GameProcessName { get; set; } = string.Empty;
+        public List<WorkingSetTrimResult> Results { get; } = new();
+
+        public long TotalBytesFreed
+        {
+            get
+            {
+                long total = 0;
+                foreach (var result in Results) total += result.BytesFreed;
+                return total;
+            }
+        }
+
+        public override string ToString() =>
+            $"{Results.Count} launcher process(es) trimmed for {GameProcessName} - freed {TotalBytesFreed / (1024.0 * 1024.0):F0} MB";
+    }
+
+    /// <summary>
+    /// Pure candidate selection for launcher working-set trimming.
+    /// </summary>
+    public static class WorkingSetTrimPolicy
+    {
+        /// <summary>
+        /// Processes below this size aren't worth a trim (and the soft faults that follow).
+        /// </summary>
+        public const long MinimumWorkingSetBytes = 32L * 1024 * 1024;
+
+        /// <summary>
+        /// Default list: the launcher clients that sit at hundreds of MB while a game runs. Trimming only
+        /// pages memory out, so steam.exe is safe to include here.
+        /// </summary>
+        public static readonly IReadOnlyList<string> DefaultRules =
+            new[] { KnownProcesses.SteamClient }.Concat(KnownProcesses.Launchers).ToArray();
+
+        /// <summary>
+        /// Selects rule-matched, non-protected processes from a detection snapshot, excluding the game itself.
+        /// </summary>
+        public static List<ProcessSnapshot> SelectCandidates(
+            BackgroundThrottleRuleSet rules,
+            IEnumerable<ProcessSnapshot> snapshot,
+            ProcessSnapshot game)
+        {
+            // Same exclusions as throttling: the game, critical system processes and HUDRA itself
+            return BackgroundThrottlePolicy.SelectTargets(rules, snapshot, game);
+        }
+
+        public static bool ShouldTrim(long workingSetBytes) => workingSetBytes >= MinimumWorkingSetBytes;
+    }
+}
@@ -0,0 +1,98 @@
+using System;
+using System.Collections.Generic;
+
+namespace HUDRA.Services.Scheduling
+{
+    /// <summary>
+    /// Trims the working sets of configured launchers once per game session so shared
+    /// memory goes to the game (and its VRAM carve-out) instead of idle launcher UIs.
+    /// </summary>
+    public class WorkingSetTrimService
+    {
+        private readonly IProcessSchedulingApi _api;
+        private readonly object _lock = new object();
+        private int _lastTrimmedGameProcessId;
+
+        public WorkingSetTrimReport? LastReport { get; private set; }
+
+        public WorkingSetTrimService() : this(new Win32ProcessSchedulingApi())
+        {
+        }
+
+        public WorkingSetTrimService(IProcessSchedulingApi api)
+        {
+            _api = api;
+        }
+
+        /// <summary>
+        /// Trims launcher working sets for a newly started game. Repeat calls for the same game PID are ignored;
+        /// the next game (different PID) re-arms the trim.
+        /// </summary>
+        public WorkingSetTrimReport? TrimForGame(
+            int gameProcessId,
+            string gameProcessName,
+            IReadOnlyList<ProcessSnapshot> snapshot,
+            IEnumerable<string> rules)
+        {
+            lock (_lock)
+            {
+                if (_lastTrimmedGameProcessId == gameProcessId)
+                    return null;
+
+                _lastTrimmedGameProcessId = gameProcessId;
+
+                var candidates = WorkingSetTrimPolicy.SelectCandidates(
+                    new BackgroundThrottleRuleSet(rules),
+                    snapshot.Count > 0 ? snapshot : _api.GetProcesses(), // Fall back if detection hasn't scanned yet
+                    new ProcessSnapshot { ProcessId = gameProcessId, ProcessName = gameProcessName });
+
+                var report = new WorkingSetTrimReport { GameProcessName = gameProcessName };
+
+                foreach (var candidate in candidates)
+                {
+                    if (!_api.TryGetWorkingSet(candidate.ProcessId, out long before) ||
+                        !WorkingSetTrimPolicy.ShouldTrim(before))
+                    {
+                        continue;
+                    }
+
+                    // Snapshot may be a few seconds old - make sure the PID still belongs to the launcher
+                    var currentName = _api.GetProcessName(candidate.ProcessId);
+                    if (!string.Equals(currentName, candidate.ProcessName, StringComparison.OrdinalIgnoreCase))
+                        continue;
+
+                    if (!_api.TryTrimWorkingSet(candidate.ProcessId))
+                        continue;
+
+                    // Unreadable after the trim (usually the process exited) - nothing to measure, so leave it out
+                    // rather than reporting the whole working set as freed
+                    if (!_api.TryGetWorkingSet(candidate.ProcessId, out long after))
+                        continue;
+
+                    report.Results.Add(new WorkingSetTrimResult
+                    {
+                        ProcessId = candidate.ProcessId,
+                        ProcessName = candidate.ProcessName,
+                        BytesBefore = before,
+                        BytesAfter = after
+                    });
+                }
+
+                LastReport = report;
+                System.Diagnostics.Debug.WriteLine($"WorkingSetTrim: {report}");
+                return report;
+            }
+        }
+
+        /// <summary>
+        /// Re-arms the trim after the game exits so relaunching the same game trims again.
+        /// </summary>
+        public void Rearm()
+        {
+            lock (_lock)
+            {
+                _lastTrimmedGameProcessId = 0;
+            }
+        }
+    }
+}
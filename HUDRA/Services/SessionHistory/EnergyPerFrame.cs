@@ -0,0 +1,290 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+
+namespace HUDRA.Services.SessionHistory
+{
+    /// <summary>
+    /// Count, mean and sum of squared deviations (Welford), mergeable across sessions without the raw values.
+    /// </summary>
+    public struct RunningStats
+    {
+        public int Count;
+        public double Mean;
+        public double M2;
+
+        public void Add(double value)
+        {
+            Count++;
+            double delta = value - Mean;
+            Mean += delta / Count;
+            M2 += delta * (value - Mean);
+        }
+
+        public static RunningStats Merge(in RunningStats a, in RunningStats b)
+        {
+            if (a.Count == 0) return b;
+            if (b.Count == 0) return a;
+
+            int count = a.Count + b.Count;
+            double delta = b.Mean - a.Mean;
+            return new RunningStats
+            {
+                Count = count,
+                Mean = a.Mean + delta * b.Count / count,
+                M2 = a.M2 + b.M2 + delta * delta * a.Count * b.Count / count
+            };
+        }
+
+        public readonly bool HasValue => Count > 0;
+
+        public readonly double Variance => Count > 1 ? M2 / (Count - 1) : double.NaN;
+
+        public readonly double StandardError => Count > 1 ? Math.Sqrt(Variance / Count) : double.NaN;
+
+        /// <summary>
+        /// Half-width of the 95% confidence interval for the mean (Student's t), NaN with fewer than two values.
+        /// </summary>
+        public readonly double ConfidenceHalfWidth95 => StandardError * TCritical95(Count - 1);
+
+        private static readonly double[] TTable95 =
+        {
+            12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+            2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+            2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+        };
+
+        private static double TCritical95(int degreesOfFreedom)
+        {
+            if (degreesOfFreedom < 1) return double.NaN;
+            if (degreesOfFreedom <= TTable95.Length) return TTable95[degreesOfFreedom - 1];
+            // First-order expansion in 1/df; within 0.003 of the exact value from 30 up
+            return 1.96 + 2.37 / degreesOfFreedom;
+        }
+    }
+
+    /// <summary>
+    /// Streams joules per frame from power and frame-rate samples. Each interval between two valid
+    /// samples contributes trapezoid energy and frames; the live value is total energy over total frames
+    /// across the last few intervals (a ratio of sums, so slow scenes don't dominate), and each completed
+    /// run of <c>windowIntervals</c> intervals adds one value to <see cref="WindowStats"/> for confidence
+    /// intervals. Fixed-size ring buffers, no allocation after construction.
+    /// </summary>
+    public sealed class EnergyPerFrameMeter
+    {
+        // Intervals spanning a longer gap (suspend, RTSS losing the hook) aren't integrated
+        private const long MaxIntervalMs = 60_000;
+
+        private readonly double[] _joules;
+        private readonly double[] _frames;
+        private readonly int _windowIntervals;
+        private int _head;
+        private int _count;
+        private double _liveJoules;
+        private double _liveFrames;
+
+        private long _lastTimestampMs;
+        private double _lastWatts = double.NaN;
+        private double _lastFps = double.NaN;
+
+        private double _windowJoules;
+        private double _windowFrames;
+        private int _windowCount;
+        private RunningStats _windowStats;
+
+        /// <param name="liveIntervals">Intervals the live value averages over (12 = 1 minute at 5 s samples).</param>
+        /// <param name="windowIntervals">Intervals per window value in <see cref="WindowStats"/>.</param>
+        public EnergyPerFrameMeter(int liveIntervals = 12, int windowIntervals = 12)
+        {
+            if (liveIntervals < 1) throw new ArgumentOutOfRangeException(nameof(liveIntervals));
+            if (windowIntervals < 1) throw new ArgumentOutOfRangeException(nameof(windowIntervals));
+
+            _joules = new double[liveIntervals];
+            _frames = new double[liveIntervals];
+            _windowIntervals = windowIntervals;
+        }
+
+        public double TotalJoules { get; private set; }
+        public double TotalFrames { get; private set; }
+
+        /// <summary>
+        /// Joules per frame over the recent intervals, NaN until one valid interval.
+        /// </summary>
+        public double LiveJoulesPerFrame => _liveFrames > 0 ? _liveJoules / _liveFrames : double.NaN;
+
+        /// <summary>
+        /// Joules per frame over everything integrated so far.
+        /// </summary>
+        public double TotalJoulesPerFrame => TotalFrames > 0 ? TotalJoules / TotalFrames : double.NaN;
+
+        /// <summary>
+        /// Distribution of per-window joules per frame; partial windows aren't included.
+        /// </summary>
+        public RunningStats WindowStats => _windowStats;
+
+        public void Add(long timestampMs, double watts, double fps)
+        {
+            bool valid = watts > 0 && fps > 0 && !double.IsInfinity(watts) && !double.IsInfinity(fps);
+            bool lastValid = !double.IsNaN(_lastWatts);
+            long elapsedMs = timestampMs - _lastTimestampMs;
+
+            if (valid && lastValid && elapsedMs > 0 && elapsedMs <= MaxIntervalMs)
+            {
+                double seconds = elapsedMs / 1000.0;
+                AddInterval((_lastWatts + watts) / 2 * seconds, (_lastFps + fps) / 2 * seconds);
+            }
+            else if (lastValid && (!valid || elapsedMs > MaxIntervalMs))
+            {
+                // Neither the live value nor a window should straddle a gap: both would mix unrelated stretches
+                ClearLive();
+                _windowJoules = 0;
+                _windowFrames = 0;
+                _windowCount = 0;
+            }
+
+            _lastTimestampMs = timestampMs;
+            _lastWatts = valid ? watts : double.NaN;
+            _lastFps = valid ? fps : double.NaN;
+        }
+
+        private void AddInterval(double joules, double frames)
+        {
+            if (_count == _joules.Length)
+            {
+                _liveJoules -= _joules[_head];
+                _liveFrames -= _frames[_head];
+            }
+            else
+            {
+                _count++;
+            }
+
+            _joules[_head] = joules;
+            _frames[_head] = frames;
+            _liveJoules += joules;
+            _liveFrames += frames;
+            _head = (_head + 1) % _joules.Length;
+
+            // Re-sum once per lap so subtraction error can't accumulate over a long session
+            if (_head == 0)
+            {
+                _liveJoules = 0;
+                _liveFrames = 0;
+                for (int i = 0; i < _count; i++)
+                {
+                    _liveJoules += _joules[i];
+                    _liveFrames += _frames[i];
+                }
+            }
+
+            TotalJoules += joules;
+            TotalFrames += frames;
+
+            _windowJoules += joules;
+            _windowFrames += frames;
+            if (++_windowCount == _windowIntervals)
+            {
+                _windowStats.Add(_windowJoules / _windowFrames);
+                _windowJoules = 0;
+                _windowFrames = 0;
+                _windowCount = 0;
+            }
+        }
+
+        private void ClearLive()
+        {
+            Array.Clear(_joules);
+            Array.Clear(_frames);
+            _head = 0;
+            _count = 0;
+            _liveJoules = 0;
+            _liveFrames = 0;
+        }
+
+        public void Reset()
+        {
+            ClearLive();
+            _lastTimestampMs = 0;
+            _lastWatts = double.NaN;
+            _lastFps = double.NaN;
+            _windowJoules = 0;
+            _windowFrames = 0;
+            _windowCount = 0;
+            _windowStats = default;
+            TotalJoules = 0;
+            TotalFrames = 0;
+        }
+    }
+
+    /// <summary>
+    /// One game profile's efficiency across its recorded sessions.
+    /// </summary>
+    public class ProfileEfficiency
+    {
+        public string ProfileLabel { get; set; } = string.Empty;
+        public int SessionCount { get; set; }
+        public TimeSpan PlayTime { get; set; }
+        public RunningStats PackageJoulesPerFrame { get; set; }
+        public RunningStats BatteryJoulesPerFrame { get; set; }
+        public double AverageFps { get; set; } = double.NaN;
+        public DateTime LastPlayedUtc { get; set; }
+        public double PowerSaverEnergyWh { get; set; }
+
+        /// <summary>
+        /// Package power when any session had it, battery discharge otherwise.
+        /// </summary>
+        public RunningStats JoulesPerFrame => PackageJoulesPerFrame.HasValue ? PackageJoulesPerFrame : BatteryJoulesPerFrame;
+
+        public bool UsesPackagePower => PackageJoulesPerFrame.HasValue;
+    }
+
+    public static class EfficiencyComparison
+    {
+        /// <summary>
+        /// Groups a game's sessions by the profile that was applied and pools their window statistics, most
+        /// recently played profile first. Sessions without frame-rate data are left out.
+        /// </summary>
+        public static List<ProfileEfficiency> ByProfile(IEnumerable<SessionSummary> sessions)
+        {
+            var groups = new Dictionary<string, (ProfileEfficiency Result, double FpsWeighted, int FpsCount)>(StringComparer.Ordinal);
+
+            foreach (var session in sessions)
+            {
+                if (!session.PackageJoulesPerFrame.HasValue && !session.BatteryJoulesPerFrame.HasValue)
+                    continue;
+
+                var label = string.IsNullOrEmpty(session.ProfileLabel) ? SessionSummary.NoProfileLabel : session.ProfileLabel;
+                if (!groups.TryGetValue(label, out var group))
+                    group = (new ProfileEfficiency { ProfileLabel = label }, 0, 0);
+
+                var result = group.Result;
+                result.SessionCount++;
+                result.PlayTime += session.Duration;
+                result.PackageJoulesPerFrame = RunningStats.Merge(result.PackageJoulesPerFrame, session.PackageJoulesPerFrame);
+                result.BatteryJoulesPerFrame = RunningStats.Merge(result.BatteryJoulesPerFrame, session.BatteryJoulesPerFrame);
+                result.PowerSaverEnergyWh += session.PowerSaverEnergyWh;
+                if (session.EndUtc > result.LastPlayedUtc)
+                    result.LastPlayedUtc = session.EndUtc;
+
+                var fps = session[SessionChannel.Fps];
+                if (fps.HasValue)
+                {
+                    group.FpsWeighted += (double)fps.Average * fps.Count;
+                    group.FpsCount += fps.Count;
+                }
+
+                groups[label] = group;
+            }
+
+            return groups.Values
+                .Select(g =>
+                {
+                    if (g.FpsCount > 0)
+                        g.Result.AverageFps = g.FpsWeighted / g.FpsCount;
+                    return g.Result;
+                })
+                .OrderByDescending(p => p.LastPlayedUtc)
+                .ToList();
+        }
+    }
+}
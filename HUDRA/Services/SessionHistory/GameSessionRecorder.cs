@@ -0,0 +1,244 @@
+using HUDRA.Models;
+using System;
+using System.Collections.Generic;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace HUDRA.Services.SessionHistory
+{
+    public interface ISessionSampleSource
+    {
+        /// <summary>
+        /// Takes one sample for the game with <paramref name="processId"/>. Called on a timer thread.
+        /// </summary>
+        SessionSample Read(int processId, long timestampMs);
+    }
+
+    /// <summary>
+    /// Samples telemetry at a low rate while a game runs and appends it to the game's history file in
+    /// batches, then writes the session summary when the game exits.
+    /// </summary>
+    public sealed class GameSessionRecorder : IDisposable
+    {
+        public static readonly TimeSpan DefaultSampleInterval = TimeSpan.FromSeconds(5);
+
+        // 10 minutes at the default rate: bounds what a crash loses without a write per sample
+        private const int FlushThreshold = 120;
+
+        private readonly SessionHistoryStore _store;
+        private readonly ISessionSampleSource _source;
+        private readonly TimeSpan _interval;
+        private readonly object _lock = new object();
+        private Timer? _timer;
+        private ActiveSession? _session;
+        private int _sampling;
+        private bool _disposed;
+
+        private sealed class ActiveSession
+        {
+            public string GameKey = string.Empty;
+            public int ProcessId;
+            public long SessionId;
+            public readonly List<SessionSample> Pending = new(FlushThreshold);
+            public SessionSummaryBuilder Summary = null!;
+
+            // Held from taking samples out of Pending until they're appended (taken before _lock), so
+            // Finish can't write the tail and summary ahead of a batch the timer is still writing
+            public readonly object WriteLock = new object();
+        }
+
+        /// <summary>
+        /// Raised on a thread-pool thread after a session's summary has been written.
+        /// </summary>
+        public event EventHandler<SessionSummary>? SessionRecorded;
+
+        /// <summary>
+        /// Raised on the sampling thread for every sample added to the session.
+        /// </summary>
+        public event EventHandler<SessionSample>? SampleTaken;
+
+        public GameSessionRecorder(SessionHistoryStore store, ISessionSampleSource source)
+            : this(store, source, DefaultSampleInterval)
+        {
+        }
+
+        public GameSessionRecorder(SessionHistoryStore store, ISessionSampleSource source, TimeSpan interval)
+        {
+            _store = store;
+            _source = source;
+            _interval = interval;
+        }
+
+        public SessionHistoryStore Store => _store;
+
+        public bool IsRecording
+        {
+            get { lock (_lock) return _session != null; }
+        }
+
+        /// <summary>
+        /// Starts a session for the game. Calling again for the same PID is a no-op; a different PID ends
+        /// the previous session first. <paramref name="profileLabel"/> groups sessions for profile comparison.
+        /// </summary>
+        public void Start(GameInfo game, string profileLabel = "")
+        {
+            ActiveSession? previous;
+            lock (_lock)
+            {
+                if (_disposed || _session?.ProcessId == game.ProcessId)
+                    return;
+
+                previous = DetachSession();
+
+                long now = DateTimeOffset.UtcNow.ToUnixTimeMilliseconds();
+                var name = !string.IsNullOrWhiteSpace(game.WindowTitle) ? game.WindowTitle : game.ProcessName;
+                _session = new ActiveSession
+                {
+                    GameKey = SessionHistoryStore.GetGameKey(game.ProcessName),
+                    ProcessId = game.ProcessId,
+                    SessionId = now,
+                    Summary = new SessionSummaryBuilder(now, name, profileLabel)
+                };
+                _timer = new Timer(OnSampleTimer, null, _interval, _interval);
+            }
+
+            System.Diagnostics.Debug.WriteLine($"SessionHistory: Recording {game.ProcessName} (PID {game.ProcessId})");
+
+            if (previous != null)
+                _ = Task.Run(() => Finish(previous));
+        }
+
+        /// <summary>
+        /// Records what the power saver saved in the current session; call before <see cref="Stop"/>.
+        /// </summary>
+        public void SetPowerSaverResult(double energySavedWh, TimeSpan savingTime)
+        {
+            lock (_lock)
+            {
+                _session?.Summary.SetPowerSaver(energySavedWh, savingTime);
+            }
+        }
+
+        /// <summary>
+        /// Ends the current session. The final write happens on a background thread.
+        /// </summary>
+        public void Stop()
+        {
+            ActiveSession? session;
+            lock (_lock)
+            {
+                session = DetachSession();
+            }
+
+            if (session != null)
+                _ = Task.Run(() => Finish(session));
+        }
+
+        private ActiveSession? DetachSession()
+        {
+            _timer?.Dispose();
+            _timer = null;
+            var session = _session;
+            _session = null;
+            return session;
+        }
+
+        private void OnSampleTimer(object? state)
+        {
+            // Skip a tick rather than pile up if a sample source is slow
+            if (Interlocked.Exchange(ref _sampling, 1) == 1)
+                return;
+
+            try
+            {
+                ActiveSession? session;
+                lock (_lock) session = _session;
+                if (session == null) return;
+
+                var sample = _source.Read(session.ProcessId, DateTimeOffset.UtcNow.ToUnixTimeMilliseconds());
+
+                lock (session.WriteLock)
+                {
+                    SessionSample[]? batch = null;
+                    lock (_lock)
+                    {
+                        // The session may have ended while the sample was being read
+                        if (!ReferenceEquals(_session, session)) return;
+
+                        session.Pending.Add(sample);
+                        session.Summary.Add(sample);
+                        if (session.Pending.Count >= FlushThreshold)
+                        {
+                            batch = session.Pending.ToArray();
+                            session.Pending.Clear();
+                        }
+                    }
+
+                    if (batch != null)
+                        _store.AppendSamples(session.GameKey, session.SessionId, batch);
+                }
+
+                SampleTaken?.Invoke(this, sample);
+            }
+            catch (Exception ex)
+            {
+                System.Diagnostics.Debug.WriteLine($"SessionHistory: Sampling failed: {ex.Message}");
+            }
+            finally
+            {
+                Volatile.Write(ref _sampling, 0);
+            }
+        }
+
+        private void Finish(ActiveSession session)
+        {
+            try
+            {
+                SessionSummary summary;
+                lock (session.WriteLock)
+                {
+                    SessionSample[] remaining;
+                    lock (_lock)
+                    {
+                        remaining = session.Pending.ToArray();
+                        session.Pending.Clear();
+                    }
+
+                    if (session.Summary.SampleCount == 0)
+                        return;
+
+                    _store.AppendSamples(session.GameKey, session.SessionId, remaining);
+
+                    summary = session.Summary.Build();
+                    _store.AppendSummary(session.GameKey, summary);
+                }
+                System.Diagnostics.Debug.WriteLine($"SessionHistory: Saved {summary.GameName}, {summary.SampleCount} samples over {summary.Duration:hh\\:mm\\:ss}");
+
+                _store.Downsample(session.GameKey,
+                    DateTime.UtcNow - SessionHistoryStore.DefaultDownsampleAge,
+                    SessionHistoryStore.DefaultDownsampleInterval);
+
+                SessionRecorded?.Invoke(this, summary);
+            }
+            catch (Exception ex)
+            {
+                System.Diagnostics.Debug.WriteLine($"SessionHistory: Failed to save session: {ex.Message}");
+            }
+        }
+
+        public void Dispose()
+        {
+            ActiveSession? session;
+            lock (_lock)
+            {
+                if (_disposed) return;
+                _disposed = true;
+                session = DetachSession();
+            }
+
+            // App exit: write synchronously so the session isn't lost
+            if (session != null)
+                Finish(session);
+        }
+    }
+}
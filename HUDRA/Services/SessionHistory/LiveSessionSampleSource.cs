@@ -0,0 +1,96 @@
+using System;
+using Windows.Devices.Power;
+
+namespace HUDRA.Services.SessionHistory
+{
+    /// <summary>
+    /// Reads session samples from the running app's services. Each channel is NaN when its source is
+    /// unavailable: package power needs ryzenadj in DLL mode, FPS needs RTSS hooked into the game.
+    /// </summary>
+    public sealed class LiveSessionSampleSource : ISessionSampleSource, IDisposable
+    {
+        private readonly Func<int> _getTargetTdp;
+        private readonly Func<TemperatureMonitorService?> _getTemperatureMonitor;
+        private readonly Func<FanControlService?> _getFanControl;
+        private readonly object _tdpLock = new object();
+        private TDPService? _tdpService;
+        private bool _disposed;
+
+        // Services are looked up per sample: App creates temperature and fan services after the main window
+        public LiveSessionSampleSource(Func<int> getTargetTdp,
+            Func<TemperatureMonitorService?> getTemperatureMonitor,
+            Func<FanControlService?> getFanControl)
+        {
+            _getTargetTdp = getTargetTdp;
+            _getTemperatureMonitor = getTemperatureMonitor;
+            _getFanControl = getFanControl;
+        }
+
+        public SessionSample Read(int processId, long timestampMs)
+        {
+            var sample = SessionSample.Empty(timestampMs);
+            if (_disposed) return sample;
+
+            int targetTdp = _getTargetTdp();
+            if (targetTdp > 0)
+                sample.TdpWatts = targetTdp;
+
+            // Created on first use so loading ryzenadj happens on the sampling thread, not at startup.
+            // The lock keeps Dispose from freeing the ryzenadj handle under a read in flight.
+            lock (_tdpLock)
+            {
+                if (_disposed) return sample;
+                _tdpService ??= new TDPService();
+                var (powerOk, watts) = _tdpService.GetPackagePower();
+                if (powerOk)
+                    sample.PackagePowerWatts = (float)watts;
+            }
+
+            var temperature = _getTemperatureMonitor()?.CurrentTemperature;
+            if (temperature != null)
+            {
+                if (temperature.CpuTemperature > 0)
+                    sample.CpuTemperature = (float)temperature.CpuTemperature;
+                if (temperature.GpuTemperature > 0)
+                    sample.GpuTemperature = (float)temperature.GpuTemperature;
+            }
+
+            var fanStatus = _getFanControl()?.LastStatus;
+            if (fanStatus != null)
+                sample.FanDutyPercent = (float)fanStatus.CurrentDutyPercent;
+
+            var fps = RtssFrameRateReader.GetFrameRate(processId);
+            if (fps.HasValue)
+                sample.Fps = (float)fps.Value;
+
+            sample.BatteryDischargeWatts = ReadBatteryDischarge();
+            return sample;
+        }
+
+        private static float ReadBatteryDischarge()
+        {
+            try
+            {
+                // Negative charge rate means the battery is discharging
+                var rate = Battery.AggregateBattery.GetReport().ChargeRateInMilliwatts;
+                return rate.HasValue ? -rate.Value / 1000f : float.NaN;
+            }
+            catch (Exception ex)
+            {
+                System.Diagnostics.Debug.WriteLine($"SessionHistory: Battery report failed: {ex.Message}");
+                return float.NaN;
+            }
+        }
+
+        public void Dispose()
+        {
+            lock (_tdpLock)
+            {
+                if (_disposed) return;
+                _disposed = true;
+                _tdpService?.Dispose();
+                _tdpService = null;
+            }
+        }
+    }
+}
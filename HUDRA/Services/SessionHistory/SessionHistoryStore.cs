@@ -0,0 +1,762 @@
+using System;
+using System.Buffers.Binary;
+using System.Collections.Generic;
+using System.IO;
+using System.Linq;
+using System.Text;
+
+namespace HUDRA.Services.SessionHistory
+{
+    public class DownsampleResult
+    {
+        public int SessionsDownsampled { get; set; }
+        public int SamplesBefore { get; set; }
+        public int SamplesAfter { get; set; }
+        public long BytesBefore { get; set; }
+        public long BytesAfter { get; set; }
+    }
+
+    /// <summary>
+    /// Append-only session history, one file per game. A file is a sequence of self-describing blocks:
+    /// sample blocks hold a run of samples stored column by column (timestamps, then each channel, each
+    /// delta-encoded as varints at 0.1 resolution), and a summary block is appended when a session ends.
+    /// Every block header carries its session and time range, so summary and range queries seek past
+    /// the blocks they don't need. A torn block at the end of a file (crash mid-write) is ignored on read
+    /// and cut off before the next append. Old sessions can be downsampled in place.
+    /// </summary>
+    public sealed class SessionHistoryStore
+    {
+        private const uint FileMagic = 0x53455348; // "HSES"
+        private const ushort FormatVersion = 1;
+        private const int FileHeaderSize = 8;
+        private const int BlockHeaderSize = 36;
+        private const float Scale = 10f;
+        private const int MaxSamplesPerBlock = ushort.MaxValue;
+        private const string FileExtension = ".hsess";
+
+        private const byte BlockSamples = 1;
+        private const byte BlockSummary = 2;
+        private const byte FlagDownsampled = 1;
+
+        public static readonly TimeSpan DefaultDownsampleAge = TimeSpan.FromDays(30);
+        public static readonly TimeSpan DefaultDownsampleInterval = TimeSpan.FromMinutes(1);
+
+        private readonly string _directory;
+        private readonly object _lock = new object();
+        private readonly HashSet<string> _checkedTails = new(StringComparer.OrdinalIgnoreCase);
+
+        private struct BlockHeader
+        {
+            public byte Kind;
+            public byte Flags;
+            public int Count;
+            public int PayloadLength;
+            public long SessionId;
+            public long FirstTimestampMs;
+            public long LastTimestampMs;
+            public uint Checksum;
+            public long Offset; // Of the header within the file
+
+            public readonly bool IsDownsampled => (Flags & FlagDownsampled) != 0;
+        }
+
+        public SessionHistoryStore() : this(Path.Combine(
+            Environment.GetFolderPath(Environment.SpecialFolder.LocalApplicationData), "HUDRA", "SessionHistory"))
+        {
+        }
+
+        public SessionHistoryStore(string directory)
+        {
+            _directory = directory;
+        }
+
+        public string Directory => _directory;
+
+        /// <summary>
+        /// File-safe key for a game, from its process name ("eldenring.exe" -> "eldenring").
+        /// </summary>
+        public static string GetGameKey(string processName)
+        {
+            var name = Path.GetFileNameWithoutExtension(processName.Trim()).ToLowerInvariant();
+            var invalid = Path.GetInvalidFileNameChars();
+            var key = new StringBuilder(name.Length);
+            foreach (var c in name)
+                key.Append(Array.IndexOf(invalid, c) >= 0 ? '_' : c);
+            return key.Length > 0 ? key.ToString() : "_";
+        }
+
+        public IReadOnlyList<string> GetGameKeys()
+        {
+            if (!System.IO.Directory.Exists(_directory))
+                return Array.Empty<string>();
+
+            return System.IO.Directory.EnumerateFiles(_directory, "*" + FileExtension)
+                .Select(Path.GetFileNameWithoutExtension)
+                .Where(k => !string.IsNullOrEmpty(k))
+                .Select(k => k!)
+                .ToList();
+        }
+
+        public long GetFileSize(string gameKey)
+        {
+            var path = GetPath(gameKey);
+            return File.Exists(path) ? new FileInfo(path).Length : 0;
+        }
+
+        #region Writing
+
+        public void AppendSamples(string gameKey, long sessionId, ReadOnlySpan<SessionSample> samples)
+        {
+            if (samples.IsEmpty) return;
+
+            using var buffer = new MemoryStream(samples.Length * 12 + BlockHeaderSize);
+            for (int start = 0; start < samples.Length; start += MaxSamplesPerBlock)
+            {
+                var run = samples.Slice(start, Math.Min(MaxSamplesPerBlock, samples.Length - start));
+                WriteSampleBlock(buffer, sessionId, run, downsampled: false);
+            }
+
+            Append(gameKey, buffer);
+        }
+
+        public void AppendSummary(string gameKey, SessionSummary summary)
+        {
+            using var buffer = new MemoryStream(128);
+            WriteSummaryBlock(buffer, summary);
+            Append(gameKey, buffer);
+        }
+
+        private void Append(string gameKey, MemoryStream blocks)
+        {
+            var path = GetPath(gameKey);
+            lock (_lock)
+            {
+                System.IO.Directory.CreateDirectory(_directory);
+                using var stream = new FileStream(path, FileMode.OpenOrCreate, FileAccess.ReadWrite, FileShare.Read);
+
+                if (stream.Length < FileHeaderSize)
+                {
+                    stream.SetLength(0);
+                    WriteFileHeader(stream);
+                    _checkedTails.Add(path);
+                }
+                else if (_checkedTails.Add(path))
+                {
+                    // Drop a block torn by a crash so new blocks stay reachable
+                    long validEnd = FindValidEnd(stream);
+                    if (validEnd < stream.Length)
+                    {
+                        System.Diagnostics.Debug.WriteLine($"SessionHistory: Truncating torn tail of {Path.GetFileName(path)} ({stream.Length - validEnd} bytes)");
+                        stream.SetLength(validEnd);
+                    }
+                }
+
+                stream.Seek(0, SeekOrigin.End);
+                stream.Write(blocks.GetBuffer(), 0, (int)blocks.Length);
+            }
+        }
+
+        private static void WriteFileHeader(Stream stream)
+        {
+            Span<byte> header = stackalloc byte[FileHeaderSize];
+            BinaryPrimitives.WriteUInt32LittleEndian(header, FileMagic);
+            BinaryPrimitives.WriteUInt16LittleEndian(header.Slice(4), FormatVersion);
+            BinaryPrimitives.WriteUInt16LittleEndian(header.Slice(6), 0);
+            stream.Write(header);
+        }
+
+        private static void WriteSampleBlock(MemoryStream output, long sessionId, ReadOnlySpan<SessionSample> samples, bool downsampled)
+        {
+            long headerOffset = output.Length;
+            output.Position = headerOffset + BlockHeaderSize;
+
+            // Timestamps: deltas from the first, which lives in the header
+            for (int i = 1; i < samples.Length; i++)
+                WriteVarint(output, ZigZag(samples[i].TimestampMs - samples[i - 1].TimestampMs));
+
+            // Channels: low bit set = no value, otherwise the zigzag delta from the last value shifted up one
+            for (int channel = 0; channel < SessionSample.ChannelCount; channel++)
+            {
+                long previous = 0;
+                for (int i = 0; i < samples.Length; i++)
+                {
+                    float value = samples[i][(SessionChannel)channel];
+                    if (float.IsNaN(value))
+                    {
+                        output.WriteByte(1);
+                        continue;
+                    }
+
+                    long quantized = Quantize(value);
+                    WriteVarint(output, ZigZag(quantized - previous) << 1);
+                    previous = quantized;
+                }
+            }
+
+            FinishBlock(output, headerOffset, new BlockHeader
+            {
+                Kind = BlockSamples,
+                Flags = downsampled ? FlagDownsampled : (byte)0,
+                Count = samples.Length,
+                SessionId = sessionId,
+                FirstTimestampMs = samples[0].TimestampMs,
+                LastTimestampMs = samples[samples.Length - 1].TimestampMs
+            });
+        }
+
+        private static void WriteSummaryBlock(MemoryStream output, SessionSummary summary)
+        {
+            long headerOffset = output.Length;
+            output.Position = headerOffset + BlockHeaderSize;
+
+            WriteVarint(output, (ulong)summary.SampleCount);
+            WriteDouble(output, summary.BatteryEnergyWh);
+
+            var name = Encoding.UTF8.GetBytes(summary.GameName ?? string.Empty);
+            WriteVarint(output, (ulong)name.Length);
+            output.Write(name, 0, name.Length);
+
+            for (int channel = 0; channel < SessionSample.ChannelCount; channel++)
+            {
+                var stats = summary.Channels[channel];
+                WriteVarint(output, (ulong)stats.Count);
+                if (stats.Count == 0) continue;
+                WriteSingle(output, stats.Min);
+                WriteSingle(output, stats.Max);
+                WriteSingle(output, stats.Average);
+            }
+
+            // Added after the first release: readers stop at the end of the payload if these are absent
+            var profile = Encoding.UTF8.GetBytes(summary.ProfileLabel ?? string.Empty);
+            WriteVarint(output, (ulong)profile.Length);
+            output.Write(profile, 0, profile.Length);
+            WriteRunningStats(output, summary.PackageJoulesPerFrame);
+            WriteRunningStats(output, summary.BatteryJoulesPerFrame);
+            WriteDouble(output, summary.PowerSaverEnergyWh);
+            WriteVarint(output, (ulong)Math.Max(0, (long)summary.PowerSaverTime.TotalSeconds));
+
+            FinishBlock(output, headerOffset, new BlockHeader
+            {
+                Kind = BlockSummary,
+                Count = 1,
+                SessionId = summary.SessionId,
+                FirstTimestampMs = ToUnixMs(summary.StartUtc),
+                LastTimestampMs = ToUnixMs(summary.EndUtc)
+            });
+        }
+
+        private static void FinishBlock(MemoryStream output, long headerOffset, BlockHeader header)
+        {
+            long end = output.Position;
+            int payloadLength = (int)(end - headerOffset - BlockHeaderSize);
+            var buffer = output.GetBuffer();
+
+            header.PayloadLength = payloadLength;
+            header.Checksum = Checksum(buffer.AsSpan((int)headerOffset + BlockHeaderSize, payloadLength));
+
+            var span = buffer.AsSpan((int)headerOffset, BlockHeaderSize);
+            span[0] = header.Kind;
+            span[1] = header.Flags;
+            BinaryPrimitives.WriteUInt16LittleEndian(span.Slice(2), (ushort)header.Count);
+            BinaryPrimitives.WriteInt32LittleEndian(span.Slice(4), header.PayloadLength);
+            BinaryPrimitives.WriteInt64LittleEndian(span.Slice(8), header.SessionId);
+            BinaryPrimitives.WriteInt64LittleEndian(span.Slice(16), header.FirstTimestampMs);
+            BinaryPrimitives.WriteInt64LittleEndian(span.Slice(24), header.LastTimestampMs);
+            BinaryPrimitives.WriteUInt32LittleEndian(span.Slice(32), header.Checksum);
+
+            output.Position = end;
+        }
+
+        #endregion
+
+        #region Queries
+
+        /// <summary>
+        /// Session summaries, oldest first, optionally limited to sessions that started in a time range.
+        /// Sessions that never finished (HUDRA closed mid-game) have no summary.
+        /// </summary>
+        public List<SessionSummary> GetSummaries(string gameKey, DateTime? fromUtc = null, DateTime? toUtc = null)
+        {
+            long from = fromUtc.HasValue ? ToUnixMs(fromUtc.Value) : long.MinValue;
+            long to = toUtc.HasValue ? ToUnixMs(toUtc.Value) : long.MaxValue;
+
+            var summaries = new List<SessionSummary>();
+            ReadBlocks(gameKey,
+                header => header.Kind == BlockSummary && header.FirstTimestampMs >= from && header.FirstTimestampMs <= to,
+                (header, payload) => summaries.Add(DecodeSummary(header, payload)));
+            return summaries;
+        }
+
+        /// <summary>
+        /// Samples with timestamps in [<paramref name="fromUtc"/>, <paramref name="toUtc"/>], oldest first.
+        /// Pass a session ID to read a single session's timeline.
+        /// </summary>
+        public List<SessionSample> GetSamples(string gameKey, DateTime fromUtc, DateTime toUtc, long? sessionId = null)
+        {
+            long from = ToUnixMs(fromUtc);
+            long to = ToUnixMs(toUtc);
+
+            var samples = new List<SessionSample>();
+            ReadBlocks(gameKey,
+                header => header.Kind == BlockSamples &&
+                          header.LastTimestampMs >= from && header.FirstTimestampMs <= to &&
+                          (!sessionId.HasValue || header.SessionId == sessionId.Value),
+                (header, payload) =>
+                {
+                    foreach (var sample in DecodeSamples(header, payload))
+                    {
+                        if (sample.TimestampMs >= from && sample.TimestampMs <= to)
+                            samples.Add(sample);
+                    }
+                });
+            return samples;
+        }
+
+        public List<SessionSample> GetSessionSamples(string gameKey, long sessionId)
+        {
+            return GetSamples(gameKey, DateTime.MinValue, DateTime.MaxValue, sessionId);
+        }
+
+        private void ReadBlocks(string gameKey, Func<BlockHeader, bool> wanted, Action<BlockHeader, byte[]> onBlock)
+        {
+            var path = GetPath(gameKey);
+            if (!File.Exists(path)) return;
+
+            lock (_lock)
+            {
+                try
+                {
+                    using var stream = OpenRead(path);
+                    if (!ReadFileHeader(stream)) return;
+
+                    byte[] payload = Array.Empty<byte>();
+                    while (TryReadBlockHeader(stream, out var header))
+                    {
+                        if (!wanted(header))
+                        {
+                            stream.Seek(header.PayloadLength, SeekOrigin.Current);
+                            continue;
+                        }
+
+                        if (payload.Length < header.PayloadLength)
+                            payload = new byte[Math.Max(header.PayloadLength, payload.Length * 2)];
+
+                        stream.ReadExactly(payload, 0, header.PayloadLength);
+                        if (Checksum(payload.AsSpan(0, header.PayloadLength)) != header.Checksum)
+                        {
+                            System.Diagnostics.Debug.WriteLine($"SessionHistory: Checksum mismatch at {header.Offset} in {Path.GetFileName(path)}, stopping");
+                            return;
+                        }
+
+                        onBlock(header, payload);
+                    }
+                }
+                catch (Exception ex) when (ex is IOException || ex is UnauthorizedAccessException)
+                {
+                    System.Diagnostics.Debug.WriteLine($"SessionHistory: Could not read {path}: {ex.Message}");
+                }
+            }
+        }
+
+        private static SessionSample[] DecodeSamples(BlockHeader header, byte[] payload)
+        {
+            var samples = new SessionSample[header.Count];
+            int position = 0;
+
+            long timestamp = header.FirstTimestampMs;
+            samples[0].TimestampMs = timestamp;
+            for (int i = 1; i < samples.Length; i++)
+            {
+                timestamp += UnZigZag(ReadVarint(payload, ref position));
+                samples[i].TimestampMs = timestamp;
+            }
+
+            for (int channel = 0; channel < SessionSample.ChannelCount; channel++)
+            {
+                long previous = 0;
+                for (int i = 0; i < samples.Length; i++)
+                {
+                    ulong token = ReadVarint(payload, ref position);
+                    if ((token & 1) != 0)
+                    {
+                        samples[i][(SessionChannel)channel] = float.NaN;
+                        continue;
+                    }
+
+                    previous += UnZigZag(token >> 1);
+                    samples[i][(SessionChannel)channel] = previous / Scale;
+                }
+            }
+
+            return samples;
+        }
+
+        private static SessionSummary DecodeSummary(BlockHeader header, byte[] payload)
+        {
+            int position = 0;
+            var summary = new SessionSummary
+            {
+                SessionId = header.SessionId,
+                StartUtc = DateTimeOffset.FromUnixTimeMilliseconds(header.FirstTimestampMs).UtcDateTime,
+                EndUtc = DateTimeOffset.FromUnixTimeMilliseconds(header.LastTimestampMs).UtcDateTime,
+                SampleCount = (int)ReadVarint(payload, ref position),
+                BatteryEnergyWh = ReadDouble(payload, ref position)
+            };
+
+            int nameLength = (int)ReadVarint(payload, ref position);
+            summary.GameName = Encoding.UTF8.GetString(payload, position, nameLength);
+            position += nameLength;
+
+            for (int channel = 0; channel < SessionSample.ChannelCount; channel++)
+            {
+                ref var stats = ref summary.Channels[channel];
+                stats.Count = (int)ReadVarint(payload, ref position);
+                if (stats.Count == 0) continue;
+                stats.Min = ReadSingle(payload, ref position);
+                stats.Max = ReadSingle(payload, ref position);
+                stats.Average = ReadSingle(payload, ref position);
+            }
+
+            if (position < payload.Length)
+            {
+                int profileLength = (int)ReadVarint(payload, ref position);
+                summary.ProfileLabel = Encoding.UTF8.GetString(payload, position, profileLength);
+                position += profileLength;
+                summary.PackageJoulesPerFrame = ReadRunningStats(payload, ref position);
+                summary.BatteryJoulesPerFrame = ReadRunningStats(payload, ref position);
+            }
+
+            if (position < payload.Length)
+            {
+                summary.PowerSaverEnergyWh = ReadDouble(payload, ref position);
+                summary.PowerSaverTime = TimeSpan.FromSeconds(ReadVarint(payload, ref position));
+            }
+
+            return summary;
+        }
+
+        private static void WriteRunningStats(Stream stream, RunningStats stats)
+        {
+            WriteVarint(stream, (ulong)stats.Count);
+            if (stats.Count == 0) return;
+            WriteDouble(stream, stats.Mean);
+            WriteDouble(stream, stats.M2);
+        }
+
+        private static RunningStats ReadRunningStats(byte[] buffer, ref int position)
+        {
+            var stats = new RunningStats { Count = (int)ReadVarint(buffer, ref position) };
+            if (stats.Count == 0) return stats;
+            stats.Mean = ReadDouble(buffer, ref position);
+            stats.M2 = ReadDouble(buffer, ref position);
+            return stats;
+        }
+
+        #endregion
+
+        #region Downsampling
+
+        /// <summary>
+        /// Replaces the samples of sessions that ended before <paramref name="olderThanUtc"/> with one averaged
+        /// sample per <paramref name="interval"/>. Summaries are kept as they are. Rewrites the file, so it is
+        /// meant to run occasionally (e.g. when a session ends), not per append.
+        /// </summary>
+        public DownsampleResult Downsample(string gameKey, DateTime olderThanUtc, TimeSpan interval)
+        {
+            var result = new DownsampleResult();
+            var path = GetPath(gameKey);
+            if (!File.Exists(path)) return result;
+
+            long cutoff = ToUnixMs(olderThanUtc);
+            long bucketMs = Math.Max(1, (long)interval.TotalMilliseconds);
+
+            lock (_lock)
+            {
+                // Pass 1: which sessions are old and still at full resolution
+                var headers = new List<BlockHeader>();
+                using (var stream = OpenRead(path))
+                {
+                    if (!ReadFileHeader(stream)) return result;
+                    while (TryReadBlockHeader(stream, out var header))
+                    {
+                        headers.Add(header);
+                        stream.Seek(header.PayloadLength, SeekOrigin.Current);
+                    }
+                }
+
+                var sessionEnds = new Dictionary<long, long>();
+                var alreadyDownsampled = new HashSet<long>();
+                foreach (var header in headers.Where(h => h.Kind == BlockSamples))
+                {
+                    sessionEnds[header.SessionId] = Math.Max(sessionEnds.GetValueOrDefault(header.SessionId, long.MinValue), header.LastTimestampMs);
+                    if (header.IsDownsampled) alreadyDownsampled.Add(header.SessionId);
+                }
+
+                var eligible = sessionEnds
+                    .Where(s => s.Value < cutoff && !alreadyDownsampled.Contains(s.Key))
+                    .Select(s => s.Key)
+                    .ToHashSet();
+                if (eligible.Count == 0) return result;
+
+                // Pass 2: copy everything else verbatim, replace each eligible session with one downsampled run
+                var tempPath = path + ".tmp";
+                using (var input = OpenRead(path))
+                using (var output = new FileStream(tempPath, FileMode.Create, FileAccess.Write, FileShare.None))
+                {
+                    result.BytesBefore = input.Length;
+                    WriteFileHeader(output);
+
+                    var sessionSamples = eligible.ToDictionary(id => id, _ => new List<SessionSample>());
+                    var payload = Array.Empty<byte>();
+
+                    foreach (var header in headers)
+                    {
+                        input.Position = header.Offset;
+                        int blockLength = BlockHeaderSize + header.PayloadLength;
+                        if (payload.Length < blockLength)
+                            payload = new byte[blockLength];
+                        input.ReadExactly(payload, 0, blockLength);
+
+                        if (header.Kind == BlockSamples && eligible.Contains(header.SessionId))
+                        {
+                            var blockPayload = payload.AsSpan(BlockHeaderSize, header.PayloadLength).ToArray();
+                            sessionSamples[header.SessionId].AddRange(DecodeSamples(header, blockPayload));
+                            continue;
+                        }
+
+                        output.Write(payload, 0, blockLength);
+                    }
+
+                    // Downsampled runs go at the end; readers order by timestamp, not file position
+                    using var buffer = new MemoryStream();
+                    foreach (var (sessionId, samples) in sessionSamples.OrderBy(s => s.Key))
+                    {
+                        var reduced = DownsampleRun(samples, bucketMs);
+                        result.SamplesBefore += samples.Count;
+                        result.SamplesAfter += reduced.Count;
+                        result.SessionsDownsampled++;
+
+                        buffer.SetLength(0);
+                        var run = reduced.ToArray();
+                        for (int start = 0; start < run.Length; start += MaxSamplesPerBlock)
+                        {
+                            int count = Math.Min(MaxSamplesPerBlock, run.Length - start);
+                            WriteSampleBlock(buffer, sessionId, run.AsSpan(start, count), downsampled: true);
+                        }
+
+                        output.Write(buffer.GetBuffer(), 0, (int)buffer.Length);
+                    }
+
+                    result.BytesAfter = output.Length;
+                }
+
+                File.Move(tempPath, path, overwrite: true);
+                _checkedTails.Add(path);
+            }
+
+            System.Diagnostics.Debug.WriteLine($"SessionHistory: Downsampled {result.SessionsDownsampled} session(s) of {gameKey}, " +
+                $"{result.SamplesBefore} -> {result.SamplesAfter} samples, {result.BytesBefore} -> {result.BytesAfter} bytes");
+            return result;
+        }
+
+        private static List<SessionSample> DownsampleRun(List<SessionSample> samples, long bucketMs)
+        {
+            samples.Sort((a, b) => a.TimestampMs.CompareTo(b.TimestampMs));
+
+            var reduced = new List<SessionSample>();
+            var sums = new double[SessionSample.ChannelCount];
+            var counts = new int[SessionSample.ChannelCount];
+            int index = 0;
+
+            while (index < samples.Count)
+            {
+                long bucketStart = samples[index].TimestampMs;
+                Array.Clear(sums);
+                Array.Clear(counts);
+
+                while (index < samples.Count && samples[index].TimestampMs - bucketStart < bucketMs)
+                {
+                    for (int channel = 0; channel < SessionSample.ChannelCount; channel++)
+                    {
+                        float value = samples[index][(SessionChannel)channel];
+                        if (float.IsNaN(value)) continue;
+                        sums[channel] += value;
+                        counts[channel]++;
+                    }
+                    index++;
+                }
+
+                var averaged = new SessionSample { TimestampMs = bucketStart };
+                for (int channel = 0; channel < SessionSample.ChannelCount; channel++)
+                    averaged[(SessionChannel)channel] = counts[channel] > 0 ? (float)(sums[channel] / counts[channel]) : float.NaN;
+                reduced.Add(averaged);
+            }
+
+            return reduced;
+        }
+
+        #endregion
+
+        #region Block I/O
+
+        private string GetPath(string gameKey) => Path.Combine(_directory, gameKey + FileExtension);
+
+        private static FileStream OpenRead(string path)
+        {
+            return new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.ReadWrite, 64 * 1024);
+        }
+
+        private static bool ReadFileHeader(Stream stream)
+        {
+            Span<byte> header = stackalloc byte[FileHeaderSize];
+            if (stream.Length < FileHeaderSize) return false;
+            stream.ReadExactly(header);
+
+            if (BinaryPrimitives.ReadUInt32LittleEndian(header) != FileMagic)
+                return false;
+
+            ushort version = BinaryPrimitives.ReadUInt16LittleEndian(header.Slice(4));
+            if (version > FormatVersion)
+            {
+                System.Diagnostics.Debug.WriteLine($"SessionHistory: Unsupported format version {version}");
+                return false;
+            }
+
+            return true;
+        }
+
+        /// <summary>
+        /// Reads the next block header. False at the end of the file or at a block that extends past it.
+        /// </summary>
+        private static bool TryReadBlockHeader(Stream stream, out BlockHeader header)
+        {
+            header = default;
+            long offset = stream.Position;
+            if (stream.Length - offset < BlockHeaderSize)
+                return false;
+
+            Span<byte> span = stackalloc byte[BlockHeaderSize];
+            stream.ReadExactly(span);
+
+            header = new BlockHeader
+            {
+                Offset = offset,
+                Kind = span[0],
+                Flags = span[1],
+                Count = BinaryPrimitives.ReadUInt16LittleEndian(span.Slice(2)),
+                PayloadLength = BinaryPrimitives.ReadInt32LittleEndian(span.Slice(4)),
+                SessionId = BinaryPrimitives.ReadInt64LittleEndian(span.Slice(8)),
+                FirstTimestampMs = BinaryPrimitives.ReadInt64LittleEndian(span.Slice(16)),
+                LastTimestampMs = BinaryPrimitives.ReadInt64LittleEndian(span.Slice(24)),
+                Checksum = BinaryPrimitives.ReadUInt32LittleEndian(span.Slice(32))
+            };
+
+            bool known = header.Kind == BlockSamples || header.Kind == BlockSummary;
+            return known && header.Count > 0 && header.PayloadLength >= 0 &&
+                   stream.Length - stream.Position >= header.PayloadLength;
+        }
+
+        private static long FindValidEnd(FileStream stream)
+        {
+            stream.Position = 0;
+            if (!ReadFileHeader(stream)) return 0;
+
+            long validEnd = stream.Position;
+            var payload = Array.Empty<byte>();
+            while (TryReadBlockHeader(stream, out var header))
+            {
+                if (payload.Length < header.PayloadLength)
+                    payload = new byte[header.PayloadLength];
+                stream.ReadExactly(payload, 0, header.PayloadLength);
+                if (Checksum(payload.AsSpan(0, header.PayloadLength)) != header.Checksum)
+                    break;
+                validEnd = stream.Position;
+            }
+
+            return validEnd;
+        }
+
+        // FNV-1a; catches torn and partially flushed blocks, not tampering
+        private static uint Checksum(ReadOnlySpan<byte> data)
+        {
+            uint hash = 2166136261;
+            foreach (var b in data)
+            {
+                hash ^= b;
+                hash *= 16777619;
+            }
+            return hash;
+        }
+
+        private static long Quantize(float value)
+        {
+            double scaled = Math.Round(value * (double)Scale);
+            return (long)Math.Clamp(scaled, int.MinValue, int.MaxValue);
+        }
+
+        private static ulong ZigZag(long value) => (ulong)((value << 1) ^ (value >> 63));
+
+        private static long UnZigZag(ulong value) => (long)(value >> 1) ^ -(long)(value & 1);
+
+        private static void WriteVarint(Stream stream, ulong value)
+        {
+            while (value >= 0x80)
+            {
+                stream.WriteByte((byte)(value | 0x80));
+                value >>= 7;
+            }
+            stream.WriteByte((byte)value);
+        }
+
+        private static ulong ReadVarint(byte[] buffer, ref int position)
+        {
+            ulong value = 0;
+            int shift = 0;
+            byte b;
+            do
+            {
+                b = buffer[position++];
+                value |= (ulong)(b & 0x7F) << shift;
+                shift += 7;
+            } while ((b & 0x80) != 0 && shift < 64);
+            return value;
+        }
+
+        private static void WriteSingle(Stream stream, float value)
+        {
+            Span<byte> bytes = stackalloc byte[4];
+            BinaryPrimitives.WriteSingleLittleEndian(bytes, value);
+            stream.Write(bytes);
+        }
+
+        private static void WriteDouble(Stream stream, double value)
+        {
+            Span<byte> bytes = stackalloc byte[8];
+            BinaryPrimitives.WriteDoubleLittleEndian(bytes, value);
+            stream.Write(bytes);
+        }
+
+        private static float ReadSingle(byte[] buffer, ref int position)
+        {
+            float value = BinaryPrimitives.ReadSingleLittleEndian(buffer.AsSpan(position));
+            position += 4;
+            return value;
+        }
+
+        private static double ReadDouble(byte[] buffer, ref int position)
+        {
+            double value = BinaryPrimitives.ReadDoubleLittleEndian(buffer.AsSpan(position));
+            position += 8;
+            return value;
+        }
+
+        private static long ToUnixMs(DateTime utc)
+        {
+            if (utc <= DateTime.MinValue) return long.MinValue;
+            if (utc >= DateTime.MaxValue) return long.MaxValue;
+            return new DateTimeOffset(DateTime.SpecifyKind(utc, DateTimeKind.Utc)).ToUnixTimeMilliseconds();
+        }
+
+        #endregion
+    }
+}
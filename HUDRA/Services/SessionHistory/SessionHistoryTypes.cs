@@ -0,0 +1,205 @@
+using System;
+
+namespace HUDRA.Services.SessionHistory
+{
+    public enum SessionChannel
+    {
+        TdpWatts,              // Target TDP while the sample was taken
+        PackagePowerWatts,     // APU package power (STAPM average) from ryzenadj
+        CpuTemperature,        // °C
+        GpuTemperature,        // °C
+        FanDutyPercent,
+        Fps,                   // Game's frame rate from RTSS
+        BatteryDischargeWatts  // Positive while discharging, negative while charging
+    }
+
+    /// <summary>
+    /// One low-rate telemetry sample. Channels without a source for this device or moment are NaN.
+    /// </summary>
+    public struct SessionSample
+    {
+        public const int ChannelCount = 7;
+
+        public long TimestampMs;   // Unix time, milliseconds
+        public float TdpWatts;
+        public float PackagePowerWatts;
+        public float CpuTemperature;
+        public float GpuTemperature;
+        public float FanDutyPercent;
+        public float Fps;
+        public float BatteryDischargeWatts;
+
+        public static SessionSample Empty(long timestampMs) => new SessionSample
+        {
+            TimestampMs = timestampMs,
+            TdpWatts = float.NaN,
+            PackagePowerWatts = float.NaN,
+            CpuTemperature = float.NaN,
+            GpuTemperature = float.NaN,
+            FanDutyPercent = float.NaN,
+            Fps = float.NaN,
+            BatteryDischargeWatts = float.NaN
+        };
+
+        public DateTime Timestamp => DateTimeOffset.FromUnixTimeMilliseconds(TimestampMs).UtcDateTime;
+
+        public float this[SessionChannel channel]
+        {
+            readonly get => channel switch
+            {
+                SessionChannel.TdpWatts => TdpWatts,
+                SessionChannel.PackagePowerWatts => PackagePowerWatts,
+                SessionChannel.CpuTemperature => CpuTemperature,
+                SessionChannel.GpuTemperature => GpuTemperature,
+                SessionChannel.FanDutyPercent => FanDutyPercent,
+                SessionChannel.Fps => Fps,
+                SessionChannel.BatteryDischargeWatts => BatteryDischargeWatts,
+                _ => throw new ArgumentOutOfRangeException(nameof(channel))
+            };
+            set
+            {
+                switch (channel)
+                {
+                    case SessionChannel.TdpWatts: TdpWatts = value; break;
+                    case SessionChannel.PackagePowerWatts: PackagePowerWatts = value; break;
+                    case SessionChannel.CpuTemperature: CpuTemperature = value; break;
+                    case SessionChannel.GpuTemperature: GpuTemperature = value; break;
+                    case SessionChannel.FanDutyPercent: FanDutyPercent = value; break;
+                    case SessionChannel.Fps: Fps = value; break;
+                    case SessionChannel.BatteryDischargeWatts: BatteryDischargeWatts = value; break;
+                    default: throw new ArgumentOutOfRangeException(nameof(channel));
+                }
+            }
+        }
+    }
+
+    public struct ChannelStats
+    {
+        public int Count;      // Samples with a value
+        public float Min;
+        public float Max;
+        public float Average;
+
+        public readonly bool HasValue => Count > 0;
+    }
+
+    /// <summary>
+    /// What a session looked like overall: written once when the game exits.
+    /// </summary>
+    public class SessionSummary
+    {
+        public const string NoProfileLabel = "No profile";
+
+        public long SessionId { get; set; }          // Session start, Unix ms
+        public string GameName { get; set; } = string.Empty;
+        public string ProfileLabel { get; set; } = string.Empty; // Profile applied at start, empty for none
+        public DateTime StartUtc { get; set; }
+        public DateTime EndUtc { get; set; }
+        public int SampleCount { get; set; }
+        public ChannelStats[] Channels { get; set; } = new ChannelStats[SessionSample.ChannelCount];
+
+        // Battery energy used, integrated from the discharge channel
+        public double BatteryEnergyWh { get; set; }
+
+        // Joules per frame over 1-minute windows, from package power and from battery discharge
+        public RunningStats PackageJoulesPerFrame { get; set; }
+        public RunningStats BatteryJoulesPerFrame { get; set; }
+
+        // Power saver (menus, loading, background): package energy saved and time spent saving
+        public double PowerSaverEnergyWh { get; set; }
+        public TimeSpan PowerSaverTime { get; set; }
+
+        public TimeSpan Duration => EndUtc - StartUtc;
+
+        public ChannelStats this[SessionChannel channel] => Channels[(int)channel];
+    }
+
+    /// <summary>
+    /// Accumulates a <see cref="SessionSummary"/> as samples arrive, so stopping a session doesn't re-read it.
+    /// </summary>
+    public sealed class SessionSummaryBuilder
+    {
+        // A gap longer than this (sleep, suspend) isn't integrated into battery energy
+        private const long MaxIntegrationGapMs = 60_000;
+
+        private readonly SessionSummary _summary;
+        private readonly double[] _sums = new double[SessionSample.ChannelCount];
+        private readonly EnergyPerFrameMeter _packageEnergy = new();
+        private readonly EnergyPerFrameMeter _batteryEnergy = new();
+        private long _lastTimestampMs;
+        private float _lastDischarge = float.NaN;
+
+        public SessionSummaryBuilder(long sessionId, string gameName, string profileLabel = "")
+        {
+            _summary = new SessionSummary { SessionId = sessionId, GameName = gameName, ProfileLabel = profileLabel };
+        }
+
+        public int SampleCount => _summary.SampleCount;
+
+        public void Add(in SessionSample sample)
+        {
+            if (_summary.SampleCount == 0)
+                _summary.StartUtc = sample.Timestamp;
+            _summary.EndUtc = sample.Timestamp;
+            _summary.SampleCount++;
+
+            for (int i = 0; i < SessionSample.ChannelCount; i++)
+            {
+                float value = sample[(SessionChannel)i];
+                if (float.IsNaN(value)) continue;
+
+                ref var stats = ref _summary.Channels[i];
+                if (stats.Count == 0)
+                {
+                    stats.Min = value;
+                    stats.Max = value;
+                }
+                else
+                {
+                    stats.Min = Math.Min(stats.Min, value);
+                    stats.Max = Math.Max(stats.Max, value);
+                }
+
+                stats.Count++;
+                _sums[i] += value;
+            }
+
+            // Trapezoid over the discharge rate; charging intervals don't count as energy used
+            if (_lastTimestampMs != 0 && !float.IsNaN(_lastDischarge) && !float.IsNaN(sample.BatteryDischargeWatts))
+            {
+                long elapsedMs = sample.TimestampMs - _lastTimestampMs;
+                if (elapsedMs > 0 && elapsedMs <= MaxIntegrationGapMs)
+                {
+                    double watts = Math.Max(0, (_lastDischarge + sample.BatteryDischargeWatts) / 2.0);
+                    _summary.BatteryEnergyWh += watts * elapsedMs / 3_600_000.0;
+                }
+            }
+
+            _lastTimestampMs = sample.TimestampMs;
+            _lastDischarge = sample.BatteryDischargeWatts;
+
+            _packageEnergy.Add(sample.TimestampMs, sample.PackagePowerWatts, sample.Fps);
+            _batteryEnergy.Add(sample.TimestampMs, sample.BatteryDischargeWatts, sample.Fps);
+        }
+
+        public void SetPowerSaver(double energySavedWh, TimeSpan savingTime)
+        {
+            _summary.PowerSaverEnergyWh = energySavedWh;
+            _summary.PowerSaverTime = savingTime;
+        }
+
+        public SessionSummary Build()
+        {
+            for (int i = 0; i < SessionSample.ChannelCount; i++)
+            {
+                ref var stats = ref _summary.Channels[i];
+                stats.Average = stats.Count > 0 ? (float)(_sums[i] / stats.Count) : 0;
+            }
+
+            _summary.PackageJoulesPerFrame = _packageEnergy.WindowStats;
+            _summary.BatteryJoulesPerFrame = _batteryEnergy.WindowStats;
+
+            return _summary;
+        }
+    }
+}
@@ -5,6 +5,8 @@ using System.Collections.Generic;
 using HUDRA.Configuration;
 using HUDRA.Controls; // For FanCurve and FanCurvePoint classes
 using HUDRA.Services.FanControl;
+using HUDRA.Services.Power;
+using HUDRA.Services.Scheduling;
 using HUDRA.Models;
 using Microsoft.Win32;
 
@@ -67,6 +69,22 @@ namespace HUDRA.Services
         // Default Profile key (for game profile revert)
         private const string DEFAULT_PROFILE_KEY = "DefaultProfile";
 
+        // Background throttling key (process names throttled while a game runs)
+        private const string BACKGROUND_THROTTLE_PROCESSES_KEY = "BackgroundThrottleProcesses";
+
+        // Launcher working-set trim key (process names trimmed at game start)
+        private const string WORKING_SET_TRIM_PROCESSES_KEY = "WorkingSetTrimProcesses";
+
+        // Menu/loading power saver keys (lower TDP and FPS cap outside gameplay)
+        private const string MENU_POWER_SAVER_ENABLED_KEY = "MenuPowerSaverEnabled";
+        private const string MENU_POWER_SAVER_TDP_KEY = "MenuPowerSaverTdp";
+        private const string MENU_POWER_SAVER_FPS_KEY = "MenuPowerSaverFps";
+
+        // Background power saver keys (lower TDP and FPS cap while the game is out of the foreground)
+        private const string BACKGROUND_POWER_SAVER_ENABLED_KEY = "BackgroundPowerSaverEnabled";
+        private const string BACKGROUND_POWER_SAVER_TDP_KEY = "BackgroundPowerSaverTdp";
+        private const string BACKGROUND_POWER_SAVER_FPS_KEY = "BackgroundPowerSaverFps";
+
         // Hardware detection key (stored permanently)
         private const string DETECTED_DEVICE_KEY = "DetectedDevice";
 
@@ -822,6 +840,101 @@ namespace HUDRA.Services
             SetBooleanSetting(SGDB_HINT_DISMISSED_KEY, dismissed);
         }
 
+        // Background throttling methods
+        public static List<string> GetBackgroundThrottleProcesses()
+        {
+            return GetProcessNameListSetting(BACKGROUND_THROTTLE_PROCESSES_KEY, BackgroundThrottlePolicy.DefaultRules);
+        }
+
+        public static List<string> GetWorkingSetTrimProcesses()
+        {
+            return GetProcessNameListSetting(WORKING_SET_TRIM_PROCESSES_KEY, WorkingSetTrimPolicy.DefaultRules);
+        }
+
+        public static bool GetMenuPowerSaverEnabled()
+        {
+            return GetBooleanSetting(MENU_POWER_SAVER_ENABLED_KEY, false); // Default to disabled - opt-in
+        }
+
+        public static void SetMenuPowerSaverEnabled(bool enabled)
+        {
+            SetBooleanSetting(MENU_POWER_SAVER_ENABLED_KEY, enabled);
+        }
+
+        public static int GetMenuPowerSaverTdp()
+        {
+            return GetIntegerSetting(MENU_POWER_SAVER_TDP_KEY, 8);
+        }
+
+        public static void SetMenuPowerSaverTdp(int tdp)
+        {
+            SetIntegerSetting(MENU_POWER_SAVER_TDP_KEY, tdp);
+        }
+
+        public static int GetMenuPowerSaverFps()
+        {
+            return GetIntegerSetting(MENU_POWER_SAVER_FPS_KEY, 30);
+        }
+
+        public static void SetMenuPowerSaverFps(int fps)
+        {
+            SetIntegerSetting(MENU_POWER_SAVER_FPS_KEY, fps);
+        }
+
+        public static bool GetBackgroundPowerSaverEnabled()
+        {
+            return GetBooleanSetting(BACKGROUND_POWER_SAVER_ENABLED_KEY, false); // Default to disabled - opt-in
+        }
+
+        public static void SetBackgroundPowerSaverEnabled(bool enabled)
+        {
+            SetBooleanSetting(BACKGROUND_POWER_SAVER_ENABLED_KEY, enabled);
+        }
+
+        public static int GetBackgroundPowerSaverTdp()
+        {
+            return GetIntegerSetting(BACKGROUND_POWER_SAVER_TDP_KEY, HudraSettings.MIN_TDP);
+        }
+
+        public static void SetBackgroundPowerSaverTdp(int tdp)
+        {
+            SetIntegerSetting(BACKGROUND_POWER_SAVER_TDP_KEY, tdp);
+        }
+
+        public static int GetBackgroundPowerSaverFps()
+        {
+            return GetIntegerSetting(BACKGROUND_POWER_SAVER_FPS_KEY, 10);
+        }
+
+        public static void SetBackgroundPowerSaverFps(int fps)
+        {
+            SetIntegerSetting(BACKGROUND_POWER_SAVER_FPS_KEY, fps);
+        }
+
+        public static PowerSaverSettings GetPowerSaverSettings()
+        {
+            return new PowerSaverSettings
+            {
+                MenuEnabled = GetMenuPowerSaverEnabled(),
+                MenuTdp = GetMenuPowerSaverTdp(),
+                MenuFpsLimit = GetMenuPowerSaverFps(),
+                BackgroundEnabled = GetBackgroundPowerSaverEnabled(),
+                BackgroundTdp = GetBackgroundPowerSaverTdp(),
+                BackgroundFpsLimit = GetBackgroundPowerSaverFps()
+            };
+        }
+
+        private static List<string> GetProcessNameListSetting(string key, IReadOnlyList<string> defaults)
+        {
+            var stored = GetStringSetting(key, "");
+            if (string.IsNullOrWhiteSpace(stored))
+            {
+                return new List<string>(defaults);
+            }
+
+            return new List<string>(stored.Split(';', StringSplitOptions.RemoveEmptyEntries | StringSplitOptions.TrimEntries));
+        }
+
         /// <summary>
         /// Reads preferences set by the installer and applies them on first launch.
         /// Should be called early in app startup, before UI is shown.
@@ -0,0 +1,219 @@
+using System;
+using System.Collections.Generic;
+using System.Globalization;
+using System.IO;
+using System.Text;
+
+namespace HUDRA.Services.Steam
+{
+    /// <summary>
+    /// One entry from an app's config/launch section in appinfo.vdf.
+    /// </summary>
+    public class SteamLaunchConfig
+    {
+        public string Executable { get; set; } = string.Empty; // Relative to the install dir
+        public string Arguments { get; set; } = string.Empty;
+        public string Type { get; set; } = string.Empty;       // default, option1, none, server, editor, vr, ...
+        public string Description { get; set; } = string.Empty;
+        public string OsList { get; set; } = string.Empty;     // Comma separated, empty = all
+        public string OsArch { get; set; } = string.Empty;     // "32", "64" or empty
+        public string BetaKey { get; set; } = string.Empty;    // Only offered on this beta branch
+    }
+
+    public class SteamAppLaunchInfo
+    {
+        public uint AppId { get; set; }
+        public string? BuildId { get; set; } // Public branch build
+        public List<SteamLaunchConfig> LaunchConfigs { get; set; } = new List<SteamLaunchConfig>();
+    }
+
+    /// <summary>
+    /// Reads launch configurations from Steam's binary appcache\appinfo.vdf (format versions 27-29).
+    /// Entries for apps that weren't asked for are skipped by their size field without being parsed.
+    /// </summary>
+    public static class SteamAppInfoReader
+    {
+        private const uint MagicV27 = 0x07564427;
+        private const uint MagicV28 = 0x07564428;
+        private const uint MagicV29 = 0x07564429; // Keys moved to a string table at the end of the file
+
+        // Binary KeyValues value types
+        private const byte TypeSection = 0x00;
+        private const byte TypeString = 0x01;
+        private const byte TypeInt32 = 0x02;
+        private const byte TypeFloat = 0x03;
+        private const byte TypePointer = 0x04;
+        private const byte TypeWideString = 0x05;
+        private const byte TypeColor = 0x06;
+        private const byte TypeUInt64 = 0x07;
+        private const byte TypeEnd = 0x08;
+        private const byte TypeInt64 = 0x0A;
+        private const byte TypeAlternateEnd = 0x0B;
+
+        public static Dictionary<uint, SteamAppLaunchInfo> ReadFile(string path, IReadOnlySet<uint> appIds)
+        {
+            using var stream = new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.ReadWrite, bufferSize: 65536);
+            return Read(stream, appIds);
+        }
+
+        /// <summary>
+        /// Throws <see cref="InvalidDataException"/> for an unknown format version or corrupt data and
+        /// <see cref="EndOfStreamException"/> for a truncated file.
+        /// </summary>
+        public static Dictionary<uint, SteamAppLaunchInfo> Read(Stream stream, IReadOnlySet<uint> appIds)
+        {
+            var results = new Dictionary<uint, SteamAppLaunchInfo>();
+            using var reader = new BinaryReader(stream, Encoding.UTF8, leaveOpen: true);
+
+            uint magic = reader.ReadUInt32();
+            if (magic != MagicV27 && magic != MagicV28 && magic != MagicV29)
+                throw new InvalidDataException($"Unsupported appinfo.vdf version 0x{magic:X8}");
+
+            reader.ReadUInt32(); // Universe
+
+            string[]? keyTable = null;
+            if (magic == MagicV29)
+            {
+                long tableOffset = reader.ReadInt64();
+                long entriesStart = stream.Position;
+                keyTable = ReadKeyTable(reader, tableOffset);
+                stream.Position = entriesStart;
+            }
+
+            int headerSize = magic == MagicV27 ? 40 : 60; // v28 added a binary SHA-1 of the KeyValues
+            int remaining = appIds.Count;
+
+            while (remaining > 0)
+            {
+                uint appId = reader.ReadUInt32();
+                if (appId == 0) break;
+
+                uint size = reader.ReadUInt32();
+                long entryEnd = stream.Position + size;
+
+                if (appIds.Contains(appId))
+                {
+                    stream.Position += headerSize;
+                    var root = ReadSection(reader, keyTable, entryEnd);
+                    results[appId] = ToLaunchInfo(appId, root);
+                    remaining--;
+                }
+
+                stream.Position = entryEnd;
+            }
+
+            return results;
+        }
+
+        private static string[] ReadKeyTable(BinaryReader reader, long offset)
+        {
+            reader.BaseStream.Position = offset;
+            uint count = reader.ReadUInt32();
+            var keys = new string[count];
+            for (int i = 0; i < keys.Length; i++)
+            {
+                keys[i] = ReadNullTerminated(reader);
+            }
+            return keys;
+        }
+
+        private static Dictionary<string, object> ReadSection(BinaryReader reader, string[]? keyTable, long limit)
+        {
+            var node = new Dictionary<string, object>(StringComparer.OrdinalIgnoreCase);
+
+            while (reader.BaseStream.Position < limit)
+            {
+                byte type = reader.ReadByte();
+                if (type == TypeEnd || type == TypeAlternateEnd)
+                    break;
+
+                string key = keyTable != null ? keyTable[reader.ReadInt32()] : ReadNullTerminated(reader);
+
+                object value = type switch
+                {
+                    TypeSection => ReadSection(reader, keyTable, limit),
+                    TypeString => ReadNullTerminated(reader),
+                    TypeInt32 or TypePointer or TypeColor => reader.ReadInt32(),
+                    TypeFloat => reader.ReadSingle(),
+                    TypeUInt64 => reader.ReadUInt64(),
+                    TypeInt64 => reader.ReadInt64(),
+                    TypeWideString => ReadWideNullTerminated(reader),
+                    _ => throw new InvalidDataException($"Unknown KeyValues type 0x{type:X2}")
+                };
+
+                node[key] = value;
+            }
+
+            return node;
+        }
+
+        private static SteamAppLaunchInfo ToLaunchInfo(uint appId, Dictionary<string, object> root)
+        {
+            var info = new SteamAppLaunchInfo { AppId = appId };
+            var appinfo = GetSection(root, "appinfo") ?? root;
+
+            var publicBranch = GetSection(GetSection(GetSection(appinfo, "depots"), "branches"), "public");
+            if (publicBranch != null && publicBranch.TryGetValue("buildid", out var build))
+            {
+                info.BuildId = Convert.ToString(build, CultureInfo.InvariantCulture);
+            }
+
+            var launch = GetSection(GetSection(appinfo, "config"), "launch");
+            if (launch == null) return info;
+
+            // Entries are keyed "0", "1", ... in Steam's display order
+            foreach (var entry in launch)
+            {
+                if (entry.Value is not Dictionary<string, object> section) continue;
+
+                var config = GetSection(section, "config");
+                info.LaunchConfigs.Add(new SteamLaunchConfig
+                {
+                    Executable = GetString(section, "executable"),
+                    Arguments = GetString(section, "arguments"),
+                    Type = GetString(section, "type"),
+                    Description = GetString(section, "description"),
+                    OsList = GetString(config, "oslist"),
+                    OsArch = GetString(config, "osarch"),
+                    BetaKey = GetString(config, "betakey")
+                });
+            }
+
+            return info;
+        }
+
+        private static Dictionary<string, object>? GetSection(Dictionary<string, object>? node, string key)
+        {
+            return node != null && node.TryGetValue(key, out var value) ? value as Dictionary<string, object> : null;
+        }
+
+        private static string GetString(Dictionary<string, object>? node, string key)
+        {
+            return node != null && node.TryGetValue(key, out var value)
+                ? Convert.ToString(value, CultureInfo.InvariantCulture) ?? string.Empty
+                : string.Empty;
+        }
+
+        private static string ReadNullTerminated(BinaryReader reader)
+        {
+            var bytes = new List<byte>(32);
+            byte b;
+            while ((b = reader.ReadByte()) != 0)
+            {
+                bytes.Add(b);
+            }
+            return Encoding.UTF8.GetString(bytes.ToArray());
+        }
+
+        private static string ReadWideNullTerminated(BinaryReader reader)
+        {
+            var builder = new StringBuilder();
+            char c;
+            while ((c = (char)reader.ReadUInt16()) != '\0')
+            {
+                builder.Append(c);
+            }
+            return builder.ToString();
+        }
+    }
+}
@@ -0,0 +1,280 @@
+using Microsoft.Win32;
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using System.Linq;
+using System.Text.Json;
+using System.Text.RegularExpressions;
+
+namespace HUDRA.Services.Steam
+{
+    /// <summary>
+    /// Resolves a Steam game's executable from its appinfo launch configurations. Results are cached in
+    /// %LocalAppData%\HUDRA\steam_launch_cache.json keyed by app ID and installed build ID, so appinfo.vdf
+    /// is only read again for apps that were updated or newly installed.
+    /// </summary>
+    public class SteamLaunchResolver
+    {
+        private class CacheEntry
+        {
+            public string BuildId { get; set; } = string.Empty;
+            public string? Executable { get; set; } // Null when appinfo had no usable Windows launch entry
+            public string Arguments { get; set; } = string.Empty;
+        }
+
+        private static readonly Regex BuildIdRegex = new Regex("\"buildid\"\\s+\"(\\d+)\"", RegexOptions.IgnoreCase | RegexOptions.Compiled);
+
+        // Launch entries that never start the game itself
+        private static readonly HashSet<string> ExcludedTypes = new(StringComparer.OrdinalIgnoreCase)
+        {
+            "server", "editor", "config", "tool", "manual", "benchmark", "demo", "othertype"
+        };
+
+        // Executables that are usually a stub in front of the real game process
+        private static readonly string[] StubNamePatterns =
+        {
+            "launcher", "crashreport", "crashhandler", "easyanticheat", "eac_launcher", "battleye", "_be.exe",
+            "start_protected_game", "redprelauncher", "setup", "vcredist", "dxsetup"
+        };
+
+        private readonly string _cachePath;
+        private readonly object _lock = new object();
+        private Dictionary<string, CacheEntry> _cache = new(StringComparer.Ordinal);
+        private bool _loaded;
+
+        public SteamLaunchResolver()
+        {
+            var appDataPath = Path.Combine(
+                Environment.GetFolderPath(Environment.SpecialFolder.LocalApplicationData),
+                "HUDRA");
+            _cachePath = Path.Combine(appDataPath, "steam_launch_cache.json");
+        }
+
+        /// <summary>
+        /// Makes sure every app has a resolved launch entry for its installed build, reading appinfo.vdf once
+        /// for all cache misses. Call before <see cref="TryGetExecutable"/> for a batch of games.
+        /// </summary>
+        public void Prepare(string? steamRoot, IEnumerable<(string AppId, string InstallDir)> apps)
+        {
+            lock (_lock)
+            {
+                EnsureLoaded();
+
+                var misses = new Dictionary<uint, string>(); // app ID -> installed build ID
+                foreach (var (appIdText, installDir) in apps)
+                {
+                    if (!uint.TryParse(appIdText, out uint appId)) continue;
+
+                    var buildId = ReadInstalledBuildId(appIdText, installDir) ?? string.Empty;
+                    if (_cache.TryGetValue(appIdText, out var cached) && buildId.Length > 0 && cached.BuildId == buildId)
+                        continue;
+
+                    misses[appId] = buildId;
+                }
+
+                if (misses.Count == 0) return;
+
+                var appInfoPath = FindAppInfoPath(steamRoot);
+                if (appInfoPath == null)
+                {
+                    Debug.WriteLine("SteamLaunchResolver: appinfo.vdf not found");
+                    return;
+                }
+
+                try
+                {
+                    var stopwatch = Stopwatch.StartNew();
+                    var launchInfo = SteamAppInfoReader.ReadFile(appInfoPath, misses.Keys.ToHashSet());
+
+                    foreach (var (appId, buildId) in misses)
+                    {
+                        var config = launchInfo.TryGetValue(appId, out var info)
+                            ? SelectLaunchConfig(info.LaunchConfigs, Environment.Is64BitOperatingSystem)
+                            : null;
+
+                        _cache[appId.ToString()] = new CacheEntry
+                        {
+                            BuildId = buildId,
+                            Executable = config?.Executable,
+                            Arguments = config?.Arguments ?? string.Empty
+                        };
+                    }
+
+                    Debug.WriteLine($"SteamLaunchResolver: Resolved {misses.Count} app(s) from appinfo.vdf in {stopwatch.ElapsedMilliseconds}ms");
+                    SaveCache();
+                }
+                catch (Exception ex)
+                {
+                    Debug.WriteLine($"SteamLaunchResolver: Failed to read appinfo.vdf: {ex.Message}");
+                }
+            }
+        }
+
+        /// <summary>
+        /// Executable path relative to the install directory, from the last <see cref="Prepare"/>.
+        /// </summary>
+        public bool TryGetExecutable(string appId, out string relativePath)
+        {
+            lock (_lock)
+            {
+                EnsureLoaded();
+                if (_cache.TryGetValue(appId, out var entry) && !string.IsNullOrWhiteSpace(entry.Executable))
+                {
+                    relativePath = entry.Executable.Replace('/', Path.DirectorySeparatorChar);
+                    return true;
+                }
+            }
+
+            relativePath = string.Empty;
+            return false;
+        }
+
+        /// <summary>
+        /// Picks the entry Steam would run for "Play" on this machine: a Windows .exe that isn't a server/editor/tool
+        /// entry or beta-only, preferring the default type, a real game binary over a launcher or anti-cheat stub,
+        /// and the matching architecture. Returns null if nothing qualifies.
+        /// </summary>
+        public static SteamLaunchConfig? SelectLaunchConfig(IReadOnlyList<SteamLaunchConfig> configs, bool is64BitOs)
+        {
+            SteamLaunchConfig? best = null;
+            int bestRank = int.MaxValue;
+
+            for (int i = 0; i < configs.Count; i++)
+            {
+                var config = configs[i];
+                if (string.IsNullOrWhiteSpace(config.Executable) ||
+                    !config.Executable.EndsWith(".exe", StringComparison.OrdinalIgnoreCase) ||
+                    !string.IsNullOrEmpty(config.BetaKey) ||
+                    ExcludedTypes.Contains(config.Type))
+                {
+                    continue;
+                }
+
+                if (!string.IsNullOrEmpty(config.OsList) &&
+                    !config.OsList.Split(',').Any(os => os.Trim().Equals("windows", StringComparison.OrdinalIgnoreCase)))
+                {
+                    continue;
+                }
+
+                int archRank = config.OsArch switch
+                {
+                    "64" when is64BitOs => 0,
+                    "64" => -1,
+                    "" => 1,
+                    _ => 2
+                };
+                if (archRank < 0) continue;
+
+                int typeRank = config.Type.ToLowerInvariant() switch
+                {
+                    "" or "default" or "none" => 0,
+                    "vr" => 2,
+                    _ => 1 // option1, option2, ...
+                };
+
+                int stubRank = IsLikelyStub(config.Executable) ? 1 : 0;
+
+                // Stub avoidance outweighs type; order in appinfo breaks ties
+                int rank = stubRank * 1000 + typeRank * 100 + archRank * 10;
+                if (rank < bestRank)
+                {
+                    best = config;
+                    bestRank = rank;
+                }
+            }
+
+            return best;
+        }
+
+        private static bool IsLikelyStub(string executable)
+        {
+            var fileName = executable.Replace('\\', '/').Split('/').Last();
+            return StubNamePatterns.Any(pattern => fileName.Contains(pattern, StringComparison.OrdinalIgnoreCase));
+        }
+
+        /// <summary>
+        /// Installed build from steamapps\appmanifest_{id}.acf next to the library's common folder.
+        /// </summary>
+        private static string? ReadInstalledBuildId(string appId, string installDir)
+        {
+            try
+            {
+                var commonDir = Path.GetDirectoryName(installDir.TrimEnd('\\', '/'));
+                var steamAppsDir = commonDir != null ? Path.GetDirectoryName(commonDir) : null;
+                if (steamAppsDir == null) return null;
+
+                var manifestPath = Path.Combine(steamAppsDir, $"appmanifest_{appId}.acf");
+                if (!File.Exists(manifestPath)) return null;
+
+                var match = BuildIdRegex.Match(File.ReadAllText(manifestPath));
+                return match.Success ? match.Groups[1].Value : null;
+            }
+            catch (Exception ex)
+            {
+                Debug.WriteLine($"SteamLaunchResolver: Failed to read manifest for {appId}: {ex.Message}");
+                return null;
+            }
+        }
+
+        private static string? FindAppInfoPath(string? steamRoot)
+        {
+            var candidates = new List<string>();
+            if (!string.IsNullOrWhiteSpace(steamRoot))
+                candidates.Add(steamRoot);
+
+            // Linked into the cross-platform test project, so the registry read is guarded rather than assumed
+            if (OperatingSystem.IsWindows())
+            {
+                try
+                {
+                    using var steamKey = Registry.CurrentUser.OpenSubKey(@"Software\Valve\Steam");
+                    if (steamKey?.GetValue("SteamPath") is string registryPath)
+                        candidates.Add(registryPath.Replace('/', Path.DirectorySeparatorChar));
+                }
+                catch
+                {
+                }
+            }
+
+            candidates.Add(@"C:\Program Files (x86)\Steam");
+
+            return candidates
+                .Select(root => Path.Combine(root, "appcache", "appinfo.vdf"))
+                .FirstOrDefault(File.Exists);
+        }
+
+        private void EnsureLoaded()
+        {
+            if (_loaded) return;
+            _loaded = true;
+
+            try
+            {
+                if (File.Exists(_cachePath))
+                {
+                    var cache = JsonSerializer.Deserialize<Dictionary<string, CacheEntry>>(File.ReadAllText(_cachePath));
+                    if (cache != null)
+                        _cache = new Dictionary<string, CacheEntry>(cache, StringComparer.Ordinal);
+                }
+            }
+            catch (Exception ex)
+            {
+                Debug.WriteLine($"SteamLaunchResolver: Failed to load cache, starting fresh: {ex.Message}");
+            }
+        }
+
+        private void SaveCache()
+        {
+            try
+            {
+                Directory.CreateDirectory(Path.GetDirectoryName(_cachePath)!);
+                File.WriteAllText(_cachePath, JsonSerializer.Serialize(_cache, new JsonSerializerOptions { WriteIndented = true }));
+            }
+            catch (Exception ex)
+            {
+                Debug.WriteLine($"SteamLaunchResolver: Failed to save cache: {ex.Message}");
+            }
+        }
+    }
+}
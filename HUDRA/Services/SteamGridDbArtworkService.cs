@@ -1,11 +1,14 @@
 using HUDRA.Models;
+using HUDRA.Services.ArtworkPlaceholders;
+using HUDRA.Services.TitleMatching;
 using craftersmine.SteamGridDBNet;
 using System;
 using System.Collections.Generic;
 using System.IO;
 using System.Linq;
 using System.Net.Http;
-using System.Text.RegularExpressions;
+using System.Runtime.CompilerServices;
+using System.Threading;
 using System.Threading.Tasks;
 
 namespace HUDRA.Services
@@ -15,13 +18,11 @@ namespace HUDRA.Services
         private readonly SteamGridDb _client;
         private readonly string _artworkDirectory;
         private readonly HttpClient _httpClient;
+        private readonly ArtworkPreviewDownloader _previewDownloader;
         private bool _disposed = false;
 
-        // Regex to strip special characters and punctuation from game names for searching and matching
-        // Includes trademark symbols AND all punctuation (colons, dashes, etc.) for consistent normalization
-        private static readonly Regex SpecialCharactersRegex = new Regex(
-            @"[™®©℠\u2122\u00AE\u00A9\u2120]|[^\w\s]",
-            RegexOptions.Compiled);
+        // Shared across searches so token IDs for common words are interned once
+        private readonly TitleMatcher _titleMatcher = new TitleMatcher();
 
         // Minimum score threshold for accepting a match (0-100)
         private const int MinimumMatchScore = 50;
@@ -30,6 +31,7 @@ namespace HUDRA.Services
         {
             _client = new SteamGridDb(apiKey);
             _httpClient = new HttpClient();
+            _previewDownloader = new ArtworkPreviewDownloader(_httpClient);
 
             // Create artwork directory in HUDRA AppData folder
             var appDataPath = Path.Combine(
@@ -65,49 +67,15 @@ namespace HUDRA.Services
 
                 System.Diagnostics.Debug.WriteLine($"SteamGridDB: Searching for artwork for {game.DisplayName}");
 
-                // Clean the search term by removing trademark/copyright symbols
-                var cleanedSearchTerm = NormalizeName(game.DisplayName);
-                System.Diagnostics.Debug.WriteLine($"SteamGridDB: Normalized search term: {cleanedSearchTerm}");
-
-                // Search for the game by name
-                var searchResults = await _client.SearchForGamesAsync(cleanedSearchTerm);
-
-                if (searchResults == null || !searchResults.Any())
-                {
-                    System.Diagnostics.Debug.WriteLine($"SteamGridDB: No games found for {game.DisplayName}");
-                    return null;
-                }
-
-                // Score all results and find the best match
-                var scoredResults = searchResults
-                    .Select(result => new { Game = result, Score = ScoreMatch(game.DisplayName, result.Name) })
-                    .OrderByDescending(x => x.Score)
-                    .ToList();
-
-                // Log all results with scores for debugging
-                foreach (var scored in scoredResults.Take(5))
-                {
-                    System.Diagnostics.Debug.WriteLine($"SteamGridDB: Result '{scored.Game.Name}' (ID: {scored.Game.Id}) - Score: {scored.Score}");
-                }
-
-                var bestMatch = scoredResults.FirstOrDefault();
-
-                // Reject if no good match found
-                if (bestMatch == null || bestMatch.Score < MinimumMatchScore)
-                {
-                    System.Diagnostics.Debug.WriteLine($"SteamGridDB: No suitable match found for {game.DisplayName} (best score: {bestMatch?.Score ?? 0}, minimum required: {MinimumMatchScore})");
-                    return null;
-                }
-
-                var steamGridGame = bestMatch.Game;
-                System.Diagnostics.Debug.WriteLine($"SteamGridDB: Selected best match: {steamGridGame.Name} (ID: {steamGridGame.Id}, Score: {bestMatch.Score})");
+                var steamGridGame = await FindBestGameAsync(game.DisplayName);
+                if (steamGridGame == null) return null;
 
                 // Get grid images for this game
-                var grids = await _client.GetGridsByGameIdAsync(steamGridGame.Id);
+                var grids = await _client.GetGridsByGameIdAsync(steamGridGame.Value.Id);
 
                 if (grids == null || !grids.Any())
                 {
-                    System.Diagnostics.Debug.WriteLine($"SteamGridDB: No grid images found for {steamGridGame.Name}");
+                    System.Diagnostics.Debug.WriteLine($"SteamGridDB: No grid images found for {steamGridGame.Value.Name}");
                     return null;
                 }
 
@@ -179,6 +147,7 @@ namespace HUDRA.Services
                     {
                         // Update the game's artwork path in the database
                         game.ArtworkPath = artworkPath;
+                        await ArtworkPlaceholderService.UpdateAsync(game);
                         database.SaveGame(game);
                     }
                 }
@@ -195,106 +164,128 @@ namespace HUDRA.Services
         }
 
         /// <summary>
-        /// Normalize a game name for comparison by removing special characters and standardizing format
+        /// Search SteamGridDB for a game by name and return the best-scoring result, or null if none reaches the minimum score
         /// </summary>
-        private string NormalizeName(string name)
+        private async Task<(int Id, string Name, int Score)?> FindBestGameAsync(string gameName)
         {
-            if (string.IsNullOrEmpty(name)) return string.Empty;
+            // Search with the normalized title (trademark symbols and punctuation stripped)
+            var titleKey = _titleMatcher.Prepare(gameName);
+            var searchTerm = titleKey.SearchText;
+            System.Diagnostics.Debug.WriteLine($"SteamGridDB: Normalized search term: {searchTerm}");
 
-            // Strip trademark/copyright symbols
-            var cleaned = SpecialCharactersRegex.Replace(name, "");
+            var searchResults = await _client.SearchForGamesAsync(searchTerm);
 
-            // Normalize whitespace and convert to lowercase for comparison
-            return Regex.Replace(cleaned, @"\s+", " ").Trim().ToLowerInvariant();
-        }
+            if (searchResults == null || !searchResults.Any())
+            {
+                System.Diagnostics.Debug.WriteLine($"SteamGridDB: No games found for {gameName}");
+                return null;
+            }
 
-        /// <summary>
-        /// Score how well a search result matches the original game name (0-100)
-        /// </summary>
-        private int ScoreMatch(string searchName, string resultName)
-        {
-            var normalizedSearch = NormalizeName(searchName);
-            var normalizedResult = NormalizeName(resultName);
+            // Score all results once against the prepared title and rank them
+            var ranked = _titleMatcher.Rank(titleKey, searchResults, result => result.Name);
 
-            if (string.IsNullOrEmpty(normalizedSearch) || string.IsNullOrEmpty(normalizedResult))
-                return 0;
+            // Log all results with scores for debugging
+            foreach (var match in ranked.Take(5))
+            {
+                System.Diagnostics.Debug.WriteLine($"SteamGridDB: Result '{match.Item.Name}' (ID: {match.Item.Id}) - Score: {match.Score}");
+            }
 
-            // Exact match after normalization
-            if (normalizedSearch == normalizedResult) return 100;
+            // Reject if no good match found
+            if (ranked.Count == 0 || ranked[0].Score < MinimumMatchScore)
+            {
+                System.Diagnostics.Debug.WriteLine($"SteamGridDB: No suitable match found for {gameName} (best score: {(ranked.Count > 0 ? ranked[0].Score : 0)}, minimum required: {MinimumMatchScore})");
+                return null;
+            }
 
-            // Result starts with search term (e.g., "Stellar Blade" matches "Stellar Blade Deluxe")
-            if (normalizedResult.StartsWith(normalizedSearch)) return 90;
+            var best = ranked[0];
+            System.Diagnostics.Debug.WriteLine($"SteamGridDB: Selected best match: {best.Item.Name} (ID: {best.Item.Id}, Score: {best.Score})");
+            return (best.Item.Id, best.Item.Name, best.Score);
+        }
 
-            // Search term starts with result (e.g., searching "Stellar Blade Deluxe" matches "Stellar Blade")
-            if (normalizedSearch.StartsWith(normalizedResult)) return 85;
+        /// <summary>
+        /// Stream artwork options from SteamGridDB for the user to choose from. Previews are fetched concurrently
+        /// at thumbnail size and yielded as each one lands; <see cref="SteamGridDbResult.Index"/> gives the
+        /// resolution rank. Use <see cref="DownloadFullImageAsync"/> for the image the user picks.
+        /// </summary>
+        public async IAsyncEnumerable<SteamGridDbResult> StreamArtworkOptionsAsync(string gameName, int maxResults = 10,
+            [EnumeratorCancellation] CancellationToken cancellationToken = default)
+        {
+            if (_disposed) yield break;
 
-            // Result contains search term
-            if (normalizedResult.Contains(normalizedSearch)) return 70;
+            var options = await FindArtworkOptionsAsync(gameName, maxResults);
+            if (options == null || options.Count == 0) yield break;
 
-            // Search term contains result
-            if (normalizedSearch.Contains(normalizedResult)) return 60;
+            cancellationToken.ThrowIfCancellationRequested();
 
-            // Word-based matching - count shared words
-            var searchWords = normalizedSearch.Split(' ', StringSplitOptions.RemoveEmptyEntries);
-            var resultWords = normalizedResult.Split(' ', StringSplitOptions.RemoveEmptyEntries);
-            var sharedWords = searchWords.Intersect(resultWords).Count();
+            var downloads = options
+                .Select(o => new ArtworkDownload(o.Index, new Uri(o.PreviewUrl), o.TempFilePath))
+                .ToList();
+            var byIndex = options.ToDictionary(o => o.Index);
 
-            if (sharedWords > 0)
+            await foreach (var download in _previewDownloader.DownloadAsync(downloads, cancellationToken).ConfigureAwait(false))
             {
-                // Score based on percentage of words matched (max 50 for partial word matches)
-                var maxWords = Math.Max(searchWords.Length, resultWords.Length);
-                return (int)(50.0 * sharedWords / maxWords);
+                yield return byIndex[download.Index];
             }
 
-            return 0; // No meaningful match
+            System.Diagnostics.Debug.WriteLine($"SteamGridDB: {options.Count} previews - first after " +
+                $"{_previewDownloader.LastTimeToFirstResult?.TotalMilliseconds ?? 0:F0}ms, all after " +
+                $"{_previewDownloader.LastTotalTime?.TotalMilliseconds ?? 0:F0}ms");
         }
 
         /// <summary>
-        /// Get multiple artwork options from SteamGridDB for the user to choose from
+        /// Download the full-size image behind a preview. Returns the preview itself when SteamGridDB had no thumbnail.
         /// </summary>
-        public async Task<List<SteamGridDbResult>?> GetArtworkOptionsAsync(string gameName, int maxResults = 10)
+        public async Task<string?> DownloadFullImageAsync(SteamGridDbResult result, CancellationToken cancellationToken = default)
         {
             if (_disposed) return null;
 
-            try
-            {
-                System.Diagnostics.Debug.WriteLine($"SteamGridDB: Fetching artwork options for {gameName}");
+            if (!result.IsThumbnail)
+                return result.TempFilePath;
 
-                // Clean the search term
-                var cleanedSearchTerm = NormalizeName(gameName);
-                System.Diagnostics.Debug.WriteLine($"SteamGridDB: Normalized search term: {cleanedSearchTerm}");
+            if (!string.IsNullOrEmpty(result.FullImageFilePath) && File.Exists(result.FullImageFilePath))
+                return result.FullImageFilePath;
 
-                // Search for the game
-                var searchResults = await _client.SearchForGamesAsync(cleanedSearchTerm);
+            try
+            {
+                var extension = GetImageExtension(new Uri(result.FullImageUrl));
+                var directory = Path.GetDirectoryName(result.TempFilePath) ?? GetPreviewDirectory();
+                var filePath = Path.Combine(directory, $"{Path.GetFileNameWithoutExtension(result.TempFilePath)}_full{extension}");
 
-                if (searchResults == null || !searchResults.Any())
-                {
-                    System.Diagnostics.Debug.WriteLine($"SteamGridDB: No games found for {gameName}");
-                    return null;
-                }
+                var imageBytes = await _httpClient.GetByteArrayAsync(result.FullImageUrl, cancellationToken);
+                await File.WriteAllBytesAsync(filePath, imageBytes, cancellationToken);
 
-                // Score and find best match
-                var scoredResults = searchResults
-                    .Select(result => new { Game = result, Score = ScoreMatch(gameName, result.Name) })
-                    .OrderByDescending(x => x.Score)
-                    .ToList();
+                result.FullImageFilePath = filePath;
+                return filePath;
+            }
+            catch (OperationCanceledException)
+            {
+                throw;
+            }
+            catch (Exception ex)
+            {
+                System.Diagnostics.Debug.WriteLine($"SteamGridDB: Error downloading full image {result.FullImageUrl}: {ex.Message}");
+                return null;
+            }
+        }
 
-                var bestMatch = scoredResults.FirstOrDefault();
-                if (bestMatch == null || bestMatch.Score < MinimumMatchScore)
-                {
-                    System.Diagnostics.Debug.WriteLine($"SteamGridDB: No suitable match found for {gameName}");
-                    return null;
-                }
+        /// <summary>
+        /// Search and rank grids for a game, assigning each a preview temp path. Returns null if nothing matched.
+        /// </summary>
+        private async Task<List<SteamGridDbResult>?> FindArtworkOptionsAsync(string gameName, int maxResults)
+        {
+            try
+            {
+                System.Diagnostics.Debug.WriteLine($"SteamGridDB: Fetching artwork options for {gameName}");
 
-                var steamGridGame = bestMatch.Game;
-                System.Diagnostics.Debug.WriteLine($"SteamGridDB: Best match: {steamGridGame.Name} (Score: {bestMatch.Score})");
+                var steamGridGame = await FindBestGameAsync(gameName);
+                if (steamGridGame == null) return null;
 
                 // Get grid images for this game
-                var grids = await _client.GetGridsByGameIdAsync(steamGridGame.Id);
+                var grids = await _client.GetGridsByGameIdAsync(steamGridGame.Value.Id);
 
                 if (grids == null || !grids.Any())
                 {
-                    System.Diagnostics.Debug.WriteLine($"SteamGridDB: No grid images found for {steamGridGame.Name}");
+                    System.Diagnostics.Debug.WriteLine($"SteamGridDB: No grid images found for {steamGridGame.Value.Name}");
                     return null;
                 }
 
@@ -304,41 +295,26 @@ namespace HUDRA.Services
                     .Take(maxResults)
                     .ToList();
 
-                // Create temp directory for previews
-                var tempDir = Path.Combine(Path.GetTempPath(), "HUDRA_SGDB");
-                if (!Directory.Exists(tempDir))
-                {
-                    Directory.CreateDirectory(tempDir);
-                }
+                // Unique per search so a repeat search can't overwrite a preview that's still on screen
+                var tempDir = GetPreviewDirectory();
+                var searchId = Guid.NewGuid().ToString("N").Substring(0, 8);
+                var baseName = SanitizeFileName(steamGridGame.Value.Name);
 
-                // Download images to temp folder
                 var results = new List<SteamGridDbResult>();
                 for (int i = 0; i < selectedGrids.Count; i++)
                 {
                     var grid = selectedGrids[i];
-                    try
-                    {
-                        var imageBytes = await _httpClient.GetByteArrayAsync(grid.FullImageUrl);
-                        var extension = Path.GetExtension(grid.FullImageUrl.ToString()) ?? ".png";
-                        var tempFileName = $"{SanitizeFileName(steamGridGame.Name)}_{i}{extension}";
-                        var tempFilePath = Path.Combine(tempDir, tempFileName);
-
-                        await File.WriteAllBytesAsync(tempFilePath, imageBytes);
-
-                        results.Add(new SteamGridDbResult
-                        {
-                            TempFilePath = tempFilePath,
-                            FullImageUrl = grid.FullImageUrl.ToString(),
-                            Width = grid.Width,
-                            Height = grid.Height
-                        });
-
-                        System.Diagnostics.Debug.WriteLine($"SteamGridDB: Downloaded preview {i + 1}/{selectedGrids.Count}");
-                    }
-                    catch (Exception ex)
+                    var previewUrl = grid.ThumbnailImageUrl ?? grid.FullImageUrl;
+
+                    results.Add(new SteamGridDbResult
                     {
-                        System.Diagnostics.Debug.WriteLine($"SteamGridDB: Failed to download grid {i}: {ex.Message}");
-                    }
+                        Index = i,
+                        TempFilePath = Path.Combine(tempDir, $"{baseName}_{searchId}_{i}{GetImageExtension(previewUrl)}"),
+                        PreviewUrl = previewUrl.ToString(),
+                        FullImageUrl = grid.FullImageUrl.ToString(),
+                        Width = grid.Width,
+                        Height = grid.Height
+                    });
                 }
 
                 return results;
@@ -350,6 +326,22 @@ namespace HUDRA.Services
             }
         }
 
+        private static string GetPreviewDirectory()
+        {
+            var tempDir = Path.Combine(Path.GetTempPath(), "HUDRA_SGDB");
+            if (!Directory.Exists(tempDir))
+            {
+                Directory.CreateDirectory(tempDir);
+            }
+            return tempDir;
+        }
+
+        private static string GetImageExtension(Uri url)
+        {
+            var extension = Path.GetExtension(url.AbsolutePath);
+            return string.IsNullOrEmpty(extension) ? ".png" : extension;
+        }
+
         /// <summary>
         /// Sanitize filename for filesystem
         /// </summary>
@@ -372,9 +364,14 @@ namespace HUDRA.Services
 
     public class SteamGridDbResult
     {
-        public string TempFilePath { get; set; } = string.Empty;
+        public int Index { get; set; } // Rank by resolution; previews arrive out of order
+        public string TempFilePath { get; set; } = string.Empty; // Preview image shown in the picker
+        public string PreviewUrl { get; set; } = string.Empty;
         public string FullImageUrl { get; set; } = string.Empty;
+        public string? FullImageFilePath { get; set; } // Set once the full image has been downloaded
         public int Width { get; set; }
         public int Height { get; set; }
+
+        public bool IsThumbnail => PreviewUrl != FullImageUrl;
     }
 }
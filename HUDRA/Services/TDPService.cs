@@ -1,10 +1,12 @@
 ﻿using System;
 using System.IO;
+using System.Linq;
 using System.Management;
 using System.Runtime.InteropServices;
 using System.Text.RegularExpressions;
 using System.Diagnostics;
 using HUDRA.Models;
+using HUDRA.Services.Power;
 
 namespace HUDRA.Services
 {
@@ -24,6 +26,12 @@ namespace HUDRA.Services
         private delegate int RefreshTableDelegate(IntPtr ry);
         private delegate float GetStapmLimitDelegate(IntPtr ry);
         private delegate float GetStapmValueDelegate(IntPtr ry);
+        private delegate int SetApuSlowLimitDelegate(IntPtr ry, uint value);
+        private delegate int SetTctlTempDelegate(IntPtr ry, uint value);
+        private delegate float GetSlowLimitDelegate(IntPtr ry);
+        private delegate float GetFastLimitDelegate(IntPtr ry);
+        private delegate float GetApuSlowLimitDelegate(IntPtr ry);
+        private delegate float GetTctlTempDelegate(IntPtr ry);
 
         private InitRyzenAdjDelegate? _initRyzenAdj;
         private SetStapmLimitDelegate? _setStapmLimit;
@@ -32,6 +40,25 @@ namespace HUDRA.Services
         private RefreshTableDelegate? _refreshTable;
         private GetStapmLimitDelegate? _getStapmLimit;
         private GetStapmValueDelegate? _getStapmValue;
+        private SetApuSlowLimitDelegate? _setApuSlowLimit;
+        private SetTctlTempDelegate? _setTctlTemp;
+        private GetSlowLimitDelegate? _getSlowLimit;
+        private GetFastLimitDelegate? _getFastLimit;
+        private GetApuSlowLimitDelegate? _getApuSlowLimit;
+        private GetTctlTempDelegate? _getTctlTemp;
+
+        private static volatile PowerEnvelope? _activeEnvelope;
+
+        /// <summary>
+        /// The envelope the running game's profile put in force. SetTdp applies all of it when asked for its
+        /// STAPM, so sticky TDP, the power saver and quick pause bring the profile's boost back along with its
+        /// TDP; any other TDP is still written flat.
+        /// </summary>
+        public static PowerEnvelope? ActiveEnvelope
+        {
+            get => _activeEnvelope;
+            set => _activeEnvelope = value;
+        }
 
         public string InitializationStatus
         {
@@ -45,12 +72,6 @@ namespace HUDRA.Services
         }
         public bool IsDllMode => _useDllMode;
 
-        // Lenovo WMI Capability IDs for CPU power limits (from HandheldCompanion)
-        private const int CAP_CPU_SHORT_TERM_POWER_LIMIT = 0x0101FF00;  // SPL / STAPM
-        private const int CAP_CPU_LONG_TERM_POWER_LIMIT = 0x0102FF00;   // Slow limit
-        private const int CAP_CPU_PEAK_POWER_LIMIT = 0x0103FF00;        // Fast limit
-        private const int CAP_APU_SPPT_POWER_LIMIT = 0x0105FF00;        // APU sPPT
-
         [DllImport("kernel32.dll", SetLastError = true)]
         private static extern IntPtr LoadLibrary(string lpFileName);
 
@@ -198,6 +219,35 @@ namespace HUDRA.Services
                 if (getStapmPtr != IntPtr.Zero)
                     _getStapmLimit = Marshal.GetDelegateForFunctionPointer<GetStapmLimitDelegate>(getStapmPtr);
 
+                IntPtr getStapmValuePtr = GetProcAddress(_libHandle, "get_stapm_value");
+                if (getStapmValuePtr != IntPtr.Zero)
+                    _getStapmValue = Marshal.GetDelegateForFunctionPointer<GetStapmValueDelegate>(getStapmValuePtr);
+
+                // Power envelope; older libryzenadj builds lack some of these
+                IntPtr setApuSlowPtr = GetProcAddress(_libHandle, "set_apu_slow_limit");
+                if (setApuSlowPtr != IntPtr.Zero)
+                    _setApuSlowLimit = Marshal.GetDelegateForFunctionPointer<SetApuSlowLimitDelegate>(setApuSlowPtr);
+
+                IntPtr setTctlPtr = GetProcAddress(_libHandle, "set_tctl_temp");
+                if (setTctlPtr != IntPtr.Zero)
+                    _setTctlTemp = Marshal.GetDelegateForFunctionPointer<SetTctlTempDelegate>(setTctlPtr);
+
+                IntPtr getSlowPtr = GetProcAddress(_libHandle, "get_slow_limit");
+                if (getSlowPtr != IntPtr.Zero)
+                    _getSlowLimit = Marshal.GetDelegateForFunctionPointer<GetSlowLimitDelegate>(getSlowPtr);
+
+                IntPtr getFastPtr = GetProcAddress(_libHandle, "get_fast_limit");
+                if (getFastPtr != IntPtr.Zero)
+                    _getFastLimit = Marshal.GetDelegateForFunctionPointer<GetFastLimitDelegate>(getFastPtr);
+
+                IntPtr getApuSlowPtr = GetProcAddress(_libHandle, "get_apu_slow_limit");
+                if (getApuSlowPtr != IntPtr.Zero)
+                    _getApuSlowLimit = Marshal.GetDelegateForFunctionPointer<GetApuSlowLimitDelegate>(getApuSlowPtr);
+
+                IntPtr getTctlPtr = GetProcAddress(_libHandle, "get_tctl_temp");
+                if (getTctlPtr != IntPtr.Zero)
+                    _getTctlTemp = Marshal.GetDelegateForFunctionPointer<GetTctlTempDelegate>(getTctlPtr);
+
                 return _initRyzenAdj != null;
             }
             catch (Exception ex)
@@ -242,10 +292,39 @@ namespace HUDRA.Services
             }
         }
 
+        /// <summary>
+        /// Package power as averaged by the SMU for STAPM, in watts. Only available in DLL mode.
+        /// </summary>
+        public (bool Success, double Watts) GetPackagePower()
+        {
+            if (!_useDllMode || _refreshTable == null || _getStapmValue == null)
+                return (false, 0);
+
+            try
+            {
+                _refreshTable(_ryzenAdjHandle);
+                float value = _getStapmValue(_ryzenAdjHandle);
+                if (float.IsNaN(value) || value <= 0)
+                    return (false, 0);
+
+                // Same unit ambiguity as the STAPM limit: large values are milliwatts
+                return (true, value < 1000 ? value : value / 1000.0);
+            }
+            catch (Exception ex)
+            {
+                System.Diagnostics.Debug.WriteLine($"Package power read failed: {ex.Message}");
+                return (false, 0);
+            }
+        }
+
         public (bool Success, string Message) SetTdp(int tdpInMilliwatts)
         {
             int tdpWatts = tdpInMilliwatts / 1000;
 
+            var envelope = ActiveEnvelope;
+            if (envelope != null && envelope.StapmWatts == tdpWatts)
+                return SetPowerEnvelope(envelope);
+
             // Check if Lenovo device with WMI support - use WMI exclusively
             var device = HardwareDetectionService.GetDetectedDevice();
             if (device.IsLenovo && device.SupportsLenovoWmi)
@@ -265,6 +344,150 @@ namespace HUDRA.Services
             }
         }
 
+        /// <summary>
+        /// Applies STAPM, slow, fast, sPPT and Tctl separately instead of one flat TDP. The envelope is
+        /// validated against the device's limits here, so callers can pass what the user picked.
+        /// </summary>
+        public (bool Success, string Message) SetPowerEnvelope(PowerEnvelope envelope)
+        {
+            var device = HardwareDetectionService.GetDetectedDevice();
+            var validation = PowerEnvelopeValidator.Validate(envelope, PowerEnvelopeLimits.ForDevice(device));
+            foreach (var adjustment in validation.Adjustments)
+                Debug.WriteLine($"[TDP] Envelope adjusted: {adjustment}");
+            envelope = validation.Envelope;
+
+            Debug.WriteLine($"[TDP] Setting power envelope: {envelope}");
+
+            if (device.IsLenovo && device.SupportsLenovoWmi)
+            {
+                return SetPowerEnvelopeWmi(envelope);
+            }
+
+            if (_useDllMode && _ryzenAdjHandle != IntPtr.Zero)
+            {
+                return SetPowerEnvelopeDll(envelope);
+            }
+            else
+            {
+                return SetPowerEnvelopeExe(envelope);
+            }
+        }
+
+        /// <summary>
+        /// The limits in force, 0 where the PM table doesn't report one. Only available in DLL mode.
+        /// </summary>
+        public (bool Success, PowerEnvelope Envelope) GetPowerEnvelope()
+        {
+            if (!_useDllMode || _ryzenAdjHandle == IntPtr.Zero)
+                return (false, new PowerEnvelope());
+
+            try
+            {
+                var smu = new RyzenAdjSmuLimits(this);
+                if (!smu.Refresh())
+                    return (false, new PowerEnvelope());
+
+                int Rounded(SmuLimit limit)
+                {
+                    double value = smu.Read(limit);
+                    return double.IsNaN(value) ? 0 : (int)Math.Round(value);
+                }
+
+                var envelope = new PowerEnvelope
+                {
+                    StapmWatts = Rounded(SmuLimit.Stapm),
+                    SlowWatts = Rounded(SmuLimit.Slow),
+                    FastWatts = Rounded(SmuLimit.Fast),
+                    ApuSlowWatts = Rounded(SmuLimit.ApuSlow),
+                    TctlCelsius = Rounded(SmuLimit.Tctl)
+                };
+                return (true, envelope);
+            }
+            catch (Exception ex)
+            {
+                Debug.WriteLine($"[TDP] Power envelope read failed: {ex.Message}");
+                return (false, new PowerEnvelope());
+            }
+        }
+
+        private (bool Success, string Message) SetPowerEnvelopeDll(PowerEnvelope envelope)
+        {
+            try
+            {
+                // Give hardware time to update before verification, as SetTdpDll does
+                var result = PowerEnvelopeApplier.Apply(new RyzenAdjSmuLimits(this), envelope,
+                    () => System.Threading.Thread.Sleep(2000));
+                Debug.WriteLine($"[TDP] Envelope result: {result.Summary}");
+
+                // Same fallback as SetTdpDll: driver updates can make the DLL report success without applying
+                if (result.NeedsWmiFallback)
+                {
+                    Debug.WriteLine($"[TDP] STAPM verification failed - trying WMI fallback");
+                    SetPowerLimitsWmi(LenovoWmiPowerLimits.For(envelope));
+
+                    System.Threading.Thread.Sleep(2000);
+                    var (readOk, actual) = GetPowerEnvelope();
+                    if (readOk && Math.Abs(actual.StapmWatts - envelope.StapmWatts) <= 2)
+                        return (true, $"Power envelope set (DLL+WMI) [{result.Summary}]");
+                }
+
+                if (result.Success)
+                {
+                    var mode = result.IsComplete ? "DLL" : "DLL partial";
+                    return (true, $"Power envelope set to {envelope} ({mode}) [{result.Summary}]");
+                }
+
+                return (false, $"Power envelope not applied [{result.Summary}]");
+            }
+            catch (Exception ex)
+            {
+                return (false, $"DLL Exception: {ex.Message}");
+            }
+        }
+
+        private (bool Success, string Message) SetPowerEnvelopeWmi(PowerEnvelope envelope)
+        {
+            var limits = LenovoWmiPowerLimits.For(envelope);
+            (bool Success, string Message) result = limits.Length > 0 ? SetPowerLimitsWmi(limits) : (true, "No power limits to set");
+
+            // Lenovo exposes no Tctl capability; libryzenadj can still set it where it loaded
+            if (envelope.TctlCelsius > 0)
+            {
+                if (_useDllMode && _ryzenAdjHandle != IntPtr.Zero)
+                {
+                    var tctl = PowerEnvelopeApplier.Apply(new RyzenAdjSmuLimits(this),
+                        new PowerEnvelope { TctlCelsius = envelope.TctlCelsius });
+                    return (result.Success, $"{result.Message}, Tctl {envelope.TctlCelsius}°C [{tctl.Summary}]");
+                }
+                return (result.Success, $"{result.Message}, Tctl not set (needs libryzenadj)");
+            }
+
+            return result;
+        }
+
+        private (bool Success, string Message) SetPowerEnvelopeExe(PowerEnvelope envelope)
+        {
+            var arguments = new System.Collections.Generic.List<string>();
+            if (envelope.StapmWatts > 0)
+            {
+                arguments.Add($"--stapm-limit={envelope.StapmWatts * 1000}");
+                arguments.Add($"--fast-limit={envelope.FastWatts * 1000}");
+                arguments.Add($"--slow-limit={envelope.SlowWatts * 1000}");
+            }
+            if (envelope.ApuSlowWatts > 0)
+                arguments.Add($"--apu-slow-limit={envelope.ApuSlowWatts * 1000}");
+            if (envelope.TctlCelsius > 0)
+                arguments.Add($"--tctl-temp={envelope.TctlCelsius}");
+
+            if (arguments.Count == 0)
+                return (true, "No power limits to set");
+
+            var result = RunRyzenAdj(string.Join(" ", arguments));
+            return result.Success
+                ? (true, $"Power envelope set to {envelope} (EXE-FALLBACK)")
+                : result;
+        }
+
         private (bool Success, int TdpWatts, string Message) GetCurrentTdpDll()
         {
             try
@@ -404,11 +627,23 @@ namespace HUDRA.Services
 
         private (bool Success, string Message) SetTdpWmi(int tdpInMilliwatts)
         {
-            try
+            int tdpWatts = tdpInMilliwatts / 1000;
+            Debug.WriteLine($"[TDP] Setting TDP via Lenovo WMI: {tdpWatts}W");
+
+            // Set all CPU power limits to the same value
+            return SetPowerLimitsWmi(new[]
             {
-                int tdpWatts = tdpInMilliwatts / 1000;
-                Debug.WriteLine($"[TDP] Setting TDP via Lenovo WMI: {tdpWatts}W");
+                (LenovoWmiPowerLimits.CpuShortTermPowerLimit, tdpWatts),  // SPL/STAPM
+                (LenovoWmiPowerLimits.CpuLongTermPowerLimit, tdpWatts),   // Slow
+                (LenovoWmiPowerLimits.CpuPeakPowerLimit, tdpWatts),       // Fast
+                (LenovoWmiPowerLimits.ApuSpptPowerLimit, tdpWatts)        // APU sPPT
+            });
+        }
 
+        private (bool Success, string Message) SetPowerLimitsWmi((int CapabilityId, int Watts)[] limits)
+        {
+            try
+            {
                 // Use LENOVO_OTHER_METHOD.SetFeatureValue (same as HandheldCompanion)
                 using var searcher = new ManagementObjectSearcher("root\\WMI", "SELECT * FROM LENOVO_OTHER_METHOD");
 
@@ -416,29 +651,21 @@ namespace HUDRA.Services
                 {
                     try
                     {
-                        // Set all CPU power limits to the same value
                         // Note: Return codes are unreliable - actual success is verified by caller
-                        int[] capabilityIds = {
-                            CAP_CPU_SHORT_TERM_POWER_LIMIT,  // SPL/STAPM
-                            CAP_CPU_LONG_TERM_POWER_LIMIT,   // Slow
-                            CAP_CPU_PEAK_POWER_LIMIT,        // Fast
-                            CAP_APU_SPPT_POWER_LIMIT         // APU sPPT
-                        };
-
-                        foreach (int capId in capabilityIds)
+                        foreach (var (capId, watts) in limits)
                         {
                             try
                             {
                                 var inParams = instance.GetMethodParameters("SetFeatureValue");
                                 inParams["IDs"] = capId;
-                                inParams["value"] = tdpWatts;
+                                inParams["value"] = watts;
                                 instance.InvokeMethod("SetFeatureValue", inParams, null);
                             }
                             catch { /* Ignore - return codes unreliable anyway */ }
                         }
 
                         // Return success - actual verification done by caller
-                        return (true, $"WMI calls completed for {tdpWatts}W");
+                        return (true, $"WMI calls completed for {string.Join("/", limits.Select(l => l.Watts))}W");
                     }
                     catch (Exception ex)
                     {
@@ -521,6 +748,15 @@ namespace HUDRA.Services
         }
 
         private (bool Success, string Message) SetTdpExe(int tdpInMilliwatts)
+        {
+            var tdpWatts = tdpInMilliwatts / 1000;
+            var arguments = $"--stapm-limit={tdpInMilliwatts} --fast-limit={tdpInMilliwatts} --slow-limit={tdpInMilliwatts}";
+
+            var result = RunRyzenAdj(arguments);
+            return result.Success ? (true, $"TDP set to {tdpWatts}W (EXE-FALLBACK)") : result;
+        }
+
+        private (bool Success, string Message) RunRyzenAdj(string arguments)
         {
             try
             {
@@ -530,9 +766,6 @@ namespace HUDRA.Services
                     return (false, "RyzenAdj.exe not found");
                 }
 
-                var tdpWatts = tdpInMilliwatts / 1000;
-                var arguments = $"--stapm-limit={tdpInMilliwatts} --fast-limit={tdpInMilliwatts} --slow-limit={tdpInMilliwatts}";
-
                 var processInfo = new ProcessStartInfo
                 {
                     FileName = ryzenAdjPath,
@@ -553,7 +786,7 @@ namespace HUDRA.Services
                 const int ACCESS_VIOLATION_CODE = -1073741819;
                 if (process.ExitCode == 0 || process.ExitCode == ACCESS_VIOLATION_CODE)
                 {
-                    return (true, $"TDP set to {tdpWatts}W (EXE-FALLBACK)");
+                    return (true, "OK");
                 }
                 else
                 {
@@ -593,6 +826,12 @@ namespace HUDRA.Services
                 _refreshTable = null;
                 _getStapmLimit = null;
                 _getStapmValue = null;
+                _setApuSlowLimit = null;
+                _setTctlTemp = null;
+                _getSlowLimit = null;
+                _getFastLimit = null;
+                _getApuSlowLimit = null;
+                _getTctlTemp = null;
 
                 // Re-initialize DLL mode
                 InitializeDllMode();
@@ -613,6 +852,71 @@ namespace HUDRA.Services
             }
         }
 
+        /// <summary>
+        /// <see cref="ISmuPowerLimits"/> over the loaded libryzenadj, for <see cref="PowerEnvelopeApplier"/>.
+        /// </summary>
+        private sealed class RyzenAdjSmuLimits : ISmuPowerLimits
+        {
+            private readonly TDPService _owner;
+
+            public RyzenAdjSmuLimits(TDPService owner)
+            {
+                _owner = owner;
+            }
+
+            public bool CanWrite(SmuLimit limit) => limit switch
+            {
+                SmuLimit.Stapm => _owner._setStapmLimit != null,
+                SmuLimit.Slow => _owner._setSlowLimit != null,
+                SmuLimit.Fast => _owner._setFastLimit != null,
+                SmuLimit.ApuSlow => _owner._setApuSlowLimit != null,
+                SmuLimit.Tctl => _owner._setTctlTemp != null,
+                _ => false
+            };
+
+            public int Write(SmuLimit limit, uint value)
+            {
+                var handle = _owner._ryzenAdjHandle;
+                return limit switch
+                {
+                    SmuLimit.Stapm => _owner._setStapmLimit!(handle, value),
+                    SmuLimit.Slow => _owner._setSlowLimit!(handle, value),
+                    SmuLimit.Fast => _owner._setFastLimit!(handle, value),
+                    SmuLimit.ApuSlow => _owner._setApuSlowLimit!(handle, value),
+                    SmuLimit.Tctl => _owner._setTctlTemp!(handle, value),
+                    _ => -1
+                };
+            }
+
+            public bool Refresh()
+            {
+                if (_owner._refreshTable == null) return false;
+                return _owner._refreshTable(_owner._ryzenAdjHandle) == 0;
+            }
+
+            public double Read(SmuLimit limit)
+            {
+                var handle = _owner._ryzenAdjHandle;
+                float? value = limit switch
+                {
+                    SmuLimit.Stapm => _owner._getStapmLimit?.Invoke(handle),
+                    SmuLimit.Slow => _owner._getSlowLimit?.Invoke(handle),
+                    SmuLimit.Fast => _owner._getFastLimit?.Invoke(handle),
+                    SmuLimit.ApuSlow => _owner._getApuSlowLimit?.Invoke(handle),
+                    SmuLimit.Tctl => _owner._getTctlTemp?.Invoke(handle),
+                    _ => null
+                };
+
+                if (value == null || float.IsNaN(value.Value) || value.Value <= 0)
+                    return double.NaN;
+                if (limit == SmuLimit.Tctl)
+                    return value.Value;
+
+                // Same unit ambiguity as GetCurrentTdpDll: large values are milliwatts
+                return value.Value < 1000 ? value.Value : value.Value / 1000.0;
+            }
+        }
+
         public void Dispose()
         {
             if (!_disposed)
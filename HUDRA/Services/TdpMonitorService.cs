@@ -1,3 +1,4 @@
+using HUDRA.Extensions;
 using Microsoft.UI.Dispatching;
 using System;
 using System.Diagnostics;
@@ -36,6 +37,11 @@ namespace HUDRA.Services
             _tdpService = new TDPService();
         }
 
+        public int TargetTdp
+        {
+            get { lock (_monitorLock) return _targetTdp; }
+        }
+
         public void UpdateTargetTdp(int targetTdp)
         {
             lock (_monitorLock)
@@ -96,7 +102,7 @@ namespace HUDRA.Services
                     var setResult = _tdpService.SetTdp(target * 1000);
                     Debug.WriteLine($"TDP drift detected. Current: {current}W, Target: {target}W - {(setResult.Success ? "corrected" : "failed")}");
 
-                    _dispatcher.TryEnqueue(() =>
+                    _dispatcher.TryEnqueueLatest("TdpDrift", () =>
                     {
                         TdpDriftDetected?.Invoke(this,
                             new TdpDriftEventArgs(current, target, setResult.Success));
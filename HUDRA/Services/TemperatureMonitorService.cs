@@ -1,4 +1,5 @@
-﻿using LibreHardwareMonitor.Hardware;
+﻿using HUDRA.Extensions;
+using LibreHardwareMonitor.Hardware;
 using Microsoft.UI.Dispatching;
 using System;
 using System.Collections.Generic;
@@ -14,6 +15,7 @@ namespace HUDRA.Services
         public double CpuTemperature { get; set; } = 0;
         public double GpuTemperature { get; set; } = 0;
         public double MaxTemperature => Math.Max(CpuTemperature, GpuTemperature);
+        public double GpuLoadPercent { get; set; } = double.NaN; // "GPU Core" load, NaN if no sensor
         public string Source { get; set; } = "Unknown";
         public DateTime LastUpdated { get; set; } = DateTime.Now;
     }
@@ -36,6 +38,7 @@ namespace HUDRA.Services
         private readonly Timer _monitoringTimer;
         private bool _disposed = false;
         private TemperatureData _currentTemperatureData = new();
+        private double _lastReportedMaxTemperature;
 
         // ADD: LibreHardwareMonitor integration
         private Computer? _computer;
@@ -132,12 +135,15 @@ namespace HUDRA.Services
                     newData = ReadTemperaturesFromWMI(); // Fallback to your existing method
                 }
 
-                // Only update if temperature changed significantly (> 1°C)
-                if (Math.Abs(newData.MaxTemperature - _currentTemperatureData.MaxTemperature) > 1.0)
+                // Latest reading is always kept for pollers (GPU load changes without the temperature);
+                // the event only fires when temperature changed significantly (> 1°C)
+                _currentTemperatureData = newData;
+
+                if (Math.Abs(newData.MaxTemperature - _lastReportedMaxTemperature) > 1.0)
                 {
-                    _currentTemperatureData = newData;
+                    _lastReportedMaxTemperature = newData.MaxTemperature;
 
-                    _dispatcher.TryEnqueue(() =>
+                    _dispatcher.TryEnqueueLatest("Temperature", () =>
                     {
                         TemperatureChanged?.Invoke(this, new TemperatureChangedEventArgs(_currentTemperatureData));
                     });
@@ -195,6 +201,17 @@ namespace HUDRA.Services
                             // Use the highest GPU temperature
                             result.GpuTemperature = Math.Max(result.GpuTemperature, gpuTemps.Max());
                         }
+
+                        var gpuLoad = hardware.Sensors.FirstOrDefault(s =>
+                            s.SensorType == SensorType.Load && s.Value.HasValue &&
+                            s.Name.Equals("GPU Core", StringComparison.OrdinalIgnoreCase));
+                        if (gpuLoad != null)
+                        {
+                            // An APU's integrated GPU is what games run on; keep the busiest if there are several
+                            result.GpuLoadPercent = double.IsNaN(result.GpuLoadPercent)
+                                ? gpuLoad.Value!.Value
+                                : Math.Max(result.GpuLoadPercent, gpuLoad.Value!.Value);
+                        }
                     }
                 }
 
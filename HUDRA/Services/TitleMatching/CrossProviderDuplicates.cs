@@ -0,0 +1,62 @@
+using HUDRA.Models;
+using System;
+using System.Collections.Generic;
+
+namespace HUDRA.Services.TitleMatching
+{
+    /// <summary>
+    /// Two providers can report the same installed game under different executables (e.g. GameLib.NET and the
+    /// Xbox provider). An entry is a duplicate when another source already has a game in the same install
+    /// folder whose title matches at <see cref="TitleMatcher.SameGameScore"/> or better.
+    /// </summary>
+    public static class CrossProviderDuplicates
+    {
+        public static DetectedGame? Find(TitleMatcher matcher, DetectedGame game, Dictionary<string, List<DetectedGame>> gamesByInstallLocation)
+        {
+            var location = NormalizeInstallLocation(game.InstallLocation);
+            if (location == null || !gamesByInstallLocation.TryGetValue(location, out var sameFolder))
+                return null;
+
+            var key = matcher.Prepare(game.DisplayName);
+            foreach (var other in sameFolder)
+            {
+                if (other.Source != game.Source &&
+                    matcher.Score(key, matcher.Prepare(other.DisplayName)) >= TitleMatcher.SameGameScore)
+                {
+                    return other;
+                }
+            }
+
+            return null;
+        }
+
+        public static Dictionary<string, List<DetectedGame>> BuildInstallLocationIndex(IEnumerable<DetectedGame> games)
+        {
+            var index = new Dictionary<string, List<DetectedGame>>(StringComparer.OrdinalIgnoreCase);
+            foreach (var game in games)
+            {
+                AddToInstallLocationIndex(index, game);
+            }
+            return index;
+        }
+
+        public static void AddToInstallLocationIndex(Dictionary<string, List<DetectedGame>> index, DetectedGame game)
+        {
+            var location = NormalizeInstallLocation(game.InstallLocation);
+            if (location == null) return;
+
+            if (!index.TryGetValue(location, out var games))
+            {
+                games = new List<DetectedGame>();
+                index[location] = games;
+            }
+            games.Add(game);
+        }
+
+        public static string? NormalizeInstallLocation(string? installLocation)
+        {
+            if (string.IsNullOrWhiteSpace(installLocation)) return null;
+            return installLocation.Trim().TrimEnd('\\', '/');
+        }
+    }
+}
@@ -0,0 +1,332 @@
+using System;
+using System.Collections.Generic;
+using System.Globalization;
+using System.Linq;
+using System.Text;
+
+namespace HUDRA.Services.TitleMatching
+{
+    /// <summary>
+    /// A game title normalized and tokenized once for repeated scoring. Token IDs are interned by the
+    /// <see cref="TitleMatcher"/> that prepared the key, so keys from different matchers can't be compared.
+    /// </summary>
+    public sealed class TitleKey
+    {
+        internal TitleKey(string title, string searchText, string compact, int[] tokenSet, int[] headSet, int sequel)
+        {
+            Title = title;
+            SearchText = searchText;
+            Compact = compact;
+            TokenSet = tokenSet;
+            HeadSet = headSet;
+            Sequel = sequel;
+        }
+
+        public string Title { get; }
+
+        /// <summary>
+        /// Lowercase words with punctuation and trademark symbols removed, suitable for a search query.
+        /// </summary>
+        public string SearchText { get; }
+
+        // Significant tokens (no stopwords/edition words, roman numerals as digits) concatenated; for edit distance
+        internal string Compact { get; }
+        // Sorted distinct significant token IDs
+        internal int[] TokenSet { get; }
+        // Tokens before a subtitle separator (":" or " - "); same as TokenSet when there is no subtitle
+        internal int[] HeadSet { get; }
+        // Last numeric token (sequel/year), 0 if none
+        internal int Sequel { get; }
+    }
+
+    public readonly record struct TitleMatch<T>(T Item, TitleKey Key, int Score);
+
+    /// <summary>
+    /// Scores how likely two game titles name the same game (0-100). Titles are prepared into a <see cref="TitleKey"/>
+    /// once; scoring compares sorted token-ID sets and falls back to edit distance for spacing/typo differences.
+    /// Editions ("Deluxe Edition", "GOTY"), subtitles and roman numerals are normalized; a differing sequel number
+    /// caps the score below any sensible match threshold. Thread-safe.
+    /// </summary>
+    public sealed class TitleMatcher
+    {
+        public const int ExactScore = 100;
+        public const int SameGameScore = 95;   // Same significant words; differs only in edition/punctuation
+        public const int SubsetScore = 80;     // One title's words contain the other's (subtitle, extra word)
+        private const int SequelMismatchCap = 40;
+
+        private static readonly HashSet<string> StopWords = new(StringComparer.Ordinal)
+        {
+            "the", "a", "an", "of", "and"
+        };
+
+        private static readonly HashSet<string> EditionWords = new(StringComparer.Ordinal)
+        {
+            "edition", "deluxe", "ultimate", "goty", "definitive", "complete", "gold", "premium", "standard",
+            "enhanced", "anniversary", "collectors", "digital", "directors", "cut", "year", "game", "bundle"
+        };
+
+        private static readonly Dictionary<string, int> RomanNumerals = new(StringComparer.Ordinal)
+        {
+            ["ii"] = 2, ["iii"] = 3, ["iv"] = 4, ["v"] = 5, ["vi"] = 6, ["vii"] = 7, ["viii"] = 8,
+            ["ix"] = 9, ["x"] = 10, ["xi"] = 11, ["xii"] = 12, ["xiii"] = 13, ["xiv"] = 14, ["xv"] = 15
+        };
+
+        private readonly Dictionary<string, int> _tokenIds = new(StringComparer.Ordinal);
+        private readonly object _lock = new object();
+
+        public int TokenCount
+        {
+            get
+            {
+                lock (_lock)
+                {
+                    return _tokenIds.Count;
+                }
+            }
+        }
+
+        public TitleKey Prepare(string title)
+        {
+            title ??= string.Empty;
+
+            var words = new List<string>();
+            int subtitleAt = -1;
+            Tokenize(title, words, ref subtitleAt);
+
+            var searchText = string.Join(" ", words);
+            var significant = new List<string>(words.Count);
+            int headCount = 0;
+            int sequel = 0;
+
+            for (int i = 0; i < words.Count; i++)
+            {
+                var word = words[i];
+                if (StopWords.Contains(word) || EditionWords.Contains(word)) continue;
+
+                // Single-letter "v"/"x" only count as numerals after the first word ("V Rising" stays a word)
+                if (RomanNumerals.TryGetValue(word, out int roman) && (word.Length > 1 || significant.Count > 0))
+                {
+                    word = roman.ToString(CultureInfo.InvariantCulture);
+                }
+
+                if (word.Length <= 4 && int.TryParse(word, NumberStyles.None, CultureInfo.InvariantCulture, out int number))
+                {
+                    sequel = number;
+                }
+
+                significant.Add(word);
+                if (subtitleAt < 0 || i < subtitleAt) headCount++;
+            }
+
+            int[] tokenSet;
+            int[] headSet;
+            lock (_lock)
+            {
+                tokenSet = ToSortedSet(significant, significant.Count);
+                headSet = headCount == significant.Count ? tokenSet : ToSortedSet(significant, headCount);
+            }
+
+            return new TitleKey(title, searchText, string.Concat(significant), tokenSet, headSet, sequel);
+        }
+
+        public int Score(TitleKey a, TitleKey b)
+        {
+            if (a.TokenSet.Length == 0 || b.TokenSet.Length == 0)
+                return 0;
+
+            if (a.Compact == b.Compact)
+            {
+                return a.SearchText == b.SearchText ? ExactScore : SameGameScore;
+            }
+
+            int score = ScoreTokens(a.TokenSet, b.TokenSet);
+
+            // "Title: Subtitle" against plain "Title"
+            if (!ReferenceEquals(a.HeadSet, a.TokenSet) && SequenceEqual(a.HeadSet, b.TokenSet) ||
+                !ReferenceEquals(b.HeadSet, b.TokenSet) && SequenceEqual(b.HeadSet, a.TokenSet))
+            {
+                score = Math.Max(score, SubsetScore + 5);
+            }
+
+            // Spacing, hyphenation and typos ("Spiderman" vs "Spider-Man", "Witcher3")
+            int longer = Math.Max(a.Compact.Length, b.Compact.Length);
+            int shorter = Math.Min(a.Compact.Length, b.Compact.Length);
+            if (score < SameGameScore && shorter * 10 >= longer * 8)
+            {
+                int distance = EditDistance(a.Compact, b.Compact);
+                double similarity = 1.0 - (double)distance / longer;
+                if (similarity >= 0.85)
+                {
+                    score = Math.Max(score, (int)(similarity * SameGameScore));
+                }
+            }
+
+            if (a.Sequel != b.Sequel)
+            {
+                score = Math.Min(score, SequelMismatchCap);
+            }
+
+            return score;
+        }
+
+        public int Score(string a, string b) => Score(Prepare(a), Prepare(b));
+
+        public List<TitleMatch<T>> Rank<T>(string query, IEnumerable<T> candidates, Func<T, string> titleOf, int minimumScore = 0) =>
+            Rank(Prepare(query), candidates, titleOf, minimumScore);
+
+        /// <summary>
+        /// Scores every candidate against <paramref name="query"/> and returns those at or above
+        /// <paramref name="minimumScore"/>, best first.
+        /// </summary>
+        public List<TitleMatch<T>> Rank<T>(TitleKey queryKey, IEnumerable<T> candidates, Func<T, string> titleOf, int minimumScore = 0)
+        {
+            var matches = new List<TitleMatch<T>>();
+
+            foreach (var candidate in candidates)
+            {
+                var key = Prepare(titleOf(candidate));
+                int score = Score(queryKey, key);
+                if (score >= minimumScore)
+                {
+                    matches.Add(new TitleMatch<T>(candidate, key, score));
+                }
+            }
+
+            // OrderByDescending is stable: equal scores keep the provider's order
+            return matches.OrderByDescending(m => m.Score).ToList();
+        }
+
+        /// <summary>
+        /// Splits into lowercase ASCII-folded words. Apostrophes join ("Assassin's" -> "assassins"), "&amp;" becomes
+        /// "and", and <paramref name="subtitleAt"/> is set to the word index after the first ":" or " - ".
+        /// </summary>
+        private static void Tokenize(string title, List<string> words, ref int subtitleAt)
+        {
+            var folded = title.Normalize(NormalizationForm.FormD);
+            var current = new StringBuilder(16);
+
+            void Flush()
+            {
+                if (current.Length > 0)
+                {
+                    words.Add(current.ToString());
+                    current.Clear();
+                }
+            }
+
+            for (int i = 0; i < folded.Length; i++)
+            {
+                char c = folded[i];
+
+                if (char.IsLetterOrDigit(c))
+                {
+                    current.Append(char.ToLowerInvariant(c));
+                    continue;
+                }
+
+                // Accents split off by FormD, and apostrophes, join the surrounding word
+                if (CharUnicodeInfo.GetUnicodeCategory(c) == UnicodeCategory.NonSpacingMark || c == '\'' || c == '’')
+                    continue;
+
+                Flush();
+
+                if (c == '&')
+                {
+                    words.Add("and");
+                }
+                else if (subtitleAt < 0 && (c == ':' || (c == '-' && i > 0 && folded[i - 1] == ' ')))
+                {
+                    subtitleAt = words.Count;
+                }
+            }
+
+            Flush();
+        }
+
+        private int[] ToSortedSet(List<string> tokens, int count)
+        {
+            var ids = new int[count];
+            for (int i = 0; i < count; i++)
+            {
+                if (!_tokenIds.TryGetValue(tokens[i], out int id))
+                {
+                    id = _tokenIds.Count;
+                    _tokenIds[tokens[i]] = id;
+                }
+                ids[i] = id;
+            }
+
+            Array.Sort(ids);
+
+            // Drop duplicates in place
+            int distinct = 0;
+            for (int i = 0; i < ids.Length; i++)
+            {
+                if (distinct == 0 || ids[distinct - 1] != ids[i])
+                    ids[distinct++] = ids[i];
+            }
+
+            if (distinct != ids.Length)
+                Array.Resize(ref ids, distinct);
+            return ids;
+        }
+
+        /// <summary>
+        /// Token-set score: containment (one title's words all appear in the other) scores 80-90,
+        /// partial overlap scales with the Dice coefficient up to 60.
+        /// </summary>
+        private static int ScoreTokens(int[] a, int[] b)
+        {
+            int shared = 0;
+            int i = 0, j = 0;
+            while (i < a.Length && j < b.Length)
+            {
+                if (a[i] == b[j]) { shared++; i++; j++; }
+                else if (a[i] < b[j]) i++;
+                else j++;
+            }
+
+            if (shared == 0) return 0;
+
+            int smaller = Math.Min(a.Length, b.Length);
+            int union = a.Length + b.Length - shared;
+
+            if (shared == smaller)
+            {
+                return SubsetScore + (int)(10.0 * shared / union);
+            }
+
+            return (int)(60.0 * 2 * shared / (a.Length + b.Length));
+        }
+
+        private static bool SequenceEqual(int[] a, int[] b)
+        {
+            return a.AsSpan().SequenceEqual(b);
+        }
+
+        private static int EditDistance(string a, string b)
+        {
+            Span<int> previous = b.Length < 128 ? stackalloc int[b.Length + 1] : new int[b.Length + 1];
+            Span<int> current = b.Length < 128 ? stackalloc int[b.Length + 1] : new int[b.Length + 1];
+
+            for (int j = 0; j <= b.Length; j++)
+                previous[j] = j;
+
+            for (int i = 1; i <= a.Length; i++)
+            {
+                current[0] = i;
+                for (int j = 1; j <= b.Length; j++)
+                {
+                    int cost = a[i - 1] == b[j - 1] ? 0 : 1;
+                    current[j] = Math.Min(Math.Min(current[j - 1] + 1, previous[j] + 1), previous[j - 1] + cost);
+                }
+
+                var swap = previous;
+                previous = current;
+                current = swap;
+            }
+
+            return previous[b.Length];
+        }
+    }
+}
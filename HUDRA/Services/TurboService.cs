@@ -1,29 +1,26 @@
-using Gma.System.MouseKeyHook;
 using HUDRA.Services.FanControl;
-using OpenLibSys;
+using HUDRA.Services.Hotkeys;
 using System;
-using System.Collections.Generic;
-using System.Drawing.Text;
-using System.Linq;
-using System.Net;
-using System.Windows.Forms;
-using static System.Runtime.InteropServices.JavaScript.JSType;
-using static System.Windows.Forms.VisualStyles.VisualStyleElement.ListView;
 
 namespace HUDRA.Services
 {
     public class TurboService : IDisposable
     {
-        private readonly IKeyboardMouseEvents _hook;
-        private readonly HashSet<Keys> _pressed = new();
-        private OpenLibSys.Ols? _ec;
+        private readonly GlobalHotkeyListener? _hotkeyListener;
+        private readonly ECPortBroker _ec = ECPortBroker.Shared;
         private readonly IFanControlDevice? _device;
 
-        // Dynamic hotkey configuration
-        private HashSet<Keys> _requiredKeys = new();
-        private Keys _mainKey = Keys.None;
-
         public event EventHandler? TurboButtonPressed;
+
+        /// <summary>
+        /// How the hotkey is currently being detected (system hotkey or low-level hook).
+        /// </summary>
+        public HotkeyListenerMode HotkeyMode => _hotkeyListener?.Mode ?? HotkeyListenerMode.Stopped;
+
+        /// <summary>
+        /// Keyboard hook callback timings. Empty when the hotkey is registered with the system.
+        /// </summary>
+        public HotkeyHookLatency HookLatency => _hotkeyListener?.GetHookLatency() ?? default;
         
         public TurboService() : this(null)
         {
@@ -35,9 +32,7 @@ namespace HUDRA.Services
             
             try
             {
-                _ec = new Ols();
-
-                if (_ec.GetStatus() != (uint)Ols.Status.NO_ERROR)
+                if (!_ec.Open())
                 {
                     throw new InvalidOperationException("Failed to initialize OpenLibSys");
                 }
@@ -48,12 +43,10 @@ namespace HUDRA.Services
                     InitializeTurboButton(_device.TurboButtonECAddress.Value);
                 }
 
-                // Load hotkey configuration from settings
-                LoadHotkeyConfiguration();
-
-                _hook = Hook.GlobalEvents();
-                _hook.KeyDown += OnKeyDown;
-                _hook.KeyUp += OnKeyUp;
+                // Hotkey detection runs on its own high-priority message-loop thread
+                _hotkeyListener = new GlobalHotkeyListener(LoadHotkeyConfiguration());
+                _hotkeyListener.HotkeyPressed += OnHotkeyPressed;
+                _hotkeyListener.Start();
             }
             catch (Exception ex)
             {
@@ -62,31 +55,29 @@ namespace HUDRA.Services
             }
         }
 
-        private void InitializeTurboButton(uint ecAddress, Ols? ec = null)
+        private void InitializeTurboButton(uint ecAddress)
         {
             try
             {
-                var ecToUse = ec ?? _ec;
-                if (ecToUse == null)
-                {
-                    throw new InvalidOperationException("No EC connection available");
-                }
-
                 byte addr_upper = (byte)((ecAddress >> 8) & byte.MaxValue);
                 byte addr_lower = (byte)(ecAddress & byte.MaxValue);
 
-                ecToUse.WriteIoPortByte(0x4E, 0x2E);
-                ecToUse.WriteIoPortByte(0x4F, 0x11);
-                ecToUse.WriteIoPortByte(0x4E, 0x2F);
-                ecToUse.WriteIoPortByte(0x4F, addr_upper);
-                ecToUse.WriteIoPortByte(0x4E, 0x2E);
-                ecToUse.WriteIoPortByte(0x4F, 0x10);
-                ecToUse.WriteIoPortByte(0x4E, 0x2F);
-                ecToUse.WriteIoPortByte(0x4F, addr_lower);
-                ecToUse.WriteIoPortByte(0x4E, 0x2E);
-                ecToUse.WriteIoPortByte(0x4F, 0x12);
-                ecToUse.WriteIoPortByte(0x4E, 0x2F);
-                ecToUse.WriteIoPortByte(0x4F, 0x40);
+                // One transaction: the fan device polls through the same index ports
+                _ec.Execute(ECPriority.High, port =>
+                {
+                    port.WriteIoPortByte(0x4E, 0x2E);
+                    port.WriteIoPortByte(0x4F, 0x11);
+                    port.WriteIoPortByte(0x4E, 0x2F);
+                    port.WriteIoPortByte(0x4F, addr_upper);
+                    port.WriteIoPortByte(0x4E, 0x2E);
+                    port.WriteIoPortByte(0x4F, 0x10);
+                    port.WriteIoPortByte(0x4E, 0x2F);
+                    port.WriteIoPortByte(0x4F, addr_lower);
+                    port.WriteIoPortByte(0x4E, 0x2E);
+                    port.WriteIoPortByte(0x4F, 0x12);
+                    port.WriteIoPortByte(0x4E, 0x2F);
+                    port.WriteIoPortByte(0x4F, 0x40);
+                });
 
                 System.Diagnostics.Debug.WriteLine($"🎮 Turbo button initialized for device with EC address: 0x{ecAddress:X}");
             }
@@ -97,133 +88,35 @@ namespace HUDRA.Services
             }
         }
 
-        private void OnKeyDown(object? sender, KeyEventArgs e)
-        {
-            _pressed.Add(e.KeyCode);
-
-            // Check if all required keys are pressed
-            if (IsHotkeyPressed())
-            {
-                System.Diagnostics.Debug.WriteLine($"🔑 ✅ HOTKEY ACTIVATED!");
-                TurboButtonPressed?.Invoke(this, EventArgs.Empty);
-            }
-        }
-
-        private void OnKeyUp(object? sender, KeyEventArgs e)
+        private void OnHotkeyPressed(object? sender, EventArgs e)
         {
-            _pressed.Remove(e.KeyCode);
+            System.Diagnostics.Debug.WriteLine($"🔑 ✅ HOTKEY ACTIVATED!");
+            TurboButtonPressed?.Invoke(this, EventArgs.Empty);
         }
 
-        private void LoadHotkeyConfiguration()
+        private static HotkeyCombo LoadHotkeyConfiguration()
         {
             try
             {
                 string modifiers = SettingsService.GetHideShowHotkeyModifiers();
                 string key = SettingsService.GetHideShowHotkeyKey();
 
-
-                _requiredKeys.Clear();
-                _mainKey = Keys.None;
-
-                // Parse modifiers
-                if (!string.IsNullOrEmpty(modifiers))
-                {
-                    var modifierList = modifiers.Split('+', StringSplitOptions.RemoveEmptyEntries)
-                                               .Select(m => m.Trim())
-                                               .ToList();
-
-                    foreach (var modifier in modifierList)
-                    {
-                        switch (modifier.ToLower())
-                        {
-                            case "win":
-                                _requiredKeys.Add(Keys.LWin);
-                                break;
-                            case "ctrl":
-                                _requiredKeys.Add(Keys.LControlKey);
-                                break;
-                            case "alt":
-                                _requiredKeys.Add(Keys.LMenu);
-                                break;
-                            case "shift":
-                                _requiredKeys.Add(Keys.LShiftKey);
-                                break;
-                        }
-                    }
-                }
-
-                // Parse main key
-                if (!string.IsNullOrEmpty(key))
-                {
-                    _mainKey = ParseKeyString(key);
-                    if (_mainKey != Keys.None)
-                    {
-                        _requiredKeys.Add(_mainKey);
-                    }
-                }
-
-                // Fallback to default if no valid hotkey is configured
-                if (_requiredKeys.Count == 0)
-                {
-                    _requiredKeys.Add(Keys.LWin);
-                    _requiredKeys.Add(Keys.LMenu);
-                    _requiredKeys.Add(Keys.LControlKey);
-                    System.Diagnostics.Debug.WriteLine($"🔑 Using default hotkey: Win+Alt+Ctrl");
-                }
-
-                System.Diagnostics.Debug.WriteLine($"🔑 Final required keys: {string.Join(", ", _requiredKeys)}");
+                // Falls back to Win+Alt+Ctrl if no valid hotkey is configured
+                var combo = HotkeyCombo.Parse(modifiers, key);
+                System.Diagnostics.Debug.WriteLine($"🔑 Final hotkey combo: {combo}");
+                return combo;
             }
             catch (Exception ex)
             {
                 System.Diagnostics.Debug.WriteLine($"Error loading hotkey configuration: {ex.Message}");
-                // Fallback to default
-                _requiredKeys.Clear();
-                _requiredKeys.Add(Keys.LWin);
-                _requiredKeys.Add(Keys.LMenu);
-                _requiredKeys.Add(Keys.LControlKey);
+                return HotkeyCombo.Default;
             }
         }
 
         public void ReloadHotkeyConfiguration()
         {
             System.Diagnostics.Debug.WriteLine($"🔑 Reloading hotkey configuration...");
-            LoadHotkeyConfiguration();
-        }
-
-        private bool IsHotkeyPressed()
-        {
-            // Check if all required keys are currently pressed
-            bool allPressed = _requiredKeys.All(key => _pressed.Contains(key));
-            
-            return allPressed;
-        }
-
-        private Keys ParseKeyString(string keyString)
-        {
-            if (string.IsNullOrEmpty(keyString))
-                return Keys.None;
-
-            // Handle special cases
-            return keyString.ToUpper() switch
-            {
-                "SPACE" => Keys.Space,
-                "TAB" => Keys.Tab,
-                "ENTER" => Keys.Enter,
-                "ESC" => Keys.Escape,
-                "INSERT" => Keys.Insert,
-                "DELETE" => Keys.Delete,
-                "HOME" => Keys.Home,
-                "END" => Keys.End,
-                "PGUP" => Keys.PageUp,
-                "PGDN" => Keys.PageDown,
-                _ when keyString.Length == 1 && char.IsLetter(keyString[0]) => 
-                    (Keys)Enum.Parse(typeof(Keys), keyString.ToUpper()),
-                _ when keyString.Length == 1 && char.IsDigit(keyString[0]) => 
-                    (Keys)Enum.Parse(typeof(Keys), $"D{keyString}"),
-                _ when keyString.StartsWith("F") && int.TryParse(keyString.Substring(1), out int fNum) && fNum >= 1 && fNum <= 24 => 
-                    (Keys)Enum.Parse(typeof(Keys), keyString.ToUpper()),
-                _ => Keys.None
-            };
+            _hotkeyListener?.SetCombo(LoadHotkeyConfiguration());
         }
 
         public (bool Success, string Message) ReinitializeAfterResume()
@@ -232,16 +125,13 @@ namespace HUDRA.Services
             {
                 System.Diagnostics.Debug.WriteLine("⚡ Reinitializing TurboService after hibernation resume...");
 
-                // Dispose the existing EC connection
-                _ec?.Dispose();
-                _ec = null;
+                // Key-up events are lost across hibernation; don't leave modifiers stuck down
+                _hotkeyListener?.ResetKeyState();
 
-                // Re-create the OpenLibSys connection
-                _ec = new Ols();
-                if (_ec.GetStatus() != (uint)Ols.Status.NO_ERROR)
+                // App reopens the shared handle once before any EC user re-initializes; this only opens it
+                // if that failed or nothing had opened it yet
+                if (!_ec.Open())
                 {
-                    _ec.Dispose();
-                    _ec = null;
                     var errorMessage = "Failed to reinitialize OpenLibSys for turbo button";
                     System.Diagnostics.Debug.WriteLine($"⚠️ {errorMessage}");
                     return (false, errorMessage);
@@ -281,13 +171,12 @@ namespace HUDRA.Services
 
         public void Dispose()
         {
-            if (_hook != null)
+            if (_hotkeyListener != null)
             {
-                _hook.KeyDown -= OnKeyDown;
-                _hook.KeyUp -= OnKeyUp;
-                _hook.Dispose();
+                _hotkeyListener.HotkeyPressed -= OnHotkeyPressed;
+                _hotkeyListener.Dispose();
             }
-            _ec?.Dispose();
+            // The EC handle is shared with fan control and closed by the app on exit
         }
     }
 }
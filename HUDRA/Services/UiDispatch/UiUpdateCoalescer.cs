@@ -0,0 +1,143 @@
+using System;
+using System.Collections.Generic;
+
+namespace HUDRA.Services.UiDispatch
+{
+    /// <summary>
+    /// Counters for a <see cref="UiUpdateCoalescer"/>. Batches is the number of UI work items actually run.
+    /// </summary>
+    public readonly struct UiUpdateStats
+    {
+        public long Posted { get; init; }
+        public long Applied { get; init; }
+        public long Superseded { get; init; }
+        public long Batches { get; init; }
+
+        public UiUpdateStats Since(UiUpdateStats earlier) => new UiUpdateStats
+        {
+            Posted = Posted - earlier.Posted,
+            Applied = Applied - earlier.Applied,
+            Superseded = Superseded - earlier.Superseded,
+            Batches = Batches - earlier.Batches
+        };
+
+        public override string ToString() =>
+            $"{Posted} posted, {Applied} applied, {Superseded} superseded, {Batches} UI batches";
+    }
+
+    /// <summary>
+    /// Latest-value slots for UI updates posted from background threads. Each key holds only the newest
+    /// update until the next drain, so a sensor that ticks ten times between frames costs one UI call.
+    /// Slots drain in the order their key was first posted within the batch. Thread-safe; no WinUI types,
+    /// so the scheduling host decides when <see cref="Drain"/> runs.
+    /// </summary>
+    public sealed class UiUpdateCoalescer
+    {
+        private readonly object _lock = new object();
+        private readonly Dictionary<string, int> _slotIndex = new(StringComparer.Ordinal);
+        private List<Action> _pending = new();
+        private bool _drainRequested;
+        private long _posted;
+        private long _applied;
+        private long _superseded;
+        private long _batches;
+
+        /// <summary>
+        /// Stores <paramref name="apply"/> as the latest update for <paramref name="key"/>, replacing any
+        /// update not yet drained. Returns true when the caller must schedule a drain; false when one is
+        /// already pending and will pick this update up.
+        /// </summary>
+        public bool Post(string key, Action apply)
+        {
+            if (key == null) throw new ArgumentNullException(nameof(key));
+            if (apply == null) throw new ArgumentNullException(nameof(apply));
+
+            lock (_lock)
+            {
+                _posted++;
+
+                if (_slotIndex.TryGetValue(key, out int index))
+                {
+                    _pending[index] = apply;
+                    _superseded++;
+                }
+                else
+                {
+                    _slotIndex[key] = _pending.Count;
+                    _pending.Add(apply);
+                }
+
+                if (_drainRequested) return false;
+                _drainRequested = true;
+                return true;
+            }
+        }
+
+        public bool HasPending
+        {
+            get
+            {
+                lock (_lock)
+                {
+                    return _pending.Count > 0;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Runs every pending update. Updates posted while draining land in the next batch and make
+        /// <see cref="Post"/> request a new drain. Exceptions from one update don't stop the rest;
+        /// they are passed to <paramref name="onError"/>.
+        /// </summary>
+        public int Drain(Action<Exception>? onError = null)
+        {
+            List<Action> batch;
+            lock (_lock)
+            {
+                _drainRequested = false;
+                if (_pending.Count == 0) return 0;
+
+                batch = _pending;
+                _pending = new List<Action>(batch.Count);
+                _slotIndex.Clear();
+                _batches++;
+            }
+
+            foreach (var apply in batch)
+            {
+                try
+                {
+                    apply();
+                }
+                catch (Exception ex)
+                {
+                    onError?.Invoke(ex);
+                }
+            }
+
+            lock (_lock)
+            {
+                _applied += batch.Count;
+            }
+
+            return batch.Count;
+        }
+
+        public UiUpdateStats Stats
+        {
+            get
+            {
+                lock (_lock)
+                {
+                    return new UiUpdateStats
+                    {
+                        Posted = _posted,
+                        Applied = _applied,
+                        Superseded = _superseded,
+                        Batches = _batches
+                    };
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,128 @@
+using Microsoft.UI.Dispatching;
+using Microsoft.UI.Xaml.Media;
+using System;
+using System.Diagnostics;
+using System.Runtime.CompilerServices;
+
+namespace HUDRA.Services.UiDispatch
+{
+    /// <summary>
+    /// Applies coalesced service updates on the UI thread at most once per rendered frame. While the window
+    /// is hidden nothing renders, so pending updates are applied at <see cref="HiddenFlushInterval"/> instead.
+    /// Use for state snapshots (temperature, fan, battery, progress text) where only the newest value matters;
+    /// discrete events that must each be seen should keep using <see cref="DispatcherQueue.TryEnqueue(DispatcherQueueHandler)"/>.
+    /// </summary>
+    public sealed class UiUpdateDispatcher
+    {
+        private static readonly ConditionalWeakTable<DispatcherQueue, UiUpdateDispatcher> _instances = new();
+        private static readonly TimeSpan StatsLogInterval = TimeSpan.FromSeconds(60);
+
+        private readonly DispatcherQueue _dispatcher;
+        private readonly UiUpdateCoalescer _coalescer = new UiUpdateCoalescer();
+        private readonly Stopwatch _statsClock = Stopwatch.StartNew();
+        private DispatcherQueueTimer? _flushTimer;
+        private UiUpdateStats _lastLoggedStats;
+        private bool _renderingHooked;
+
+        public static TimeSpan HiddenFlushInterval { get; set; } = TimeSpan.FromSeconds(1);
+
+        /// <summary>
+        /// Reports whether the window is on screen. Null means always visible.
+        /// </summary>
+        public Func<bool>? IsWindowVisible { get; set; }
+
+        public UiUpdateStats Stats => _coalescer.Stats;
+
+        private UiUpdateDispatcher(DispatcherQueue dispatcher)
+        {
+            _dispatcher = dispatcher;
+        }
+
+        public static UiUpdateDispatcher For(DispatcherQueue dispatcher)
+        {
+            if (dispatcher == null) throw new ArgumentNullException(nameof(dispatcher));
+            return _instances.GetValue(dispatcher, d => new UiUpdateDispatcher(d));
+        }
+
+        /// <summary>
+        /// Queues <paramref name="apply"/> as the latest update for <paramref name="key"/>. Safe from any thread.
+        /// </summary>
+        public bool Post(string key, Action apply)
+        {
+            if (!_coalescer.Post(key, apply))
+                return true; // Drain already scheduled
+
+            if (_dispatcher.HasThreadAccess)
+            {
+                ScheduleDrain();
+                return true;
+            }
+
+            return _dispatcher.TryEnqueue(ScheduleDrain);
+        }
+
+        /// <summary>
+        /// Applies pending updates immediately, e.g. when the window is shown again after being hidden.
+        /// Must be called on the UI thread.
+        /// </summary>
+        public void Flush()
+        {
+            CancelScheduledDrain();
+            DrainPending();
+        }
+
+        private void ScheduleDrain()
+        {
+            bool visible = IsWindowVisible?.Invoke() ?? true;
+
+            if (visible && !_renderingHooked)
+            {
+                CompositionTarget.Rendering += OnRendering;
+                _renderingHooked = true;
+            }
+
+            // Backstop for frames that never arrive (hidden or minimized window)
+            if (_flushTimer == null)
+            {
+                _flushTimer = _dispatcher.CreateTimer();
+                _flushTimer.IsRepeating = false;
+                _flushTimer.Tick += (s, e) => Flush();
+            }
+
+            if (!_flushTimer.IsRunning)
+            {
+                _flushTimer.Interval = HiddenFlushInterval;
+                _flushTimer.Start();
+            }
+        }
+
+        private void OnRendering(object? sender, object e)
+        {
+            Flush();
+        }
+
+        private void CancelScheduledDrain()
+        {
+            if (_renderingHooked)
+            {
+                CompositionTarget.Rendering -= OnRendering;
+                _renderingHooked = false;
+            }
+
+            _flushTimer?.Stop();
+        }
+
+        private void DrainPending()
+        {
+            _coalescer.Drain(ex => Debug.WriteLine($"UI update failed: {ex.Message}"));
+
+            if (_statsClock.Elapsed >= StatsLogInterval)
+            {
+                var stats = _coalescer.Stats;
+                Debug.WriteLine($"UI updates (last {_statsClock.Elapsed.TotalSeconds:F0}s): {stats.Since(_lastLoggedStats)}");
+                _lastLoggedStats = stats;
+                _statsClock.Restart();
+            }
+        }
+    }
+}